@@ -307,6 +307,9 @@ MA 02111-1307, USA. */
 /* ./configure --enable-assert option, to enable some ASSERT()s */
 #undef WANT_ASSERT
 
+/* ./configure --enable-memstats option, to count allocations per tag */
+#undef WANT_MEMSTATS
+
 /* Define if your processor stores words with the most significant byte first
    (like Motorola and SPARC, unlike Intel and VAX). */
 #undef WORDS_BIGENDIAN
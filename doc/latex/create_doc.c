@@ -29,6 +29,7 @@ static char * docsin[] = {
     "../../fmpz_poly_mat/doc/fmpz_poly_mat.txt", 
     "../../nmod_vec/doc/nmod_vec.txt",
     "../../nmod_mat/doc/nmod_mat.txt",
+    "../../nmod_sparse_mat/doc/nmod_sparse_mat.txt",
     "../../nmod_poly/doc/nmod_poly.txt",
     "../../nmod_poly_factor/doc/nmod_poly_factor.txt",
     "../../nmod_poly_mat/doc/nmod_poly_mat.txt",
@@ -61,6 +62,7 @@ static char * docsin[] = {
     "../../doc/longlong.txt",
     "../../mpn_extras/doc/mpn_extras.txt",
     "../../doc/profiler.txt", 
+    "../../thread_pool/doc/thread_pool.txt",
     "../../interfaces/doc/interfaces.txt",
     "../../fft/doc/fft.txt",
     "../../qsieve/doc/qsieve.txt",
@@ -83,6 +85,7 @@ static char * docsout[] = {
     "input/fmpz_poly_mat.tex", 
     "input/nmod_vec.tex",
     "input/nmod_mat.tex",
+    "input/nmod_sparse_mat.tex",
     "input/nmod_poly.tex",
     "input/nmod_poly_factor.tex",
     "input/nmod_poly_mat.tex",
@@ -115,6 +118,7 @@ static char * docsout[] = {
     "input/longlong.tex", 
     "input/mpn_extras.tex",
     "input/profiler.tex", 
+    "input/thread_pool.tex",
     "input/interfaces.tex",
     "input/fft.tex",
     "input/qsieve.tex",
@@ -94,6 +94,46 @@ FLINT_DLL void __flint_set_memory_functions(void *(*alloc_func) (size_t),
      void *(*calloc_func) (size_t, size_t), void *(*realloc_func) (void *, size_t),
                                                               void (*free_func) (void *));
 
+/*
+   Allocation statistics, only collected if configured with --enable-memstats.
+   Otherwise the functions below are still defined, but as stubs: the tag
+   functions do nothing, no tags are recorded and all statistics are zero.
+*/
+typedef struct
+{
+    const char * tag;
+    slong allocs;          /* calls to flint_malloc and flint_calloc */
+    slong reallocs;
+    slong frees;
+    slong bytes;           /* bytes allocated, including growth by reallocs */
+    slong realloc_bytes;   /* growth by reallocs */
+    slong live;            /* bytes currently allocated */
+    slong peak;            /* maximum of live */
+    slong max_chain;       /* longest run of reallocs of a single block */
+} flint_memstats_struct;
+
+typedef flint_memstats_struct flint_memstats_t[1];
+
+#define FLINT_MEMSTATS_MAX_TAGS 256
+
+FLINT_DLL void flint_memstats_push_tag(const char * tag);
+FLINT_DLL void flint_memstats_pop_tag(void);
+FLINT_DLL const char * flint_memstats_current_tag(void);
+FLINT_DLL slong flint_memstats_num_tags(void);
+FLINT_DLL void flint_memstats_get(flint_memstats_t stats, slong i);
+FLINT_DLL void flint_memstats_total(flint_memstats_t stats);
+FLINT_DLL void flint_memstats_reset(void);
+FLINT_DLL void flint_memstats_print(void);
+
+/* for tagging within FLINT, these cost nothing without --enable-memstats */
+#if WANT_MEMSTATS
+#define FLINT_MEMSTATS_PUSH_TAG(tag) flint_memstats_push_tag(tag)
+#define FLINT_MEMSTATS_POP_TAG() flint_memstats_pop_tag()
+#else
+#define FLINT_MEMSTATS_PUSH_TAG(tag) do { } while (0)
+#define FLINT_MEMSTATS_POP_TAG() do { } while (0)
+#endif
+
 FLINT_DLL void flint_abort(void);
 FLINT_DLL void flint_set_abort(void (*func)(void));
   /* flint_abort is calling abort by default
@@ -160,6 +200,7 @@ FLINT_DLL void flint_set_abort(void (*func)(void));
 FLINT_DLL int flint_get_num_threads(void);
 FLINT_DLL void flint_set_num_threads(int num_threads);
 FLINT_DLL void flint_parallel_cleanup(void);
+FLINT_DLL void flint_cleanup_master(void);
 
 FLINT_DLL int flint_test_multiplier(void);
 
@@ -223,7 +264,7 @@ void flint_randclear(flint_rand_t state)
 
 #define FLINT_TEST_CLEANUP(xxx) \
    flint_randclear(xxx); \
-   flint_cleanup();
+   flint_cleanup_master();
 
 /*
   We define this here as there is no mpfr.h
@@ -58,12 +58,14 @@ typedef fmpz_preinvn_struct fmpz_preinvn_t[1];
 
 typedef struct
 {
-   int count;
-#if HAVE_PTHREAD
-   pthread_t thread;
-#endif
-   void * address;
-} fmpz_block_header_s;
+   slong allocs;        /* mpz's handed out by the cache */
+   slong blocks;        /* blocks of mpz's allocated */
+   slong blocks_freed;  /* blocks given back when trimming the cache */
+   slong cached;        /* mpz's currently in the cache */
+   slong remote_frees;  /* mpz's returned to the cache by other threads */
+} fmpz_mpz_cache_stats_struct;
+
+typedef fmpz_mpz_cache_stats_struct fmpz_mpz_cache_stats_t[1];
 
 /* maximum positive value a small coefficient can have */
 #define COEFF_MAX ((WORD(1) << (FLINT_BITS - 2)) - WORD(1))
@@ -81,6 +83,8 @@ FLINT_DLL void _fmpz_cleanup_mpz_content(void);
 
 FLINT_DLL void _fmpz_cleanup(void);
 
+FLINT_DLL void _fmpz_mpz_cache_stats(fmpz_mpz_cache_stats_t stats);
+
 FLINT_DLL __mpz_struct * _fmpz_promote(fmpz_t f);
 
 FLINT_DLL __mpz_struct * _fmpz_promote_val(fmpz_t f);
@@ -10,6 +10,7 @@
 */
 
 #include <stdlib.h>
+#include <string.h>
 #include <gmp.h>
 #include "flint.h"
 #include "fmpz.h"
@@ -127,6 +128,12 @@ void _fmpz_cleanup(void)
 #endif
 }
 
+/* there is no mpz cache */
+void _fmpz_mpz_cache_stats(fmpz_mpz_cache_stats_t stats)
+{
+    memset(stats, 0, sizeof(fmpz_mpz_cache_stats_struct));
+}
+
 __mpz_struct * _fmpz_promote(fmpz_t f)
 {
     if (!COEFF_IS_MPZ(*f)) /* f is small so promote it first */
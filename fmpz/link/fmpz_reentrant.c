@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2009 William Hart
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -10,13 +11,19 @@
 */
 
 #include <stdlib.h>
+#include <string.h>
 #include <gmp.h>
 #include "flint.h"
 #include "fmpz.h"
 
 __mpz_struct * _fmpz_new_mpz(void)
 {
-    __mpz_struct * mpz_ptr = (__mpz_struct *) flint_malloc(sizeof(__mpz_struct));
+    __mpz_struct * mpz_ptr;
+
+    FLINT_MEMSTATS_PUSH_TAG("fmpz");
+    mpz_ptr = (__mpz_struct *) flint_malloc(sizeof(__mpz_struct));
+    FLINT_MEMSTATS_POP_TAG();
+
     mpz_init2(mpz_ptr, 2*FLINT_BITS);
     return mpz_ptr;
 }
@@ -35,6 +42,12 @@ void _fmpz_cleanup(void)
 {
 }
 
+/* there is no mpz cache */
+void _fmpz_mpz_cache_stats(fmpz_mpz_cache_stats_t stats)
+{
+    memset(stats, 0, sizeof(fmpz_mpz_cache_stats_struct));
+}
+
 __mpz_struct * _fmpz_promote(fmpz_t f)
 {
     if (!COEFF_IS_MPZ(*f))  /* f is small so promote it first */
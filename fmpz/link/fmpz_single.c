@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2009 William Hart
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -18,6 +19,7 @@
 #endif
 
 #include <stdlib.h>
+#include <string.h>
 
 #include <gmp.h>
 #include "flint.h"
@@ -28,18 +30,146 @@
 
 #define PAGES_PER_BLOCK 16
 
-/* The number of new mpz's allocated at a time */
-#define MPZ_BLOCK 64 
+/* Trim the cache when it holds more than this many blocks worth of mpz's */
+#define FLINT_MPZ_CACHE_TRIM_BLOCKS 4
 
-FLINT_TLS_PREFIX __mpz_struct ** mpz_free_arr = NULL;
-FLINT_TLS_PREFIX ulong mpz_free_num = 0;
-FLINT_TLS_PREFIX ulong mpz_free_alloc = 0;
-#pragma omp threadprivate(mpz_free_arr, mpz_free_num, mpz_free_alloc)
+/*
+   Each thread has a cache of mpz's carved out of page aligned blocks which
+   it owns. An mpz cleared by the owner goes straight back into its cache.
+   One cleared by another thread is pushed onto the lock-free remote stack
+   of the owner, linked through its first limb, and the owner takes the
+   whole stack back when its cache runs dry. When the owner cleans up, its
+   remote stack is closed and the mpz's still in use are cleared for good
+   by whichever threads release them, the last one freeing the block.
+*/
+/*
+   Header of a block of mpz's, placed before its first page. Each page
+   starts with room for a header whose address field points to the block.
+*/
+typedef struct
+{
+   slong count;    /* number of mpz's of the block cleared for good */
+   slong free;     /* number of mpz's of the block in the owner's cache */
+   void * cache;   /* the cache of the thread owning the block */
+   void * address;
+} fmpz_block_header_s;
+
+typedef struct
+{
+    __mpz_struct ** free_arr;
+    slong free_num;
+    slong free_alloc;
+    slong trim_limit;
+    void * remote;   /* stack of mpz's freed by other threads */
+    slong refs;      /* live blocks, plus one until the owner cleans up */
+    fmpz_mpz_cache_stats_struct stats;
+} fmpz_mpz_cache_struct;
+
+FLINT_TLS_PREFIX fmpz_mpz_cache_struct * mpz_cache = NULL;
+#pragma omp threadprivate(mpz_cache)
+
+/* value of the remote stack of a cache whose owner has cleaned up */
+static __mpz_struct _fmpz_remote_closed;
+#define REMOTE_CLOSED ((void *) &_fmpz_remote_closed)
 
 static slong flint_page_size;
 static slong flint_mpz_structs_per_block;
 static slong flint_page_mask;
 
+#if defined(_MSC_VER)
+
+static __inline void * _fmpz_atomic_load_ptr(void ** p)
+{
+    return InterlockedCompareExchangePointer(p, NULL, NULL);
+}
+
+static __inline void * _fmpz_atomic_swap_ptr(void ** p, void * v)
+{
+    return InterlockedExchangePointer(p, v);
+}
+
+/* if *p is *old set it to v, else set *old to *p */
+static __inline int _fmpz_atomic_cas_ptr(void ** p, void ** old, void * v)
+{
+    void * prev = InterlockedCompareExchangePointer(p, v, *old);
+    int ok = (prev == *old);
+
+    *old = prev;
+
+    return ok;
+}
+
+static __inline slong _fmpz_atomic_add(slong * p, slong v)
+{
+#if FLINT64
+    return InterlockedExchangeAdd64(p, v) + v;
+#else
+    return InterlockedExchangeAdd(p, v) + v;
+#endif
+}
+
+#elif defined(__GNUC__)
+
+static __inline__ void * _fmpz_atomic_load_ptr(void ** p)
+{
+    return __atomic_load_n(p, __ATOMIC_ACQUIRE);
+}
+
+static __inline__ void * _fmpz_atomic_swap_ptr(void ** p, void * v)
+{
+    return __atomic_exchange_n(p, v, __ATOMIC_ACQ_REL);
+}
+
+/* if *p is *old set it to v, else set *old to *p */
+static __inline__ int _fmpz_atomic_cas_ptr(void ** p, void ** old, void * v)
+{
+    return __atomic_compare_exchange_n(p, old, v, 1,
+                                        __ATOMIC_RELEASE, __ATOMIC_ACQUIRE);
+}
+
+static __inline__ slong _fmpz_atomic_add(slong * p, slong v)
+{
+    return __atomic_add_fetch(p, v, __ATOMIC_ACQ_REL);
+}
+
+#else
+
+/* no atomics available, only safe if mpz's don't cross threads */
+
+static void * _fmpz_atomic_load_ptr(void ** p)
+{
+    return *p;
+}
+
+static void * _fmpz_atomic_swap_ptr(void ** p, void * v)
+{
+    void * old = *p;
+
+    *p = v;
+
+    return old;
+}
+
+static int _fmpz_atomic_cas_ptr(void ** p, void ** old, void * v)
+{
+    if (*p != *old)
+    {
+        *old = *p;
+        return 0;
+    }
+
+    *p = v;
+
+    return 1;
+}
+
+static slong _fmpz_atomic_add(slong * p, slong v)
+{
+    return (*p += v);
+}
+
+#endif
+
 slong flint_get_page_size()
 {
 #if defined(__unix__)
@@ -60,124 +190,275 @@ void * flint_align_ptr(void * ptr, slong size)
     return (void *)((mask & (slong) ptr) + size);
 }
 
-__mpz_struct * _fmpz_new_mpz(void)
+static __inline__ fmpz_block_header_s * _fmpz_mpz_block(__mpz_struct * ptr)
+{
+    fmpz_block_header_s * page = (fmpz_block_header_s *)((slong) ptr & flint_page_mask);
+
+    return (fmpz_block_header_s *) page->address;
+}
+
+static void _fmpz_mpz_cache_unref(fmpz_mpz_cache_struct * cache)
+{
+    if (_fmpz_atomic_add(&cache->refs, -1) == 0)
+        flint_free(cache);
+}
+
+/* clear ptr for good, returns 1 if this freed its block */
+static int _fmpz_mpz_release(__mpz_struct * ptr, fmpz_block_header_s * block)
+{
+    mpz_clear(ptr);
+
+    if (_fmpz_atomic_add(&block->count, 1) != flint_mpz_structs_per_block)
+        return 0;
+
+    _fmpz_mpz_cache_unref(block->cache);
+    flint_free(block->address);
+
+    return 1;
+}
+
+static fmpz_mpz_cache_struct * _fmpz_mpz_cache(void)
 {
-    if (mpz_free_num == 0) /* allocate more mpz's */
+    if (mpz_cache == NULL)
     {
-        void * aligned_ptr, * ptr;
+        mpz_cache = flint_malloc(sizeof(fmpz_mpz_cache_struct));
+
+        mpz_cache->free_arr = NULL;
+        mpz_cache->free_num = 0;
+        mpz_cache->free_alloc = 0;
+        mpz_cache->trim_limit = 0;
+        mpz_cache->remote = NULL;
+        mpz_cache->refs = 1;
+        memset(&mpz_cache->stats, 0, sizeof(fmpz_mpz_cache_stats_struct));
+    }
 
-        slong i, j, num, block_size, skip;
+    return mpz_cache;
+}
 
-        flint_page_size = flint_get_page_size();
-        block_size = PAGES_PER_BLOCK*flint_page_size;
-        flint_page_mask = ~(flint_page_size - 1);
+static void _fmpz_mpz_cache_fit_length(fmpz_mpz_cache_struct * cache, slong len)
+{
+    if (len > cache->free_alloc)
+    {
+        cache->free_alloc = FLINT_MAX(len, FLINT_MAX(64, cache->free_alloc * 2));
+        cache->free_arr = flint_realloc(cache->free_arr,
+                                   cache->free_alloc * sizeof(__mpz_struct *));
+    }
+}
 
-        /* get new block */
-        ptr = flint_malloc(block_size + flint_page_size);
+/* give back the blocks none of whose mpz's are in use */
+static void _fmpz_mpz_cache_trim(fmpz_mpz_cache_struct * cache)
+{
+    slong i, j;
 
-        /* align to page boundary */
-        aligned_ptr = flint_align_ptr(ptr, flint_page_size);
+    for (i = j = 0; i < cache->free_num; i++)
+    {
+        __mpz_struct * ptr = cache->free_arr[i];
+        fmpz_block_header_s * block = _fmpz_mpz_block(ptr);
 
-        /* set free count to zero and determine if this is the main thread */
-        ((fmpz_block_header_s *) ptr)->count = 0;
-#if HAVE_PTHREAD
-        ((fmpz_block_header_s *) ptr)->thread = pthread_self();
-#endif
-        /* how many __mpz_structs worth are dedicated to header, per page */
-        skip = (sizeof(fmpz_block_header_s) - 1)/sizeof(__mpz_struct) + 1;
+        if (block->free == flint_mpz_structs_per_block)
+            cache->stats.blocks_freed += _fmpz_mpz_release(ptr, block);
+        else
+            cache->free_arr[j++] = ptr;
+    }
 
-        /* total number of number of __mpz_structs worth per page */
-        num = flint_page_size/sizeof(__mpz_struct);
+    cache->free_num = j;
 
-        flint_mpz_structs_per_block = PAGES_PER_BLOCK*(num - skip);
+    /* hysteresis, so that we don't trim again straight away */
+    cache->trim_limit = FLINT_MAX(2 * j,
+                  FLINT_MPZ_CACHE_TRIM_BLOCKS * flint_mpz_structs_per_block);
+}
 
-        if (mpz_free_num  + flint_mpz_structs_per_block >= mpz_free_alloc)
-        {
-            mpz_free_alloc = FLINT_MAX(mpz_free_num + flint_mpz_structs_per_block, mpz_free_alloc * 2);
-            mpz_free_arr = flint_realloc(mpz_free_arr, mpz_free_alloc * sizeof(__mpz_struct *));
-        }
+static void _fmpz_mpz_cache_push(fmpz_mpz_cache_struct * cache, __mpz_struct * ptr)
+{
+    if (ptr->_mp_alloc > FLINT_MPZ_MAX_CACHE_LIMBS)
+        mpz_realloc2(ptr, 2*FLINT_BITS);
 
-        for (i = 0; i < PAGES_PER_BLOCK; i++)
-        {
-            __mpz_struct * page_ptr = (__mpz_struct *)((slong) aligned_ptr + i*flint_page_size);
+    _fmpz_mpz_cache_fit_length(cache, cache->free_num + 1);
 
-            /* set pointer in each page to start of entire block */
-            ((fmpz_block_header_s *) page_ptr)->address = ptr;
+    cache->free_arr[cache->free_num++] = ptr;
+    _fmpz_mpz_block(ptr)->free++;
+}
 
-            for (j = skip; j < num; j++) 
-            {
-                mpz_init2(page_ptr + j, 2*FLINT_BITS);
+/* take back the mpz's other threads have returned */
+static void _fmpz_mpz_cache_drain(fmpz_mpz_cache_struct * cache)
+{
+    __mpz_struct * ptr;
 
-                mpz_free_arr[mpz_free_num++] = page_ptr + j;
-            }
+    if (_fmpz_atomic_load_ptr(&cache->remote) == NULL)
+        return;
+
+    ptr = _fmpz_atomic_swap_ptr(&cache->remote, NULL);
+
+    while (ptr != NULL)
+    {
+        __mpz_struct * next = (__mpz_struct *) ptr->_mp_d[0];
+
+        _fmpz_mpz_cache_push(cache, ptr);
+        cache->stats.remote_frees++;
+
+        ptr = next;
+    }
+}
+
+static void _fmpz_mpz_cache_new_block(fmpz_mpz_cache_struct * cache)
+{
+    fmpz_block_header_s * block;
+    void * aligned_ptr, * ptr;
+    slong i, j, num, block_size, skip;
+
+    flint_page_size = flint_get_page_size();
+    block_size = PAGES_PER_BLOCK*flint_page_size;
+    flint_page_mask = ~(flint_page_size - 1);
+
+    /* get new block, with room for its header before the first page */
+    FLINT_MEMSTATS_PUSH_TAG("fmpz");
+    ptr = flint_malloc(block_size + flint_page_size + sizeof(fmpz_block_header_s));
+    FLINT_MEMSTATS_POP_TAG();
+
+    /* align to page boundary */
+    aligned_ptr = flint_align_ptr((char *) ptr + sizeof(fmpz_block_header_s),
+                                                             flint_page_size);
+
+    block = (fmpz_block_header_s *) ptr;
+    block->count = 0;
+    block->free = 0;
+    block->cache = cache;
+    block->address = ptr;
+
+    /* how many __mpz_structs worth are dedicated to header, per page */
+    skip = (sizeof(fmpz_block_header_s) - 1)/sizeof(__mpz_struct) + 1;
+
+    /* total number of number of __mpz_structs worth per page */
+    num = flint_page_size/sizeof(__mpz_struct);
+
+    flint_mpz_structs_per_block = PAGES_PER_BLOCK*(num - skip);
+
+    _fmpz_mpz_cache_fit_length(cache, cache->free_num + flint_mpz_structs_per_block);
+
+    for (i = 0; i < PAGES_PER_BLOCK; i++)
+    {
+        __mpz_struct * page_ptr = (__mpz_struct *)((slong) aligned_ptr + i*flint_page_size);
+
+        /* set pointer in each page to start of entire block */
+        ((fmpz_block_header_s *) page_ptr)->address = ptr;
+
+        for (j = skip; j < num; j++)
+        {
+            mpz_init2(page_ptr + j, 2*FLINT_BITS);
+
+            cache->free_arr[cache->free_num++] = page_ptr + j;
         }
     }
 
-    return mpz_free_arr[--mpz_free_num];
+    block->free = flint_mpz_structs_per_block;
+
+    _fmpz_atomic_add(&cache->refs, 1);
+    cache->stats.blocks++;
+
+    if (cache->trim_limit == 0)
+        cache->trim_limit = FLINT_MPZ_CACHE_TRIM_BLOCKS * flint_mpz_structs_per_block;
 }
 
-void _fmpz_clear_mpz(fmpz f)
+__mpz_struct * _fmpz_new_mpz(void)
 {
-    __mpz_struct * ptr = COEFF_TO_PTR(f);
+    fmpz_mpz_cache_struct * cache = _fmpz_mpz_cache();
+    __mpz_struct * ptr;
 
-    /* check free count for block is zero, else this mpz came from a thread */
-    fmpz_block_header_s * header_ptr = (fmpz_block_header_s *)((slong) ptr & flint_page_mask);
+    if (cache->free_num == 0)
+        _fmpz_mpz_cache_drain(cache);
 
-    header_ptr = (fmpz_block_header_s *) header_ptr->address;
+    if (cache->free_num == 0) /* allocate more mpz's */
+        _fmpz_mpz_cache_new_block(cache);
 
-    /* clean up if this is left over from another thread */
-#if HAVE_PTHREAD
-    if (header_ptr->count != 0 || header_ptr->thread != pthread_self()) 
-#else
-    if (header_ptr->count != 0)
-#endif
+    ptr = cache->free_arr[--cache->free_num];
+    _fmpz_mpz_block(ptr)->free--;
+    cache->stats.allocs++;
+
+    return ptr;
+}
+
+void _fmpz_clear_mpz(fmpz f)
+{
+    __mpz_struct * ptr = COEFF_TO_PTR(f);
+    fmpz_block_header_s * block = _fmpz_mpz_block(ptr);
+    fmpz_mpz_cache_struct * owner = block->cache;
+
+    if (owner == mpz_cache)
     {
-        mpz_clear(ptr);
+        _fmpz_mpz_cache_push(owner, ptr);
 
-        if (++header_ptr->count == flint_mpz_structs_per_block)
-            flint_free(header_ptr);    
-    } else
+        if (owner->free_num > owner->trim_limit)
+            _fmpz_mpz_cache_trim(owner);
+    }
+    else /* return it to the thread it came from */
     {
-        if (ptr->_mp_alloc > FLINT_MPZ_MAX_CACHE_LIMBS)
+        void * head = _fmpz_atomic_load_ptr(&owner->remote);
+
+        /* we need a limb to link through */
+        if (ptr->_mp_alloc > FLINT_MPZ_MAX_CACHE_LIMBS || ptr->_mp_alloc < 1)
             mpz_realloc2(ptr, 2*FLINT_BITS);
 
-        if (mpz_free_num == mpz_free_alloc)
+        while (1)
         {
-            mpz_free_alloc = FLINT_MAX(64, mpz_free_alloc * 2);
-            mpz_free_arr = flint_realloc(mpz_free_arr, mpz_free_alloc * sizeof(__mpz_struct *));
-        }
+            if (head == REMOTE_CLOSED)
+            {
+                _fmpz_mpz_release(ptr, block);
+                break;
+            }
 
-        mpz_free_arr[mpz_free_num++] = ptr;
+            ptr->_mp_d[0] = (mp_limb_t) head;
+
+            if (_fmpz_atomic_cas_ptr(&owner->remote, &head, ptr))
+                break;
+        }
     }
 }
 
 void _fmpz_cleanup_mpz_content(void)
 {
-    ulong i;
+    fmpz_mpz_cache_struct * cache = mpz_cache;
+    __mpz_struct * ptr;
+    slong i;
 
-    for (i = 0; i < mpz_free_num; i++)
-    {
-       fmpz_block_header_s * ptr;
+    if (cache == NULL)
+        return;
+
+    mpz_cache = NULL;
 
-       mpz_clear(mpz_free_arr[i]);
+    /* from now on other threads clear the mpz's they release */
+    ptr = _fmpz_atomic_swap_ptr(&cache->remote, REMOTE_CLOSED);
 
-       /* update count of cleared mpz's for block */
-       ptr = (fmpz_block_header_s *)((slong) mpz_free_arr[i] & ~(flint_page_size - 1));
+    while (ptr != NULL)
+    {
+        __mpz_struct * next = (__mpz_struct *) ptr->_mp_d[0];
+
+        _fmpz_mpz_release(ptr, _fmpz_mpz_block(ptr));
 
-       ptr = (fmpz_block_header_s *) ptr->address;
-       
-       if (++ptr->count == flint_mpz_structs_per_block)
-          flint_free(ptr);
+        ptr = next;
     }
 
-    mpz_free_num = mpz_free_alloc = 0;
+    for (i = 0; i < cache->free_num; i++)
+        _fmpz_mpz_release(cache->free_arr[i], _fmpz_mpz_block(cache->free_arr[i]));
+
+    flint_free(cache->free_arr);
+
+    _fmpz_mpz_cache_unref(cache);
 }
 
 void _fmpz_cleanup(void)
 {
     _fmpz_cleanup_mpz_content();
-    flint_free(mpz_free_arr);
-    mpz_free_arr = NULL;
+}
+
+void _fmpz_mpz_cache_stats(fmpz_mpz_cache_stats_t stats)
+{
+    if (mpz_cache == NULL)
+        memset(stats, 0, sizeof(fmpz_mpz_cache_stats_struct));
+    else
+    {
+        *stats = mpz_cache->stats;
+        stats->cached = mpz_cache->free_num;
+    }
 }
 
 __mpz_struct * _fmpz_promote(fmpz_t f)
@@ -86,16 +86,18 @@ void fmpz_multi_CRT_ui(fmpz_t output, mp_srcptr residues,
     /* First layer of reconstruction */
     num = (WORD(1) << n);
 
+    /* r_i + p_i ((r_{i+1} - r_i) p_i^{-1} mod p_{i+1}), in limbs */
     for (i = 0, j = 0; i + 2 <= num_primes; i += 2, j++)
     {
-        fmpz_set_ui(temp, residues[i]);
-        fmpz_mod_ui(temp2, temp, comb->primes[i+1]);
-        fmpz_sub_ui(temp2, temp2, residues[i + 1]);
-        fmpz_neg(temp2, temp2);
-        fmpz_mul(temp, temp2, comb->res[0] + j);
-        fmpz_mod_ui(temp2, temp, comb->primes[i+1]);
-        fmpz_mul_ui(temp, temp2, comb->primes[i]); 
-        fmpz_add_ui(comb_temp[0] + j, temp, residues[i]);
+        nmod_t mod = comb->mod[i + 1];
+        mp_limb_t hi, lo, t;
+
+        NMOD_RED(t, residues[i], mod);
+        t = nmod_sub(residues[i + 1], t, mod);
+        t = n_mulmod2_preinv(t, fmpz_get_ui(comb->res[0] + j), mod.n, mod.ninv);
+        umul_ppmm(hi, lo, t, comb->primes[i]);
+        add_ssaaaa(hi, lo, hi, lo, 0, residues[i]);
+        fmpz_set_uiui(comb_temp[0] + j, hi, lo);
     }
 
     if (i < num_primes)
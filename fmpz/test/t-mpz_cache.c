@@ -0,0 +1,198 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "ulong_extras.h"
+
+#if HAVE_PTHREAD
+#include <pthread.h>
+
+/*
+   The worker allocates a vector in each round, hands it over to the main
+   thread, which clears it, and waits until it has been cleared.
+*/
+typedef struct
+{
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    fmpz * vec;
+    slong len;
+    slong rounds;
+    int fail;
+    fmpz * orphan;
+} shared_t;
+
+static void set_vec(fmpz * vec, slong len, slong round)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+    {
+        fmpz_set_ui(vec + i, i + round + 1);
+        fmpz_mul_2exp(vec + i, vec + i, 100 + (i % 500));
+    }
+}
+
+static void * worker(void * arg_ptr)
+{
+    shared_t * S = (shared_t *) arg_ptr;
+    fmpz_mpz_cache_stats_t stats;
+    slong r, len, blocks = 0;
+    fmpz * vec;
+
+    for (r = 0; r < S->rounds; r++)
+    {
+        vec = _fmpz_vec_init(S->len);
+        set_vec(vec, S->len, r);
+
+        pthread_mutex_lock(&S->mutex);
+        S->vec = vec;
+        pthread_cond_broadcast(&S->cond);
+        while (S->vec != NULL)
+            pthread_cond_wait(&S->cond, &S->mutex);
+        pthread_mutex_unlock(&S->mutex);
+
+        /* the mpz's returned must be reused rather than new blocks */
+        _fmpz_mpz_cache_stats(stats);
+        if (r == 1)
+            blocks = stats->blocks;
+        else if (r > 1 && stats->blocks != blocks)
+            S->fail = 1;
+    }
+
+    /* emptying the cache must take back the mpz's the main thread cleared */
+    _fmpz_mpz_cache_stats(stats);
+    len = stats->cached + 1;
+    blocks = stats->blocks;
+
+    vec = _fmpz_vec_init(len);
+    set_vec(vec, len, 0);
+
+    _fmpz_mpz_cache_stats(stats);
+    if (stats->allocs != 0 && (stats->remote_frees == 0 || stats->blocks != blocks))
+        S->fail = 1;
+
+    _fmpz_vec_clear(vec, len);
+
+    /* leave some mpz's behind, to be cleared after the thread cleaned up */
+    S->orphan = _fmpz_vec_init(S->len);
+    set_vec(S->orphan, S->len, 0);
+
+    flint_cleanup();
+
+    return NULL;
+}
+#endif
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mpz_cache....");
+    fflush(stdout);
+
+    /* the cache is trimmed after a large vector is cleared */
+    {
+        fmpz_mpz_cache_stats_t stats;
+        slong len = 100000;
+        fmpz * vec = _fmpz_vec_init(len);
+
+        set_vec(vec, len, 0);
+        _fmpz_vec_clear(vec, len);
+
+        _fmpz_mpz_cache_stats(stats);
+
+        if (stats->allocs != 0 && (stats->blocks_freed == 0 ||
+                                  stats->cached >= len))
+        {
+            flint_printf("FAIL (trim):\n");
+            flint_printf("blocks = %wd, blocks_freed = %wd, cached = %wd\n",
+                         stats->blocks, stats->blocks_freed, stats->cached);
+            abort();
+        }
+    }
+
+#if HAVE_PTHREAD
+    for (iter = 0; iter < 10 * flint_test_multiplier(); iter++)
+    {
+        pthread_t thread;
+        shared_t S;
+        slong r, i;
+
+        pthread_mutex_init(&S.mutex, NULL);
+        pthread_cond_init(&S.cond, NULL);
+        S.vec = NULL;
+        S.len = n_randint(state, 5000) + 1;
+        S.rounds = n_randint(state, 10) + 3;
+        S.fail = 0;
+        S.orphan = NULL;
+
+        pthread_create(&thread, NULL, worker, &S);
+
+        for (r = 0; r < S.rounds; r++)
+        {
+            pthread_mutex_lock(&S.mutex);
+            while (S.vec == NULL)
+                pthread_cond_wait(&S.cond, &S.mutex);
+
+            for (i = 0; i < S.len; i++)
+            {
+                fmpz_t t;
+
+                fmpz_init_set_ui(t, i + r + 1);
+                fmpz_mul_2exp(t, t, 100 + (i % 500));
+
+                if (!fmpz_equal(t, S.vec + i))
+                    S.fail = 1;
+
+                fmpz_clear(t);
+            }
+
+            _fmpz_vec_clear(S.vec, S.len);
+            S.vec = NULL;
+            pthread_cond_broadcast(&S.cond);
+            pthread_mutex_unlock(&S.mutex);
+        }
+
+        pthread_join(thread, NULL);
+
+        /* the worker has cleaned up, its blocks go when these are cleared */
+        for (i = 0; i < S.len; i++)
+        {
+            fmpz_add_ui(S.orphan + i, S.orphan + i, 1);
+            fmpz_sub_ui(S.orphan + i, S.orphan + i, 1);
+        }
+        _fmpz_vec_clear(S.orphan, S.len);
+
+        pthread_mutex_destroy(&S.mutex);
+        pthread_cond_destroy(&S.cond);
+
+        if (S.fail)
+        {
+            flint_printf("FAIL (threads):\n");
+            flint_printf("len = %wd, rounds = %wd\n", S.len, S.rounds);
+            abort();
+        }
+    }
+#endif
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -107,6 +107,9 @@ FLINT_DLL void fmpz_factor_divisor_sigma(fmpz_t res, const fmpz_factor_t fac, ul
 
 /* ECM Factoring functions ***************************************************/
 
+/* stage II bound from which the polynomial stage II is used */
+#define FMPZ_FACTOR_ECM_FFT_CUTOFF UWORD(1000000)
+
 typedef struct ecm_s {
 
     mp_ptr t, u, v, w;  /* temp variables */
@@ -159,6 +162,9 @@ FLINT_DLL int fmpz_factor_ecm_stage_I(mp_ptr f, const mp_limb_t *prime_array,
 FLINT_DLL int fmpz_factor_ecm_stage_II(mp_ptr f, mp_limb_t B1, mp_limb_t B2,
                                        mp_limb_t P, mp_ptr n, ecm_t ecm_inf);
 
+FLINT_DLL int fmpz_factor_ecm_stage_II_fft(mp_ptr f, mp_limb_t B1,
+                        mp_limb_t B2, mp_limb_t P, mp_ptr n, ecm_t ecm_inf);
+
 FLINT_DLL int fmpz_factor_ecm(fmpz_t f, mp_limb_t curves, mp_limb_t B1,
                         mp_limb_t B2, flint_rand_t state, const fmpz_t n_in);
 
@@ -16,6 +16,7 @@
 #include "flint.h"
 #include "fmpz.h"
 #include "mpn_extras.h"
+#include "thread_pool.h"
 
 static
 ulong n_ecm_primorial[] =
@@ -43,29 +44,89 @@ ulong n_ecm_primorial[] =
 #define num_n_ecm_primorials 9
 #endif
 
+/* A single curve, run by one thread with its own ecm_t */
+typedef struct
+{
+    ecm_s * ecm_inf;
+    mp_ptr f;
+    mp_ptr sig;
+    mp_ptr n;
+    const mp_limb_t * prime_array;
+    mp_limb_t num, B1, B2, P;
+    int stage;          /* 0 if no factor found, else as returned */
+    mp_size_t limbs;    /* limbs of the (shifted) factor in f */
+}
+_ecm_curve_arg_t;
+
+static void
+_fmpz_factor_ecm_curve_worker(void * arg_ptr)
+{
+    _ecm_curve_arg_t * arg = (_ecm_curve_arg_t *) arg_ptr;
+    int ret;
+
+    arg->stage = 0;
+
+    /************************ SELECT CURVE ************************/
+
+    ret = fmpz_factor_ecm_select_curve(arg->f, arg->sig, arg->n, arg->ecm_inf);
+
+    if (ret == -1)  /* unsuitable curve */
+        return;
+
+    if (ret)
+    {
+        /* Found factor while selecting curve, very very lucky :) */
+        arg->stage = -1;
+        arg->limbs = ret;
+        return;
+    }
+
+    /************************** STAGE I ***************************/
+
+    ret = fmpz_factor_ecm_stage_I(arg->f, arg->prime_array, arg->num,
+                                  arg->B1, arg->n, arg->ecm_inf);
+
+    if (ret)
+    {
+        arg->stage = 1;
+        arg->limbs = ret;
+        return;
+    }
+
+    /************************** STAGE II ***************************/
+
+    if (arg->B2 >= FMPZ_FACTOR_ECM_FFT_CUTOFF)
+        ret = fmpz_factor_ecm_stage_II_fft(arg->f, arg->B1, arg->B2, arg->P,
+                                           arg->n, arg->ecm_inf);
+    else
+        ret = fmpz_factor_ecm_stage_II(arg->f, arg->B1, arg->B2, arg->P,
+                                       arg->n, arg->ecm_inf);
+
+    if (ret)
+    {
+        arg->stage = 2;
+        arg->limbs = ret;
+    }
+}
+
 int
 fmpz_factor_ecm(fmpz_t f, mp_limb_t curves, mp_limb_t B1, mp_limb_t B2,
                 flint_rand_t state, const fmpz_t n_in)
 {
     fmpz_t sig, nm8;
     mp_limb_t P, num, maxD, mmin, mmax, mdiff, prod, maxj, n_size, cy;
-    int i, j, ret;
-    ecm_t ecm_inf;
+    slong i, j, c, batch, num_threads;
+    int ret;
+    ecm_s * ecm_inf;
+    _ecm_curve_arg_t * args;
     __mpz_struct *fac, *mpz_ptr;
-    mp_ptr n, mpsig;
-
-    TMP_INIT;
+    mp_ptr n, mpsig, mpf;
+    unsigned char * GCD_table;
+    unsigned char ** prime_table;
 
     const mp_limb_t *prime_array;
     n_size = fmpz_size(n_in);
 
-    fmpz_factor_ecm_init(ecm_inf, n_size);
-
-    TMP_START;
-
-    n     = TMP_ALLOC(n_size * sizeof(mp_limb_t));
-    mpsig = TMP_ALLOC(n_size * sizeof(mp_limb_t));
-
     if (n_size == 1)
     {
         ret = n_factor_ecm(&P, curves, B1, B2, state, fmpz_get_ui(n_in));
@@ -73,6 +134,22 @@ fmpz_factor_ecm(fmpz_t f, mp_limb_t curves, mp_limb_t B1, mp_limb_t B2,
         return ret;
     }
 
+    /*
+       Curves are run in batches of one curve per thread. Each curve has its
+       own ecm_t sharing n, its inverse and the stage II tables.
+    */
+    num_threads = flint_get_num_threads();
+
+    ecm_inf = flint_malloc(num_threads * sizeof(ecm_s));
+    args = flint_malloc(num_threads * sizeof(_ecm_curve_arg_t));
+
+    for (i = 0; i < num_threads; i++)
+        fmpz_factor_ecm_init(ecm_inf + i, n_size);
+
+    n     = flint_malloc(n_size * sizeof(mp_limb_t));
+    mpsig = flint_malloc(num_threads * n_size * sizeof(mp_limb_t));
+    mpf   = flint_malloc(num_threads * (n_size + 1) * sizeof(mp_limb_t));
+
     if ((!COEFF_IS_MPZ(* n_in)))
     {
         count_leading_zeros(ecm_inf->normbits, fmpz_get_ui(n_in));
@@ -83,18 +160,27 @@ fmpz_factor_ecm(fmpz_t f, mp_limb_t curves, mp_limb_t B1, mp_limb_t B2,
     {
         mpz_ptr = COEFF_TO_PTR(* n_in);
         count_leading_zeros(ecm_inf->normbits, mpz_ptr->_mp_d[n_size - 1]);
-        mpn_lshift(n, mpz_ptr->_mp_d, n_size, ecm_inf->normbits);
+        if (ecm_inf->normbits)
+            mpn_lshift(n, mpz_ptr->_mp_d, n_size, ecm_inf->normbits);
+        else
+            mpn_copyi(n, mpz_ptr->_mp_d, n_size);
     }
 
     flint_mpn_preinvn(ecm_inf->ninv, n, n_size);
     ecm_inf->one[0] = UWORD(1) << ecm_inf->normbits;
 
+    for (i = 1; i < num_threads; i++)
+    {
+        ecm_inf[i].normbits = ecm_inf->normbits;
+        mpn_copyi(ecm_inf[i].ninv, ecm_inf->ninv, n_size);
+        mpn_copyi(ecm_inf[i].one, ecm_inf->one, n_size);
+    }
+
     fmpz_init(sig);
     fmpz_init(nm8);
     fmpz_sub_ui(nm8, n_in, 8);
 
     ret = 0;
-    fac = _fmpz_promote(f);
 
     /************************ STAGE I PRECOMPUTATIONS ************************/
 
@@ -114,6 +200,19 @@ fmpz_factor_ecm(fmpz_t f, mp_limb_t curves, mp_limb_t B1, mp_limb_t B2,
         j += 1;
 
     P = n_ecm_primorial[j - 1]; 
+
+    /* the polynomial stage II is cheapest with about as many baby steps
+       as giant steps, i.e. phi(P)/2 close to (B2 - B1)/P */
+
+    if (B2 >= FMPZ_FACTOR_ECM_FFT_CUTOFF)
+    {
+        j = 1;
+        while ((j < num_n_ecm_primorials) &&
+               n_euler_phi(n_ecm_primorial[j])/2 <= (B2 - B1)/n_ecm_primorial[j])
+            j += 1;
+
+        P = n_ecm_primorial[j - 1];
+    }
     
     mmin = (B1 + (P/2)) / P;
     mmax = ((B2 - P/2) + P - 1)/P;      /* ceil */
@@ -122,122 +221,138 @@ fmpz_factor_ecm(fmpz_t f, mp_limb_t curves, mp_limb_t B1, mp_limb_t B2,
 
     /* compute GCD_table */
 
-    ecm_inf->GCD_table = flint_malloc(maxj + 1);
+    GCD_table = flint_malloc(maxj + 1);
 
     for (j = 1; j <= maxj; j += 2)
     {
         if ((j%2) && n_gcd(j, P) == 1)
-            ecm_inf->GCD_table[j] = 1;  
+            GCD_table[j] = 1;  
         else
-            ecm_inf->GCD_table[j] = 0;
+            GCD_table[j] = 0;
     }  
 
-    /* compute prime table */
+    /* compute prime table, not needed by the polynomial stage II */
 
-    ecm_inf->prime_table = flint_malloc(mdiff * sizeof(unsigned char*));
+    if (B2 >= FMPZ_FACTOR_ECM_FFT_CUTOFF)
+    {
+        prime_table = NULL;
+        mdiff = 0;
+    }
+    else
+        prime_table = flint_malloc(mdiff * sizeof(unsigned char*));
 
     for (i = 0; i < mdiff; i++)
-        ecm_inf->prime_table[i] = flint_malloc((maxj + 1) * sizeof(unsigned char));
+        prime_table[i] = flint_malloc((maxj + 1) * sizeof(unsigned char));
 
     for (i = 0; i < mdiff; i++)
     {
         for (j = 1; j <= maxj; j += 2)
         {
-            ecm_inf->prime_table[i][j] = 0;
+            prime_table[i][j] = 0;
 
             /* if (i + mmin)*D + j
                is prime, mark 1. Can be possibly prime
                only if gcd(j, D) = 1 */
 
-            if (ecm_inf->GCD_table[j] == 1)
+            if (GCD_table[j] == 1)
             {
                 prod = (i + mmin)*P + j;
                 if (n_is_prime(prod))
-                    ecm_inf->prime_table[i][j] = 1;
+                    prime_table[i][j] = 1;
 
                 prod = (i + mmin)*P - j;
                 if (n_is_prime(prod))
-                    ecm_inf->prime_table[i][j] = 1;
+                    prime_table[i][j] = 1;
             }
         }
     }
 
+    for (i = 0; i < num_threads; i++)
+    {
+        ecm_inf[i].GCD_table = GCD_table;
+        ecm_inf[i].prime_table = prime_table;
+
+        args[i].ecm_inf = ecm_inf + i;
+        args[i].f = mpf + i * (n_size + 1);
+        args[i].sig = mpsig + i * n_size;
+        args[i].n = n;
+        args[i].prime_array = prime_array;
+        args[i].num = num;
+        args[i].B1 = B1;
+        args[i].B2 = B2;
+        args[i].P = P;
+    }
 
     /****************************** TRY "CURVES" *****************************/
 
-    for (j = 0; j < curves; j++)
+    for (c = 0; c < curves; c += batch)
     {
-        fmpz_randm(sig, state, nm8);
-        fmpz_add_ui(sig, sig, 7);
-
-        if ((!COEFF_IS_MPZ(*sig)))
-        {
-            mpsig[0] = fmpz_get_ui(sig);
-            cy = mpn_lshift(mpsig, mpsig, 1, ecm_inf->normbits);
-            if (cy)
-                mpsig[1] = cy;
-        }
-        else
-        {
-            mpz_ptr = COEFF_TO_PTR(*sig);
-
-            cy = mpn_lshift(mpsig, mpz_ptr->_mp_d, mpz_ptr->_mp_size, ecm_inf->normbits);
-            if (cy)
-                mpsig[mpz_ptr->_mp_size] = cy;
+        batch = FLINT_MIN(num_threads, curves - c);
 
-        }
-
-        /************************ SELECT CURVE ************************/
-
-        ret = fmpz_factor_ecm_select_curve(fac->_mp_d, mpsig, n, ecm_inf);
+        /* the random sigmas are drawn in curve order */
 
-        if (ret)
+        for (i = 0; i < batch; i++)
         {
-            /* Found factor while selecting curve,
-               very very lucky :) */
+            mp_ptr s = args[i].sig;
 
-            mpn_rshift(fac->_mp_d, fac->_mp_d, ret, ecm_inf->normbits);
-            MPN_NORM(fac->_mp_d, ret);
+            fmpz_randm(sig, state, nm8);
+            fmpz_add_ui(sig, sig, 7);
 
-            fac->_mp_size = ret;
-            _fmpz_demote_val(f);    
+            mpn_zero(s, n_size);
 
-            ret = -1;
-            goto cleanup;
+            if ((!COEFF_IS_MPZ(*sig)))
+            {
+                s[0] = fmpz_get_ui(sig);
+                cy = (ecm_inf->normbits == 0) ? 0 :
+                         mpn_lshift(s, s, 1, ecm_inf->normbits);
+                if (cy)
+                    s[1] = cy;
+            }
+            else
+            {
+                mpz_ptr = COEFF_TO_PTR(*sig);
+
+                if (ecm_inf->normbits == 0)
+                    mpn_copyi(s, mpz_ptr->_mp_d, mpz_ptr->_mp_size);
+                else
+                {
+                    cy = mpn_lshift(s, mpz_ptr->_mp_d, mpz_ptr->_mp_size,
+                                                          ecm_inf->normbits);
+                    if (cy)
+                        s[mpz_ptr->_mp_size] = cy;
+                }
+            }
         }
 
-        if (ret != -1)
-        {
-
-            /************************** STAGE I ***************************/
+        if (batch == 1)
+            _fmpz_factor_ecm_curve_worker(args);
+        else
+            flint_parallel_do(_fmpz_factor_ecm_curve_worker, args, batch,
+                                            sizeof(_ecm_curve_arg_t), batch);
 
-            ret = fmpz_factor_ecm_stage_I(fac->_mp_d, prime_array, num, B1, n, ecm_inf);
+        /* report the first curve of the batch which found a factor */
 
-            if (ret)
+        for (i = 0; i < batch; i++)
+        {
+            if (args[i].stage != 0)
             {
-                /* Found factor after stage I */
-                mpn_rshift(fac->_mp_d, fac->_mp_d, ret, ecm_inf->normbits);
-                MPN_NORM(fac->_mp_d, ret);
+                mp_size_t limbs = args[i].limbs;
 
-                fac->_mp_size = ret;
-                _fmpz_demote_val(f);    
+                fac = _fmpz_promote(f);
 
-                ret = 1;
-                goto cleanup;
-            }  
-            /************************** STAGE II ***************************/
+                if (fac->_mp_alloc < limbs)
+                    _mpz_realloc(fac, limbs);
 
-            ret = fmpz_factor_ecm_stage_II(fac->_mp_d, B1, B2, P, n, ecm_inf);
+                if (ecm_inf->normbits)
+                    mpn_rshift(fac->_mp_d, args[i].f, limbs, ecm_inf->normbits);
+                else
+                    mpn_copyi(fac->_mp_d, args[i].f, limbs);
 
-            if (ret)
-            {
-                /* Found factor after stage I */
-                mpn_rshift(fac->_mp_d, fac->_mp_d, ret, ecm_inf->normbits);
-                MPN_NORM(fac->_mp_d, ret);
-                fac->_mp_size = ret;
-                _fmpz_demote_val(f);  
+                MPN_NORM(fac->_mp_d, limbs);
+                fac->_mp_size = limbs;
+                _fmpz_demote_val(f);
 
-                ret = 2;
+                ret = args[i].stage;
                 goto cleanup;
             }
         }
@@ -245,15 +360,22 @@ fmpz_factor_ecm(fmpz_t f, mp_limb_t curves, mp_limb_t B1, mp_limb_t B2,
 
     cleanup:
 
-
-    flint_free(ecm_inf->GCD_table);
+    flint_free(GCD_table);
     for (i = 0; i < mdiff; i++)
-        flint_free(ecm_inf->prime_table[i]);
-    flint_free(ecm_inf->prime_table);
+        flint_free(prime_table[i]);
+    flint_free(prime_table);
 
-    fmpz_factor_ecm_clear(ecm_inf);
-    
-    TMP_END;
+    for (i = 0; i < num_threads; i++)
+        fmpz_factor_ecm_clear(ecm_inf + i);
+
+    flint_free(ecm_inf);
+    flint_free(args);
+    flint_free(n);
+    flint_free(mpsig);
+    flint_free(mpf);
+
+    fmpz_clear(sig);
+    fmpz_clear(nm8);
 
     return ret;
 }
@@ -117,6 +117,7 @@ fmpz_factor_ecm_select_curve(mp_ptr f, mp_ptr sig, mp_ptr n, ecm_t ecm_inf)
         ((gcdlimbs == ecm_inf->n_size) && mpn_cmp(tempf, n, ecm_inf->n_size) == 0)) == 0)
     {
         /* Found factor */
+        mpn_copyi(f, tempf, gcdlimbs);
         ret = gcdlimbs;
         goto cleanup;
     }
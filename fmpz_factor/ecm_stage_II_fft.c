@@ -0,0 +1,282 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mod_poly.h"
+#include "mpn_extras.h"
+
+/* Polynomial continuation of stage II of ECM */
+
+/* r = a >> normbits, i.e. the residue represented by a */
+static void
+_fmpz_factor_ecm_get_fmpz(fmpz_t r, mp_srcptr a, ecm_t ecm_inf)
+{
+    __mpz_struct * m = _fmpz_promote(r);
+    mp_size_t sz = ecm_inf->n_size;
+
+    if (m->_mp_alloc < sz)
+        _mpz_realloc(m, sz);
+
+    if (ecm_inf->normbits)
+        mpn_rshift(m->_mp_d, a, sz, ecm_inf->normbits);
+    else
+        mpn_copyi(m->_mp_d, a, sz);
+
+    MPN_NORM(m->_mp_d, sz);
+    m->_mp_size = sz;
+
+    _fmpz_demote_val(r);
+}
+
+/*
+   Sets xs[i] to xs[i]/zs[i] mod N for 0 <= i < len with a single inversion
+   (Montgomery's simultaneous inversion). If some zs[i] is not invertible,
+   g is set to a factor of N which is nontrivial if one can be found this
+   way and 0 is returned.
+*/
+static int
+_fmpz_factor_ecm_normalise(fmpz * xs, const fmpz * zs, slong len,
+                           fmpz_t g, const fmpz_t N)
+{
+    fmpz * pre;
+    fmpz_t inv, t;
+    slong i;
+    int ret = 1;
+
+    pre = _fmpz_vec_init(len);
+    fmpz_init(inv);
+    fmpz_init(t);
+
+    fmpz_set(pre + 0, zs + 0);
+    for (i = 1; i < len; i++)
+    {
+        fmpz_mul(pre + i, pre + i - 1, zs + i);
+        fmpz_mod(pre + i, pre + i, N);
+    }
+
+    if (!fmpz_invmod(inv, pre + len - 1, N))
+    {
+        fmpz_gcd(g, pre + len - 1, N);
+
+        for (i = 0; i < len && fmpz_equal(g, N); i++)
+        {
+            fmpz_gcd(t, zs + i, N);
+            if (!fmpz_is_one(t))
+                fmpz_set(g, t);
+        }
+
+        ret = 0;
+        goto cleanup;
+    }
+
+    for (i = len - 1; i > 0; i--)
+    {
+        fmpz_mul(t, inv, pre + i - 1);
+        fmpz_mul(inv, inv, zs + i);
+        fmpz_mod(inv, inv, N);
+        fmpz_mul(xs + i, xs + i, t);
+        fmpz_mod(xs + i, xs + i, N);
+    }
+
+    fmpz_mul(xs + 0, xs + 0, inv);
+    fmpz_mod(xs + 0, xs + 0, N);
+
+cleanup:
+
+    _fmpz_vec_clear(pre, len);
+    fmpz_clear(inv);
+    fmpz_clear(t);
+
+    return ret;
+}
+
+int
+fmpz_factor_ecm_stage_II_fft(mp_ptr f, mp_limb_t B1, mp_limb_t B2, mp_limb_t P,
+                             mp_ptr n, ecm_t ecm_inf)
+{
+    mp_ptr Qx, Qz, Rx, Rz, Sx, Sz, Tx, Tz, arrx, arrz, Q0x2, Q0z2;
+    mp_limb_t mmin, mmax, maxj, i, j;
+    mp_size_t sz;
+    slong k, l, len;
+    fmpz * bx, * bz, * F, * gx, * gz, * ys;
+    fmpz_t N, g, d;
+    int ret;
+
+    TMP_INIT;
+
+    sz = ecm_inf->n_size;
+
+    mmin = (B1 + (P/2)) / P;
+    mmax = ((B2 - P/2) + P - 1)/P;      /* ceil */
+    maxj = (P + 1)/2;
+
+    /* giant step 0 only meets baby steps below B1 */
+    mmin = FLINT_MAX(mmin, 1);
+
+    TMP_START;
+    Qx   = TMP_ALLOC(sz * sizeof(mp_limb_t));
+    Qz   = TMP_ALLOC(sz * sizeof(mp_limb_t));
+    Rx   = TMP_ALLOC(sz * sizeof(mp_limb_t));
+    Rz   = TMP_ALLOC(sz * sizeof(mp_limb_t));
+    Sx   = TMP_ALLOC(sz * sizeof(mp_limb_t));
+    Sz   = TMP_ALLOC(sz * sizeof(mp_limb_t));
+    Tx   = TMP_ALLOC(sz * sizeof(mp_limb_t));
+    Tz   = TMP_ALLOC(sz * sizeof(mp_limb_t));
+    Q0x2 = TMP_ALLOC(sz * sizeof(mp_limb_t));
+    Q0z2 = TMP_ALLOC(sz * sizeof(mp_limb_t));
+    arrx = flint_malloc(((maxj >> 1) + 1) * sz * sizeof(mp_limb_t));
+    arrz = flint_malloc(((maxj >> 1) + 1) * sz * sizeof(mp_limb_t));
+
+    mpn_zero(arrx, ((maxj >> 1) + 1) * sz);
+    mpn_zero(arrz, ((maxj >> 1) + 1) * sz);
+    mpn_zero(Q0x2, sz);
+    mpn_zero(Q0z2, sz);
+
+    fmpz_init(N);
+    fmpz_init(g);
+    fmpz_init(d);
+
+    _fmpz_factor_ecm_get_fmpz(N, n, ecm_inf);
+
+    ret = 0;
+
+    /* baby steps jQ0 for odd j, stored in arr[j/2], as in stage II */
+
+    mpn_copyi(arrx, ecm_inf->x, sz);
+    mpn_copyi(arrz, ecm_inf->z, sz);
+
+    fmpz_factor_ecm_double(Q0x2, Q0z2, arrx, arrz, n, ecm_inf);
+
+    fmpz_factor_ecm_add(arrx + 1 * sz, arrz + 1 * sz,
+                         Q0x2, Q0z2, arrx, arrz, arrx, arrz, n, ecm_inf);
+
+    for (j = 2; j <= (maxj >> 1); j += 1)
+    {
+        fmpz_factor_ecm_add(arrx + j * sz, arrz + j * sz,
+                             arrx + (j - 1) * sz, arrz + (j - 1) * sz,
+                             Q0x2, Q0z2,
+                             arrx + (j - 2) * sz, arrz + (j - 2) * sz,
+                             n, ecm_inf);
+    }
+
+    /* F(X) = prod (X - x(jQ0)) over the j coprime to P */
+
+    for (j = 1, k = 0; j <= maxj; j += 2)
+        k += (ecm_inf->GCD_table[j] == 1);
+
+    bx = _fmpz_vec_init(k);
+    bz = _fmpz_vec_init(k);
+    F  = _fmpz_vec_init(k + 1);
+    gx = _fmpz_vec_init(k);
+    gz = _fmpz_vec_init(k);
+    ys = _fmpz_vec_init(k);
+
+    for (j = 1, l = 0; j <= maxj; j += 2)
+    {
+        if (ecm_inf->GCD_table[j] == 1)
+        {
+            _fmpz_factor_ecm_get_fmpz(bx + l, arrx + (j >> 1) * sz, ecm_inf);
+            _fmpz_factor_ecm_get_fmpz(bz + l, arrz + (j >> 1) * sz, ecm_inf);
+            l++;
+        }
+    }
+
+    if (!_fmpz_factor_ecm_normalise(bx, bz, k, d, N))
+        goto check;
+
+    _fmpz_mod_poly_product_roots_fmpz_vec(F, bx, k, N);
+
+    /* giant steps iQ for mmin <= i <= mmax, where Q = P * Q0, evaluated
+       at F in blocks of k points; x(iQ) = x(jQ0) mod p exactly when
+       iP + j or iP - j is a multiple of the order of Q0 mod p */
+
+    fmpz_factor_ecm_mul_montgomery_ladder(Qx, Qz, ecm_inf->x, ecm_inf->z,
+                                           P, n, ecm_inf);
+    fmpz_factor_ecm_mul_montgomery_ladder(Rx, Rz, Qx, Qz, mmin, n, ecm_inf);
+    fmpz_factor_ecm_mul_montgomery_ladder(Sx, Sz, Qx, Qz, mmin + 1, n, ecm_inf);
+
+    fmpz_one(g);
+
+    for (i = mmin; i <= mmax; )
+    {
+        len = FLINT_MIN((mp_limb_t) k, mmax - i + 1);
+
+        for (l = 0; l < len; l++, i++)
+        {
+            _fmpz_factor_ecm_get_fmpz(gx + l, Rx, ecm_inf);
+            _fmpz_factor_ecm_get_fmpz(gz + l, Rz, ecm_inf);
+
+            /* (R, S) = (S, S + Q), the difference being R */
+            fmpz_factor_ecm_add(Tx, Tz, Sx, Sz, Qx, Qz, Rx, Rz, n, ecm_inf);
+            mpn_copyi(Rx, Sx, sz);
+            mpn_copyi(Rz, Sz, sz);
+            mpn_copyi(Sx, Tx, sz);
+            mpn_copyi(Sz, Tz, sz);
+        }
+
+        if (!_fmpz_factor_ecm_normalise(gx, gz, len, d, N))
+            goto check;
+
+        _fmpz_mod_poly_evaluate_fmpz_vec_fast(ys, F, k + 1, gx, len, N);
+
+        for (l = 0; l < len; l++)
+        {
+            fmpz_mul(g, g, ys + l);
+            fmpz_mod(g, g, N);
+        }
+    }
+
+    fmpz_gcd(d, g, N);
+
+check:
+
+    /* a factor is found unless d is 1 or N, write it shifted to f */
+
+    if (!fmpz_is_one(d) && !fmpz_equal(d, N) && !fmpz_is_zero(d))
+    {
+        mpn_zero(f, sz);
+
+        if (!COEFF_IS_MPZ(*d))
+            f[0] = fmpz_get_ui(d);
+        else
+        {
+            __mpz_struct * m = COEFF_TO_PTR(*d);
+            mpn_copyi(f, m->_mp_d, m->_mp_size);
+        }
+
+        if (ecm_inf->normbits)
+            mpn_lshift(f, f, sz, ecm_inf->normbits);
+
+        MPN_NORM(f, sz);
+        ret = sz;
+    }
+
+    _fmpz_vec_clear(bx, k);
+    _fmpz_vec_clear(bz, k);
+    _fmpz_vec_clear(F, k + 1);
+    _fmpz_vec_clear(gx, k);
+    _fmpz_vec_clear(gz, k);
+    _fmpz_vec_clear(ys, k);
+
+    fmpz_clear(N);
+    fmpz_clear(g);
+    fmpz_clear(d);
+
+    TMP_END;
+
+    flint_free(arrx);
+    flint_free(arrz);
+
+    return ret;
+}
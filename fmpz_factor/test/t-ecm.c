@@ -12,6 +12,7 @@
 #include <gmp.h>
 #include "flint.h"
 #include "fmpz.h"
+#include "fmpz_factor.h"
 #include "ulong_extras.h"
 
 int main(void)
@@ -68,6 +69,51 @@ int main(void)
         abort();
     }
 
+    /* polynomial stage II, curves run in parallel */
+    fails = 0;
+
+    for (i = 40; i <= 60; i += 10)
+    {
+        for (j = 0; j < flint_test_multiplier(); j++)
+        {
+            flint_set_num_threads(n_randint(state, 4) + 1);
+
+            fmpz_set_ui(prime1, n_randprime(state, i, 1));
+            fmpz_set_ui(prime2, n_randprime(state, 60, 1));
+
+            fmpz_mul(primeprod, prime1, prime2);
+            fmpz_mul_ui(primeprod, primeprod, n_randprime(state, 60, 1));
+
+            k = fmpz_factor_ecm(fac, i, 1000, FMPZ_FACTOR_ECM_FFT_CUTOFF,
+                                state, primeprod);
+
+            if (k == 0)
+                fails += 1;
+            else
+            {
+                fmpz_mod(modval, primeprod, fac);
+                if (fmpz_cmp_ui(modval, 0) != 0 || fmpz_is_one(fac)
+                    || fmpz_equal(fac, primeprod))
+                {
+                    printf("FAIL : Wrong factor calculated (stage II fft)\n");
+                    printf("n : ");
+                    fmpz_print(primeprod);
+                    printf(" factor calculated : ");
+                    fmpz_print(fac);
+                    abort();
+                }
+            }
+        }
+    }
+
+    flint_set_num_threads(1);
+
+    if (fails > 2 * flint_test_multiplier())
+    {
+        printf("FAIL : ECM failed too many times (%d times, stage II fft)\n", fails);
+        abort();
+    }
+
     fmpz_clear(prime1);
     fmpz_clear(prime2);
     fmpz_clear(primeprod);
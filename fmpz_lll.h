@@ -160,6 +160,14 @@ FLINT_DLL void fmpz_lll(fmpz_mat_t B, fmpz_mat_t U, const fmpz_lll_t fl);
 
 FLINT_DLL int fmpz_lll_with_removal(fmpz_mat_t B, fmpz_mat_t U, const fmpz_t gs_B, const fmpz_lll_t fl);
 
+/* Size reduction  *********************************************************/
+
+/* size reductions of at least this many entry operations are split
+   across threads */
+#define FMPZ_LLL_SIZE_REDUCE_THREAD_CUTOFF 100000
+
+FLINT_DLL void _fmpz_lll_sub_lincomb_si(fmpz * v, fmpz * const * rows, const slong * x, slong j0, slong j1, slong len);
+
 /* Modified ULLL  ************************************************************/
 
 FLINT_DLL void fmpz_lll_storjohann_ulll(fmpz_mat_t FM, slong new_size, const fmpz_lll_t fl);
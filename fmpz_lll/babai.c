@@ -27,9 +27,14 @@ FUNC_HEAD
         slong xx;
         double tmp, rtmp, halfplus, onedothalfplus;
         ulong loops;
+        slong * X;
+        int pending = 0;
 
         aa = (a > zeros) ? a : zeros + 1;
 
+        /* the X_j of a pass are collected and applied to the row at once */
+        X = flint_calloc(LIMIT + 1, sizeof(slong));
+
         halfplus = (fl->eta + 0.5) / 2;
         onedothalfplus = 1.0 + halfplus;
 
@@ -97,6 +102,7 @@ FUNC_HEAD
                 }
                 if (new_max_expo > max_expo - SIZE_RED_FAILURE_THRESH)
                 {
+                    flint_free(X);
                     return -1;
                 }
                 max_expo = new_max_expo;
@@ -128,14 +134,8 @@ FUNC_HEAD
                                 d_mat_entry(mu, kappa, k) =
                                     d_mat_entry(mu, kappa, k) - tmp;
                             }
-                            _fmpz_vec_sub(B->rows[kappa], B->rows[kappa],
-                                          B->rows[j], n);
-                            if (U != NULL)
-                            {
-                                _fmpz_vec_sub(U->rows[kappa],
-                                              U->rows[kappa], U->rows[j],
-                                              U->c);
-                            }
+                            X[j] += 1;
+                            pending = 1;
                         }
                         else    /* otherwise X is -1 */
                         {
@@ -145,14 +145,8 @@ FUNC_HEAD
                                 d_mat_entry(mu, kappa, k) =
                                     d_mat_entry(mu, kappa, k) + tmp;
                             }
-                            _fmpz_vec_add(B->rows[kappa], B->rows[kappa],
-                                          B->rows[j], n);
-                            if (U != NULL)
-                            {
-                                _fmpz_vec_add(U->rows[kappa],
-                                              U->rows[kappa], U->rows[j],
-                                              U->c);
-                            }
+                            X[j] -= 1;
+                            pending = 1;
                         }
                     }
                     else        /* we must have |X| >= 2 */
@@ -174,15 +168,8 @@ FUNC_HEAD
                                     d_mat_entry(mu, kappa, k) - rtmp;
                             }
 
-                            xx = (slong) tmp;
-                            _fmpz_vec_scalar_submul_si(B->rows[kappa],
-                                                       B->rows[j], n, xx);
-                            if (U != NULL)
-                            {
-                                _fmpz_vec_scalar_submul_si(U->rows[kappa],
-                                                           U->rows[j],
-                                                           U->c, xx);
-                            }
+                            X[j] += (slong) tmp;
+                            pending = 1;
                         }
                         else
                         {
@@ -254,6 +241,19 @@ FUNC_HEAD
                 }
             }
 
+            if (pending)
+            {
+                _fmpz_lll_sub_lincomb_si(B->rows[kappa], B->rows, X,
+                                                     zeros + 1, LIMIT, n);
+                if (U != NULL)
+                    _fmpz_lll_sub_lincomb_si(U->rows[kappa], U->rows, X,
+                                                  zeros + 1, LIMIT, U->c);
+
+                for (j = zeros + 1; j < LIMIT; j++)
+                    X[j] = 0;
+                pending = 0;
+            }
+
             if (test)           /* Anything happened? */
             {
                 expo[kappa] =
@@ -291,6 +291,8 @@ FUNC_HEAD
             s[k + 1] = s[k] - tmp;
         }
 #endif
+
+        flint_free(X);
     }
     else
     {
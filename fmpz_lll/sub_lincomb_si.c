@@ -0,0 +1,130 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "fmpz_lll.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+    fmpz * v;
+    fmpz * const * rows;
+    const slong * x;
+    const slong * idx;
+    slong num;
+    slong c0;
+    slong c1;
+}
+_sub_lincomb_arg_t;
+
+/*
+   Column by column, the products of small entries are summed in three
+   limbs (two's complement) and only the total is subtracted from v.
+*/
+static void
+_fmpz_lll_sub_lincomb_si_range(_sub_lincomb_arg_t * arg)
+{
+    slong i, l;
+    fmpz_t s, t;
+
+    fmpz_init(s);
+    fmpz_init(t);
+
+    for (i = arg->c0; i < arg->c1; i++)
+    {
+        mp_limb_t a2 = 0, a1 = 0, a0 = 0, hi, lo;
+        int big = 0;
+
+        for (l = 0; l < arg->num; l++)
+        {
+            slong j = arg->idx[l];
+            fmpz c = arg->rows[j][i];
+
+            if (!COEFF_IS_MPZ(c))
+            {
+                smul_ppmm(hi, lo, c, arg->x[j]);
+                add_sssaaaaaa(a2, a1, a0, a2, a1, a0,
+                                     -(hi >> (FLINT_BITS - 1)), hi, lo);
+            }
+            else
+            {
+                if (!big)
+                    fmpz_zero(t);
+                big = 1;
+                if (arg->x[j] > 0)
+                    fmpz_addmul_ui(t, arg->rows[j] + i, arg->x[j]);
+                else
+                    fmpz_submul_ui(t, arg->rows[j] + i, -(ulong) arg->x[j]);
+            }
+        }
+
+        fmpz_set_signed_uiuiui(s, a2, a1, a0);
+        if (big)
+            fmpz_add(s, s, t);
+        fmpz_sub(arg->v + i, arg->v + i, s);
+    }
+
+    fmpz_clear(s);
+    fmpz_clear(t);
+}
+
+static void
+_fmpz_lll_sub_lincomb_si_worker(void * arg_ptr)
+{
+    _fmpz_lll_sub_lincomb_si_range((_sub_lincomb_arg_t *) arg_ptr);
+}
+
+void
+_fmpz_lll_sub_lincomb_si(fmpz * v, fmpz * const * rows, const slong * x,
+                                              slong j0, slong j1, slong len)
+{
+    _sub_lincomb_arg_t * args;
+    slong * idx;
+    slong i, num, num_threads;
+
+    idx = flint_malloc(sizeof(slong) * FLINT_MAX(j1 - j0, 1));
+
+    for (i = j0, num = 0; i < j1; i++)
+        if (x[i] != 0)
+            idx[num++] = i;
+
+    if (num == 0 || len <= 0)
+    {
+        flint_free(idx);
+        return;
+    }
+
+    num_threads = flint_get_num_threads();
+    if ((double) num * len < FMPZ_LLL_SIZE_REDUCE_THREAD_CUTOFF)
+        num_threads = 1;
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads, len / 16));
+
+    args = flint_malloc(sizeof(_sub_lincomb_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].v = v;
+        args[i].rows = rows;
+        args[i].x = x;
+        args[i].idx = idx;
+        args[i].num = num;
+        args[i].c0 = (len * i) / num_threads;
+        args[i].c1 = (len * (i + 1)) / num_threads;
+    }
+
+    if (num_threads == 1)
+        _fmpz_lll_sub_lincomb_si_range(args);
+    else
+        flint_parallel_do(_fmpz_lll_sub_lincomb_si_worker, args, num_threads,
+                                     sizeof(_sub_lincomb_arg_t), num_threads);
+
+    flint_free(args);
+    flint_free(idx);
+}
@@ -0,0 +1,98 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_lll.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("sub_lincomb_si....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        fmpz_mat_t A;
+        fmpz * v, * w;
+        slong * x;
+        slong r, len, j, j0, j1;
+
+        r = n_randint(state, 50) + 1;
+        len = n_randint(state, 50) + 1;
+
+        /* large enough to be split across threads */
+        if (n_randint(state, 20) == 0)
+        {
+            r = n_randint(state, 200) + 200;
+            len = n_randint(state, 500) + 500;
+        }
+
+        fmpz_mat_init(A, r, len);
+        v = _fmpz_vec_init(len);
+        w = _fmpz_vec_init(len);
+        x = flint_malloc(sizeof(slong) * r);
+
+        fmpz_mat_randtest(A, state, n_randint(state, 200) + 1);
+        _fmpz_vec_randtest(v, state, len, n_randint(state, 200) + 1);
+        _fmpz_vec_set(w, v, len);
+
+        j0 = n_randint(state, r);
+        j1 = j0 + n_randint(state, r - j0 + 1);
+
+        for (j = 0; j < r; j++)
+        {
+            if (n_randint(state, 3) == 0)
+                x[j] = 0;
+            else
+            {
+                x[j] = n_randtest_bits(state, n_randint(state, 53) + 1);
+                if (n_randint(state, 2))
+                    x[j] = -x[j];
+            }
+        }
+
+        for (j = j0; j < j1; j++)
+            _fmpz_vec_scalar_submul_si(w, A->rows[j], len, x[j]);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        _fmpz_lll_sub_lincomb_si(v, A->rows, x, j0, j1, len);
+
+        if (!_fmpz_vec_equal(v, w, len))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("r = %wd, len = %wd, j0 = %wd, j1 = %wd\n",
+                         r, len, j0, j1);
+            abort();
+        }
+
+        fmpz_mat_clear(A);
+        _fmpz_vec_clear(v, len);
+        _fmpz_vec_clear(w, len);
+        flint_free(x);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
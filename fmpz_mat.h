@@ -240,6 +240,9 @@ FLINT_DLL void fmpz_mat_mul_strassen(fmpz_mat_t C, const fmpz_mat_t A, const fmp
 FLINT_DLL void fmpz_mat_mul_classical_inline(fmpz_mat_t C, const fmpz_mat_t A,
     const fmpz_mat_t B);
 
+/* Maximum number of limbs used for the modular images of A, B and C */
+#define FMPZ_MAT_MUL_MULTI_MOD_BATCH_LIMBS (WORD(1) << 26)
+
 FLINT_DLL void _fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A,
     const fmpz_mat_t B, mp_bitcnt_t bits);
 
@@ -323,6 +326,19 @@ FLINT_DLL void fmpz_mat_det_modular(fmpz_t det, const fmpz_mat_t A, int proved);
 FLINT_DLL void fmpz_mat_det_modular_accelerated(fmpz_t det,
     const fmpz_mat_t A, int proved);
 
+/* minimum dimension for determinants modulo primes to be computed in parallel */
+#define FMPZ_MAT_DET_MODULAR_THREAD_CUTOFF 40
+
+/*
+   primes without change after which an unproved determinant is returned;
+   enough for their product, at least 2^NMOD_MAT_OPTIMAL_MODULUS_BITS per
+   prime, to exceed 100 bits
+*/
+#define FMPZ_MAT_DET_STABLE_PRIMES (100 / NMOD_MAT_OPTIMAL_MODULUS_BITS + 1)
+
+FLINT_DLL void _fmpz_mat_det_modular_given_divisor(fmpz_t det,
+        const fmpz_mat_t A, const fmpz_t d, slong stable);
+
 FLINT_DLL void fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
         const fmpz_t d, int proved);
 
@@ -10,6 +10,7 @@
 */
 
 #include "fmpz_mat.h"
+#include "thread_pool.h"
 
 /* Enable to exercise corner cases */
 #define DEBUG_USE_SMALL_PRIMES 0
@@ -30,13 +31,65 @@ next_good_prime(const fmpz_t d, mp_limb_t p)
 }
 
 
-void
-fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
-    const fmpz_t d, int proved)
+typedef struct
 {
-    fmpz_t bound, prod, stable_prod, x, xnew;
-    mp_limb_t p, xmod;
+    const fmpz_mat_struct * A;
+    mp_srcptr primes;
+    mp_srcptr dmod;
+    mp_ptr res;
+    slong i0;
+    slong i1;
+}
+_det_modular_arg_t;
+
+/* det(A) / d modulo primes i0, ..., i1 - 1 */
+static void
+_fmpz_mat_det_modular_range(_det_modular_arg_t * arg)
+{
+    slong i, n = arg->A->r;
     nmod_mat_t Amod;
+    mp_limb_t xmod;
+
+    nmod_mat_init(Amod, n, n, arg->primes[arg->i0]);
+
+    for (i = arg->i0; i < arg->i1; i++)
+    {
+        _nmod_mat_set_mod(Amod, arg->primes[i]);
+        fmpz_mat_get_nmod_mat(Amod, arg->A);
+
+        xmod = _nmod_mat_det(Amod);
+        arg->res[i] = n_mulmod2_preinv(xmod,
+            n_invmod(arg->dmod[i], arg->primes[i]), Amod->mod.n, Amod->mod.ninv);
+    }
+
+    nmod_mat_clear(Amod);
+}
+
+static void
+_fmpz_mat_det_modular_worker(void * arg_ptr)
+{
+    _fmpz_mat_det_modular_range((_det_modular_arg_t *) arg_ptr);
+}
+
+/*
+   The primes are taken in batches: the determinants modulo the primes of a
+   batch are computed in parallel and combined with a subproduct tree, the
+   result then being combined with the previous ones. When proved, every
+   batch but the last contains all the primes the bound says are still
+   needed. Otherwise batches have one prime per thread and we stop after
+   stable consecutive primes that did not change the result.
+*/
+void
+_fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
+    const fmpz_t d, slong stable)
+{
+    fmpz_t bound, prod, x, y, Q;
+    mp_ptr primes, dmod, res;
+    _det_modular_arg_t * args;
+    fmpz_comb_t comb;
+    fmpz_comb_temp_t comb_temp;
+    mp_limb_t p;
+    slong i, num, alloc, num_threads, max_threads, stable_primes;
     slong n = A->r;
 
     if (n == 0)
@@ -53,18 +106,28 @@ fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
 
     fmpz_init(bound);
     fmpz_init(prod);
-    fmpz_init(stable_prod);
     fmpz_init(x);
-    fmpz_init(xnew);
+    fmpz_init(y);
+    fmpz_init(Q);
 
     /* Bound x = det(A) / d */
     fmpz_mat_det_bound(bound, A);
     fmpz_mul_ui(bound, bound, UWORD(2));  /* accomodate sign */
     fmpz_cdiv_q(bound, bound, d);
 
-    nmod_mat_init(Amod, n, n, 2);
+    max_threads = flint_get_num_threads();
+    if (n < FMPZ_MAT_DET_MODULAR_THREAD_CUTOFF)
+        max_threads = 1;
+
+    alloc = max_threads;
+    primes = flint_malloc(sizeof(mp_limb_t) * alloc);
+    dmod = flint_malloc(sizeof(mp_limb_t) * alloc);
+    res = flint_malloc(sizeof(mp_limb_t) * alloc);
+    args = flint_malloc(sizeof(_det_modular_arg_t) * max_threads);
+
     fmpz_zero(x);
     fmpz_one(prod);
+    stable_primes = 0;
 
 #if DEBUG_USE_SMALL_PRIMES
     p = UWORD(1);
@@ -75,39 +138,97 @@ fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
     /* Compute x = det(A) / d */
     while (fmpz_cmp(prod, bound) <= 0)
     {
-        p = next_good_prime(d, p);
-        _nmod_mat_set_mod(Amod, p);
-        fmpz_mat_get_nmod_mat(Amod, A);
+        /* each further prime has at least this many bits */
+        num = (fmpz_bits(bound) - fmpz_bits(prod))
+                                / NMOD_MAT_OPTIMAL_MODULUS_BITS + 1;
+        if (stable != 0)
+            num = FLINT_MIN(num, max_threads);
 
-        /* Compute x = det(A) / d mod p */
-        xmod = _nmod_mat_det(Amod);
-        xmod = n_mulmod2_preinv(xmod,
-            n_invmod(fmpz_fdiv_ui(d, p), p), Amod->mod.n, Amod->mod.ninv);
+        if (num > alloc)
+        {
+            alloc = num;
+            primes = flint_realloc(primes, sizeof(mp_limb_t) * alloc);
+            dmod = flint_realloc(dmod, sizeof(mp_limb_t) * alloc);
+            res = flint_realloc(res, sizeof(mp_limb_t) * alloc);
+        }
+
+        for (i = 0; i < num; i++)
+        {
+            p = next_good_prime(d, p);
+            primes[i] = p;
+            dmod[i] = fmpz_fdiv_ui(d, p);
+        }
+
+        /* Compute x = det(A) / d mod p for each prime */
+        num_threads = FLINT_MIN(max_threads, num);
+
+        for (i = 0; i < num_threads; i++)
+        {
+            args[i].A = A;
+            args[i].primes = primes;
+            args[i].dmod = dmod;
+            args[i].res = res;
+            args[i].i0 = (num * i) / num_threads;
+            args[i].i1 = (num * (i + 1)) / num_threads;
+        }
+
+        if (num_threads == 1)
+            _fmpz_mat_det_modular_range(args);
+        else
+            flint_parallel_do(_fmpz_mat_det_modular_worker, args, num_threads,
+                                  sizeof(_det_modular_arg_t), num_threads);
 
-        fmpz_CRT_ui(xnew, x, prod, xmod, p, 1);
+        if (stable != 0 && !fmpz_is_one(prod))
+        {
+            for (i = 0; i < num; i++)
+                if (fmpz_fdiv_ui(x, primes[i]) != res[i])
+                    break;
+
+            stable_primes = (i == num) ? stable_primes + num : 0;
+        }
 
-        if (fmpz_equal(xnew, x))
+        fmpz_comb_init(comb, primes, num);
+        fmpz_comb_temp_init(comb_temp, comb);
+
+        if (fmpz_is_one(prod))
         {
-            fmpz_mul_ui(stable_prod, stable_prod, p);
-            if (!proved && fmpz_bits(stable_prod) > 100)
-                break;
+            fmpz_multi_CRT_ui(x, res, comb, comb_temp, 1);
+            fmpz_set(prod, comb->comb[comb->n - 1]);
         }
         else
         {
-            fmpz_set_ui(stable_prod, p);
+            /* the product of the batch is at the top of the tree */
+            fmpz_multi_CRT_ui(y, res, comb, comb_temp, 0);
+            fmpz_set(Q, comb->comb[comb->n - 1]);
+            fmpz_CRT(x, x, prod, y, Q, 1);
+            fmpz_mul(prod, prod, Q);
         }
 
-        fmpz_mul_ui(prod, prod, p);
-        fmpz_set(x, xnew);
+        fmpz_comb_temp_clear(comb_temp);
+        fmpz_comb_clear(comb);
+
+        if (stable != 0 && stable_primes >= stable)
+            break;
     }
 
     /* det(A) = x * d */
     fmpz_mul(det, x, d);
 
-    nmod_mat_clear(Amod);
+    flint_free(primes);
+    flint_free(dmod);
+    flint_free(res);
+    flint_free(args);
     fmpz_clear(bound);
     fmpz_clear(prod);
-    fmpz_clear(stable_prod);
     fmpz_clear(x);
-    fmpz_clear(xnew);
+    fmpz_clear(y);
+    fmpz_clear(Q);
+}
+
+void
+fmpz_mat_det_modular_given_divisor(fmpz_t det, const fmpz_mat_t A,
+    const fmpz_t d, int proved)
+{
+    _fmpz_mat_det_modular_given_divisor(det, A, d,
+                                   proved ? 0 : FMPZ_MAT_DET_STABLE_PRIMES);
 }
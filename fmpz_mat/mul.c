@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2010,2011 Fredrik Johansson
     Copyright (C) 2016 Aaditya Thakkar
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -31,6 +32,8 @@ fmpz_mat_mul(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
         return;
     }
 
+    FLINT_MEMSTATS_PUSH_TAG("fmpz_mat_mul");
+
     dim = FLINT_MIN(FLINT_MIN(m, n), k);
 
     if (dim < 12)
@@ -76,4 +79,6 @@ fmpz_mat_mul(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B)
             _fmpz_mat_mul_multi_mod(C, A, B, bits);
         }
     }
+
+    FLINT_MEMSTATS_POP_TAG();
 }
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2010 Fredrik Johansson
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -10,24 +11,159 @@
 */
 
 #include "fmpz_mat.h"
+#include "thread_pool.h"
+
+/*
+   Reduction of a block of rows of a matrix modulo the primes of comb
+   (crt = 0), or reconstruction of a block of rows from its images
+   (crt = 1). When P is set, the rows already hold values modulo P, the
+   product of the primes of earlier batches, and the values modulo the
+   primes of comb, whose product is Q, are combined with them. If sign
+   is set, the symmetric remainders modulo PQ are returned at the end.
+*/
+typedef struct
+{
+    fmpz_mat_struct * M;
+    nmod_mat_struct * mod_M;
+    slong r0;
+    slong r1;
+    const fmpz_comb_struct * comb;
+    int crt;
+    int sign;
+    const fmpz * P;
+    const fmpz * Pinv;      /* P^-1 mod Q */
+    const fmpz * Q;
+    const fmpz * PQ;
+}
+_multi_mod_arg_t;
+
+static void
+_fmpz_mat_multi_mod_rows(_multi_mod_arg_t * arg)
+{
+    slong i, j, k, c = arg->M->c, num_primes = arg->comb->num_primes;
+    mp_ptr * residues;
+    fmpz * t = NULL;
+    fmpz_t u;
+
+    if (c == 0)
+        return;
+
+    residues = flint_malloc(sizeof(mp_ptr) * num_primes);
+
+    if (arg->P != NULL)
+    {
+        t = _fmpz_vec_init(c);
+        fmpz_init(u);
+    }
+
+    for (i = arg->r0; i < arg->r1; i++)
+    {
+        fmpz * x = arg->M->rows[i];
+
+        for (k = 0; k < num_primes; k++)
+            residues[k] = arg->mod_M[k].rows[i];
+
+        if (!arg->crt)
+        {
+            _fmpz_vec_multi_mod_ui(residues, x, c, arg->comb);
+        }
+        else if (arg->P == NULL)
+        {
+            _fmpz_vec_multi_CRT_ui(x, residues, c, arg->comb, arg->sign);
+        }
+        else
+        {
+            _fmpz_vec_multi_CRT_ui(t, residues, c, arg->comb, 0);
+
+            /* x + P ((t - x) P^-1 mod Q) is t mod Q and x mod P */
+            for (j = 0; j < c; j++)
+            {
+                fmpz_sub(t + j, t + j, x + j);
+                fmpz_mul(t + j, t + j, arg->Pinv);
+                fmpz_mod(t + j, t + j, arg->Q);
+                fmpz_addmul(x + j, arg->P, t + j);
+
+                if (arg->sign)
+                {
+                    fmpz_mul_2exp(u, x + j, 1);
+                    if (fmpz_cmp(u, arg->PQ) > 0)
+                        fmpz_sub(x + j, x + j, arg->PQ);
+                }
+            }
+        }
+    }
+
+    if (arg->P != NULL)
+    {
+        _fmpz_vec_clear(t, c);
+        fmpz_clear(u);
+    }
+
+    flint_free(residues);
+}
+
+static void
+_fmpz_mat_multi_mod_worker(void * arg_ptr)
+{
+    _fmpz_mat_multi_mod_rows((_multi_mod_arg_t *) arg_ptr);
+}
+
+/* runs the rows of arg->M over the threads, the other fields are shared */
+static void
+_fmpz_mat_multi_mod_threaded(const _multi_mod_arg_t * arg, slong num_threads)
+{
+    _multi_mod_arg_t * args;
+    slong i, r = arg->M->r;
+
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads, r));
+
+    args = flint_malloc(sizeof(_multi_mod_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i] = *arg;
+        args[i].r0 = (r * i) / num_threads;
+        args[i].r1 = (r * (i + 1)) / num_threads;
+    }
+
+    flint_parallel_do(_fmpz_mat_multi_mod_worker, args, num_threads,
+                                     sizeof(_multi_mod_arg_t), num_threads);
+
+    flint_free(args);
+}
+
+/* Multiplication of the images modulo the primes p0 <= p < p1 */
+typedef struct
+{
+    nmod_mat_struct * mod_C;
+    nmod_mat_struct * mod_A;
+    nmod_mat_struct * mod_B;
+    slong p0;
+    slong p1;
+}
+_mul_arg_t;
+
+static void
+_fmpz_mat_mul_multi_mod_worker(void * arg_ptr)
+{
+    _mul_arg_t arg = *((_mul_arg_t *) arg_ptr);
+    slong i;
+
+    for (i = arg.p0; i < arg.p1; i++)
+        nmod_mat_mul(arg.mod_C + i, arg.mod_A + i, arg.mod_B + i);
+}
 
 void
 _fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B,
     mp_bitcnt_t bits)
 {
-    slong i, j, k;
-
-    fmpz_comb_t comb;
-    fmpz_comb_temp_t comb_temp;
-
-    slong num_primes;
+    slong i, j, num_primes, batch, num_threads, size;
     mp_bitcnt_t primes_bits;
     mp_limb_t * primes;
-    mp_limb_t * residues;
-
-    nmod_mat_t * mod_C;
-    nmod_mat_t * mod_A;
-    nmod_mat_t * mod_B;
+    fmpz_comb_t comb;
+    fmpz_t P, Pinv, Q, PQ;
+    nmod_mat_struct * mod_A, * mod_B, * mod_C;
+    _multi_mod_arg_t arg;
 
     primes_bits = NMOD_MAT_OPTIMAL_MODULUS_BITS;
 
@@ -42,76 +178,140 @@ _fmpz_mat_mul_multi_mod(fmpz_mat_t C, const fmpz_mat_t A, const fmpz_mat_t B,
         num_primes = (bits + primes_bits - 1) / primes_bits;
     }
 
+    num_threads = flint_get_num_threads();
+
+    /*
+       The images of A, B and C are only needed for the current batch of
+       primes, the images of C being folded into C by a partial CRT. Limit
+       their total size, but use at least one prime per thread when the cap
+       allows it.
+    */
+    size = A->r * A->c + B->r * B->c + C->r * C->c;
+    batch = num_primes;
+    if ((double) batch * size > FMPZ_MAT_MUL_MULTI_MOD_BATCH_LIMBS)
+    {
+        batch = FMPZ_MAT_MUL_MULTI_MOD_BATCH_LIMBS / FLINT_MAX(1, size);
+        if (batch >= num_threads)
+            batch -= batch % num_threads;
+        batch = FLINT_MAX(batch, 1);
+    }
+
     /* Initialize */
     primes = flint_malloc(sizeof(mp_limb_t) * num_primes);
     primes[0] = n_nextprime(UWORD(1) << primes_bits, 0);
     for (i = 1; i < num_primes; i++)
         primes[i] = n_nextprime(primes[i-1], 0);
 
-    residues = flint_malloc(sizeof(mp_limb_t) * num_primes);
+    mod_A = flint_malloc(sizeof(nmod_mat_struct) * batch);
+    mod_B = flint_malloc(sizeof(nmod_mat_struct) * batch);
+    mod_C = flint_malloc(sizeof(nmod_mat_struct) * batch);
+
+    fmpz_init_set_ui(P, 1);
+    fmpz_init(Pinv);
+    fmpz_init(Q);
+    fmpz_init(PQ);
 
-    mod_A = flint_malloc(sizeof(nmod_mat_t) * num_primes);
-    mod_B = flint_malloc(sizeof(nmod_mat_t) * num_primes);
-    mod_C = flint_malloc(sizeof(nmod_mat_t) * num_primes);
-    for (i = 0; i < num_primes; i++)
+    for (i = 0; i < num_primes; i += batch)
     {
-        nmod_mat_init(mod_A[i], A->r, A->c, primes[i]);
-        nmod_mat_init(mod_B[i], B->r, B->c, primes[i]);
-        nmod_mat_init(mod_C[i], C->r, C->c, primes[i]);
-    }
+        slong len = FLINT_MIN(batch, num_primes - i);
+
+        for (j = 0; j < len; j++)
+        {
+            nmod_mat_init(mod_A + j, A->r, A->c, primes[i + j]);
+            nmod_mat_init(mod_B + j, B->r, B->c, primes[i + j]);
+            nmod_mat_init(mod_C + j, C->r, C->c, primes[i + j]);
+        }
 
-    fmpz_comb_init(comb, primes, num_primes);
-    fmpz_comb_temp_init(comb_temp, comb);
+        fmpz_comb_init(comb, primes + i, len);
 
-    /* Calculate residues of A */
-    for (i = 0; i < A->r; i++)
-    {   for (j = 0; j < A->c; j++)
-        {   fmpz_multi_mod_ui(residues, &(A->rows[i][j]), comb, comb_temp);
-            for (k = 0; k < num_primes; k++)
-                mod_A[k]->rows[i][j] = residues[k];
+        arg.comb = comb;
+        arg.crt = 0;
+        arg.sign = 0;
+        arg.P = NULL;
+        arg.Pinv = arg.Q = arg.PQ = NULL;
+
+        /* Calculate residues of A and B */
+        arg.M = (fmpz_mat_struct *) A;
+        arg.mod_M = mod_A;
+        _fmpz_mat_multi_mod_threaded(&arg, num_threads);
+        arg.M = (fmpz_mat_struct *) B;
+        arg.mod_M = mod_B;
+        _fmpz_mat_multi_mod_threaded(&arg, num_threads);
+
+        /*
+           Multiply, one prime per task if there are enough of them; the
+           tasks are handed out dynamically by the thread pool.
+        */
+        if (num_threads > 1 && len >= num_threads)
+        {
+            _mul_arg_t * args;
+
+            args = flint_malloc(sizeof(_mul_arg_t) * len);
+
+            for (j = 0; j < len; j++)
+            {
+                args[j].mod_C = mod_C;
+                args[j].mod_A = mod_A;
+                args[j].mod_B = mod_B;
+                args[j].p0 = j;
+                args[j].p1 = j + 1;
+            }
+
+            flint_parallel_do(_fmpz_mat_mul_multi_mod_worker, args, len,
+                                             sizeof(_mul_arg_t), num_threads);
+
+            flint_free(args);
+        }
+        else
+        {
+            for (j = 0; j < len; j++)
+                nmod_mat_mul(mod_C + j, mod_A + j, mod_B + j);
         }
-    }
 
-    /* Calculate residues of B */
-    for (i = 0; i < B->r; i++)
-    {   for (j = 0; j < B->c; j++)
-        {   fmpz_multi_mod_ui(residues, &B->rows[i][j], comb, comb_temp);
-            for (k = 0; k < num_primes; k++)
-                mod_B[k]->rows[i][j] = residues[k];
+        for (j = 0; j < len; j++)
+        {
+            nmod_mat_clear(mod_A + j);
+            nmod_mat_clear(mod_B + j);
         }
-    }
 
-    /* Multiply */
-    for (i = 0; i < num_primes; i++)
-    {
-        nmod_mat_mul(mod_C[i], mod_A[i], mod_B[i]);
-    }
+        /* Chinese remaindering, combined with the earlier batches */
+        fmpz_set_ui(Q, 1);
+        for (j = 0; j < len; j++)
+            fmpz_mul_ui(Q, Q, primes[i + j]);
+
+        arg.M = C;
+        arg.mod_M = mod_C;
+        arg.crt = 1;
+        arg.sign = (i + len == num_primes);
 
-    /* Chinese remaindering */
-    for (i = 0; i < C->r; i++)
-    {   for (j = 0; j < C->c; j++)
-        {   for (k = 0; k < num_primes; k++)
-                residues[k] = mod_C[k]->rows[i][j];
-            fmpz_multi_CRT_ui(&C->rows[i][j], residues, comb, comb_temp, 1);
+        if (i != 0)
+        {
+            fmpz_invmod(Pinv, P, Q);
+            fmpz_mul(PQ, P, Q);
+            arg.P = P;
+            arg.Pinv = Pinv;
+            arg.Q = Q;
+            arg.PQ = PQ;
         }
+
+        _fmpz_mat_multi_mod_threaded(&arg, num_threads);
+
+        fmpz_comb_clear(comb);
+        fmpz_mul(P, P, Q);
+
+        for (j = 0; j < len; j++)
+            nmod_mat_clear(mod_C + j);
     }
 
     /* Cleanup */
-    for (i = 0; i < num_primes; i++)
-    {
-        nmod_mat_clear(mod_A[i]);
-        nmod_mat_clear(mod_B[i]);
-        nmod_mat_clear(mod_C[i]);
-    }
+    fmpz_clear(P);
+    fmpz_clear(Pinv);
+    fmpz_clear(Q);
+    fmpz_clear(PQ);
 
     flint_free(mod_A);
     flint_free(mod_B);
     flint_free(mod_C);
-
-    fmpz_comb_temp_clear(comb_temp);
-    fmpz_comb_clear(comb);
-
-    flint_free(residues);
     flint_free(primes);
 }
 
@@ -16,22 +16,23 @@ fmpz_mat_multi_CRT_ui_precomp(fmpz_mat_t mat,
     nmod_mat_t * const residues, slong nres,
     const fmpz_comb_t comb, fmpz_comb_temp_t temp, int sign)
 {
-    slong i, j, k;
-    mp_ptr r;
+    slong i, k;
+    mp_ptr * r;
 
-    r = _nmod_vec_init(nres);
+    if (fmpz_mat_is_empty(mat))
+        return;
+
+    r = flint_malloc(sizeof(mp_ptr) * nres);
 
     for (i = 0; i < fmpz_mat_nrows(mat); i++)
     {
-        for (j = 0; j < fmpz_mat_ncols(mat); j++)
-        {
-            for (k = 0; k < nres; k++)
-                r[k] = nmod_mat_entry(residues[k], i, j);
-            fmpz_multi_CRT_ui(fmpz_mat_entry(mat, i, j), r, comb, temp, sign);
-        }
+        for (k = 0; k < nres; k++)
+            r[k] = residues[k]->rows[i];
+
+        _fmpz_vec_multi_CRT_ui(mat->rows[i], r, fmpz_mat_ncols(mat), comb, sign);
     }
 
-    _nmod_vec_clear(r);
+    flint_free(r);
 }
 
 void
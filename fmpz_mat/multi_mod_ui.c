@@ -15,22 +15,23 @@ void
 fmpz_mat_multi_mod_ui_precomp(nmod_mat_t * residues, slong nres, 
     const fmpz_mat_t mat, const fmpz_comb_t comb, fmpz_comb_temp_t temp)
 {
-    slong i, j, k;
-    mp_ptr r;
+    slong i, k;
+    mp_ptr * r;
 
-    r = _nmod_vec_init(nres);
+    if (fmpz_mat_is_empty(mat))
+        return;
+
+    r = flint_malloc(sizeof(mp_ptr) * nres);
 
     for (i = 0; i < fmpz_mat_nrows(mat); i++)
     {
-        for (j = 0; j < fmpz_mat_ncols(mat); j++)
-        {
-            fmpz_multi_mod_ui(r, fmpz_mat_entry(mat, i, j), comb, temp);
-            for (k = 0; k < nres; k++)
-                nmod_mat_entry(residues[k], i, j) = r[k];
-        }
+        for (k = 0; k < nres; k++)
+            r[k] = residues[k]->rows[i];
+
+        _fmpz_vec_multi_mod_ui(r, mat->rows[i], fmpz_mat_ncols(mat), comb);
     }
 
-    _nmod_vec_clear(r);
+    flint_free(r);
 }
 
 void
@@ -10,6 +10,8 @@
 */
 
 #include "fmpz_mat.h"
+#include "fmpq.h"
+#include "thread_pool.h"
 
 static mp_limb_t
 find_good_prime_and_invert(nmod_mat_t Ainv,
@@ -87,6 +89,102 @@ mp_limb_t * get_crt_primes(slong * num_primes, const fmpz_mat_t A, mp_limb_t p)
 }
 
 
+typedef struct
+{
+    nmod_mat_t * Ay_mod;
+    nmod_mat_t * A_mod;
+    const nmod_mat_struct * y_mod;
+    mp_srcptr primes;
+    slong i0;
+    slong i1;
+}
+_dixon_residual_arg_t;
+
+/* Ay modulo primes i0, ..., i1 - 1, all the primes being >= p */
+static void
+_fmpz_mat_dixon_residual_worker(void * arg_ptr)
+{
+    _dixon_residual_arg_t * arg = (_dixon_residual_arg_t *) arg_ptr;
+    const nmod_mat_struct * y_mod = arg->y_mod;
+    nmod_mat_t y;
+    slong i;
+
+    nmod_mat_window_init(y, y_mod, 0, 0, y_mod->r, y_mod->c);
+
+    for (i = arg->i0; i < arg->i1; i++)
+    {
+        _nmod_mat_set_mod(y, arg->primes[i]);
+        nmod_mat_mul(arg->Ay_mod[i], arg->A_mod[i], y);
+    }
+
+    nmod_mat_window_clear(y);
+}
+
+/*
+   Checks whether the solution can already be recovered from
+   x = A^(-1) * B mod ppow. The entries are reconstructed in the same way
+   as by fmpq_mat_set_fmpz_mat_mod_fmpz, giving X = Xnum / d. As
+   A * Xnum = d * B mod ppow, this is an equality if both sides are less
+   than ppow / 2 in absolute value, which abits and bbits bound.
+*/
+static int
+_fmpz_mat_dixon_is_solved(const fmpz_mat_t x, const fmpz_t ppow,
+                                  mp_limb_t p, mp_bitcnt_t abits,
+                                  mp_bitcnt_t bbits)
+{
+    fmpz_mat_t num, den;
+    fmpz_t d, t, u;
+    mp_bitcnt_t bits = fmpz_bits(ppow), nbits = 0;
+    slong i, j;
+    int success = 1;
+
+    fmpz_mat_init(num, x->r, x->c);
+    fmpz_mat_init(den, x->r, x->c);
+    fmpz_init(d);
+    fmpz_init(t);
+    fmpz_init(u);
+
+    fmpz_one(d);
+
+    for (i = 0; i < x->r && success; i++)
+    {
+        for (j = 0; j < x->c && success; j++)
+        {
+            fmpz_mul(t, d, fmpz_mat_entry(x, i, j));
+            fmpz_fdiv_qr(u, t, t, ppow);
+
+            success = _fmpq_reconstruct_fmpz(fmpz_mat_entry(num, i, j),
+                                                            u, t, ppow);
+
+            fmpz_mul(d, d, u);
+            fmpz_set(fmpz_mat_entry(den, i, j), d);
+        }
+    }
+
+    /* the congruence needs d to be invertible */
+    success = success && fmpz_bits(d) + bbits + 3 < bits
+                      && fmpz_fdiv_ui(d, p) != 0;
+
+    for (i = 0; i < x->r && success; i++)
+    {
+        for (j = 0; j < x->c && success; j++)
+        {
+            fmpz_divexact(t, d, fmpz_mat_entry(den, i, j));
+            fmpz_mul(t, t, fmpz_mat_entry(num, i, j));
+            nbits = FLINT_MAX(nbits, fmpz_bits(t));
+            success = nbits + abits + 3 < bits;
+        }
+    }
+
+    fmpz_mat_clear(num);
+    fmpz_mat_clear(den);
+    fmpz_clear(d);
+    fmpz_clear(t);
+    fmpz_clear(u);
+
+    return success;
+}
+
 static void
 _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
                         const fmpz_mat_t A, const fmpz_mat_t B,
@@ -95,18 +193,20 @@ _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
 {
     fmpz_t bound, ppow;
     fmpz_mat_t x, d, y, Ay;
-    fmpz_t prod;
     mp_limb_t * crt_primes;
-    nmod_mat_t * A_mod;
-    nmod_mat_t Ay_mod, d_mod, y_mod;
-    slong i, n, cols, num_primes;
+    nmod_mat_t * A_mod, * Ay_mod;
+    nmod_mat_t d_mod, y_mod;
+    fmpz_comb_t comb;
+    fmpz_comb_temp_t comb_temp;
+    _dixon_residual_arg_t * args;
+    mp_bitcnt_t abits, bbits;
+    slong i, n, cols, num_primes, num_threads, steps, next_check;
 
     n = A->r;
     cols = B->c;
 
     fmpz_init(bound);
     fmpz_init(ppow);
-    fmpz_init(prod);
 
     fmpz_mat_init(x, n, cols);
     fmpz_mat_init(y, n, cols);
@@ -124,19 +224,43 @@ _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
         fmpz_mul(bound, N, N);
     fmpz_mul_ui(bound, bound, UWORD(2));  /* signs */
 
+    /* bits of n * max |A_ij| and max |B_ij|, for early termination */
+    abits = FLINT_ABS(fmpz_mat_max_bits(A)) + FLINT_BIT_COUNT(n);
+    bbits = FLINT_ABS(fmpz_mat_max_bits(B));
+
     crt_primes = get_crt_primes(&num_primes, A, p);
     A_mod = flint_malloc(sizeof(nmod_mat_t) * num_primes);
+    Ay_mod = flint_malloc(sizeof(nmod_mat_t) * num_primes);
     for (i = 0; i < num_primes; i++)
     {
         nmod_mat_init(A_mod[i], n, n, crt_primes[i]);
         fmpz_mat_get_nmod_mat(A_mod[i], A);
+        nmod_mat_init(Ay_mod[i], n, cols, crt_primes[i]);
     }
 
-    nmod_mat_init(Ay_mod, n, cols, UWORD(1));
     nmod_mat_init(d_mod, n, cols, p);
     nmod_mat_init(y_mod, n, cols, p);
 
+    fmpz_comb_init(comb, crt_primes, num_primes);
+    fmpz_comb_temp_init(comb_temp, comb);
+
+    /* the products modulo the primes are independent */
+    num_threads = FLINT_MAX(1, FLINT_MIN(flint_get_num_threads(), num_primes));
+    args = flint_malloc(sizeof(_dixon_residual_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].Ay_mod = Ay_mod;
+        args[i].A_mod = A_mod;
+        args[i].y_mod = y_mod;
+        args[i].primes = crt_primes;
+        args[i].i0 = (num_primes * i) / num_threads;
+        args[i].i1 = (num_primes * (i + 1)) / num_threads;
+    }
+
     fmpz_one(ppow);
+    steps = 0;
+    next_check = 4;
 
     while (fmpz_cmp(ppow, bound) <= 0)
     {
@@ -152,30 +276,30 @@ _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
         if (fmpz_cmp(ppow, bound) > 0)
             break;
 
+        /* stop as soon as the solution is small enough to be recovered */
+        if (++steps == next_check)
+        {
+            if (_fmpz_mat_dixon_is_solved(x, ppow, p, abits, bbits))
+                break;
+
+            next_check += FLINT_MAX(1, next_check / 4);
+        }
+
         /* d = (d - Ay) / p */
 #if USE_SLOW_MULTIPLICATION
         fmpz_mat_set_nmod_mat_unsigned(y, y_mod);
         fmpz_mat_mul(Ay, A, y);
 #else
-        for (i = 0; i < num_primes; i++)
-        {
-            _nmod_mat_set_mod(y_mod, crt_primes[i]);
-            _nmod_mat_set_mod(Ay_mod, crt_primes[i]);
-            nmod_mat_mul(Ay_mod, A_mod[i], y_mod);
-            if (i == 0)
-            {
-                fmpz_mat_set_nmod_mat(Ay, Ay_mod);
-                fmpz_set_ui(prod, crt_primes[0]);
-            }
-            else
-            {
-                fmpz_mat_CRT_ui(Ay, Ay, prod, Ay_mod, 1);
-                fmpz_mul_ui(prod, prod, crt_primes[i]);
-            }
-        }
+        if (num_threads == 1)
+            _fmpz_mat_dixon_residual_worker(args);
+        else
+            flint_parallel_do(_fmpz_mat_dixon_residual_worker, args,
+                   num_threads, sizeof(_dixon_residual_arg_t), num_threads);
+
+        fmpz_mat_multi_CRT_ui_precomp(Ay, Ay_mod, num_primes,
+                                                comb, comb_temp, 1);
 #endif
 
-        _nmod_mat_set_mod(y_mod, p);
         fmpz_mat_sub(d, d, Ay);
         fmpz_mat_scalar_divexact_ui(d, d, p);
     }
@@ -185,17 +309,23 @@ _fmpz_mat_solve_dixon(fmpz_mat_t X, fmpz_t mod,
 
     nmod_mat_clear(y_mod);
     nmod_mat_clear(d_mod);
-    nmod_mat_clear(Ay_mod);
 
     for (i = 0; i < num_primes; i++)
+    {
         nmod_mat_clear(A_mod[i]);
+        nmod_mat_clear(Ay_mod[i]);
+    }
+
+    fmpz_comb_temp_clear(comb_temp);
+    fmpz_comb_clear(comb);
 
+    flint_free(args);
     flint_free(A_mod);
+    flint_free(Ay_mod);
     flint_free(crt_primes);
 
     fmpz_clear(bound);
     fmpz_clear(ppow);
-    fmpz_clear(prod);
 
     fmpz_mat_clear(x);
     fmpz_mat_clear(y);
@@ -86,6 +86,41 @@ main(void)
         fmpz_clear(det2);
     }
 
+    /* large enough for the primes to be shared between threads */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        int proved = n_randlimb(state) % 2;
+        m = 40 + n_randint(state, 30);
+
+        fmpz_mat_init(A, m, m);
+
+        fmpz_init(det1);
+        fmpz_init(det2);
+
+        flint_set_num_threads(n_randint(state, 5) + 1);
+
+        fmpz_mat_randtest(A, state, 1+n_randint(state,100));
+
+        fmpz_mat_det_bareiss(det1, A);
+        fmpz_mat_det_modular(det2, A, proved);
+
+        if (!fmpz_equal(det1, det2))
+        {
+            flint_printf("FAIL (threads):\n");
+            flint_printf("different determinants!\n");
+            fmpz_mat_print_pretty(A), flint_printf("\n");
+            flint_printf("det1: "), fmpz_print(det1), flint_printf("\n");
+            flint_printf("det2: "), fmpz_print(det2), flint_printf("\n");
+            abort();
+        }
+
+        fmpz_clear(det1);
+        fmpz_clear(det2);
+        fmpz_mat_clear(A);
+    }
+
+    flint_set_num_threads(1);
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
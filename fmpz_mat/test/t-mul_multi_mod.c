@@ -48,6 +48,8 @@ int main(void)
         /* Make sure noise in the output is ok */
         fmpz_mat_randtest(C, state, n_randint(state, 200) + 1);
 
+        flint_set_num_threads(n_randint(state, 5) + 1);
+
         fmpz_mat_mul_classical_inline(C, A, B);
         fmpz_mat_mul_multi_mod(D, A, B);
 
@@ -63,6 +65,8 @@ int main(void)
         fmpz_mat_clear(D);
     }
 
+    flint_set_num_threads(1);
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
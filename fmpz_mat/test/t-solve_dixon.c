@@ -81,6 +81,51 @@ main(void)
         fmpz_clear(mod);
     }
 
+    /* Test systems with small solutions and many right hand sides */
+    for (i = 0; i < 20 * flint_test_multiplier(); i++)
+    {
+        fmpz_mat_t X0;
+
+        m = 1 + n_randint(state, 40);
+        n = 1 + n_randint(state, 60);
+
+        fmpz_mat_init(A, m, m);
+        fmpz_mat_init(B, m, n);
+        fmpz_mat_init(X, m, n);
+        fmpz_mat_init(X0, m, n);
+        fmpz_init(mod);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        fmpz_mat_randrank(A, state, m, 1+n_randint(state, 30));
+        fmpz_mat_randops(A, state, 1+n_randint(state, 1 + m*m));
+        fmpz_mat_randtest(X0, state, 1+n_randint(state, 20));
+        fmpz_mat_mul(B, A, X0);
+
+        success = fmpz_mat_solve_dixon(X, mod, A, B);
+
+        fmpz_mat_scalar_mod_fmpz(X0, X0, mod);
+
+        if (!success || !fmpz_mat_equal(X, X0))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("X != X0 mod p^k!\n");
+            flint_printf("A:\n"),      fmpz_mat_print_pretty(A),  flint_printf("\n");
+            flint_printf("B:\n"),      fmpz_mat_print_pretty(B),  flint_printf("\n");
+            flint_printf("X:\n"),      fmpz_mat_print_pretty(X),  flint_printf("\n");
+            flint_printf("mod = "),    fmpz_print(mod),           flint_printf("\n");
+            abort();
+        }
+
+        fmpz_mat_clear(A);
+        fmpz_mat_clear(B);
+        fmpz_mat_clear(X);
+        fmpz_mat_clear(X0);
+        fmpz_clear(mod);
+    }
+
+    flint_set_num_threads(1);
+
     /* Test singular systems */
     for (i = 0; i < 100 * flint_test_multiplier(); i++)
     {
@@ -481,6 +481,46 @@ FLINT_DLL int fmpz_mpoly_divrem_array(fmpz_mpoly_t q, fmpz_mpoly_t r,
                     const fmpz_mpoly_t poly2, const fmpz_mpoly_t poly3, 
                                                    const fmpz_mpoly_ctx_t ctx);
 
+/* Evaluation ****************************************************************/
+
+FLINT_DLL void fmpz_mpoly_evaluate_all_fmpz(fmpz_t ev, const fmpz_mpoly_t A,
+                               const fmpz * vals, const fmpz_mpoly_ctx_t ctx);
+
+FLINT_DLL void fmpz_mpoly_evaluate_all_nmod_vec(mp_ptr evals,
+                const fmpz_mpoly_t A, mp_srcptr vals, slong npoints,
+                                      nmod_t mod, const fmpz_mpoly_ctx_t ctx);
+
+FLINT_DLL mp_limb_t fmpz_mpoly_evaluate_all_nmod(const fmpz_mpoly_t A,
+                   mp_srcptr vals, nmod_t mod, const fmpz_mpoly_ctx_t ctx);
+
+FLINT_DLL void fmpz_mpoly_evaluate_one_fmpz(fmpz_mpoly_t A,
+                        const fmpz_mpoly_t B, slong var, const fmpz_t val,
+                                                   const fmpz_mpoly_ctx_t ctx);
+
+FLINT_DLL void fmpz_mpoly_compose(fmpz_mpoly_t A, const fmpz_mpoly_t B,
+                  fmpz_mpoly_struct * const * C, const fmpz_mpoly_ctx_t ctxB,
+                                                const fmpz_mpoly_ctx_t ctxAC);
+
+/* GCD ***********************************************************************/
+
+/* minimum length of the inputs for the images of a gcd to use threads */
+#define FMPZ_MPOLY_GCD_THREAD_CUTOFF 20
+
+/* inputs with a smaller proportion of nonzero terms use sparse interpolation */
+#define FMPZ_MPOLY_GCD_DENSITY_CUTOFF 0.1
+
+FLINT_DLL int _fmpz_mpoly_gcd_modular(fmpz_mpoly_t G, const fmpz_mpoly_t A,
+            const fmpz_mpoly_t B, const fmpz_mpoly_ctx_t ctx, int zippel);
+
+FLINT_DLL int fmpz_mpoly_gcd_brown(fmpz_mpoly_t G, const fmpz_mpoly_t A,
+                         const fmpz_mpoly_t B, const fmpz_mpoly_ctx_t ctx);
+
+FLINT_DLL int fmpz_mpoly_gcd_zippel(fmpz_mpoly_t G, const fmpz_mpoly_t A,
+                         const fmpz_mpoly_t B, const fmpz_mpoly_ctx_t ctx);
+
+FLINT_DLL int fmpz_mpoly_gcd(fmpz_mpoly_t G, const fmpz_mpoly_t A,
+                         const fmpz_mpoly_t B, const fmpz_mpoly_ctx_t ctx);
+
 /* Reduction *****************************************************************/
 
 FLINT_DLL slong
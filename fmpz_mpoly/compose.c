@@ -0,0 +1,164 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mpoly.h"
+
+void fmpz_mpoly_compose(fmpz_mpoly_t A, const fmpz_mpoly_t B,
+                  fmpz_mpoly_struct * const * C, const fmpz_mpoly_ctx_t ctxB,
+                                                 const fmpz_mpoly_ctx_t ctxAC)
+{
+    int deg, rev;
+    slong i, j, k, v, nvars, N, total;
+    slong * offsets, * shifts, * starts;
+    ulong * degs, e, mask;
+    int * full, used[FLINT_BITS];
+    fmpz_mpoly_struct * pows, sums[FLINT_BITS];
+    fmpz_mpoly_t T, U;
+    TMP_INIT;
+
+    if (B->length == 0)
+    {
+        fmpz_mpoly_zero(A, ctxAC);
+        return;
+    }
+
+    degrev_from_ord(deg, rev, ctxB->ord);
+    nvars = ctxB->n - deg;
+    N = words_per_exp(ctxB->n, B->bits);
+    mask = (-UWORD(1)) >> (FLINT_BITS - B->bits);
+
+    TMP_START;
+
+    offsets = (slong *) TMP_ALLOC(nvars*sizeof(slong));
+    shifts = (slong *) TMP_ALLOC(nvars*sizeof(slong));
+    starts = (slong *) TMP_ALLOC(nvars*sizeof(slong));
+    degs = (ulong *) TMP_ALLOC(nvars*sizeof(ulong));
+    full = (int *) TMP_ALLOC(nvars*sizeof(int));
+
+    total = 0;
+    for (v = 0; v < nvars; v++)
+    {
+        mpoly_gen_offset_shift(offsets + v, shifts + v, v,
+                                               B->bits, ctxB->n, deg, rev);
+        degs[v] = 0;
+        for (i = 0; i < B->length; i++)
+        {
+            e = (B->exps[N*i + offsets[v]] >> shifts[v]) & mask;
+            degs[v] = FLINT_MAX(degs[v], e);
+        }
+
+        full[v] = degs[v] < (ulong) B->length;
+        starts[v] = total;
+        total += full[v] ? degs[v] + 1 : FLINT_BIT_COUNT(degs[v]);
+    }
+
+    pows = (fmpz_mpoly_struct *) flint_malloc(
+                                         total*sizeof(fmpz_mpoly_struct));
+    for (k = 0; k < total; k++)
+        fmpz_mpoly_init(pows + k, ctxAC);
+
+    for (v = 0; v < nvars; v++)
+    {
+        fmpz_mpoly_struct * p = pows + starts[v];
+
+        if (full[v])
+        {
+            fmpz_mpoly_one(p + 0, ctxAC);
+            for (k = 1; k <= degs[v]; k++)
+                fmpz_mpoly_mul_johnson(p + k, p + k - 1, C[v], ctxAC);
+        } else
+        {
+            fmpz_mpoly_set(p + 0, C[v], ctxAC);
+            for (k = 1; k < FLINT_BIT_COUNT(degs[v]); k++)
+                fmpz_mpoly_mul_johnson(p + k, p + k - 1, p + k - 1, ctxAC);
+        }
+    }
+
+    fmpz_mpoly_init(T, ctxAC);
+    fmpz_mpoly_init(U, ctxAC);
+
+    /*
+        the images of the terms are summed with a binary counter of partial
+        sums, so that each addition is between polynomials of similar size
+    */
+    for (k = 0; k < FLINT_BITS; k++)
+    {
+        fmpz_mpoly_init(sums + k, ctxAC);
+        used[k] = 0;
+    }
+
+    for (i = 0; i < B->length; i++)
+    {
+        fmpz_mpoly_set_fmpz(T, B->coeffs + i, ctxAC);
+
+        for (v = 0; v < nvars; v++)
+        {
+            e = (B->exps[N*i + offsets[v]] >> shifts[v]) & mask;
+
+            if (e == 0)
+                continue;
+
+            if (full[v])
+            {
+                fmpz_mpoly_mul_johnson(U, T, pows + starts[v] + e, ctxAC);
+                fmpz_mpoly_swap(T, U, ctxAC);
+            } else
+            {
+                for (j = 0; e != 0; j++, e >>= 1)
+                {
+                    if (e & 1)
+                    {
+                        fmpz_mpoly_mul_johnson(U, T,
+                                               pows + starts[v] + j, ctxAC);
+                        fmpz_mpoly_swap(T, U, ctxAC);
+                    }
+                }
+            }
+        }
+
+        for (k = 0; used[k]; k++)
+        {
+            fmpz_mpoly_add(U, T, sums + k, ctxAC);
+            fmpz_mpoly_swap(T, U, ctxAC);
+            used[k] = 0;
+        }
+
+        fmpz_mpoly_swap(sums + k, T, ctxAC);
+        used[k] = 1;
+    }
+
+    fmpz_mpoly_zero(T, ctxAC);
+    for (k = 0; k < FLINT_BITS; k++)
+    {
+        if (used[k])
+        {
+            fmpz_mpoly_add(U, T, sums + k, ctxAC);
+            fmpz_mpoly_swap(T, U, ctxAC);
+        }
+
+        fmpz_mpoly_clear(sums + k, ctxAC);
+    }
+
+    /* T is local, so A may alias B or one of the C[v] */
+    fmpz_mpoly_swap(A, T, ctxAC);
+
+    fmpz_mpoly_clear(T, ctxAC);
+    fmpz_mpoly_clear(U, ctxAC);
+
+    for (k = 0; k < total; k++)
+        fmpz_mpoly_clear(pows + k, ctxAC);
+    flint_free(pows);
+
+    TMP_END;
+}
@@ -0,0 +1,127 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mpoly.h"
+
+void fmpz_mpoly_evaluate_all_fmpz(fmpz_t ev, const fmpz_mpoly_t A,
+                                const fmpz * vals, const fmpz_mpoly_ctx_t ctx)
+{
+    int deg, rev;
+    slong i, j, k, v, nvars, N, total;
+    slong * offsets, * shifts, * starts;
+    ulong * degs, e, mask;
+    int * full;
+    fmpz * pows;
+    fmpz_t s, t;
+    TMP_INIT;
+
+    if (A->length == 0)
+    {
+        fmpz_zero(ev);
+        return;
+    }
+
+    degrev_from_ord(deg, rev, ctx->ord);
+    nvars = ctx->n - deg;
+    N = words_per_exp(ctx->n, A->bits);
+    mask = (-UWORD(1)) >> (FLINT_BITS - A->bits);
+
+    TMP_START;
+
+    offsets = (slong *) TMP_ALLOC(nvars*sizeof(slong));
+    shifts = (slong *) TMP_ALLOC(nvars*sizeof(slong));
+    starts = (slong *) TMP_ALLOC(nvars*sizeof(slong));
+    degs = (ulong *) TMP_ALLOC(nvars*sizeof(ulong));
+    full = (int *) TMP_ALLOC(nvars*sizeof(int));
+
+    /* degree of each variable read directly from the packed exponents */
+    total = 0;
+    for (v = 0; v < nvars; v++)
+    {
+        mpoly_gen_offset_shift(offsets + v, shifts + v, v,
+                                                A->bits, ctx->n, deg, rev);
+        degs[v] = 0;
+        for (i = 0; i < A->length; i++)
+        {
+            e = (A->exps[N*i + offsets[v]] >> shifts[v]) & mask;
+            degs[v] = FLINT_MAX(degs[v], e);
+        }
+
+        /*
+            store every power if there are no more of them than terms,
+            otherwise only the repeated squares
+        */
+        full[v] = degs[v] < (ulong) A->length;
+        starts[v] = total;
+        total += full[v] ? degs[v] + 1 : FLINT_BIT_COUNT(degs[v]);
+    }
+
+    pows = _fmpz_vec_init(total);
+
+    for (v = 0; v < nvars; v++)
+    {
+        fmpz * p = pows + starts[v];
+
+        if (full[v])
+        {
+            fmpz_one(p + 0);
+            for (k = 1; k <= degs[v]; k++)
+                fmpz_mul(p + k, p + k - 1, vals + v);
+        } else
+        {
+            fmpz_set(p + 0, vals + v);
+            for (k = 1; k < FLINT_BIT_COUNT(degs[v]); k++)
+                fmpz_mul(p + k, p + k - 1, p + k - 1);
+        }
+    }
+
+    fmpz_init(s);
+    fmpz_init(t);
+
+    for (i = 0; i < A->length; i++)
+    {
+        fmpz_set(t, A->coeffs + i);
+
+        for (v = 0; v < nvars; v++)
+        {
+            e = (A->exps[N*i + offsets[v]] >> shifts[v]) & mask;
+
+            if (e == 0)
+                continue;
+
+            if (full[v])
+            {
+                fmpz_mul(t, t, pows + starts[v] + e);
+            } else
+            {
+                for (j = 0; e != 0; j++, e >>= 1)
+                {
+                    if (e & 1)
+                        fmpz_mul(t, t, pows + starts[v] + j);
+                }
+            }
+        }
+
+        fmpz_add(s, s, t);
+    }
+
+    fmpz_swap(ev, s);
+
+    fmpz_clear(s);
+    fmpz_clear(t);
+    _fmpz_vec_clear(pows, total);
+
+    TMP_END;
+}
@@ -0,0 +1,25 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mpoly.h"
+
+mp_limb_t fmpz_mpoly_evaluate_all_nmod(const fmpz_mpoly_t A,
+                    mp_srcptr vals, nmod_t mod, const fmpz_mpoly_ctx_t ctx)
+{
+    mp_limb_t ev;
+
+    fmpz_mpoly_evaluate_all_nmod_vec(&ev, A, vals, 1, mod, ctx);
+
+    return ev;
+}
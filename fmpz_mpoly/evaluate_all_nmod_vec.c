@@ -0,0 +1,161 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "nmod_vec.h"
+#include "fmpz_mpoly.h"
+
+/* multiply the running products t by the powers p, pointwise */
+static void _fmpz_mpoly_evaluate_mul(mp_ptr t, int * have, mp_srcptr p,
+                                                     slong len, nmod_t mod)
+{
+    slong j;
+
+    if (!*have)
+    {
+        flint_mpn_copyi(t, p, len);
+        *have = 1;
+        return;
+    }
+
+    for (j = 0; j < len; j++)
+        t[j] = nmod_mul(t[j], p[j], mod);
+}
+
+void fmpz_mpoly_evaluate_all_nmod_vec(mp_ptr evals, const fmpz_mpoly_t A,
+                            mp_srcptr vals, slong npoints, nmod_t mod,
+                                                   const fmpz_mpoly_ctx_t ctx)
+{
+    int deg, rev;
+    slong i, j, k, v, nvars, N, total;
+    slong * offsets, * shifts, * starts;
+    ulong * degs, e, mask;
+    int * full, have;
+    mp_ptr pows, t;
+    mp_limb_t c;
+    TMP_INIT;
+
+    _nmod_vec_zero(evals, npoints);
+
+    if (A->length == 0 || npoints == 0)
+        return;
+
+    degrev_from_ord(deg, rev, ctx->ord);
+    nvars = ctx->n - deg;
+    N = words_per_exp(ctx->n, A->bits);
+    mask = (-UWORD(1)) >> (FLINT_BITS - A->bits);
+
+    TMP_START;
+
+    offsets = (slong *) TMP_ALLOC(nvars*sizeof(slong));
+    shifts = (slong *) TMP_ALLOC(nvars*sizeof(slong));
+    starts = (slong *) TMP_ALLOC(nvars*sizeof(slong));
+    degs = (ulong *) TMP_ALLOC(nvars*sizeof(ulong));
+    full = (int *) TMP_ALLOC(nvars*sizeof(int));
+
+    total = 0;
+    for (v = 0; v < nvars; v++)
+    {
+        mpoly_gen_offset_shift(offsets + v, shifts + v, v,
+                                                A->bits, ctx->n, deg, rev);
+        degs[v] = 0;
+        for (i = 0; i < A->length; i++)
+        {
+            e = (A->exps[N*i + offsets[v]] >> shifts[v]) & mask;
+            degs[v] = FLINT_MAX(degs[v], e);
+        }
+
+        full[v] = degs[v] < (ulong) A->length;
+        starts[v] = total;
+        total += full[v] ? degs[v] + 1 : FLINT_BIT_COUNT(degs[v]);
+    }
+
+    /*
+        power k of variable v at point j is stored at
+        pows[(starts[v] + k)*npoints + j], so that each update of the
+        running products below runs over consecutive words
+    */
+    pows = (mp_ptr) flint_malloc(total*npoints*sizeof(mp_limb_t));
+    t = (mp_ptr) flint_malloc(npoints*sizeof(mp_limb_t));
+
+    for (v = 0; v < nvars; v++)
+    {
+        mp_ptr p = pows + starts[v]*npoints;
+
+        if (full[v])
+        {
+            for (j = 0; j < npoints; j++)
+                p[j] = 1 % mod.n;
+            for (k = 1; k <= degs[v]; k++)
+                for (j = 0; j < npoints; j++)
+                    p[k*npoints + j] = nmod_mul(p[(k - 1)*npoints + j],
+                                                     vals[j*nvars + v], mod);
+        } else
+        {
+            for (j = 0; j < npoints; j++)
+                p[j] = vals[j*nvars + v];
+            for (k = 1; k < FLINT_BIT_COUNT(degs[v]); k++)
+                for (j = 0; j < npoints; j++)
+                    p[k*npoints + j] = nmod_mul(p[(k - 1)*npoints + j],
+                                               p[(k - 1)*npoints + j], mod);
+        }
+    }
+
+    /*
+        a single pass over the terms updates all of the points, the
+        coefficient being applied by the vectorised scalar addmul
+    */
+    for (i = 0; i < A->length; i++)
+    {
+        c = fmpz_fdiv_ui(A->coeffs + i, mod.n);
+
+        if (c == 0)
+            continue;
+
+        have = 0;
+
+        for (v = 0; v < nvars; v++)
+        {
+            e = (A->exps[N*i + offsets[v]] >> shifts[v]) & mask;
+
+            if (full[v])
+            {
+                if (e != 0)
+                    _fmpz_mpoly_evaluate_mul(t, &have,
+                              pows + (starts[v] + e)*npoints, npoints, mod);
+            } else
+            {
+                for (k = 0; e != 0; k++, e >>= 1)
+                {
+                    if (e & 1)
+                        _fmpz_mpoly_evaluate_mul(t, &have,
+                              pows + (starts[v] + k)*npoints, npoints, mod);
+                }
+            }
+        }
+
+        if (have)
+        {
+            _nmod_vec_scalar_addmul_nmod(evals, t, npoints, c, mod);
+        } else
+        {
+            for (j = 0; j < npoints; j++)
+                evals[j] = nmod_add(evals[j], c, mod);
+        }
+    }
+
+    flint_free(t);
+    flint_free(pows);
+
+    TMP_END;
+}
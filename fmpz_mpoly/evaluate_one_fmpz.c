@@ -0,0 +1,173 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mpoly.h"
+
+/* sort perm so that the exponents it indexes are in descending order */
+static void _fmpz_mpoly_evaluate_one_sort(slong * perm, slong * tmp,
+       slong len, const ulong * exps, slong N, ulong maskhi, ulong masklo)
+{
+    slong i, j, k, half = len/2;
+
+    if (len < 2)
+        return;
+
+    _fmpz_mpoly_evaluate_one_sort(perm, tmp, half, exps, N, maskhi, masklo);
+    _fmpz_mpoly_evaluate_one_sort(perm + half, tmp, len - half,
+                                                    exps, N, maskhi, masklo);
+
+    for (i = 0, j = half, k = 0; i < half && j < len; k++)
+    {
+        if (mpoly_monomial_cmp(exps + N*perm[j], exps + N*perm[i],
+                                                     N, maskhi, masklo) > 0)
+            tmp[k] = perm[j++];
+        else
+            tmp[k] = perm[i++];
+    }
+
+    while (i < half)
+        tmp[k++] = perm[i++];
+    while (j < len)
+        tmp[k++] = perm[j++];
+
+    for (k = 0; k < len; k++)
+        perm[k] = tmp[k];
+}
+
+void fmpz_mpoly_evaluate_one_fmpz(fmpz_mpoly_t A, const fmpz_mpoly_t B,
+                      slong var, const fmpz_t val, const fmpz_mpoly_ctx_t ctx)
+{
+    int deg, rev, full;
+    slong i, j, k, len = B->length, N, offset, shift, npows;
+    ulong e, d, mask, maskhi, masklo;
+    slong * perm, * tmp;
+    ulong * texps;
+    fmpz * tcoeffs, * pows;
+    fmpz_mpoly_t R;
+    TMP_INIT;
+
+    if (len == 0)
+    {
+        fmpz_mpoly_zero(A, ctx);
+        return;
+    }
+
+    degrev_from_ord(deg, rev, ctx->ord);
+    N = words_per_exp(ctx->n, B->bits);
+    mask = (-UWORD(1)) >> (FLINT_BITS - B->bits);
+    masks_from_bits_ord(maskhi, masklo, B->bits, ctx->ord);
+
+    mpoly_gen_offset_shift(&offset, &shift, var, B->bits, ctx->n, deg, rev);
+
+    d = 0;
+    for (i = 0; i < len; i++)
+    {
+        e = (B->exps[N*i + offset] >> shift) & mask;
+        d = FLINT_MAX(d, e);
+    }
+
+    /* every power of val, or only its repeated squares if the degree is large */
+    full = d < (ulong) len;
+    npows = full ? d + 1 : FLINT_BIT_COUNT(d);
+    pows = _fmpz_vec_init(npows);
+
+    if (full)
+    {
+        fmpz_one(pows + 0);
+        for (k = 1; k < npows; k++)
+            fmpz_mul(pows + k, pows + k - 1, val);
+    } else
+    {
+        fmpz_set(pows + 0, val);
+        for (k = 1; k < npows; k++)
+            fmpz_mul(pows + k, pows + k - 1, pows + k - 1);
+    }
+
+    TMP_START;
+
+    texps = (ulong *) TMP_ALLOC(N*len*sizeof(ulong));
+    perm = (slong *) TMP_ALLOC(len*sizeof(slong));
+    tmp = (slong *) TMP_ALLOC(len*sizeof(slong));
+    tcoeffs = _fmpz_vec_init(len);
+
+    /*
+        substitute into each term: the field of var is cleared, and the
+        degree field, if any, is reduced by the same amount
+    */
+    for (i = 0; i < len; i++)
+    {
+        e = (B->exps[N*i + offset] >> shift) & mask;
+
+        mpoly_monomial_set(texps + N*i, B->exps + N*i, N);
+        texps[N*i + offset] -= e << shift;
+        if (deg)
+            texps[N*i + 0] -= e << (FLINT_BITS/B->bits - 1)*B->bits;
+
+        fmpz_set(tcoeffs + i, B->coeffs + i);
+
+        if (full)
+        {
+            if (e != 0)
+                fmpz_mul(tcoeffs + i, tcoeffs + i, pows + e);
+        } else
+        {
+            for (k = 0; e != 0; k++, e >>= 1)
+            {
+                if (e & 1)
+                    fmpz_mul(tcoeffs + i, tcoeffs + i, pows + k);
+            }
+        }
+
+        perm[i] = i;
+    }
+
+    _fmpz_mpoly_evaluate_one_sort(perm, tmp, len, texps, N, maskhi, masklo);
+
+    /* gather in sorted order, combining like terms */
+    fmpz_mpoly_init2(R, len, ctx);
+    fmpz_mpoly_fit_bits(R, B->bits, ctx);
+    R->bits = B->bits;
+
+    k = -1;
+    for (i = 0; i < len; i++)
+    {
+        j = perm[i];
+
+        if (k >= 0 && mpoly_monomial_equal(R->exps + N*k, texps + N*j, N))
+        {
+            fmpz_add(R->coeffs + k, R->coeffs + k, tcoeffs + j);
+        } else
+        {
+            if (k < 0 || !fmpz_is_zero(R->coeffs + k))
+                k++;
+
+            fmpz_swap(R->coeffs + k, tcoeffs + j);
+            mpoly_monomial_set(R->exps + N*k, texps + N*j, N);
+        }
+    }
+
+    if (k >= 0 && fmpz_is_zero(R->coeffs + k))
+        k--;
+
+    _fmpz_mpoly_set_length(R, k + 1, ctx);
+
+    fmpz_mpoly_swap(A, R, ctx);
+    fmpz_mpoly_clear(R, ctx);
+
+    _fmpz_vec_clear(tcoeffs, len);
+    _fmpz_vec_clear(pows, npows);
+
+    TMP_END;
+}
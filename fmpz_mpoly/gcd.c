@@ -0,0 +1,57 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mpoly.h"
+
+/* proportion of the monomials within the degree bounds which occur */
+static double _fmpz_mpoly_density(const fmpz_mpoly_t A,
+                                                   const fmpz_mpoly_ctx_t ctx)
+{
+    slong i;
+    int deg, rev;
+    double size = 1.0;
+    ulong * max_degs;
+    TMP_INIT;
+
+    TMP_START;
+    max_degs = (ulong *) TMP_ALLOC(ctx->n*sizeof(ulong));
+
+    degrev_from_ord(deg, rev, ctx->ord);
+    fmpz_mpoly_max_degrees(max_degs, A, ctx);
+
+    for (i = deg; i < ctx->n; i++)
+        size *= (double) max_degs[i] + 1.0;
+
+    TMP_END;
+
+    return A->length/size;
+}
+
+int fmpz_mpoly_gcd(fmpz_mpoly_t G, const fmpz_mpoly_t A,
+                         const fmpz_mpoly_t B, const fmpz_mpoly_ctx_t ctx)
+{
+    int zippel;
+
+    if (A->length == 0 || B->length == 0)
+        return fmpz_mpoly_gcd_brown(G, A, B, ctx);
+
+    /* sparse inputs usually have a sparse gcd */
+    zippel = _fmpz_mpoly_density(A, ctx) < FMPZ_MPOLY_GCD_DENSITY_CUTOFF &&
+             _fmpz_mpoly_density(B, ctx) < FMPZ_MPOLY_GCD_DENSITY_CUTOFF;
+
+    if (zippel)
+        return fmpz_mpoly_gcd_zippel(G, A, B, ctx);
+    else
+        return fmpz_mpoly_gcd_brown(G, A, B, ctx);
+}
@@ -0,0 +1,348 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mpoly.h"
+#include "nmod_mpoly.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+    mp_limb_t p;
+    nmod_mpoly_ctx_t ctx;
+    nmod_mpoly_t G;
+    const fmpz_mpoly_struct * A;
+    const fmpz_mpoly_struct * B;
+    const fmpz_mpoly_struct * form; /* NULL for dense interpolation */
+    const fmpz * gamma;
+    slong num_threads;
+    int success;
+}
+_fmpz_mpoly_gcd_image_arg_t;
+
+/*
+   The gcd of the images of A and B modulo p, scaled to have leading
+   coefficient gamma. If a form is given, sparse interpolation is tried
+   first, falling back to dense interpolation.
+*/
+static void _fmpz_mpoly_gcd_image_worker(void * arg_ptr)
+{
+    _fmpz_mpoly_gcd_image_arg_t * arg = (_fmpz_mpoly_gcd_image_arg_t *) arg_ptr;
+    nmod_mpoly_t a, b;
+    slong i, N;
+
+    nmod_mpoly_init(a, arg->ctx);
+    nmod_mpoly_init(b, arg->ctx);
+    nmod_mpoly_set_fmpz_mpoly(a, arg->A, arg->ctx);
+    nmod_mpoly_set_fmpz_mpoly(b, arg->B, arg->ctx);
+
+    arg->success = 0;
+
+    if (arg->form != NULL)
+    {
+        const fmpz_mpoly_struct * H = arg->form;
+        nmod_mpoly_t S;
+        flint_rand_t state;
+
+        nmod_mpoly_init2(S, H->length, arg->ctx);
+        nmod_mpoly_fit_bits(S, H->bits, arg->ctx);
+        S->bits = H->bits;
+        N = words_per_exp(arg->ctx->n, H->bits);
+        for (i = 0; i < H->length; i++)
+        {
+            S->coeffs[i] = 1;
+            mpoly_monomial_set(S->exps + N*i, H->exps + N*i, N);
+        }
+        _nmod_mpoly_set_length(S, H->length, arg->ctx);
+
+        flint_randinit(state);
+        flint_randseed(state, arg->p, arg->p ^ UWORD(0x5851f42d4c957f2d));
+
+        arg->success = _nmod_mpoly_gcd_zippel(arg->G, a, b, S, arg->ctx,
+                                                     state, arg->num_threads);
+
+        flint_randclear(state);
+        nmod_mpoly_clear(S, arg->ctx);
+    }
+
+    if (!arg->success)
+        arg->success = _nmod_mpoly_gcd_brown(arg->G, a, b, arg->ctx,
+                                                            arg->num_threads);
+
+    if (arg->success)
+        nmod_mpoly_scalar_mul_ui(arg->G, arg->G,
+                              fmpz_fdiv_ui(arg->gamma, arg->p), arg->ctx);
+
+    nmod_mpoly_clear(a, arg->ctx);
+    nmod_mpoly_clear(b, arg->ctx);
+}
+
+/*
+   Set H to the combination of H modulo M and G modulo p, with coefficients
+   in the symmetric range. Both must have the same exponent fields. Returns
+   whether H changed.
+*/
+static int _fmpz_mpoly_gcd_crt(fmpz_mpoly_t H, const fmpz_t M,
+               const nmod_mpoly_t G, mp_limb_t p, const fmpz_mpoly_ctx_t ctx)
+{
+    slong i, j, k, N;
+    ulong maskhi, masklo;
+    int cmp, changed = 0;
+    fmpz_t zero;
+    fmpz_mpoly_t T;
+
+    fmpz_init(zero);
+    fmpz_mpoly_init2(T, H->length + G->length, ctx);
+    fmpz_mpoly_fit_bits(T, H->bits, ctx);
+    T->bits = H->bits;
+
+    N = words_per_exp(ctx->n, H->bits);
+    masks_from_bits_ord(maskhi, masklo, H->bits, ctx->ord);
+
+    for (i = j = k = 0; i < H->length || j < G->length; )
+    {
+        if (i >= H->length)
+            cmp = -1;
+        else if (j >= G->length)
+            cmp = 1;
+        else
+            cmp = mpoly_monomial_cmp(H->exps + N*i, G->exps + N*j,
+                                                           N, maskhi, masklo);
+
+        if (cmp > 0)
+        {
+            fmpz_CRT_ui(T->coeffs + k, H->coeffs + i, M, 0, p, 1);
+            mpoly_monomial_set(T->exps + N*k, H->exps + N*i, N);
+            changed |= !fmpz_equal(T->coeffs + k, H->coeffs + i);
+            i++;
+        } else if (cmp < 0)
+        {
+            fmpz_CRT_ui(T->coeffs + k, zero, M, G->coeffs[j], p, 1);
+            mpoly_monomial_set(T->exps + N*k, G->exps + N*j, N);
+            changed = 1;
+            j++;
+        } else
+        {
+            fmpz_CRT_ui(T->coeffs + k, H->coeffs + i, M, G->coeffs[j], p, 1);
+            mpoly_monomial_set(T->exps + N*k, H->exps + N*i, N);
+            changed |= !fmpz_equal(T->coeffs + k, H->coeffs + i);
+            i++;
+            j++;
+        }
+
+        k += !fmpz_is_zero(T->coeffs + k);
+    }
+
+    _fmpz_mpoly_set_length(T, k, ctx);
+    fmpz_mpoly_swap(H, T, ctx);
+
+    fmpz_mpoly_clear(T, ctx);
+    fmpz_clear(zero);
+
+    return changed;
+}
+
+/* whether the primitive part of H, written to T, divides A and B */
+static int _fmpz_mpoly_gcd_check(fmpz_mpoly_t T, const fmpz_mpoly_t H,
+      const fmpz_mpoly_t A, const fmpz_mpoly_t B, const fmpz_mpoly_ctx_t ctx)
+{
+    int res;
+    fmpz_t c;
+    fmpz_mpoly_t Q;
+
+    fmpz_init(c);
+    fmpz_mpoly_init(Q, ctx);
+
+    _fmpz_vec_content(c, H->coeffs, H->length);
+    if (fmpz_sgn(H->coeffs + 0) < 0)
+        fmpz_neg(c, c);
+    fmpz_mpoly_scalar_divexact_fmpz(T, H, c, ctx);
+
+    res = fmpz_mpoly_divides_monagan_pearce(Q, A, T, ctx) &&
+          fmpz_mpoly_divides_monagan_pearce(Q, B, T, ctx);
+
+    fmpz_mpoly_clear(Q, ctx);
+    fmpz_clear(c);
+
+    return res;
+}
+
+int _fmpz_mpoly_gcd_modular(fmpz_mpoly_t G, const fmpz_mpoly_t A,
+           const fmpz_mpoly_t B, const fmpz_mpoly_ctx_t ctx, int zippel)
+{
+    slong i, nb, batch, nvars, N, bits;
+    ulong maskhi, masklo;
+    mp_limb_t p;
+    int deg, rev, have, changed, done = 0, cmp;
+    fmpz_t cA, cB, d, gamma, l, M;
+    fmpz_mpoly_t Ap, Bp, H, T;
+    _fmpz_mpoly_gcd_image_arg_t * args;
+
+    if (A->length == 0 || B->length == 0)
+    {
+        if (A->length == 0)
+            fmpz_mpoly_set(G, B, ctx);
+        else
+            fmpz_mpoly_set(G, A, ctx);
+
+        if (G->length != 0 && fmpz_sgn(G->coeffs + 0) < 0)
+            fmpz_mpoly_neg(G, G, ctx);
+        return 1;
+    }
+
+    degrev_from_ord(deg, rev, ctx->ord);
+    nvars = ctx->n - deg;
+
+    fmpz_init(cA);
+    fmpz_init(cB);
+    fmpz_init(d);
+    fmpz_init(gamma);
+    fmpz_init(l);
+    fmpz_init(M);
+    fmpz_mpoly_init(Ap, ctx);
+    fmpz_mpoly_init(Bp, ctx);
+    fmpz_mpoly_init(H, ctx);
+    fmpz_mpoly_init(T, ctx);
+
+    /* remove integer contents */
+    _fmpz_vec_content(cA, A->coeffs, A->length);
+    _fmpz_vec_content(cB, B->coeffs, B->length);
+    fmpz_gcd(d, cA, cB);
+    fmpz_mpoly_scalar_divexact_fmpz(Ap, A, cA, ctx);
+    fmpz_mpoly_scalar_divexact_fmpz(Bp, B, cB, ctx);
+
+    /* the leading coefficient of the gcd divides gamma */
+    fmpz_gcd(gamma, Ap->coeffs + 0, Bp->coeffs + 0);
+    fmpz_mul(l, Ap->coeffs + 0, Bp->coeffs + 0);
+
+    batch = flint_get_num_threads();
+    if (FLINT_MIN(A->length, B->length) < FMPZ_MPOLY_GCD_THREAD_CUTOFF)
+        batch = 1;
+
+    args = (_fmpz_mpoly_gcd_image_arg_t *) flint_malloc(
+                                batch*sizeof(_fmpz_mpoly_gcd_image_arg_t));
+    for (i = 0; i < batch; i++)
+    {
+        args[i].A = Ap;
+        args[i].B = Bp;
+        args[i].gamma = gamma;
+        nmod_mpoly_ctx_init(args[i].ctx, nvars, ctx->ord, 2);
+        nmod_mpoly_init(args[i].G, args[i].ctx);
+    }
+
+    have = 0;
+    p = UWORD(1) << (FLINT_BITS - 1);
+
+    while (!done)
+    {
+        /*
+           The first image uses the threads on its evaluation points, the
+           following ones are computed a batch of primes at a time.
+        */
+        nb = have ? batch : 1;
+
+        for (i = 0; i < nb; )
+        {
+            p = n_nextprime(p, 1);
+            if (fmpz_fdiv_ui(l, p) == 0)
+                continue;
+
+            args[i].p = p;
+            nmod_mpoly_ctx_init(args[i].ctx, nvars, ctx->ord, p);
+            args[i].form = (zippel && have) ? H : NULL;
+            args[i].num_threads = have ? 1 : batch;
+            i++;
+        }
+
+        if (nb == 1)
+            _fmpz_mpoly_gcd_image_worker(args);
+        else
+            flint_parallel_do(_fmpz_mpoly_gcd_image_worker, args, nb,
+                                  sizeof(_fmpz_mpoly_gcd_image_arg_t), nb);
+
+        for (i = 0; i < nb && !done; i++)
+        {
+            nmod_mpoly_struct * Gp = args[i].G;
+
+            if (!args[i].success)
+                continue;
+
+            N = words_per_exp(ctx->n, Gp->bits);
+
+            /* the primitive parts are coprime */
+            if (Gp->length == 1 && mpoly_monomial_is_zero(Gp->exps, N))
+            {
+                fmpz_mpoly_set_fmpz(G, d, ctx);
+                done = 1;
+                break;
+            }
+
+            /* compare leading monomials with the same exponent fields */
+            bits = FLINT_MAX(H->bits, Gp->bits);
+            fmpz_mpoly_fit_bits(H, bits, ctx);
+            nmod_mpoly_fit_bits(Gp, bits, args[i].ctx);
+
+            if (have)
+            {
+                N = words_per_exp(ctx->n, bits);
+                masks_from_bits_ord(maskhi, masklo, bits, ctx->ord);
+
+                cmp = mpoly_monomial_cmp(Gp->exps, H->exps, N, maskhi, masklo);
+                if (cmp > 0) /* unlucky prime */
+                    continue;
+                if (cmp < 0) /* all previous primes were unlucky */
+                    have = 0;
+            }
+
+            if (!have)
+            {
+                fmpz_mpoly_zero(H, ctx);
+                fmpz_one(M);
+            }
+
+            changed = _fmpz_mpoly_gcd_crt(H, M, Gp, args[i].p, ctx);
+            fmpz_mul_ui(M, M, args[i].p);
+
+            /* try the division when the combination is new or stable */
+            if ((!have || !changed) && _fmpz_mpoly_gcd_check(T, H, Ap, Bp, ctx))
+            {
+                fmpz_mpoly_scalar_mul_fmpz(G, T, d, ctx);
+                done = 1;
+            }
+
+            have = 1;
+        }
+    }
+
+    for (i = 0; i < batch; i++)
+    {
+        nmod_mpoly_clear(args[i].G, args[i].ctx);
+        nmod_mpoly_ctx_clear(args[i].ctx);
+    }
+    flint_free(args);
+
+    fmpz_clear(cA);
+    fmpz_clear(cB);
+    fmpz_clear(d);
+    fmpz_clear(gamma);
+    fmpz_clear(l);
+    fmpz_clear(M);
+    fmpz_mpoly_clear(Ap, ctx);
+    fmpz_mpoly_clear(Bp, ctx);
+    fmpz_mpoly_clear(H, ctx);
+    fmpz_mpoly_clear(T, ctx);
+
+    return 1;
+}
@@ -17,6 +17,7 @@
 #include "flint.h"
 #include "fmpz.h"
 #include "fmpz_mpoly.h"
+#include "thread_pool.h"
 
 
 /*
@@ -537,7 +538,7 @@ mul_heap_threaded_arg_t;
     The workers simply take the next available division and calculate all
     product terms in this division.
 */
-void * _fmpz_mpoly_mul_heap_threaded_worker(void * arg_ptr)
+static void _fmpz_mpoly_mul_heap_threaded_worker(void * arg_ptr)
 {
     mul_heap_threaded_arg_t * arg = (mul_heap_threaded_arg_t *) arg_ptr;
 
@@ -582,8 +583,6 @@ void * _fmpz_mpoly_mul_heap_threaded_worker(void * arg_ptr)
         base->idx = i;
         pthread_mutex_unlock(&base->mutex);
     }
-    flint_cleanup();
-    return NULL;
 }
 
 
@@ -596,16 +595,18 @@ slong _fmpz_mpoly_mul_heap_threaded(fmpz ** poly1, ulong ** exp1, slong * alloc,
                  const fmpz * coeff3, const ulong * exp3, slong len3,
                                            slong N, ulong maskhi, ulong masklo)
 {
-    slong i, j, k, ndivs2;
-    pthread_t * threads;
+    slong i, j, k, ndivs2, num_handles;
+    thread_pool_handle * handles;
     mul_heap_threaded_arg_t * args;
     mul_heap_threaded_base_t * base;
     mul_heap_threaded_div_t * divs;
     fmpz * p1;
     ulong * e1;
 
+    num_handles = flint_request_threads(&handles, flint_get_num_threads());
+
     base = flint_malloc(sizeof(mul_heap_threaded_base_t));
-    base->nthreads = flint_get_num_threads();
+    base->nthreads = num_handles + 1;
     base->ndivs    = base->nthreads*4;  /* number of divisons */
     base->coeff2 = coeff2;
     base->exp2 = exp2;
@@ -621,7 +622,6 @@ slong _fmpz_mpoly_mul_heap_threaded(fmpz ** poly1, ulong ** exp1, slong * alloc,
     ndivs2 = base->ndivs*base->ndivs;
 
     divs    = flint_malloc(sizeof(mul_heap_threaded_div_t) * base->ndivs);
-    threads = flint_malloc(sizeof(pthread_t) * base->nthreads);
     args    = flint_malloc(sizeof(mul_heap_threaded_arg_t) * base->nthreads);
 
     for (i = base->ndivs - 1; i >= 0; i--)
@@ -677,13 +677,17 @@ slong _fmpz_mpoly_mul_heap_threaded(fmpz ** poly1, ulong ** exp1, slong * alloc,
         args[i].idx = i;
         args[i].basep = base;
         args[i].divp = divs;
-        pthread_create(&threads[i], NULL, _fmpz_mpoly_mul_heap_threaded_worker,
-                                                                     &args[i]);
     }
-    for (i = 0; i < base->nthreads; i++)
-        pthread_join(threads[i], NULL);
+    for (i = 0; i < num_handles; i++)
+        thread_pool_wake(global_thread_pool, handles[i], 0,
+                         _fmpz_mpoly_mul_heap_threaded_worker, &args[i + 1]);
+    _fmpz_mpoly_mul_heap_threaded_worker(&args[0]);
+    for (i = 0; i < num_handles; i++)
+        thread_pool_wait(global_thread_pool, handles[i]);
     pthread_mutex_destroy(&base->mutex);
 
+    flint_give_back_threads(handles, num_handles);
+
     /* concatenate the outputs */ 
     k = 0; /* avoid bogus warning */
     for (i = base->ndivs - 1; i >= 0; i--)
@@ -720,7 +724,6 @@ slong _fmpz_mpoly_mul_heap_threaded(fmpz ** poly1, ulong ** exp1, slong * alloc,
     }
 
     flint_free(args);
-    flint_free(threads);
     flint_free(divs);
     flint_free(base);
 
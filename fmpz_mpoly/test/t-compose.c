@@ -0,0 +1,181 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mpoly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("compose....");
+    fflush(stdout);
+
+    /* Check composition followed by evaluation is evaluation at the
+       evaluated composing polynomials */
+    for (i = 0; i < 300 * flint_test_multiplier(); i++)
+    {
+       fmpz_mpoly_ctx_t ctx1, ctx2;
+       fmpz_mpoly_t f, g;
+       fmpz_mpoly_struct * C, ** Cp;
+       fmpz * vals1, * vals2;
+       fmpz_t fe, ge;
+       ordering_t ord1, ord2;
+       slong j, nvars1, nvars2, len, len2, exp_bound, exp_bound2;
+
+       ord1 = mpoly_ordering_randtest(state);
+       ord2 = mpoly_ordering_randtest(state);
+       nvars1 = n_randint(state, 4) + 1;
+       nvars2 = n_randint(state, 4) + 1;
+
+       fmpz_mpoly_ctx_init(ctx1, nvars1, ord1);
+       fmpz_mpoly_ctx_init(ctx2, nvars2, ord2);
+
+       fmpz_mpoly_init(f, ctx1);
+       fmpz_mpoly_init(g, ctx2);
+       fmpz_init(fe);
+       fmpz_init(ge);
+       vals1 = _fmpz_vec_init(nvars1);
+       vals2 = _fmpz_vec_init(nvars2);
+
+       C = (fmpz_mpoly_struct *) flint_malloc(
+                                      nvars1*sizeof(fmpz_mpoly_struct));
+       Cp = (fmpz_mpoly_struct **) flint_malloc(
+                                      nvars1*sizeof(fmpz_mpoly_struct *));
+
+       len = n_randint(state, 15);
+       len2 = n_randint(state, 5) + 1;
+       exp_bound = n_randint(state, 6) + 1;
+       exp_bound2 = n_randint(state, 4) + 1;
+
+       fmpz_mpoly_randtest(f, state, len, exp_bound, 20, ctx1);
+
+       for (j = 0; j < nvars1; j++)
+       {
+          fmpz_mpoly_init(C + j, ctx2);
+          fmpz_mpoly_randtest(C + j, state, len2, exp_bound2, 10, ctx2);
+          Cp[j] = C + j;
+       }
+
+       fmpz_mpoly_compose(g, f, Cp, ctx1, ctx2);
+       fmpz_mpoly_test(g, ctx2);
+
+       _fmpz_vec_randtest(vals2, state, nvars2, 10);
+
+       for (j = 0; j < nvars1; j++)
+          fmpz_mpoly_evaluate_all_fmpz(vals1 + j, C + j, vals2, ctx2);
+
+       fmpz_mpoly_evaluate_all_fmpz(fe, f, vals1, ctx1);
+       fmpz_mpoly_evaluate_all_fmpz(ge, g, vals2, ctx2);
+
+       result = fmpz_equal(fe, ge);
+
+       if (!result)
+       {
+          printf("FAIL\n");
+          printf("ord1 = "); mpoly_ordering_print(ord1);
+          printf(", ord2 = "); mpoly_ordering_print(ord2);
+          flint_printf(", nvars1 = %wd, nvars2 = %wd\n\n", nvars1, nvars2);
+
+          fmpz_mpoly_print_pretty(f, NULL, ctx1); printf("\n\n");
+          fmpz_mpoly_print_pretty(g, NULL, ctx2); printf("\n\n");
+
+          flint_abort();
+       }
+
+       for (j = 0; j < nvars1; j++)
+          fmpz_mpoly_clear(C + j, ctx2);
+       flint_free(C);
+       flint_free(Cp);
+
+       fmpz_mpoly_clear(f, ctx1);
+       fmpz_mpoly_clear(g, ctx2);
+       fmpz_clear(fe);
+       fmpz_clear(ge);
+       _fmpz_vec_clear(vals1, nvars1);
+       _fmpz_vec_clear(vals2, nvars2);
+    }
+
+    /* Check composition with the generators, with aliasing */
+    for (i = 0; i < 300 * flint_test_multiplier(); i++)
+    {
+       fmpz_mpoly_ctx_t ctx;
+       fmpz_mpoly_t f, g;
+       fmpz_mpoly_struct * C, ** Cp;
+       ordering_t ord;
+       slong j, nvars, len, exp_bound;
+
+       ord = mpoly_ordering_randtest(state);
+       nvars = n_randint(state, 6) + 1;
+
+       fmpz_mpoly_ctx_init(ctx, nvars, ord);
+
+       fmpz_mpoly_init(f, ctx);
+       fmpz_mpoly_init(g, ctx);
+
+       C = (fmpz_mpoly_struct *) flint_malloc(
+                                      nvars*sizeof(fmpz_mpoly_struct));
+       Cp = (fmpz_mpoly_struct **) flint_malloc(
+                                      nvars*sizeof(fmpz_mpoly_struct *));
+
+       for (j = 0; j < nvars; j++)
+       {
+          fmpz_mpoly_init(C + j, ctx);
+          fmpz_mpoly_gen(C + j, j, ctx);
+          Cp[j] = C + j;
+       }
+
+       len = n_randint(state, 50);
+       exp_bound = n_randint(state, 50) + 1;
+
+       fmpz_mpoly_randtest(f, state, len, exp_bound, 50, ctx);
+       fmpz_mpoly_set(g, f, ctx);
+
+       fmpz_mpoly_compose(g, g, Cp, ctx, ctx);
+       fmpz_mpoly_test(g, ctx);
+
+       result = fmpz_mpoly_equal(f, g, ctx);
+
+       if (!result)
+       {
+          printf("FAIL\n");
+          printf("generators\n");
+          printf("ord = "); mpoly_ordering_print(ord);
+          flint_printf(", nvars = %wd\n\n", nvars);
+
+          fmpz_mpoly_print_pretty(f, NULL, ctx); printf("\n\n");
+          fmpz_mpoly_print_pretty(g, NULL, ctx); printf("\n\n");
+
+          flint_abort();
+       }
+
+       for (j = 0; j < nvars; j++)
+          fmpz_mpoly_clear(C + j, ctx);
+       flint_free(C);
+       flint_free(Cp);
+
+       fmpz_mpoly_clear(f, ctx);
+       fmpz_mpoly_clear(g, ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,164 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mpoly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, j, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("evaluate_all_fmpz....");
+    fflush(stdout);
+
+    /* Check evaluation is a ring homomorphism */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+       fmpz_mpoly_ctx_t ctx;
+       fmpz_mpoly_t f, g, h;
+       fmpz_t fe, ge, he, t;
+       fmpz * vals;
+       ordering_t ord;
+       slong nvars, len1, len2, exp_bound1, exp_bound2, coeff_bits;
+
+       ord = mpoly_ordering_randtest(state);
+       nvars = n_randint(state, 6) + 1;
+
+       fmpz_mpoly_ctx_init(ctx, nvars, ord);
+
+       fmpz_mpoly_init(f, ctx);
+       fmpz_mpoly_init(g, ctx);
+       fmpz_mpoly_init(h, ctx);
+       fmpz_init(fe);
+       fmpz_init(ge);
+       fmpz_init(he);
+       fmpz_init(t);
+       vals = _fmpz_vec_init(nvars);
+
+       len1 = n_randint(state, 50);
+       len2 = n_randint(state, 50);
+       exp_bound1 = n_randint(state, 20) + 1;
+       exp_bound2 = n_randint(state, 20) + 1;
+       coeff_bits = n_randint(state, 100) + 1;
+
+       for (j = 0; j < 4; j++)
+       {
+          fmpz_mpoly_randtest(f, state, len1, exp_bound1, coeff_bits, ctx);
+          fmpz_mpoly_randtest(g, state, len2, exp_bound2, coeff_bits, ctx);
+          _fmpz_vec_randtest(vals, state, nvars, n_randint(state, 20) + 1);
+
+          fmpz_mpoly_evaluate_all_fmpz(fe, f, vals, ctx);
+          fmpz_mpoly_evaluate_all_fmpz(ge, g, vals, ctx);
+
+          fmpz_mpoly_add(h, f, g, ctx);
+          fmpz_mpoly_evaluate_all_fmpz(he, h, vals, ctx);
+          fmpz_add(t, fe, ge);
+          result = fmpz_equal(he, t);
+
+          fmpz_mpoly_mul_johnson(h, f, g, ctx);
+          fmpz_mpoly_evaluate_all_fmpz(he, h, vals, ctx);
+          fmpz_mul(t, fe, ge);
+          result = result && fmpz_equal(he, t);
+
+          if (!result)
+          {
+             printf("FAIL\n");
+             printf("ord = "); mpoly_ordering_print(ord);
+             flint_printf(", nvars = %wd, len1 = %wd, exp_bound1 = %wd, "
+                      "len2 = %wd, exp_bound2 = %wd\n\n",
+                            nvars, len1, exp_bound1, len2, exp_bound2);
+
+             fmpz_mpoly_print_pretty(f, NULL, ctx); printf("\n\n");
+             fmpz_mpoly_print_pretty(g, NULL, ctx); printf("\n\n");
+
+             flint_abort();
+          }
+       }
+
+       fmpz_mpoly_clear(f, ctx);
+       fmpz_mpoly_clear(g, ctx);
+       fmpz_mpoly_clear(h, ctx);
+       fmpz_clear(fe);
+       fmpz_clear(ge);
+       fmpz_clear(he);
+       fmpz_clear(t);
+       _fmpz_vec_clear(vals, nvars);
+    }
+
+    /* Check large exponents, which only store repeated squares */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+       fmpz_mpoly_ctx_t ctx;
+       fmpz_mpoly_t f, g;
+       fmpz_t fe, ge, t;
+       fmpz * vals;
+       ordering_t ord;
+       slong nvars, exp_bound;
+       ulong e;
+
+       ord = mpoly_ordering_randtest(state);
+       nvars = n_randint(state, 3) + 1;
+
+       fmpz_mpoly_ctx_init(ctx, nvars, ord);
+
+       fmpz_mpoly_init(f, ctx);
+       fmpz_mpoly_init(g, ctx);
+       fmpz_init(fe);
+       fmpz_init(ge);
+       fmpz_init(t);
+       vals = _fmpz_vec_init(nvars);
+
+       exp_bound = n_randint(state, 500) + 1;
+
+       fmpz_mpoly_randtest(f, state, 3, exp_bound, 10, ctx);
+       _fmpz_vec_randtest(vals, state, nvars, 3);
+
+       /* multiply by a high power of the first variable */
+       e = n_randint(state, 1000);
+       fmpz_mpoly_gen(g, 0, ctx);
+       fmpz_mpoly_pow_fps(g, g, e, ctx);
+       fmpz_mpoly_mul_johnson(g, g, f, ctx);
+
+       fmpz_mpoly_evaluate_all_fmpz(fe, f, vals, ctx);
+       fmpz_mpoly_evaluate_all_fmpz(ge, g, vals, ctx);
+       fmpz_pow_ui(t, vals + 0, e);
+       fmpz_mul(t, t, fe);
+
+       result = fmpz_equal(ge, t);
+
+       if (!result)
+       {
+          printf("FAIL\n");
+          printf("large exponents\n");
+          flint_abort();
+       }
+
+       fmpz_mpoly_clear(f, ctx);
+       fmpz_mpoly_clear(g, ctx);
+       fmpz_clear(fe);
+       fmpz_clear(ge);
+       fmpz_clear(t);
+       _fmpz_vec_clear(vals, nvars);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,101 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "nmod_vec.h"
+#include "fmpz_mpoly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("evaluate_all_nmod....");
+    fflush(stdout);
+
+    /* Check batched evaluation agrees with evaluation over Z at each point */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+       fmpz_mpoly_ctx_t ctx;
+       fmpz_mpoly_t f;
+       fmpz_t fe;
+       fmpz * zvals;
+       mp_ptr vals, evals;
+       nmod_t mod;
+       ordering_t ord;
+       slong j, k, nvars, len, exp_bound, coeff_bits, npoints;
+
+       ord = mpoly_ordering_randtest(state);
+       nvars = n_randint(state, 6) + 1;
+
+       fmpz_mpoly_ctx_init(ctx, nvars, ord);
+       nmod_init(&mod, n_randtest_not_zero(state));
+
+       fmpz_mpoly_init(f, ctx);
+       fmpz_init(fe);
+       zvals = _fmpz_vec_init(nvars);
+
+       len = n_randint(state, 50);
+       exp_bound = n_randint(state, 200) + 1;
+       coeff_bits = n_randint(state, 200) + 1;
+       npoints = n_randint(state, 40);
+
+       vals = _nmod_vec_init(npoints*nvars);
+       evals = _nmod_vec_init(npoints);
+
+       fmpz_mpoly_randtest(f, state, len, exp_bound, coeff_bits, ctx);
+       _nmod_vec_randtest(vals, state, npoints*nvars, mod);
+
+       fmpz_mpoly_evaluate_all_nmod_vec(evals, f, vals, npoints, mod, ctx);
+
+       for (j = 0; j < npoints; j++)
+       {
+          for (k = 0; k < nvars; k++)
+             fmpz_set_ui(zvals + k, vals[j*nvars + k]);
+
+          fmpz_mpoly_evaluate_all_fmpz(fe, f, zvals, ctx);
+
+          result = fmpz_fdiv_ui(fe, mod.n) == evals[j] &&
+             fmpz_mpoly_evaluate_all_nmod(f, vals + j*nvars, mod, ctx)
+                                                                == evals[j];
+
+          if (!result)
+          {
+             printf("FAIL\n");
+             printf("ord = "); mpoly_ordering_print(ord);
+             flint_printf(", nvars = %wd, n = %wu, point %wd of %wd\n\n",
+                                              nvars, mod.n, j, npoints);
+
+             fmpz_mpoly_print_pretty(f, NULL, ctx); printf("\n\n");
+
+             flint_abort();
+          }
+       }
+
+       fmpz_mpoly_clear(f, ctx);
+       fmpz_clear(fe);
+       _fmpz_vec_clear(zvals, nvars);
+       _nmod_vec_clear(vals);
+       _nmod_vec_clear(evals);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    printf("PASS\n");
+    return 0;
+}
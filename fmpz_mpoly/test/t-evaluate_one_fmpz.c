@@ -0,0 +1,132 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_mpoly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("evaluate_one_fmpz....");
+    fflush(stdout);
+
+    /* Check evaluating one variable at a time agrees with evaluate_all */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+       fmpz_mpoly_ctx_t ctx;
+       fmpz_mpoly_t f, g, h;
+       fmpz_t fe, ge;
+       fmpz * vals;
+       ordering_t ord;
+       slong j, k, nvars, len, exp_bound, coeff_bits;
+       slong * order;
+
+       ord = mpoly_ordering_randtest(state);
+       nvars = n_randint(state, 6) + 1;
+
+       fmpz_mpoly_ctx_init(ctx, nvars, ord);
+
+       fmpz_mpoly_init(f, ctx);
+       fmpz_mpoly_init(g, ctx);
+       fmpz_mpoly_init(h, ctx);
+       fmpz_init(fe);
+       fmpz_init(ge);
+       vals = _fmpz_vec_init(nvars);
+       order = (slong *) flint_malloc(nvars*sizeof(slong));
+
+       len = n_randint(state, 50);
+       exp_bound = n_randint(state, 100) + 1;
+       coeff_bits = n_randint(state, 100) + 1;
+
+       fmpz_mpoly_randtest(f, state, len, exp_bound, coeff_bits, ctx);
+       _fmpz_vec_randtest(vals, state, nvars, n_randint(state, 10) + 1);
+
+       /* evaluate the variables in a random order */
+       for (j = 0; j < nvars; j++)
+          order[j] = j;
+       for (j = nvars - 1; j > 0; j--)
+       {
+          slong t;
+          k = n_randint(state, j + 1);
+          t = order[j]; order[j] = order[k]; order[k] = t;
+       }
+
+       fmpz_mpoly_set(g, f, ctx);
+       for (j = 0; j < nvars; j++)
+       {
+          if (n_randint(state, 2))
+          {
+             fmpz_mpoly_evaluate_one_fmpz(g, g, order[j], vals + order[j], ctx);
+          } else
+          {
+             fmpz_mpoly_evaluate_one_fmpz(h, g, order[j], vals + order[j], ctx);
+             fmpz_mpoly_swap(g, h, ctx);
+          }
+
+          fmpz_mpoly_test(g, ctx);
+       }
+
+       fmpz_mpoly_evaluate_all_fmpz(fe, f, vals, ctx);
+
+       result = (g->length == 0 && fmpz_is_zero(fe)) ||
+                (g->length == 1 && fmpz_equal(g->coeffs + 0, fe) &&
+                   mpoly_monomial_is_zero(g->exps,
+                                          words_per_exp(ctx->n, g->bits)));
+
+       if (!result)
+       {
+          printf("FAIL\n");
+          printf("ord = "); mpoly_ordering_print(ord);
+          flint_printf(", nvars = %wd, len = %wd, exp_bound = %wd\n\n",
+                                                     nvars, len, exp_bound);
+
+          fmpz_mpoly_print_pretty(f, NULL, ctx); printf("\n\n");
+          fmpz_mpoly_print_pretty(g, NULL, ctx); printf("\n\n");
+
+          flint_abort();
+       }
+
+       /* partial evaluation commutes with evaluation of the rest */
+       fmpz_mpoly_evaluate_one_fmpz(h, f, order[0], vals + order[0], ctx);
+       fmpz_mpoly_evaluate_all_fmpz(ge, h, vals, ctx);
+
+       result = fmpz_equal(fe, ge);
+
+       if (!result)
+       {
+          printf("FAIL\n");
+          printf("partial evaluation\n");
+          flint_abort();
+       }
+
+       fmpz_mpoly_clear(f, ctx);
+       fmpz_mpoly_clear(g, ctx);
+       fmpz_mpoly_clear(h, ctx);
+       fmpz_clear(fe);
+       fmpz_clear(ge);
+       _fmpz_vec_clear(vals, nvars);
+       flint_free(order);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    printf("PASS\n");
+    return 0;
+}
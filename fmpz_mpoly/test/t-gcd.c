@@ -0,0 +1,204 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mpoly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, j, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("gcd....");
+    fflush(stdout);
+
+    /* Check gcd(a*g, b*g) is divisible by g, has coprime cofactors, and
+       the dense and sparse algorithms agree */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+       fmpz_mpoly_ctx_t ctx;
+       fmpz_mpoly_t a, b, g, A, B, G, G1, G2, Q1, Q2, T;
+       ordering_t ord;
+       slong nvars, len, len1, len2, exp_bound, exp_bound1, exp_bound2;
+       slong coeff_bits;
+       int ok1, ok2, ok3;
+
+       ord = mpoly_ordering_randtest(state);
+       nvars = n_randint(state, 4) + 1;
+
+       fmpz_mpoly_ctx_init(ctx, nvars, ord);
+
+       fmpz_mpoly_init(a, ctx);
+       fmpz_mpoly_init(b, ctx);
+       fmpz_mpoly_init(g, ctx);
+       fmpz_mpoly_init(A, ctx);
+       fmpz_mpoly_init(B, ctx);
+       fmpz_mpoly_init(G, ctx);
+       fmpz_mpoly_init(G1, ctx);
+       fmpz_mpoly_init(G2, ctx);
+       fmpz_mpoly_init(Q1, ctx);
+       fmpz_mpoly_init(Q2, ctx);
+       fmpz_mpoly_init(T, ctx);
+
+       len = n_randint(state, 8) + 1;
+       len1 = n_randint(state, 8);
+       len2 = n_randint(state, 8);
+
+       exp_bound = n_randint(state, 5) + 1;
+       exp_bound1 = n_randint(state, 5) + 1;
+       exp_bound2 = n_randint(state, 5) + 1;
+
+       coeff_bits = n_randint(state, 200) + 1;
+
+       /* large enough to use threads */
+       if (n_randint(state, 10) == 0)
+       {
+          len1 = 25;
+          len2 = 25;
+       }
+
+       flint_set_num_threads(n_randint(state, 4) + 1);
+
+       for (j = 0; j < 2; j++)
+       {
+          fmpz_mpoly_randtest(a, state, len1, exp_bound1, coeff_bits, ctx);
+          fmpz_mpoly_randtest(b, state, len2, exp_bound2, coeff_bits, ctx);
+          fmpz_mpoly_randtest(g, state, len, exp_bound, coeff_bits, ctx);
+
+          fmpz_mpoly_mul_johnson(A, a, g, ctx);
+          fmpz_mpoly_mul_johnson(B, b, g, ctx);
+
+          fmpz_mpoly_gcd(G, A, B, ctx);
+          fmpz_mpoly_gcd_brown(G1, A, B, ctx);
+          fmpz_mpoly_gcd_zippel(G2, A, B, ctx);
+
+          fmpz_mpoly_test(G, ctx);
+          fmpz_mpoly_test(G1, ctx);
+          fmpz_mpoly_test(G2, ctx);
+
+          result = fmpz_mpoly_equal(G, G1, ctx) && fmpz_mpoly_equal(G, G2, ctx);
+
+          if (result)
+          {
+             if (A->length == 0 && B->length == 0)
+             {
+                result = (G->length == 0);
+             } else
+             {
+                ok1 = fmpz_mpoly_divides_monagan_pearce(Q1, A, G, ctx);
+                ok2 = fmpz_mpoly_divides_monagan_pearce(Q2, B, G, ctx);
+                ok3 = g->length == 0 ||
+                      fmpz_mpoly_divides_monagan_pearce(T, G, g, ctx);
+
+                result = G->length != 0 && fmpz_sgn(G->coeffs + 0) > 0
+                                                         && ok1 && ok2 && ok3;
+
+                if (result)
+                {
+                   fmpz_mpoly_gcd(T, Q1, Q2, ctx);
+                   result = fmpz_mpoly_is_one(T, ctx);
+                }
+             }
+          }
+
+          if (!result)
+          {
+             printf("FAIL\n");
+             printf("ord = "); mpoly_ordering_print(ord);
+             flint_printf(", nvars = %wd, coeff_bits = %wd\n\n",
+                                                          nvars, coeff_bits);
+
+             fmpz_mpoly_print_pretty(A, NULL, ctx); printf("\n\n");
+             fmpz_mpoly_print_pretty(B, NULL, ctx); printf("\n\n");
+             fmpz_mpoly_print_pretty(g, NULL, ctx); printf("\n\n");
+             fmpz_mpoly_print_pretty(G, NULL, ctx); printf("\n\n");
+             fmpz_mpoly_print_pretty(G1, NULL, ctx); printf("\n\n");
+             fmpz_mpoly_print_pretty(G2, NULL, ctx); printf("\n\n");
+
+             flint_abort();
+          }
+       }
+
+       fmpz_mpoly_clear(a, ctx);
+       fmpz_mpoly_clear(b, ctx);
+       fmpz_mpoly_clear(g, ctx);
+       fmpz_mpoly_clear(A, ctx);
+       fmpz_mpoly_clear(B, ctx);
+       fmpz_mpoly_clear(G, ctx);
+       fmpz_mpoly_clear(G1, ctx);
+       fmpz_mpoly_clear(G2, ctx);
+       fmpz_mpoly_clear(Q1, ctx);
+       fmpz_mpoly_clear(Q2, ctx);
+       fmpz_mpoly_clear(T, ctx);
+    }
+
+    /* Check aliasing of the gcd with either input */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+       fmpz_mpoly_ctx_t ctx;
+       fmpz_mpoly_t a, b, g, G;
+       ordering_t ord;
+       slong nvars;
+
+       ord = mpoly_ordering_randtest(state);
+       nvars = n_randint(state, 4) + 1;
+
+       fmpz_mpoly_ctx_init(ctx, nvars, ord);
+
+       fmpz_mpoly_init(a, ctx);
+       fmpz_mpoly_init(b, ctx);
+       fmpz_mpoly_init(g, ctx);
+       fmpz_mpoly_init(G, ctx);
+
+       fmpz_mpoly_randtest(g, state, 5, 4, 50, ctx);
+       fmpz_mpoly_randtest(a, state, 5, 4, 50, ctx);
+       fmpz_mpoly_randtest(b, state, 5, 4, 50, ctx);
+       fmpz_mpoly_mul_johnson(a, a, g, ctx);
+       fmpz_mpoly_mul_johnson(b, b, g, ctx);
+
+       fmpz_mpoly_gcd(G, a, b, ctx);
+
+       if (n_randint(state, 2))
+       {
+          fmpz_mpoly_gcd(a, a, b, ctx);
+          result = fmpz_mpoly_equal(a, G, ctx);
+       } else
+       {
+          fmpz_mpoly_gcd(b, a, b, ctx);
+          result = fmpz_mpoly_equal(b, G, ctx);
+       }
+
+       if (!result)
+       {
+          printf("FAIL\n");
+          printf("aliasing\n");
+          flint_abort();
+       }
+
+       fmpz_mpoly_clear(a, ctx);
+       fmpz_mpoly_clear(b, ctx);
+       fmpz_mpoly_clear(g, ctx);
+       fmpz_mpoly_clear(G, ctx);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    printf("PASS\n");
+    return 0;
+}
@@ -619,6 +619,15 @@ FLINT_DLL void _fmpz_poly_resultant_euclidean(fmpz_t res, const fmpz * poly1, sl
 FLINT_DLL void fmpz_poly_resultant_euclidean(fmpz_t res, const fmpz_poly_t poly1, 
                                                       const fmpz_poly_t poly2);
 
+/* Multimodular algorithms reduce this many primes at once with a comb, and
+   work on several primes in parallel for polynomials of at least the given
+   length */
+#define FMPZ_POLY_MULTI_MOD_BATCH 32
+#define FMPZ_POLY_MODULAR_THREAD_CUTOFF 64
+
+FLINT_DLL void _fmpz_poly_resultant_multi_mod_ui(mp_ptr res, mp_srcptr primes,
+      slong num_primes, const fmpz * A, slong len1, const fmpz * B, slong len2);
+
 FLINT_DLL void _fmpz_poly_resultant_modular(fmpz_t res, const fmpz * poly1, slong len1, 
                                                const fmpz * poly2, slong len2);
 
@@ -1188,6 +1197,10 @@ FLINT_DLL void fmpz_poly_hensel_lift_only_inverse(fmpz_poly_t Aout, fmpz_poly_t
     const fmpz_poly_t a, const fmpz_poly_t b, 
     const fmpz_t p, const fmpz_t p1);
 
+/* The two subtrees of a Hensel tree are lifted in parallel when the product
+   of their leaves has at least this length */
+#define FMPZ_POLY_HENSEL_THREAD_CUTOFF 64
+
 FLINT_DLL void fmpz_poly_hensel_lift_tree_recursive(slong *link, 
     fmpz_poly_t *v, fmpz_poly_t *w, fmpz_poly_t f, slong j, slong inv, 
     const fmpz_t p0, const fmpz_t p1);
@@ -15,18 +15,99 @@
 #include "fmpz_vec.h"
 #include "fmpz_poly.h"
 #include "mpn_extras.h"
+#include "thread_pool.h"
 
+typedef struct
+{
+    mp_limb_t p;
+    mp_ptr h;
+    slong hlen;
+    const fmpz * A;
+    slong len1;
+    const fmpz * B;
+    slong len2;
+}
+_gcd_image_arg_t;
+
+static void
+_fmpz_poly_gcd_modular_image(void * arg_ptr)
+{
+    _gcd_image_arg_t * arg = (_gcd_image_arg_t *) arg_ptr;
+    mp_ptr a, b;
+    nmod_t mod;
+
+    nmod_init(&mod, arg->p);
+
+    a = _nmod_vec_init(arg->len1);
+    b = _nmod_vec_init(arg->len2);
+
+    /* reduce polynomials modulo p */
+    _fmpz_vec_get_nmod_vec(a, arg->A, arg->len1, mod);
+    _fmpz_vec_get_nmod_vec(b, arg->B, arg->len2, mod);
+
+    /* compute gcd over Z/pZ */
+    arg->hlen = _nmod_poly_gcd(arg->h, a, arg->len1, b, arg->len2, mod);
+
+    _nmod_vec_clear(a);
+    _nmod_vec_clear(b);
+}
+
+/* value of poly at 1 and -1 */
+static void
+_fmpz_poly_evaluate_pm1(fmpz_t e1, fmpz_t em1, const fmpz * poly, slong len)
+{
+    slong i;
+
+    fmpz_zero(e1);
+    fmpz_zero(em1);
+
+    for (i = 0; i < len; i++)
+    {
+        fmpz_add(e1, e1, poly + i);
+        if (i & 1)
+            fmpz_sub(em1, em1, poly + i);
+        else
+            fmpz_add(em1, em1, poly + i);
+    }
+}
+
+static int
+_fmpz_divides_value(const fmpz_t a, const fmpz_t r)
+{
+    return fmpz_is_zero(r) ? fmpz_is_zero(a) : fmpz_divisible(a, r);
+}
+
+/*
+   Checks whether res divides A and B, trying the values at 1 and -1
+   (in ev) first, which avoids most of the trial divisions that fail.
+*/
+static int
+_fmpz_poly_gcd_modular_check(fmpz * Q, const fmpz * A, slong len1,
+          const fmpz * B, slong len2, const fmpz * res, slong hlen, fmpz * ev)
+{
+    _fmpz_poly_evaluate_pm1(ev + 4, ev + 5, res, hlen);
+
+    if (!_fmpz_divides_value(ev + 0, ev + 4) ||
+        !_fmpz_divides_value(ev + 1, ev + 5) ||
+        !_fmpz_divides_value(ev + 2, ev + 4) ||
+        !_fmpz_divides_value(ev + 3, ev + 5))
+        return 0;
+
+    return _fmpz_poly_divides(Q, B, len2, res, hlen) &&
+           _fmpz_poly_divides(Q, A, len1, res, hlen);
+}
 
 void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1, 
                                         const fmpz * poly2, slong len2)
 {
     mp_bitcnt_t bits1, bits2, nb1, nb2, bits_small, pbits, curr_bits = 0, new_bits;   
     fmpz_t ac, bc, hc, d, g, l, eval_A, eval_B, eval_GCD, modulus;
-    fmpz * A, * B, * Q, * lead_A, * lead_B;
-    mp_ptr a, b, h;
+    fmpz * A, * B, * Q, * lead_A, * lead_B, * ev;
+    mp_ptr h;
     mp_limb_t p, h_inv, g_mod;
     nmod_t mod;
-    slong i, n, n0, unlucky, hlen, bound;
+    slong i, k, n, n0, unlucky, hlen, bound, batch;
+    _gcd_image_arg_t * args;
     int g_pm1;
 
     fmpz_init(ac);
@@ -126,10 +207,24 @@ void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1,
 
     Q = _fmpz_vec_init(len1);
 
-    /* make space for polynomials mod p */
-    a = _nmod_vec_init(len1);
-    b = _nmod_vec_init(len2);
-    h = _nmod_vec_init(len2);
+    /* values of A and B at 1 and -1, for quick divisibility checks */
+    ev = _fmpz_vec_init(6);
+    _fmpz_poly_evaluate_pm1(ev + 0, ev + 1, A, len1);
+    _fmpz_poly_evaluate_pm1(ev + 2, ev + 3, B, len2);
+
+    /* the images modulo a batch of primes are computed in parallel */
+    batch = (len2 >= FMPZ_POLY_MODULAR_THREAD_CUTOFF) ?
+                                                  flint_get_num_threads() : 1;
+    args = flint_malloc(sizeof(_gcd_image_arg_t) * batch);
+
+    for (k = 0; k < batch; k++)
+    {
+        args[k].h = _nmod_vec_init(len2);
+        args[k].A = A;
+        args[k].len1 = len1;
+        args[k].B = B;
+        args[k].len2 = len2;
+    }
 
     /* zero entire output */
     _fmpz_vec_zero(res, len2);
@@ -143,29 +238,40 @@ void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1,
     bound = (n0 + 3)*FLINT_MAX(nb1, nb2) + (n0 + 1); /* initialise bound */
     unlucky = 0;
 
-    for (;;)
+    for (k = batch; ; k++)
     {
-        /* get new prime and initialise modulus */
-        p = n_nextprime(p, 0);
-        if (fmpz_fdiv_ui(l, p) == 0)
+        if (k == batch)
         {
-            unlucky += pbits;
-            continue;
-        }
-        nmod_init(&mod, p);
+            /* get new primes */
+            for (k = 0; k < batch; )
+            {
+                p = n_nextprime(p, 0);
+                if (fmpz_fdiv_ui(l, p) == 0)
+                {
+                    unlucky += pbits;
+                    continue;
+                }
+                args[k++].p = p;
+            }
 
-        /* reduce polynomials modulo p */
-        _fmpz_vec_get_nmod_vec(a, A, len1, mod);
-        _fmpz_vec_get_nmod_vec(b, B, len2, mod);
+            if (batch == 1)
+                _fmpz_poly_gcd_modular_image(args);
+            else
+                flint_parallel_do(_fmpz_poly_gcd_modular_image, args, batch,
+                                              sizeof(_gcd_image_arg_t), batch);
+            k = 0;
+        }
 
-        /* compute gcd over Z/pZ */
-        hlen = _nmod_poly_gcd(h, a, len1, b, len2, mod);
+        p = args[k].p;
+        nmod_init(&mod, p);
+        h = args[k].h;
+        hlen = args[k].hlen;
 
         if (hlen == 1) /* gcd is 1 */
         {
             fmpz_one(res);
             _fmpz_vec_zero(res + 1, len2 - 1);
-            break; 
+            break;
         }
 
         if (hlen > n + 1) /* discard this prime */
@@ -193,9 +299,9 @@ void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1,
             if (g_pm1)
             {
                 /* are we done? */
-                if (_fmpz_poly_divides(Q, B, len2, res, hlen) &&
-                    _fmpz_poly_divides(Q, A, len1, res, hlen))
-                break;
+                if (_fmpz_poly_gcd_modular_check(Q, A, len1, B, len2,
+                                                          res, hlen, ev))
+                    break;
             }
             else
             {
@@ -220,8 +326,8 @@ void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1,
                     _fmpz_vec_scalar_divexact_fmpz(res, res, hlen, hc);
 
                     /* are we done? */
-                    if (_fmpz_poly_divides(Q, B, len2, res, hlen) &&
-                        _fmpz_poly_divides(Q, A, len1, res, hlen))
+                    if (_fmpz_poly_gcd_modular_check(Q, A, len1, B, len2,
+                                                              res, hlen, ev))
                         break;
 
                     /* no, so multiply by content again */
@@ -259,8 +365,8 @@ void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1,
                 break;
 
             /* are we done? */
-            if (_fmpz_poly_divides(Q, B, len2, res, hlen) &&
-                _fmpz_poly_divides(Q, A, len1, res, hlen))
+            if (_fmpz_poly_gcd_modular_check(Q, A, len1, B, len2,
+                                                      res, hlen, ev))
                 break;
 
             if (!g_pm1) 
@@ -278,9 +384,10 @@ void _fmpz_poly_gcd_modular(fmpz * res, const fmpz * poly1, slong len1,
     fmpz_clear(l); 
     fmpz_clear(hc);
 
-    _nmod_vec_clear(a);
-    _nmod_vec_clear(b);
-    _nmod_vec_clear(h); 
+    for (k = 0; k < batch; k++)
+        _nmod_vec_clear(args[k].h);
+    flint_free(args);
+    _fmpz_vec_clear(ev, 6);
 
     /* finally multiply by content */
     _fmpz_vec_scalar_mul_fmpz(res, res, hlen, d);
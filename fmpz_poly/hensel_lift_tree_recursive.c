@@ -14,6 +14,29 @@
 #include "flint.h"
 #include "fmpz.h"
 #include "fmpz_poly.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+    slong * link;
+    fmpz_poly_t * v;
+    fmpz_poly_t * w;
+    fmpz_poly_struct * f;
+    slong j;
+    slong inv;
+    const fmpz * p0;
+    const fmpz * p1;
+}
+_hensel_subtree_arg_t;
+
+static void
+_fmpz_poly_hensel_lift_subtree_worker(void * arg_ptr)
+{
+    _hensel_subtree_arg_t * arg = (_hensel_subtree_arg_t *) arg_ptr;
+
+    fmpz_poly_hensel_lift_tree_recursive(arg->link, arg->v, arg->w, arg->f,
+                                            arg->j, arg->inv, arg->p0, arg->p1);
+}
 
 void fmpz_poly_hensel_lift_tree_recursive(slong *link, 
     fmpz_poly_t *v, fmpz_poly_t *w, fmpz_poly_t f, slong j, slong inv, 
@@ -33,10 +56,36 @@ void fmpz_poly_hensel_lift_tree_recursive(slong *link,
                                                   v[j], v[j+1], w[j], w[j+1], 
                                                   p0, p1);
 
-        fmpz_poly_hensel_lift_tree_recursive(link, v, w, v[j], link[j], 
-            inv, p0, p1);
-        fmpz_poly_hensel_lift_tree_recursive(link, v, w, v[j+1], link[j+1], 
-            inv, p0, p1);
+        /* the two subtrees involve disjoint nodes */
+        if (link[j] >= 0 && link[j + 1] >= 0 &&
+            f->length >= FMPZ_POLY_HENSEL_THREAD_CUTOFF &&
+            flint_get_num_threads() > 1)
+        {
+            _hensel_subtree_arg_t args[2];
+            slong i;
+
+            for (i = 0; i < 2; i++)
+            {
+                args[i].link = link;
+                args[i].v = v;
+                args[i].w = w;
+                args[i].f = v[j + i];
+                args[i].j = link[j + i];
+                args[i].inv = inv;
+                args[i].p0 = p0;
+                args[i].p1 = p1;
+            }
+
+            flint_parallel_do(_fmpz_poly_hensel_lift_subtree_worker, args, 2,
+                                           sizeof(_hensel_subtree_arg_t), 2);
+        }
+        else
+        {
+            fmpz_poly_hensel_lift_tree_recursive(link, v, w, v[j], link[j], 
+                inv, p0, p1);
+            fmpz_poly_hensel_lift_tree_recursive(link, v, w, v[j+1], link[j+1], 
+                inv, p0, p1);
+        }
     }
 }
 
@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2008, 2009 William Hart
     Copyright (C) 2014 Fredrik Johansson
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -171,6 +172,8 @@ fmpz_poly_mul(fmpz_poly_t res,
 
     rlen = len1 + len2 - 1;
 
+    FLINT_MEMSTATS_PUSH_TAG("fmpz_poly_mul");
+
     if (res == poly1 || res == poly2)
     {
         fmpz_poly_t t;
@@ -196,4 +199,6 @@ fmpz_poly_mul(fmpz_poly_t res,
     }
 
     _fmpz_poly_set_length(res, rlen);
+
+    FLINT_MEMSTATS_POP_TAG();
 }
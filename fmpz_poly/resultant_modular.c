@@ -26,9 +26,8 @@ void _fmpz_poly_resultant_modular(fmpz_t res, const fmpz * poly1, slong len1,
     fmpz_comb_temp_t comb_temp;
     fmpz_t ac, bc, l, modulus;
     fmpz * A, * B, * lead_A, * lead_B;
-    mp_ptr a, b, rarr, parr;
+    mp_ptr rarr, parr;
     mp_limb_t p;
-    nmod_t mod;
     
     /* special case, one of the polys is a constant */
     if (len2 == 1) /* if len1 == 1 then so does len2 */
@@ -81,30 +80,19 @@ void _fmpz_poly_resultant_modular(fmpz_t res, const fmpz * poly1, slong len1,
     fmpz_set_ui(modulus, 1);
     fmpz_zero(res);
 
-    /* make space for polynomials mod p */
-    a = _nmod_vec_init(len1);
-    b = _nmod_vec_init(len2);
-    
+    /* choose the primes, the images are computed all at once */
     for (i = 0; curr_bits < bound; )
     {
-        /* get new prime and initialise modulus */
         p = n_nextprime(p, 0);
         if (fmpz_fdiv_ui(l, p) == 0)
             continue;
-        
-        curr_bits += pbits;
-
-        nmod_init(&mod, p);
 
-        /* reduce polynomials modulo p */
-        _fmpz_vec_get_nmod_vec(a, A, len1, mod);
-        _fmpz_vec_get_nmod_vec(b, B, len2, mod);
-
-        /* compute resultant over Z/pZ */
-        parr[i] = p;
-        rarr[i++] = _nmod_poly_resultant(a, len1, b, len2, mod);
+        curr_bits += pbits;
+        parr[i++] = p;
     }
 
+    _fmpz_poly_resultant_multi_mod_ui(rarr, parr, num_primes, A, len1, B, len2);
+
     fmpz_comb_init(comb, parr, num_primes);
     fmpz_comb_temp_init(comb_temp, comb);
     
@@ -114,9 +102,6 @@ void _fmpz_poly_resultant_modular(fmpz_t res, const fmpz * poly1, slong len1,
     fmpz_comb_temp_clear(comb_temp);
     fmpz_comb_clear(comb);
         
-    _nmod_vec_clear(a);
-    _nmod_vec_clear(b);
-
     _nmod_vec_clear(parr);
     _nmod_vec_clear(rarr);
     
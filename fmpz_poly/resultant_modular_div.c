@@ -28,9 +28,8 @@ void _fmpz_poly_resultant_modular_div(fmpz_t res,
     fmpz_comb_temp_t comb_temp;
     fmpz_t ac, bc, l, modulus, div, la, lb;
     fmpz * A, * B, * lead_A, * lead_B;
-    mp_ptr a, b, rarr, parr;
+    mp_ptr rarr, parr, dinv;
     mp_limb_t p, d;
-    nmod_t mod;
 
     if (fmpz_is_zero(divisor))
     {
@@ -109,10 +108,6 @@ void _fmpz_poly_resultant_modular_div(fmpz_t res,
     fmpz_set_ui(modulus, 1);
     fmpz_zero(res);
 
-    /* make space for polynomials mod p */
-    a = _nmod_vec_init(len1);
-    b = _nmod_vec_init(len2);
-
     pbits = FLINT_BITS - 1;
     p = (UWORD(1)<<pbits);
 
@@ -123,32 +118,30 @@ void _fmpz_poly_resultant_modular_div(fmpz_t res,
 
     parr = _nmod_vec_init(num_primes);
     rarr = _nmod_vec_init(num_primes);
+    dinv = _nmod_vec_init(num_primes);
 
-    
-    for(i=0; i< num_primes; )
+    /* choose the primes, the images are computed all at once */
+    for (i = 0; i < num_primes; )
     {
-        /* get new prime and initialise modulus */
         p = n_nextprime(p, 0);
 
-        if (fmpz_fdiv_ui(l, p) == 0) 
+        if (fmpz_fdiv_ui(l, p) == 0)
             continue;
         d = fmpz_fdiv_ui(div, p);
-        if (d==0)
+        if (d == 0)
             continue;
-        d = n_invmod(d, p);
-
-        nmod_init(&mod, p);
-
-        /* reduce polynomials modulo p */
-        _fmpz_vec_get_nmod_vec(a, A, len1, mod);
-        _fmpz_vec_get_nmod_vec(b, B, len2, mod);
 
-        /* compute resultant over Z/pZ */
-        rarr[i] = _nmod_poly_resultant(a, len1, b, len2, mod);
-        rarr[i] = n_mulmod2_preinv(rarr[i], d, mod.n, mod.ninv);
+        dinv[i] = n_invmod(d, p);
         parr[i++] = p;
     }
 
+    _fmpz_poly_resultant_multi_mod_ui(rarr, parr, num_primes, A, len1, B, len2);
+
+    for (i = 0; i < num_primes; i++)
+        rarr[i] = n_mulmod2(rarr[i], dinv[i], parr[i]);
+
+    _nmod_vec_clear(dinv);
+
     fmpz_comb_init(comb, parr, num_primes);
     fmpz_comb_temp_init(comb_temp, comb);
     
@@ -158,9 +151,6 @@ void _fmpz_poly_resultant_modular_div(fmpz_t res,
     fmpz_comb_temp_clear(comb_temp);
     fmpz_comb_clear(comb);
         
-    _nmod_vec_clear(a);
-    _nmod_vec_clear(b);
-
     _nmod_vec_clear(parr);
     _nmod_vec_clear(rarr);
     
@@ -0,0 +1,121 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "fmpz_poly.h"
+#include "nmod_poly.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+    mp_ptr res;
+    mp_srcptr primes;
+    slong i0;
+    slong i1;
+    const fmpz * A;
+    slong len1;
+    const fmpz * B;
+    slong len2;
+}
+_resultant_arg_t;
+
+/*
+   The primes are taken in batches, for which the polynomials are reduced
+   together with a comb before the resultants are computed one by one.
+*/
+static void
+_fmpz_poly_resultant_multi_mod_ui_range(_resultant_arg_t * arg)
+{
+    slong i, j, n, len1 = arg->len1, len2 = arg->len2;
+    mp_ptr * a, * b, abuf, bbuf;
+    fmpz_comb_t comb;
+
+    n = FLINT_MIN(FMPZ_POLY_MULTI_MOD_BATCH, arg->i1 - arg->i0);
+
+    a = flint_malloc(sizeof(mp_ptr) * n);
+    b = flint_malloc(sizeof(mp_ptr) * n);
+    abuf = _nmod_vec_init(n * len1);
+    bbuf = _nmod_vec_init(n * len2);
+
+    for (j = 0; j < n; j++)
+    {
+        a[j] = abuf + j*len1;
+        b[j] = bbuf + j*len2;
+    }
+
+    for (i = arg->i0; i < arg->i1; i += n)
+    {
+        n = FLINT_MIN(FMPZ_POLY_MULTI_MOD_BATCH, arg->i1 - i);
+
+        fmpz_comb_init(comb, arg->primes + i, n);
+
+        _fmpz_vec_multi_mod_ui(a, arg->A, len1, comb);
+        _fmpz_vec_multi_mod_ui(b, arg->B, len2, comb);
+
+        for (j = 0; j < n; j++)
+            arg->res[i + j] = _nmod_poly_resultant(a[j], len1,
+                                                 b[j], len2, comb->mod[j]);
+
+        fmpz_comb_clear(comb);
+    }
+
+    flint_free(a);
+    flint_free(b);
+    _nmod_vec_clear(abuf);
+    _nmod_vec_clear(bbuf);
+}
+
+static void
+_fmpz_poly_resultant_multi_mod_ui_worker(void * arg_ptr)
+{
+    _fmpz_poly_resultant_multi_mod_ui_range((_resultant_arg_t *) arg_ptr);
+}
+
+void
+_fmpz_poly_resultant_multi_mod_ui(mp_ptr res, mp_srcptr primes,
+      slong num_primes, const fmpz * A, slong len1, const fmpz * B, slong len2)
+{
+    _resultant_arg_t * args;
+    slong i, num_threads;
+
+    if (num_primes <= 0)
+        return;
+
+    num_threads = flint_get_num_threads();
+    if (len2 < FMPZ_POLY_MODULAR_THREAD_CUTOFF)
+        num_threads = 1;
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads, num_primes));
+
+    args = flint_malloc(sizeof(_resultant_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].res = res;
+        args[i].primes = primes;
+        args[i].i0 = (num_primes * i) / num_threads;
+        args[i].i1 = (num_primes * (i + 1)) / num_threads;
+        args[i].A = A;
+        args[i].len1 = len1;
+        args[i].B = B;
+        args[i].len2 = len2;
+    }
+
+    if (num_threads == 1)
+        _fmpz_poly_resultant_multi_mod_ui_range(args);
+    else
+        flint_parallel_do(_fmpz_poly_resultant_multi_mod_ui_worker, args,
+                      num_threads, sizeof(_resultant_arg_t), num_threads);
+
+    flint_free(args);
+}
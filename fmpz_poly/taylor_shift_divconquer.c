@@ -10,19 +10,18 @@
 */
 
 #include <math.h>
-#include <pthread.h>
 #include <gmp.h>
 #include "flint.h"
 #include "fmpz.h"
 #include "fmpz_poly.h"
 #include "nmod_poly.h"
+#include "thread_pool.h"
 
 typedef struct
 {
     fmpz * poly;
     const fmpz * c;
     slong len;
-    slong num_threads;
     slong num_total_threads;
 }
 worker_t;
@@ -30,15 +29,12 @@ worker_t;
 void _fmpz_poly_taylor_shift_dc(fmpz * poly,
     const fmpz_t c, slong len, slong num_total_threads);
 
-static void *
+static void
 _fmpz_poly_taylor_shift_dc_worker(void * arg_ptr)
 {
     worker_t * data = (worker_t *) arg_ptr;
-    flint_set_num_threads(data->num_threads);
     _fmpz_poly_taylor_shift_dc(data->poly, data->c, data->len,
                                data->num_total_threads);
-    flint_cleanup();
-    return NULL;
 }
 
 void
@@ -85,13 +81,11 @@ _fmpz_poly_taylor_shift_dc(fmpz * poly, const fmpz_t c, slong len,
     }
     else
     {
-        pthread_t threads[2];
         worker_t args[2];
 
         args[0].poly = poly;
         args[0].c = c;
         args[0].len = len1;
-        args[0].num_threads = flint_get_num_threads() / 2;
 
         if (num_total_threads == 1)
             args[0].num_total_threads = flint_get_num_threads();
@@ -101,16 +95,11 @@ _fmpz_poly_taylor_shift_dc(fmpz * poly, const fmpz_t c, slong len,
         args[1].poly = poly + len1;
         args[1].c = c;
         args[1].len = len2;
-        args[1].num_threads = args[0].num_threads;
         args[1].num_total_threads = args[0].num_total_threads;
 
-        pthread_create(&threads[0], NULL,
-            _fmpz_poly_taylor_shift_dc_worker, &args[0]);
-        pthread_create(&threads[1], NULL,
-            _fmpz_poly_taylor_shift_dc_worker, &args[1]);
-
-        pthread_join(threads[0], NULL);
-        pthread_join(threads[1], NULL);
+        /* each half gets half of the remaining threads for its recursion */
+        flint_parallel_do(_fmpz_poly_taylor_shift_dc_worker, args, 2,
+                                                       sizeof(worker_t), 2);
     }
 
     tmp = _fmpz_vec_init(len1 + 1);
@@ -9,94 +9,12 @@
     (at your option) any later version.  See <http://www.gnu.org/licenses/>.
 */
 
-#include <pthread.h>
 #include <gmp.h>
 #include "flint.h"
 #include "fmpz.h"
+#include "fmpz_vec.h"
 #include "fmpz_poly.h"
-
-typedef struct
-{
-    fmpz * vec;
-    mp_ptr * residues;
-    slong n0;
-    slong n1;
-    mp_srcptr primes;
-    slong num_primes;
-    int crt;  /* reduce if 0, lift if 1 */
-}
-mod_ui_arg_t;
-
-void *
-_fmpz_vec_multi_mod_ui_worker(void * arg_ptr)
-{
-    mod_ui_arg_t arg = *((mod_ui_arg_t *) arg_ptr);
-    mp_ptr tmp;
-    slong i, j;
-
-    fmpz_comb_t comb;
-    fmpz_comb_temp_t comb_temp;
-
-    tmp = flint_malloc(sizeof(mp_limb_t) * arg.num_primes);
-    fmpz_comb_init(comb, arg.primes, arg.num_primes);
-    fmpz_comb_temp_init(comb_temp, comb);
-
-    for (i = arg.n0; i < arg.n1; i++)
-    {
-        if (arg.crt)
-        {
-            for (j = 0; j < arg.num_primes; j++)
-                tmp[j] = arg.residues[j][i];
-            fmpz_multi_CRT_ui(arg.vec + i, tmp, comb, comb_temp, 1);
-        }
-        else
-        {
-            fmpz_multi_mod_ui(tmp, arg.vec + i, comb, comb_temp);
-            for (j = 0; j < arg.num_primes; j++)
-                arg.residues[j][i] = tmp[j];
-        }
-    }
-
-    flint_free(tmp);
-    fmpz_comb_clear(comb);
-    fmpz_comb_temp_clear(comb_temp);
-
-    flint_cleanup();
-    return NULL;
-}
-
-void
-_fmpz_vec_multi_mod_ui_threaded(mp_ptr * residues, fmpz * vec, slong len,
-    mp_srcptr primes, slong num_primes, int crt)
-{
-    pthread_t * threads;
-    mod_ui_arg_t * args;
-    slong i, num_threads;
-
-    num_threads = flint_get_num_threads();
-    threads = flint_malloc(sizeof(pthread_t) * num_threads);
-    args = flint_malloc(sizeof(mod_ui_arg_t) * num_threads);
-
-    for (i = 0; i < num_threads; i++)
-    {
-        args[i].vec = vec;
-        args[i].residues = residues;
-        args[i].n0 = (len * i) / num_threads;
-        args[i].n1 = (len * (i + 1)) / num_threads;
-        args[i].primes = (mp_ptr) primes;
-        args[i].num_primes = num_primes;
-        args[i].crt = crt;
-
-        pthread_create(&threads[i], NULL,
-            _fmpz_vec_multi_mod_ui_worker, &args[i]);
-    }
-
-    for (i = 0; i < num_threads; i++)
-        pthread_join(threads[i], NULL);
-
-    flint_free(threads);
-    flint_free(args);
-}
+#include "thread_pool.h"
 
 typedef struct
 {
@@ -110,7 +28,7 @@ typedef struct
 }
 taylor_shift_arg_t;
 
-void *
+void
 _fmpz_poly_multi_taylor_shift_worker(void * arg_ptr)
 {
     taylor_shift_arg_t arg = *((taylor_shift_arg_t *) arg_ptr);
@@ -126,21 +44,16 @@ _fmpz_poly_multi_taylor_shift_worker(void * arg_ptr)
         cm = fmpz_fdiv_ui(arg.c, p);
         _nmod_poly_taylor_shift(arg.residues[i], cm, arg.len, mod);
     }
-
-    flint_cleanup();
-    return NULL;
 }
 
 void
 _fmpz_poly_multi_taylor_shift_threaded(mp_ptr * residues, slong len,
     const fmpz_t c, mp_srcptr primes, slong num_primes)
 {
-    pthread_t * threads;
     taylor_shift_arg_t * args;
     slong i, num_threads;
 
     num_threads = flint_get_num_threads();
-    threads = flint_malloc(sizeof(pthread_t) * num_threads);
     args = flint_malloc(sizeof(taylor_shift_arg_t) * num_threads);
 
     for (i = 0; i < num_threads; i++)
@@ -152,15 +65,11 @@ _fmpz_poly_multi_taylor_shift_threaded(mp_ptr * residues, slong len,
         args[i].primes = (mp_ptr) primes;
         args[i].num_primes = num_primes;
         args[i].c = (fmpz *) c;
-
-        pthread_create(&threads[i], NULL,
-            _fmpz_poly_multi_taylor_shift_worker, &args[i]);
     }
 
-    for (i = 0; i < num_threads; i++)
-        pthread_join(threads[i], NULL);
+    flint_parallel_do(_fmpz_poly_multi_taylor_shift_worker, args,
+                   num_threads, sizeof(taylor_shift_arg_t), num_threads);
 
-    flint_free(threads);
     flint_free(args);
 }
 
@@ -170,6 +79,7 @@ _fmpz_poly_taylor_shift_multi_mod_threaded(fmpz * poly, const fmpz_t c, slong le
     slong xbits, ybits, num_primes, i;
     mp_ptr primes;
     mp_ptr * residues;
+    fmpz_comb_t comb;
 
     if (len <= 1 || fmpz_is_zero(c))
         return;
@@ -205,9 +115,13 @@ _fmpz_poly_taylor_shift_multi_mod_threaded(fmpz * poly, const fmpz_t c, slong le
     for (i = 0; i < num_primes; i++)
         residues[i] = flint_malloc(sizeof(mp_limb_t) * len);
 
-    _fmpz_vec_multi_mod_ui_threaded(residues, poly, len, primes, num_primes, 0);
+    fmpz_comb_init(comb, primes, num_primes);
+
+    _fmpz_vec_multi_mod_ui(residues, poly, len, comb);
     _fmpz_poly_multi_taylor_shift_threaded(residues, len, c, primes, num_primes);
-    _fmpz_vec_multi_mod_ui_threaded(residues, poly, len, primes, num_primes, 1);
+    _fmpz_vec_multi_CRT_ui(poly, residues, len, comb, 1);
+
+    fmpz_comb_clear(comb);
 
     for (i = 0; i < num_primes; i++)
         flint_free(residues[i]);
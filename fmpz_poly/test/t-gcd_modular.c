@@ -113,6 +113,9 @@ main(void)
 
         fmpz_poly_mul(f, a, f);
         fmpz_poly_mul(g, a, g);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
         fmpz_poly_gcd_modular(d, f, g);
 
         fmpz_poly_divrem_divconquer(q, r, d, a);
@@ -156,6 +159,9 @@ main(void)
 
         fmpz_poly_mul(f, a, f);
         fmpz_poly_mul(g, a, g);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
         fmpz_poly_gcd_modular(d, f, g);
 
         if (!_t_gcd_is_canonical(a)) fmpz_poly_neg(a, a);
@@ -179,6 +185,8 @@ main(void)
         fmpz_poly_clear(r);
     }
 
+    flint_set_num_threads(1);
+
     /* Sebastian's test case */
     {
         fmpz_poly_t a, b, d;
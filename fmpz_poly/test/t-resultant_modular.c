@@ -105,6 +105,43 @@ main(void)
         fmpz_poly_clear(p);
     }
 
+    /* Check long polynomials, with threads, against the euclidean version */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+        fmpz_t a, b;
+        fmpz_poly_t f, g;
+
+        fmpz_init(a);
+        fmpz_init(b);
+        fmpz_poly_init(f);
+        fmpz_poly_init(g);
+        fmpz_poly_randtest(f, state, n_randint(state, 50) + 64, 50);
+        fmpz_poly_randtest(g, state, n_randint(state, 50) + 64, 50);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        fmpz_poly_resultant_modular(a, f, g);
+        fmpz_poly_resultant_euclidean(b, f, g);
+
+        result = (fmpz_equal(a, b));
+        if (!result)
+        {
+            flint_printf("FAIL (long):\n");
+            flint_printf("f(x) = "), fmpz_poly_print_pretty(f, "x"), flint_printf("\n\n");
+            flint_printf("g(x) = "), fmpz_poly_print_pretty(g, "x"), flint_printf("\n\n");
+            flint_printf("res_modular(f, g)   = "), fmpz_print(a), flint_printf("\n\n");
+            flint_printf("res_euclidean(f, g) = "), fmpz_print(b), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_clear(a);
+        fmpz_clear(b);
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(g);
+    }
+
+    flint_set_num_threads(1);
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
@@ -18,6 +18,136 @@
 #include "fmpz_mat.h"
 
 #include "fmpz_mod_poly.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+   fmpz_mat_struct * res;
+   const fmpz_poly_struct * f;
+   const fmpz_poly_factor_struct * lifted_fac;
+   const fmpz * P;
+   slong k;
+   slong lo_n;
+   slong hi_n;
+   slong i0;
+   slong i1;
+}
+_CLD_mat_arg_t;
+
+/* CLD bounds for columns i0, ..., i1 - 1 at each end */
+static void
+_fmpz_poly_factor_CLD_bounds_worker(void * arg_ptr)
+{
+   _CLD_mat_arg_t * arg = (_CLD_mat_arg_t *) arg_ptr;
+   const fmpz_poly_struct * f = arg->f;
+   fmpz * bounds = arg->res->rows[arg->lifted_fac->num];
+   slong i, k = arg->k;
+
+   for (i = arg->i0; i < arg->i1; i++)
+   {
+      fmpz_poly_CLD_bound(bounds + i, f, i);
+      fmpz_poly_CLD_bound(bounds + 2*k - i - 1, f, f->length - i - 2);
+   }
+}
+
+/* rows i0, ..., i1 - 1 of the matrix, one for each lifted factor */
+static void
+_fmpz_poly_factor_CLD_rows_worker(void * arg_ptr)
+{
+   _CLD_mat_arg_t * arg = (_CLD_mat_arg_t *) arg_ptr;
+   const fmpz_poly_struct * f = arg->f;
+   const fmpz_poly_factor_struct * lifted_fac = arg->lifted_fac;
+   fmpz ** rows = arg->res->rows;
+   slong i, zeroes, lo_n = arg->lo_n, hi_n = arg->hi_n;
+   fmpz_poly_t gd, gcld, temp;
+   fmpz_poly_t trunc_f, trunc_fac; /* don't initialise trunc_f, trunc_fac */
+
+   fmpz_poly_init(gd);
+   fmpz_poly_init(gcld);
+   fmpz_poly_init(temp);
+
+   if (lo_n > 0)
+   {
+      for (i = arg->i0; i < arg->i1; i++)
+      {
+         zeroes = 0;
+         while (zeroes < lifted_fac->p[i].length - 1
+                   && fmpz_is_zero(lifted_fac->p[i].coeffs + zeroes))
+            zeroes++;
+
+         fmpz_poly_attach_truncate(trunc_fac, lifted_fac->p + i, lo_n + zeroes + 1);
+         fmpz_poly_derivative(gd, trunc_fac);
+         fmpz_poly_mullow(gcld, f, gd, lo_n + zeroes);
+         fmpz_poly_divlow_smodp(rows[i], gcld, trunc_fac, arg->P, lo_n);
+      }
+   }
+
+   if (hi_n > 0)
+   {
+      fmpz_poly_attach_shift(trunc_f, f, f->length - hi_n);
+
+      for (i = arg->i0; i < arg->i1; i++)
+      {
+         slong len = lifted_fac->p[i].length - hi_n - 1;
+
+         if (len < 0)
+         {
+            fmpz_poly_shift_left(temp, lifted_fac->p + i, -len);
+            fmpz_poly_derivative(gd, temp);
+            fmpz_poly_mulhigh_n(gcld, trunc_f, gd, hi_n);
+            fmpz_poly_divhigh_smodp(rows[i] + lo_n, gcld, temp, arg->P, hi_n);
+         } else
+         {
+            fmpz_poly_attach_shift(trunc_fac, lifted_fac->p + i, len);
+            fmpz_poly_derivative(gd, trunc_fac);
+            fmpz_poly_mulhigh_n(gcld, trunc_f, gd, hi_n);
+            fmpz_poly_divhigh_smodp(rows[i] + lo_n, gcld, trunc_fac, arg->P, hi_n);
+         }
+      }
+   }
+
+   /* do not clear trunc_fac */
+   /* do not clear trunc_f */
+   fmpz_poly_clear(gd);
+   fmpz_poly_clear(gcld);
+   fmpz_poly_clear(temp);
+}
+
+/* split n items between the threads and run the worker on each range */
+static void
+_fmpz_poly_factor_CLD_mat_parallel(void (*worker)(void *),
+                                   _CLD_mat_arg_t * arg, slong n)
+{
+   _CLD_mat_arg_t * args;
+   slong i, num_threads;
+
+   num_threads = flint_get_num_threads();
+   if (arg->f->length < FMPZ_POLY_FACTOR_CLD_THREAD_CUTOFF)
+      num_threads = 1;
+   num_threads = FLINT_MAX(1, FLINT_MIN(num_threads, n));
+
+   if (num_threads == 1)
+   {
+      arg->i0 = 0;
+      arg->i1 = n;
+      worker(arg);
+      return;
+   }
+
+   args = flint_malloc(sizeof(_CLD_mat_arg_t) * num_threads);
+
+   for (i = 0; i < num_threads; i++)
+   {
+      args[i] = *arg;
+      args[i].i0 = (n * i) / num_threads;
+      args[i].i1 = (n * (i + 1)) / num_threads;
+   }
+
+   flint_parallel_do(worker, args, num_threads,
+                                   sizeof(_CLD_mat_arg_t), num_threads);
+
+   flint_free(args);
+}
 
 slong _fmpz_poly_factor_CLD_mat(fmpz_mat_t res, const fmpz_poly_t f,
                               fmpz_poly_factor_t lifted_fac, fmpz_t P, ulong k)
@@ -28,21 +158,26 @@ slong _fmpz_poly_factor_CLD_mat(fmpz_mat_t res, const fmpz_poly_t f,
       derivative fg'/g. The results are stored in res, along with an extra
       row for the CLD bounds for that column. The matrix res is required to be
       initialised to be of size (r + 1, 2k).
+
+      The bounds, and then the rows, are independent of each other and are
+      computed in parallel.
    */
 
-   slong i, zeroes, bound, lo_n, hi_n, r = lifted_fac->num;
+   slong i, bound, lo_n, hi_n, r = lifted_fac->num;
    slong bit_r = FLINT_MAX(r, 20);
-   fmpz_poly_t gd, gcld, temp;
-   fmpz_poly_t trunc_f, trunc_fac; /* don't initialise trunc_f, trunc_fac */
+   _CLD_mat_arg_t arg;
    fmpz_t t;
 
+   arg.res = res;
+   arg.f = f;
+   arg.lifted_fac = lifted_fac;
+   arg.P = P;
+   arg.k = k;
+
    /* insert CLD bounds in last row of matrix */
 
-   for (i = 0; i < k; i++)
-   {
-      fmpz_poly_CLD_bound(res->rows[r] + i, f, i);
-      fmpz_poly_CLD_bound(res->rows[r] + 2*k - i - 1, f, f->length - i - 2);
-   }
+   _fmpz_poly_factor_CLD_mat_parallel(_fmpz_poly_factor_CLD_bounds_worker,
+                                                                &arg, k);
 
    /* we exclude columns in the middle for which CLD bounds are too large */
 
@@ -72,52 +207,13 @@ slong _fmpz_poly_factor_CLD_mat(fmpz_mat_t res, const fmpz_poly_t f,
 
    /* now insert data into matrix */
 
-   fmpz_poly_init(gd);
-   fmpz_poly_init(gcld);
-   /* do not initialise trunc_f */
-   /* do not initialise trunc_fac */
-
-   if (lo_n > 0)
-   {
-      for (i = 0; i < r; i++)
-      {
-         zeroes = 0;
-         while (lifted_fac->p[i].coeffs + zeroes)
-            zeroes++;
-
-         fmpz_poly_attach_truncate(trunc_fac, lifted_fac->p + i, lo_n + zeroes + 1);
-         fmpz_poly_derivative(gd, trunc_fac);
-         fmpz_poly_mullow(gcld, f, gd, lo_n + zeroes);
-         fmpz_poly_divlow_smodp(res->rows[i], gcld, trunc_fac, P, lo_n);
-      }      
-   }
-
-   if (hi_n > 0)
+   if (lo_n > 0 || hi_n > 0)
    {
-      fmpz_poly_init(temp);
-
-      fmpz_poly_attach_shift(trunc_f, f, f->length - hi_n);
-      
-      for (i = 0; i < r; i++)
-      {
-         slong len = lifted_fac->p[i].length - hi_n - 1;
-
-         if (len < 0)
-         {
-            fmpz_poly_shift_left(temp, lifted_fac->p + i, -len);
-            fmpz_poly_derivative(gd, temp);
-            fmpz_poly_mulhigh_n(gcld, trunc_f, gd, hi_n);
-            fmpz_poly_divhigh_smodp(res->rows[i] + lo_n, gcld, temp, P, hi_n);
-         } else
-         {
-            fmpz_poly_attach_shift(trunc_fac, lifted_fac->p + i, len);
-            fmpz_poly_derivative(gd, trunc_fac);
-            fmpz_poly_mulhigh_n(gcld, trunc_f, gd, hi_n);
-            fmpz_poly_divhigh_smodp(res->rows[i] + lo_n, gcld, trunc_fac, P, hi_n);
-         }
-      }
+      arg.lo_n = lo_n;
+      arg.hi_n = hi_n;
 
-      fmpz_poly_clear(temp);      
+      _fmpz_poly_factor_CLD_mat_parallel(_fmpz_poly_factor_CLD_rows_worker,
+                                                                &arg, r);
    }
 
    if (hi_n > 0)
@@ -127,11 +223,5 @@ slong _fmpz_poly_factor_CLD_mat(fmpz_mat_t res, const fmpz_poly_t f,
          fmpz_set(res->rows[r] + lo_n + i, res->rows[r] + 2*k - hi_n + i);
    }
 
-   /* do not clear trunc_fac */
-   /* do not clear trunc_f */
-   fmpz_poly_clear(gd);
-   fmpz_poly_clear(gcld);
-
    return lo_n + hi_n;
 }
-
@@ -14,6 +14,7 @@
 #include <stdlib.h>
 #include "flint.h"
 #include "fmpz_poly.h"
+#include "ulong_extras.h"
 
 #define LONG_FAC_TEST 0 /* run an extra long test */
 #define TEST_HARD 0 /* test hard polynomials */
@@ -155,6 +156,63 @@ main(void)
         fmpz_poly_factor_clear(fac);
     }
 
+    /*
+       products of many quadratics have many local factors, with threads;
+       the degree is at least FMPZ_POLY_HENSEL_THREAD_CUTOFF so that the
+       subtrees of the Hensel tree are lifted in parallel
+    */
+    for (i = 0; i < 2 * flint_test_multiplier(); i++)
+    {
+        fmpz_poly_t f, g, h;
+        fmpz_poly_factor_t fac;
+        slong j, n = n_randint(state, 9) + 32;
+        ulong a = 1;
+
+        fmpz_poly_init(f);
+        fmpz_poly_init(g);
+        fmpz_poly_init(h);
+        fmpz_poly_factor_init(fac);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        fmpz_poly_one(f);
+        fmpz_poly_set_coeff_ui(g, 2, 1);
+
+        for (j = 0; j < n; j++)
+        {
+            /* x^2 - a for distinct non-squares a */
+            do {
+               a += n_randint(state, 4) + 1;
+            } while (n_is_square(a));
+
+            fmpz_poly_set_coeff_si(g, 0, -(slong) a);
+            fmpz_poly_mul(f, f, g);
+        }
+
+        fmpz_poly_factor(fac, f);
+
+        fmpz_poly_set_fmpz(h, &fac->c);
+        for (j = 0; j < fac->num; j++)
+            fmpz_poly_mul(h, h, fac->p + j);
+
+        result = fmpz_poly_equal(f, h) && fac->num == n;
+        if (!result)
+        {
+            flint_printf("FAIL (threads):\n");
+            flint_printf("n = %wd, num = %wd\n", n, fac->num);
+            flint_printf("f = "), fmpz_poly_print(f), flint_printf("\n\n");
+            flint_printf("fac = "), fmpz_poly_factor_print(fac), flint_printf("\n\n");
+            abort();
+        }
+
+        fmpz_poly_clear(f);
+        fmpz_poly_clear(g);
+        fmpz_poly_clear(h);
+        fmpz_poly_factor_clear(fac);
+    }
+
+    flint_set_num_threads(1);
+
     FLINT_TEST_CLEANUP(state);
     
     flint_printf("PASS\n");
@@ -98,6 +98,20 @@ FLINT_DLL void _fmpz_vec_set_nmod_vec(fmpz * res,
 FLINT_DLL void _fmpz_vec_get_nmod_vec(mp_ptr res, 
                                     const fmpz * poly, slong len, nmod_t mod);
 
+/*
+   Entries of at most max(16, min(num_primes, DIRECT_LIMBS)) limbs are
+   reduced directly rather than with the remainder tree; conversions of
+   at least THREAD_CUTOFF entries times primes are split across threads.
+*/
+#define FMPZ_VEC_MULTI_MOD_DIRECT_LIMBS 128
+#define FMPZ_VEC_MULTI_MOD_THREAD_CUTOFF 100000
+
+FLINT_DLL void _fmpz_vec_multi_mod_ui(mp_ptr * residues, const fmpz * vec,
+                                         slong len, const fmpz_comb_t comb);
+
+FLINT_DLL void _fmpz_vec_multi_CRT_ui(fmpz * vec, const mp_ptr * residues,
+                               slong len, const fmpz_comb_t comb, int sign);
+
 FLINT_DLL slong _fmpz_vec_get_fft(mp_limb_t ** coeffs_f, 
                                  const fmpz * coeffs_m, slong l, slong length);
 
@@ -225,6 +239,17 @@ FLINT_DLL void _fmpz_vec_content(fmpz_t res, const fmpz * vec, slong len);
 
 FLINT_DLL void _fmpz_vec_lcm(fmpz_t res, const fmpz * vec, slong len);
 
+/*  Primality testing  *******************************************************/
+
+/*
+   Multi-limb entries are sieved in blocks of BLOCK entries with a
+   remainder tree against the primes up to SIEVE_BOUND.
+*/
+#define FMPZ_VEC_IS_PROBABPRIME_BLOCK 64
+#define FMPZ_VEC_IS_PROBABPRIME_SIEVE_BOUND 32768
+
+FLINT_DLL void _fmpz_vec_is_probabprime(int * res, const fmpz * vec, slong len);
+
 /*  Dot product  *************************************************************/
 
 FLINT_DLL void _fmpz_vec_dot(fmpz_t res, const fmpz * vec1, const fmpz * vec2, slong len2);
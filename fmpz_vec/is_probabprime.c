@@ -0,0 +1,174 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+    int * res;
+    const fmpz * vec;
+    const slong * idx;      /* entries of the block */
+    slong len;
+    const fmpz * primorial;
+}
+_is_probabprime_arg_t;
+
+/*
+    Reduces the primorial modulo the product of the entries of the block
+    and carries the remainder down the product tree, so that every entry
+    meets all small primes at the cost of a few multiplications and
+    divisions of balanced size. Entries sharing a factor with the
+    primorial exceed the sieve bound and are composite; the others get a
+    BPSW test.
+*/
+static void
+_fmpz_vec_is_probabprime_block(_is_probabprime_arg_t * arg)
+{
+    slong len = arg->len, i, j, k, depth, * lens;
+    fmpz ** tree;
+    fmpz_t g;
+
+    for (depth = 1, k = len; k > 1; k = (k + 1) / 2)
+        depth++;
+
+    tree = flint_malloc(sizeof(fmpz *) * depth);
+    lens = flint_malloc(sizeof(slong) * depth);
+
+    lens[0] = len;
+    tree[0] = _fmpz_vec_init(len);
+    for (i = 0; i < len; i++)
+        fmpz_set(tree[0] + i, arg->vec + arg->idx[i]);
+
+    for (k = 1; k < depth; k++)
+    {
+        lens[k] = (lens[k - 1] + 1) / 2;
+        tree[k] = _fmpz_vec_init(lens[k]);
+
+        for (j = 0; j < lens[k]; j++)
+        {
+            if (2 * j + 1 < lens[k - 1])
+                fmpz_mul(tree[k] + j, tree[k - 1] + 2 * j,
+                                      tree[k - 1] + 2 * j + 1);
+            else
+                fmpz_set(tree[k] + j, tree[k - 1] + 2 * j);
+        }
+    }
+
+    /* replace the tree by the remainders from the top down */
+    fmpz_mod(tree[depth - 1], arg->primorial, tree[depth - 1]);
+
+    for (k = depth - 2; k >= 0; k--)
+        for (j = 0; j < lens[k]; j++)
+            fmpz_mod(tree[k] + j, tree[k + 1] + j / 2, tree[k] + j);
+
+    fmpz_init(g);
+
+    for (i = 0; i < len; i++)
+    {
+        const fmpz * n = arg->vec + arg->idx[i];
+
+        fmpz_gcd(g, tree[0] + i, n);
+
+        if (fmpz_is_one(g))
+            arg->res[arg->idx[i]] = fmpz_is_probabprime_BPSW(n);
+        else
+            arg->res[arg->idx[i]] = 0;
+    }
+
+    fmpz_clear(g);
+
+    for (k = 0; k < depth; k++)
+        _fmpz_vec_clear(tree[k], lens[k]);
+
+    flint_free(tree);
+    flint_free(lens);
+}
+
+static void
+_fmpz_vec_is_probabprime_worker(void * arg_ptr)
+{
+    _fmpz_vec_is_probabprime_block((_is_probabprime_arg_t *) arg_ptr);
+}
+
+void
+_fmpz_vec_is_probabprime(int * res, const fmpz * vec, slong len)
+{
+    slong i, j, num_small, num_large, num_blocks;
+    _is_probabprime_arg_t * args;
+    slong * large;
+    ulong * small;
+    int * small_res;
+    fmpz_t P;
+
+    small = flint_malloc(sizeof(ulong) * len);
+    small_res = flint_malloc(sizeof(int) * len);
+    large = flint_malloc(sizeof(slong) * len);
+
+    num_small = num_large = 0;
+
+    for (i = 0; i < len; i++)
+    {
+        if (fmpz_sgn(vec + i) <= 0)
+            res[i] = 0;
+        else if (fmpz_abs_fits_ui(vec + i))
+            small[num_small++] = fmpz_get_ui(vec + i);
+        else
+            large[num_large++] = i;
+    }
+
+    /* single limb candidates are proved */
+    n_is_prime_vec(small_res, small, num_small);
+
+    for (i = 0, j = 0; i < len; i++)
+        if (fmpz_sgn(vec + i) > 0 && fmpz_abs_fits_ui(vec + i))
+            res[i] = small_res[j++];
+
+    if (num_large > 0)
+    {
+        fmpz_init(P);
+        fmpz_primorial(P, FMPZ_VEC_IS_PROBABPRIME_SIEVE_BOUND);
+
+        num_blocks = (num_large + FMPZ_VEC_IS_PROBABPRIME_BLOCK - 1)
+                                               / FMPZ_VEC_IS_PROBABPRIME_BLOCK;
+        args = flint_malloc(sizeof(_is_probabprime_arg_t) * num_blocks);
+
+        for (i = 0; i < num_blocks; i++)
+        {
+            slong i0 = i * FMPZ_VEC_IS_PROBABPRIME_BLOCK;
+
+            args[i].res = res;
+            args[i].vec = vec;
+            args[i].idx = large + i0;
+            args[i].len = FLINT_MIN(FMPZ_VEC_IS_PROBABPRIME_BLOCK,
+                                                              num_large - i0);
+            args[i].primorial = P;
+        }
+
+        if (num_blocks == 1)
+            _fmpz_vec_is_probabprime_block(args);
+        else
+            flint_parallel_do(_fmpz_vec_is_probabprime_worker, args,
+                   num_blocks, sizeof(_is_probabprime_arg_t),
+                   flint_get_num_threads());
+
+        flint_free(args);
+        fmpz_clear(P);
+    }
+
+    flint_free(small);
+    flint_free(small_res);
+    flint_free(large);
+}
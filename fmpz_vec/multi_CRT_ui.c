@@ -0,0 +1,111 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "thread_pool.h"
+
+/* residues of this many limbs in all are gathered at a time */
+#define MULTI_CRT_BUFFER 8192
+
+typedef struct
+{
+    fmpz * vec;
+    const mp_ptr * residues;
+    slong i0;
+    slong i1;
+    const fmpz_comb_struct * comb;
+    int sign;
+}
+_multi_CRT_arg_t;
+
+/*
+   The residues of a chunk of entries are first gathered prime by prime,
+   reading each array sequentially, then each entry is reconstructed up the
+   tree with the same temporaries.
+*/
+static void
+_fmpz_vec_multi_CRT_ui_range(_multi_CRT_arg_t * arg)
+{
+    const fmpz_comb_struct * comb = arg->comb;
+    slong num_primes = comb->num_primes;
+    slong i, k, c0, c1, chunk;
+    fmpz_comb_temp_t temp;
+    mp_ptr r;
+
+    chunk = FLINT_MAX(1, MULTI_CRT_BUFFER / num_primes);
+    r = flint_malloc(sizeof(mp_limb_t) * num_primes * FLINT_MIN(chunk, arg->i1 - arg->i0));
+    fmpz_comb_temp_init(temp, comb);
+
+    for (c0 = arg->i0; c0 < arg->i1; c0 = c1)
+    {
+        c1 = FLINT_MIN(c0 + chunk, arg->i1);
+
+        for (k = 0; k < num_primes; k++)
+        {
+            mp_srcptr in = arg->residues[k];
+
+            for (i = c0; i < c1; i++)
+                r[(i - c0)*num_primes + k] = in[i];
+        }
+
+        for (i = c0; i < c1; i++)
+            fmpz_multi_CRT_ui(arg->vec + i, r + (i - c0)*num_primes,
+                                                  comb, temp, arg->sign);
+    }
+
+    fmpz_comb_temp_clear(temp);
+    flint_free(r);
+}
+
+static void
+_fmpz_vec_multi_CRT_ui_worker(void * arg_ptr)
+{
+    _fmpz_vec_multi_CRT_ui_range((_multi_CRT_arg_t *) arg_ptr);
+}
+
+void
+_fmpz_vec_multi_CRT_ui(fmpz * vec, const mp_ptr * residues, slong len,
+                                            const fmpz_comb_t comb, int sign)
+{
+    slong i, num_threads, num_primes = comb->num_primes;
+    _multi_CRT_arg_t * args;
+
+    if (len <= 0)
+        return;
+
+    num_threads = flint_get_num_threads();
+    if ((double) len * num_primes < FMPZ_VEC_MULTI_MOD_THREAD_CUTOFF)
+        num_threads = 1;
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads, len));
+
+    args = flint_malloc(sizeof(_multi_CRT_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].vec = vec;
+        args[i].residues = residues;
+        args[i].i0 = (len * i) / num_threads;
+        args[i].i1 = (len * (i + 1)) / num_threads;
+        args[i].comb = comb;
+        args[i].sign = sign;
+    }
+
+    if (num_threads == 1)
+        _fmpz_vec_multi_CRT_ui_range(args);
+    else
+        flint_parallel_do(_fmpz_vec_multi_CRT_ui_worker, args, num_threads,
+                                     sizeof(_multi_CRT_arg_t), num_threads);
+
+    flint_free(args);
+}
@@ -0,0 +1,189 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "nmod_vec.h"
+#include "thread_pool.h"
+
+/* entries reduced together, prime by prime */
+#define MULTI_MOD_CHUNK 128
+
+typedef struct
+{
+    mp_ptr * residues;
+    const fmpz * vec;
+    slong i0;
+    slong i1;
+    const fmpz_comb_struct * comb;
+    mp_srcptr powers;   /* powers[k*limbs + j] = 2^(FLINT_BITS*j) mod p_k */
+    slong limbs;        /* entries with at most this many limbs use powers */
+}
+_multi_mod_arg_t;
+
+/*
+   Entries of up to arg->limbs limbs are reduced directly as
+   sum_j d_j (2^(FLINT_BITS*j) mod p) with a single reduction at the end,
+   prime by prime for a chunk of entries, so that the powers stay in
+   registers and the output is written sequentially. Larger entries go
+   down the remainder tree of the comb.
+*/
+static void
+_fmpz_vec_multi_mod_ui_range(_multi_mod_arg_t * arg)
+{
+    const fmpz_comb_struct * comb = arg->comb;
+    slong num_primes = comb->num_primes, limbs = arg->limbs;
+    slong i, j, k, c0, c1;
+    fmpz_comb_temp_t temp;
+    mp_ptr r = NULL;
+    int have_temp = 0;
+
+    for (c0 = arg->i0; c0 < arg->i1; c0 = c1)
+    {
+        c1 = FLINT_MIN(c0 + MULTI_MOD_CHUNK, arg->i1);
+
+        for (k = 0; k < num_primes; k++)
+        {
+            nmod_t mod = comb->mod[k];
+            mp_srcptr pw = arg->powers + k*limbs;
+            mp_ptr out = arg->residues[k];
+
+            for (i = c0; i < c1; i++)
+            {
+                fmpz c = arg->vec[i];
+
+                if (!COEFF_IS_MPZ(c))
+                {
+                    mp_limb_t t;
+
+                    NMOD_RED(t, (mp_limb_t) FLINT_ABS(c), mod);
+                    out[i] = (c < 0) ? nmod_neg(t, mod) : t;
+                }
+                else
+                {
+                    __mpz_struct * m = COEFF_TO_PTR(c);
+                    slong size = FLINT_ABS(m->_mp_size);
+                    mp_limb_t hi, lo, a2, a1, a0, t;
+
+                    if (size > limbs)
+                        continue;
+
+                    a2 = 0;
+                    a1 = 0;
+                    a0 = m->_mp_d[0];
+                    for (j = 1; j < size; j++)
+                    {
+                        umul_ppmm(hi, lo, m->_mp_d[j], pw[j]);
+                        add_sssaaaaaa(a2, a1, a0, a2, a1, a0, 0, hi, lo);
+                    }
+
+                    if (a2 >= mod.n)
+                        NMOD_RED(a2, a2, mod);
+                    NMOD_RED3(t, a2, a1, a0, mod);
+                    out[i] = (m->_mp_size < 0) ? nmod_neg(t, mod) : t;
+                }
+            }
+        }
+
+        for (i = c0; i < c1; i++)
+        {
+            fmpz c = arg->vec[i];
+
+            if (COEFF_IS_MPZ(c) && FLINT_ABS(COEFF_TO_PTR(c)->_mp_size) > limbs)
+            {
+                if (!have_temp)
+                {
+                    fmpz_comb_temp_init(temp, comb);
+                    r = flint_malloc(sizeof(mp_limb_t) * num_primes);
+                    have_temp = 1;
+                }
+
+                fmpz_multi_mod_ui(r, arg->vec + i, comb, temp);
+
+                for (k = 0; k < num_primes; k++)
+                    arg->residues[k][i] = r[k];
+            }
+        }
+    }
+
+    if (have_temp)
+    {
+        fmpz_comb_temp_clear(temp);
+        flint_free(r);
+    }
+}
+
+static void
+_fmpz_vec_multi_mod_ui_worker(void * arg_ptr)
+{
+    _fmpz_vec_multi_mod_ui_range((_multi_mod_arg_t *) arg_ptr);
+}
+
+void
+_fmpz_vec_multi_mod_ui(mp_ptr * residues, const fmpz * vec, slong len,
+                                                     const fmpz_comb_t comb)
+{
+    slong i, j, limbs, num_threads, num_primes = comb->num_primes;
+    _multi_mod_arg_t * args;
+    mp_ptr powers;
+
+    if (len <= 0)
+        return;
+
+    /* the direct method is quadratic, the tree wins on large entries */
+    limbs = FLINT_MAX(16, FLINT_MIN(num_primes, FMPZ_VEC_MULTI_MOD_DIRECT_LIMBS));
+    limbs = FLINT_MAX(1, FLINT_MIN(limbs, _fmpz_vec_max_limbs(vec, len)));
+
+    powers = flint_malloc(sizeof(mp_limb_t) * num_primes * limbs);
+
+    for (i = 0; i < num_primes; i++)
+    {
+        nmod_t mod = comb->mod[i];
+        mp_limb_t b;
+
+        NMOD_RED2(b, UWORD(1), UWORD(0), mod);    /* 2^FLINT_BITS mod p */
+
+        powers[i*limbs] = 1;
+        for (j = 1; j < limbs; j++)
+            powers[i*limbs + j] = (j == 1) ? b :
+                n_mulmod2_preinv(powers[i*limbs + j - 1], b, mod.n, mod.ninv);
+    }
+
+    num_threads = flint_get_num_threads();
+    if ((double) len * num_primes < FMPZ_VEC_MULTI_MOD_THREAD_CUTOFF)
+        num_threads = 1;
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads, len / MULTI_MOD_CHUNK));
+
+    args = flint_malloc(sizeof(_multi_mod_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].residues = residues;
+        args[i].vec = vec;
+        args[i].i0 = (len * i) / num_threads;
+        args[i].i1 = (len * (i + 1)) / num_threads;
+        args[i].comb = comb;
+        args[i].powers = powers;
+        args[i].limbs = limbs;
+    }
+
+    if (num_threads == 1)
+        _fmpz_vec_multi_mod_ui_range(args);
+    else
+        flint_parallel_do(_fmpz_vec_multi_mod_ui_worker, args, num_threads,
+                                     sizeof(_multi_mod_arg_t), num_threads);
+
+    flint_free(args);
+    flint_free(powers);
+}
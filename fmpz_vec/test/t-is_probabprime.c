@@ -0,0 +1,98 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i, j;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("is_probabprime....");
+    fflush(stdout);
+
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        slong len;
+        fmpz * vec;
+        int * res, r;
+        fmpz_t t;
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        len = n_randint(state, 50);
+        if (n_randint(state, 10) == 0)
+            len += n_randint(state, 500);
+
+        vec = _fmpz_vec_init(len);
+        res = flint_malloc(sizeof(int) * (len + 1));
+        fmpz_init(t);
+
+        for (j = 0; j < len; j++)
+        {
+            switch (n_randint(state, 4))
+            {
+                case 0:
+                    fmpz_randtest(vec + j, state, 200);
+                    break;
+                case 1:
+                    fmpz_randprime(vec + j, state,
+                                             2 + n_randint(state, 200), 0);
+                    break;
+                case 2:
+                    /* composites without small factors */
+                    fmpz_randprime(vec + j, state, 40 + n_randint(state, 60), 0);
+                    fmpz_randprime(t, state, 40 + n_randint(state, 60), 0);
+                    fmpz_mul(vec + j, vec + j, t);
+                    break;
+                default:
+                    fmpz_randtest_unsigned(vec + j, state, 150);
+                    fmpz_setbit(vec + j, 0);
+            }
+        }
+
+        _fmpz_vec_is_probabprime(res, vec, len);
+
+        for (j = 0; j < len; j++)
+        {
+            if (fmpz_sgn(vec + j) <= 0)
+                r = 0;
+            else if (fmpz_abs_fits_ui(vec + j))
+                r = n_is_prime(fmpz_get_ui(vec + j));
+            else
+                r = fmpz_is_probabprime_BPSW(vec + j);
+
+            if (res[j] != r)
+            {
+                flint_printf("FAIL:\n");
+                fmpz_print(vec + j); flint_printf("\n");
+                flint_printf("res = %d, r = %d\n", res[j], r);
+                abort();
+            }
+        }
+
+        fmpz_clear(t);
+        _fmpz_vec_clear(vec, len);
+        flint_free(res);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
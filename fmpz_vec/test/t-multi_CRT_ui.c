@@ -0,0 +1,107 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+
+int main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("multi_CRT_ui....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 300 * flint_test_multiplier(); iter++)
+    {
+        slong i, k, len, num_primes, bits;
+        mp_limb_t * primes, ** residues;
+        fmpz_comb_t comb;
+        fmpz_t M, h;
+        fmpz * vec, * vec2;
+        int sign;
+
+        len = n_randint(state, 600);
+        num_primes = n_randint(state, 150) + 1;
+        bits = n_randint(state, FLINT_BITS - 1) + 2;
+        sign = n_randint(state, 2);
+
+        primes = flint_malloc(sizeof(mp_limb_t) * num_primes);
+        primes[0] = n_nextprime(UWORD(1) << (bits - 1), 0);
+        for (k = 1; k < num_primes; k++)
+            primes[k] = n_nextprime(primes[k - 1], 0);
+
+        fmpz_init(M);
+        fmpz_init(h);
+        fmpz_one(M);
+        for (k = 0; k < num_primes; k++)
+            fmpz_mul_ui(M, M, primes[k]);
+
+        residues = flint_malloc(sizeof(mp_ptr) * num_primes);
+        for (k = 0; k < num_primes; k++)
+            residues[k] = flint_malloc(sizeof(mp_limb_t) * FLINT_MAX(len, 1));
+
+        /* entries in [0, M) or in (-M/2, M/2] */
+        vec = _fmpz_vec_init(len);
+        vec2 = _fmpz_vec_init(len);
+        fmpz_fdiv_q_2exp(h, M, 1);
+        for (i = 0; i < len; i++)
+        {
+            if (n_randint(state, 2))
+                fmpz_randm(vec + i, state, M);
+            else
+                fmpz_randtest_mod(vec + i, state, M);
+
+            if (sign && fmpz_cmp(vec + i, h) > 0)
+                fmpz_sub(vec + i, vec + i, M);
+        }
+
+        fmpz_comb_init(comb, primes, num_primes);
+
+        for (k = 0; k < num_primes; k++)
+            for (i = 0; i < len; i++)
+                residues[k][i] = fmpz_fdiv_ui(vec + i, primes[k]);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        _fmpz_vec_multi_CRT_ui(vec2, (const mp_ptr *) residues, len, comb, sign);
+
+        if (!_fmpz_vec_equal(vec, vec2, len))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("len = %wd, num_primes = %wd, bits = %wd, sign = %d\n",
+                          len, num_primes, bits, sign);
+            abort();
+        }
+
+        fmpz_comb_clear(comb);
+        _fmpz_vec_clear(vec, len);
+        _fmpz_vec_clear(vec2, len);
+        for (k = 0; k < num_primes; k++)
+            flint_free(residues[k]);
+        flint_free(residues);
+        flint_free(primes);
+        fmpz_clear(M);
+        fmpz_clear(h);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
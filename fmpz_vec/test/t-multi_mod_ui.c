@@ -0,0 +1,89 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "fmpz.h"
+#include "fmpz_vec.h"
+
+int main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("multi_mod_ui....");
+    fflush(stdout);
+
+    for (iter = 0; iter < 300 * flint_test_multiplier(); iter++)
+    {
+        slong i, k, len, num_primes, bits;
+        mp_limb_t * primes, ** residues;
+        fmpz_comb_t comb;
+        fmpz * vec;
+
+        len = n_randint(state, 600);
+        num_primes = n_randint(state, 150) + 1;
+        bits = n_randint(state, FLINT_BITS - 1) + 2;
+
+        primes = flint_malloc(sizeof(mp_limb_t) * num_primes);
+        primes[0] = n_nextprime(UWORD(1) << (bits - 1), 0);
+        for (k = 1; k < num_primes; k++)
+            primes[k] = n_nextprime(primes[k - 1], 0);
+
+        residues = flint_malloc(sizeof(mp_ptr) * num_primes);
+        for (k = 0; k < num_primes; k++)
+            residues[k] = flint_malloc(sizeof(mp_limb_t) * FLINT_MAX(len, 1));
+
+        /* both small entries and entries larger than the product */
+        vec = _fmpz_vec_init(len);
+        for (i = 0; i < len; i++)
+            fmpz_randtest(vec + i, state,
+                   n_randint(state, 2) ? 100 : n_randint(state, 2*bits*num_primes + 20000));
+
+        fmpz_comb_init(comb, primes, num_primes);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        _fmpz_vec_multi_mod_ui(residues, vec, len, comb);
+
+        for (k = 0; k < num_primes; k++)
+        {
+            for (i = 0; i < len; i++)
+            {
+                if (residues[k][i] != fmpz_fdiv_ui(vec + i, primes[k]))
+                {
+                    flint_printf("FAIL:\n");
+                    flint_printf("len = %wd, num_primes = %wd, i = %wd, k = %wd\n",
+                                  len, num_primes, i, k);
+                    fmpz_print(vec + i); flint_printf("\n");
+                    abort();
+                }
+            }
+        }
+
+        fmpz_comb_clear(comb);
+        _fmpz_vec_clear(vec, len);
+        for (k = 0; k < num_primes; k++)
+            flint_free(residues[k]);
+        flint_free(residues);
+        flint_free(primes);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -2,6 +2,7 @@
     Copyright (C) 2011 Fredrik Johansson
     Copyright (C) 2016 Claus Fieker
     Copyright (C) 2016 William Hart.
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -13,6 +14,7 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include "flint.h"
 
 #if HAVE_GC
@@ -44,6 +46,373 @@ void __flint_set_memory_functions_init()
 }
 #endif
 
+/******************************************************************************
+
+    Allocation statistics
+
+    With --enable-memstats every block returned by flint_malloc, flint_calloc
+    and flint_realloc is recorded in a hash table, keyed by its address, with
+    its size, the tag which was current when it was first allocated and the
+    number of times it was reallocated. Blocks not allocated by FLINT (e.g.
+    by GMP) are not in the table and are ignored when freed.
+
+******************************************************************************/
+
+#if WANT_MEMSTATS
+
+#if HAVE_PTHREAD
+#include <pthread.h>
+
+static pthread_mutex_t memstats_lock = PTHREAD_MUTEX_INITIALIZER;
+#define MEMSTATS_LOCK pthread_mutex_lock(&memstats_lock)
+#define MEMSTATS_UNLOCK pthread_mutex_unlock(&memstats_lock)
+#else
+#define MEMSTATS_LOCK
+#define MEMSTATS_UNLOCK
+#endif
+
+#define MEMSTATS_MAX_DEPTH 64
+
+typedef struct
+{
+    void * ptr;
+    size_t size;
+    int tag;
+    int chain;
+} memstats_entry_t;
+
+static memstats_entry_t * memstats_table = NULL;
+static slong memstats_alloc = 0;
+static slong memstats_num = 0;
+
+static flint_memstats_struct memstats[FLINT_MEMSTATS_MAX_TAGS] = {{"(untagged)"}};
+static flint_memstats_struct memstats_all = {"(total)"};
+static slong memstats_num_tags = 1;
+
+FLINT_TLS_PREFIX int memstats_tag_stack[MEMSTATS_MAX_DEPTH];
+FLINT_TLS_PREFIX int memstats_tag_depth = 0;
+#pragma omp threadprivate(memstats_tag_stack, memstats_tag_depth)
+
+static slong _memstats_hash(void * ptr)
+{
+    ulong h = ((ulong) ptr) >> 4;
+
+    h *= UWORD(2654435761);
+    h ^= h >> 15;
+
+    return h & (memstats_alloc - 1);
+}
+
+static void _memstats_insert(void * ptr, size_t size, int tag, int chain)
+{
+    slong i;
+
+    if (2*(memstats_num + 1) > memstats_alloc)
+    {
+        memstats_entry_t * old = memstats_table;
+        slong old_alloc = memstats_alloc;
+
+        memstats_alloc = FLINT_MAX(1024, 2*memstats_alloc);
+        memstats_table = calloc(memstats_alloc, sizeof(memstats_entry_t));
+
+        if (memstats_table == NULL)
+        {
+            /* not flint_printf, which allocates */
+            printf("Exception (FLINT memory_manager). Unable to grow allocation table.\n");
+            flint_abort();
+        }
+
+        memstats_num = 0;
+
+        for (i = 0; i < old_alloc; i++)
+            if (old[i].ptr != NULL)
+                _memstats_insert(old[i].ptr, old[i].size, old[i].tag, old[i].chain);
+
+        free(old);
+    }
+
+    i = _memstats_hash(ptr);
+    while (memstats_table[i].ptr != NULL)
+        i = (i + 1) & (memstats_alloc - 1);
+
+    memstats_table[i].ptr = ptr;
+    memstats_table[i].size = size;
+    memstats_table[i].tag = tag;
+    memstats_table[i].chain = chain;
+    memstats_num++;
+}
+
+/* remove ptr from the table, returns 0 if it was not there */
+static int _memstats_remove(memstats_entry_t * e, void * ptr)
+{
+    slong i, j, k, mask = memstats_alloc - 1;
+
+    if (memstats_alloc == 0)
+        return 0;
+
+    i = _memstats_hash(ptr);
+    while (memstats_table[i].ptr != ptr)
+    {
+        if (memstats_table[i].ptr == NULL)
+            return 0;
+        i = (i + 1) & mask;
+    }
+
+    *e = memstats_table[i];
+
+    /* shift back entries which would no longer be found (linear probing) */
+    for (j = (i + 1) & mask; memstats_table[j].ptr != NULL; j = (j + 1) & mask)
+    {
+        k = _memstats_hash(memstats_table[j].ptr);
+
+        if ((j > i && (k <= i || k > j)) || (j < i && k <= i && k > j))
+        {
+            memstats_table[i] = memstats_table[j];
+            i = j;
+        }
+    }
+
+    memstats_table[i].ptr = NULL;
+    memstats_num--;
+
+    return 1;
+}
+
+static void _memstats_live(flint_memstats_struct * s, slong bytes)
+{
+    s->live += bytes;
+    if (s->live > s->peak)
+        s->peak = s->live;
+}
+
+static int _memstats_current_tag(void)
+{
+    if (memstats_tag_depth == 0)
+        return 0;
+
+    return memstats_tag_stack[FLINT_MIN(memstats_tag_depth, MEMSTATS_MAX_DEPTH) - 1];
+}
+
+static void _memstats_alloc(void * ptr, size_t size)
+{
+    int tag = _memstats_current_tag();
+
+    MEMSTATS_LOCK;
+
+    _memstats_insert(ptr, size, tag, 0);
+
+    memstats[tag].allocs++;
+    memstats[tag].bytes += size;
+    _memstats_live(memstats + tag, size);
+
+    memstats_all.allocs++;
+    memstats_all.bytes += size;
+    _memstats_live(&memstats_all, size);
+
+    MEMSTATS_UNLOCK;
+}
+
+/*
+   The entry must be removed before the block is handed back to the system,
+   as another thread may get the same address from its next allocation.
+*/
+static int _memstats_free(memstats_entry_t * e, void * ptr)
+{
+    int found;
+
+    MEMSTATS_LOCK;
+
+    found = _memstats_remove(e, ptr);
+
+    if (found)
+    {
+        memstats[e->tag].frees++;
+        memstats[e->tag].live -= e->size;
+        memstats_all.frees++;
+        memstats_all.live -= e->size;
+    }
+
+    MEMSTATS_UNLOCK;
+
+    return found;
+}
+
+static void _memstats_realloc(memstats_entry_t * e, void * ptr, size_t size)
+{
+    flint_memstats_struct * s = memstats + e->tag;
+    slong grow = (slong) size - (slong) e->size;
+
+    MEMSTATS_LOCK;
+
+    _memstats_insert(ptr, size, e->tag, e->chain + 1);
+
+    /* the old block was counted as freed, undo that */
+    s->frees--;
+    memstats_all.frees--;
+    _memstats_live(s, size);
+    _memstats_live(&memstats_all, size);
+
+    s->reallocs++;
+    memstats_all.reallocs++;
+    s->max_chain = FLINT_MAX(s->max_chain, e->chain + 1);
+    memstats_all.max_chain = FLINT_MAX(memstats_all.max_chain, e->chain + 1);
+
+    if (grow > 0)
+    {
+        s->bytes += grow;
+        s->realloc_bytes += grow;
+        memstats_all.bytes += grow;
+        memstats_all.realloc_bytes += grow;
+    }
+
+    MEMSTATS_UNLOCK;
+}
+
+/* zero the counters; live memory stays, and becomes the peak */
+static void _memstats_reset(flint_memstats_struct * s)
+{
+    s->allocs = s->reallocs = s->frees = 0;
+    s->bytes = s->realloc_bytes = s->max_chain = 0;
+    s->peak = s->live;
+}
+
+static void _memstats_print(const flint_memstats_struct * s)
+{
+    flint_printf("%-24s %10wd %10wd %10wd %10.2f %10.2f %10.2f %10.2f %6wd\n",
+        s->tag, s->allocs, s->reallocs, s->frees,
+        s->bytes / 1048576.0, s->realloc_bytes / 1048576.0,
+        s->peak / 1048576.0, s->live / 1048576.0, s->max_chain);
+}
+
+#endif
+
+void flint_memstats_push_tag(const char * tag)
+{
+#if WANT_MEMSTATS
+    slong i;
+
+    MEMSTATS_LOCK;
+
+    for (i = 0; i < memstats_num_tags; i++)
+        if (strcmp(memstats[i].tag, tag) == 0)
+            break;
+
+    if (i == memstats_num_tags)
+    {
+        if (memstats_num_tags < FLINT_MEMSTATS_MAX_TAGS)
+            memstats[memstats_num_tags++].tag = tag;
+        else /* out of tags, count as untagged */
+            i = 0;
+    }
+
+    MEMSTATS_UNLOCK;
+
+    if (memstats_tag_depth < MEMSTATS_MAX_DEPTH)
+        memstats_tag_stack[memstats_tag_depth] = i;
+    memstats_tag_depth++;
+#endif
+}
+
+void flint_memstats_pop_tag(void)
+{
+#if WANT_MEMSTATS
+    if (memstats_tag_depth == 0)
+    {
+        flint_printf("Exception (flint_memstats_pop_tag). No tag pushed.\n");
+        flint_abort();
+    }
+
+    memstats_tag_depth--;
+#endif
+}
+
+const char * flint_memstats_current_tag(void)
+{
+#if WANT_MEMSTATS
+    int tag = _memstats_current_tag();
+
+    return tag == 0 ? NULL : memstats[tag].tag;
+#else
+    return NULL;
+#endif
+}
+
+slong flint_memstats_num_tags(void)
+{
+#if WANT_MEMSTATS
+    return memstats_num_tags;
+#else
+    return 0;
+#endif
+}
+
+void flint_memstats_get(flint_memstats_t stats, slong i)
+{
+#if WANT_MEMSTATS
+    if (i < 0 || i >= memstats_num_tags)
+    {
+        flint_printf("Exception (flint_memstats_get). Index out of range.\n");
+        flint_abort();
+    }
+
+    MEMSTATS_LOCK;
+    *stats = memstats[i];
+    MEMSTATS_UNLOCK;
+#else
+    memset(stats, 0, sizeof(flint_memstats_struct));
+#endif
+}
+
+void flint_memstats_total(flint_memstats_t stats)
+{
+#if WANT_MEMSTATS
+    MEMSTATS_LOCK;
+    *stats = memstats_all;
+    MEMSTATS_UNLOCK;
+#else
+    memset(stats, 0, sizeof(flint_memstats_struct));
+#endif
+}
+
+void flint_memstats_reset(void)
+{
+#if WANT_MEMSTATS
+    slong i;
+
+    MEMSTATS_LOCK;
+
+    for (i = 0; i < memstats_num_tags; i++)
+        _memstats_reset(memstats + i);
+    _memstats_reset(&memstats_all);
+
+    MEMSTATS_UNLOCK;
+#endif
+}
+
+void flint_memstats_print(void)
+{
+#if WANT_MEMSTATS
+    flint_memstats_t s;
+    slong i;
+
+    flint_printf("%-24s %10s %10s %10s %10s %10s %10s %10s %6s\n", "tag",
+        "allocs", "reallocs", "frees", "bytes(MB)", "grown(MB)",
+        "peak(MB)", "live(MB)", "chain");
+
+    for (i = 0; i < flint_memstats_num_tags(); i++)
+    {
+        flint_memstats_get(s, i);
+        if (s->allocs != 0 || s->live != 0)
+            _memstats_print(s);
+    }
+
+    flint_memstats_total(s);
+    _memstats_print(s);
+#else
+    flint_printf("memstats: not available, configure with --enable-memstats\n");
+#endif
+}
+
 static void flint_memory_error(size_t size)
 {
     flint_printf("Exception (FLINT memory_manager). Unable to allocate memory (%ld).\n", size);
@@ -90,6 +459,10 @@ void * flint_malloc(size_t size)
    if (ptr == NULL)
         flint_memory_error(size);
 
+#if WANT_MEMSTATS
+   _memstats_alloc(ptr, size);
+#endif
+
    return ptr;
 }
 
@@ -110,6 +483,10 @@ void * _flint_realloc(void * ptr, size_t size)
 void * flint_realloc(void * ptr, size_t size)
 {
     void * ptr2;
+#if WANT_MEMSTATS
+    memstats_entry_t e;
+    int found = (ptr != NULL && _memstats_free(&e, ptr));
+#endif
   
     if (ptr)
       ptr2 = (*__flint_reallocate_func)(ptr, size);
@@ -119,6 +496,13 @@ void * flint_realloc(void * ptr, size_t size)
     if (ptr2 == NULL)
         flint_memory_error(size);
 
+#if WANT_MEMSTATS
+    if (found)
+        _memstats_realloc(&e, ptr2, size);
+    else
+        _memstats_alloc(ptr2, size);
+#endif
+
     return ptr2;
 }
 
@@ -144,6 +528,10 @@ void * flint_calloc(size_t num, size_t size)
     if (ptr == NULL)
         flint_memory_error(size);
 
+#if WANT_MEMSTATS
+    _memstats_alloc(ptr, num*size);
+#endif
+
     return ptr;
 }
 
@@ -156,6 +544,13 @@ void _flint_free(void * ptr)
 
 void flint_free(void * ptr)
 {
+#if WANT_MEMSTATS
+   memstats_entry_t e;
+
+   if (ptr != NULL)
+      _memstats_free(&e, ptr);
+#endif
+
    (*__flint_free_func)(ptr);
 }
 
@@ -405,6 +405,9 @@ FLINT_DLL void mpoly_get_monomial(ulong * exps, const ulong * poly_exps,
 FLINT_DLL void mpoly_set_monomial(ulong * exp1, const ulong * exp2,
                                         slong bits, slong n, int deg, int rev);
 
+FLINT_DLL void mpoly_gen_offset_shift(slong * offset, slong * shift,
+                 slong var, slong bits, slong nfields, int deg, int rev);
+
 FLINT_DLL void mpoly_unpack_monomials(ulong * exps1, slong bits1,
                        const ulong * exps2, slong bits2, slong len, slong num);
 
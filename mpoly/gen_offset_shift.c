@@ -0,0 +1,25 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "mpoly.h"
+
+void mpoly_gen_offset_shift(slong * offset, slong * shift, slong var,
+                                   slong bits, slong nfields, int deg, int rev)
+{
+    slong fields_per_word = FLINT_BITS/bits;
+    slong field = rev ? nfields - var - 1 : var + deg;
+
+    /* fields are packed from the most significant end of each word */
+    *offset = field/fields_per_word;
+    *shift = (fields_per_word - field%fields_per_word - 1)*bits;
+}
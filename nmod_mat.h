@@ -159,10 +159,14 @@ FLINT_DLL void nmod_mat_scalar_mul_add(nmod_mat_t dest, const nmod_mat_t X,
 FLINT_DLL void nmod_mat_mul(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B);
 FLINT_DLL void nmod_mat_mul_classical(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B);
 FLINT_DLL void nmod_mat_mul_strassen(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B);
+FLINT_DLL void nmod_mat_mul_blocked(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B);
 
 FLINT_DLL void _nmod_mat_mul_classical(nmod_mat_t D, const nmod_mat_t C,
                                 const nmod_mat_t A, const nmod_mat_t B, int op);
 
+FLINT_DLL void _nmod_mat_mul_blocked(nmod_mat_t D, const nmod_mat_t C,
+                                const nmod_mat_t A, const nmod_mat_t B, int op);
+
 FLINT_DLL void nmod_mat_addmul(nmod_mat_t D, const nmod_mat_t C,
                                 const nmod_mat_t A, const nmod_mat_t B);
 
@@ -276,8 +280,35 @@ FLINT_DLL void nmod_mat_similarity(nmod_mat_t M, slong r, ulong d);
 /* Size at which pre-transposing becomes faster in classical multiplication */
 #define NMOD_MAT_MUL_TRANSPOSE_CUTOFF 20
 
-/* Strassen multiplication */
+/* Cache blocked multiplication */
+#define NMOD_MAT_MUL_BLOCKED_CUTOFF 16
+
+/*
+   Strassen multiplication. Blocked multiplication is much faster when it
+   can accumulate in double precision (n <= 2^FP_BITS) or in single limbs
+   (n <= 2^HALF_BITS), which pushes the crossover further out.
+*/
 #define NMOD_MAT_MUL_STRASSEN_CUTOFF 256
+#define NMOD_MAT_MUL_STRASSEN_CUTOFF_FP 1024
+#define NMOD_MAT_MUL_STRASSEN_CUTOFF_HALF 768
+
+#if FLINT64
+#define NMOD_MAT_MUL_BLOCKED_FP_BITS 23
+#else
+#define NMOD_MAT_MUL_BLOCKED_FP_BITS 13
+#endif
+#define NMOD_MAT_MUL_BLOCKED_HALF_BITS (FLINT_BITS / 2 - 1)
+
+NMOD_MAT_INLINE
+slong _nmod_mat_mul_strassen_cutoff(nmod_t mod)
+{
+    if (mod.n <= (UWORD(1) << NMOD_MAT_MUL_BLOCKED_FP_BITS))
+        return NMOD_MAT_MUL_STRASSEN_CUTOFF_FP;
+    else if (mod.n <= (UWORD(1) << NMOD_MAT_MUL_BLOCKED_HALF_BITS))
+        return NMOD_MAT_MUL_STRASSEN_CUTOFF_HALF;
+    else
+        return NMOD_MAT_MUL_STRASSEN_CUTOFF;
+}
 
 /* Cutoff between classical and recursive triangular solving */
 #define NMOD_MAT_SOLVE_TRI_ROWS_CUTOFF 64
@@ -19,18 +19,23 @@ void
 nmod_mat_addmul(nmod_mat_t D, const nmod_mat_t C,
                                 const nmod_mat_t A, const nmod_mat_t B)
 {
-    slong m, k, n;
+    slong m, k, n, cutoff;
 
     m = A->r;
     k = A->c;
     n = B->c;
+    cutoff = _nmod_mat_mul_strassen_cutoff(A->mod);
 
-    if (m < NMOD_MAT_MUL_STRASSEN_CUTOFF ||
-        n < NMOD_MAT_MUL_STRASSEN_CUTOFF ||
-        k < NMOD_MAT_MUL_STRASSEN_CUTOFF)
+    if (m < NMOD_MAT_MUL_BLOCKED_CUTOFF ||
+        n < NMOD_MAT_MUL_BLOCKED_CUTOFF ||
+        k < NMOD_MAT_MUL_BLOCKED_CUTOFF)
     {
         _nmod_mat_mul_classical(D, C, A, B, 1);
     }
+    else if (m < cutoff || n < cutoff || k < cutoff)
+    {
+        _nmod_mat_mul_blocked(D, C, A, B, 1);
+    }
     else
     {
         nmod_mat_t tmp;
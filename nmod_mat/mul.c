@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2010 Fredrik Johansson
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -18,20 +19,29 @@
 void
 nmod_mat_mul(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
 {
-    slong m, k, n;
+    slong m, k, n, cutoff;
 
     m = A->r;
     k = A->c;
     n = B->c;
+    cutoff = _nmod_mat_mul_strassen_cutoff(A->mod);
 
-    if (m < NMOD_MAT_MUL_STRASSEN_CUTOFF ||
-        n < NMOD_MAT_MUL_STRASSEN_CUTOFF ||
-        k < NMOD_MAT_MUL_STRASSEN_CUTOFF)
+    FLINT_MEMSTATS_PUSH_TAG("nmod_mat_mul");
+
+    if (m < NMOD_MAT_MUL_BLOCKED_CUTOFF ||
+        n < NMOD_MAT_MUL_BLOCKED_CUTOFF ||
+        k < NMOD_MAT_MUL_BLOCKED_CUTOFF)
     {
         nmod_mat_mul_classical(C, A, B);
     }
+    else if (m < cutoff || n < cutoff || k < cutoff)
+    {
+        nmod_mat_mul_blocked(C, A, B);
+    }
     else
     {
         nmod_mat_mul_strassen(C, A, B);
     }
+
+    FLINT_MEMSTATS_POP_TAG();
 }
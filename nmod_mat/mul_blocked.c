@@ -0,0 +1,741 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "nmod_vec.h"
+#include "thread_pool.h"
+
+#if NMOD_VEC_SIMD
+#include <immintrin.h>
+#endif
+
+/*
+   Cache blocking in the style of GotoBLAS: a KC x NC block of B and an
+   MC x KC block of A are packed into contiguous micro-panels of NR columns,
+   respectively MR rows, and an MR x NR micro-kernel accumulates the product
+   of two micro-panels in registers. Entries are reduced only once per
+   KC block, where KC is chosen small enough that the unreduced sums cannot
+   overflow the accumulators.
+
+   For small moduli the entries are converted to doubles and the products
+   are accumulated exactly in double precision (the sums stay below 2^53),
+   which allows vectorised FMA kernels. Otherwise single limb or double
+   limb integer accumulators are used.
+*/
+
+#define BLOCK_MC 120
+#define BLOCK_KC 256
+#define BLOCK_NC 1024
+
+#define METHOD_DOUBLE 0
+#define METHOD_LIMB1 1
+#define METHOD_LIMB2 2
+
+/* number of bits of precision in a double accumulator */
+#if FLINT64
+#define DOUBLE_BITS 53
+#else
+#define DOUBLE_BITS 32
+#endif
+
+typedef void (*dkernel_func)(double * t, const double * a,
+                                               const double * b, slong kc);
+
+/* double micro-kernels *******************************************************/
+
+static void
+_dkernel_4x4(double * t, const double * a, const double * b, slong kc)
+{
+    double c00 = 0, c01 = 0, c02 = 0, c03 = 0;
+    double c10 = 0, c11 = 0, c12 = 0, c13 = 0;
+    double c20 = 0, c21 = 0, c22 = 0, c23 = 0;
+    double c30 = 0, c31 = 0, c32 = 0, c33 = 0;
+    double a0, a1, a2, a3, b0, b1, b2, b3;
+    slong p;
+
+    for (p = 0; p < kc; p++)
+    {
+        a0 = a[0]; a1 = a[1]; a2 = a[2]; a3 = a[3];
+        b0 = b[0]; b1 = b[1]; b2 = b[2]; b3 = b[3];
+
+        c00 += a0 * b0; c01 += a0 * b1; c02 += a0 * b2; c03 += a0 * b3;
+        c10 += a1 * b0; c11 += a1 * b1; c12 += a1 * b2; c13 += a1 * b3;
+        c20 += a2 * b0; c21 += a2 * b1; c22 += a2 * b2; c23 += a2 * b3;
+        c30 += a3 * b0; c31 += a3 * b1; c32 += a3 * b2; c33 += a3 * b3;
+
+        a += 4;
+        b += 4;
+    }
+
+    t[0] = c00; t[1] = c01; t[2] = c02; t[3] = c03;
+    t[4] = c10; t[5] = c11; t[6] = c12; t[7] = c13;
+    t[8] = c20; t[9] = c21; t[10] = c22; t[11] = c23;
+    t[12] = c30; t[13] = c31; t[14] = c32; t[15] = c33;
+}
+
+#if NMOD_VEC_SIMD && HAVE_AVX2_DISPATCH
+
+__attribute__((target("avx2,fma")))
+static void
+_dkernel_6x8_avx2(double * t, const double * a, const double * b, slong kc)
+{
+    __m256d c00, c01, c10, c11, c20, c21, c30, c31, c40, c41, c50, c51;
+    __m256d b0, b1, ai;
+    slong p;
+
+    c00 = c01 = c10 = c11 = c20 = c21 = _mm256_setzero_pd();
+    c30 = c31 = c40 = c41 = c50 = c51 = _mm256_setzero_pd();
+
+    for (p = 0; p < kc; p++)
+    {
+        b0 = _mm256_loadu_pd(b);
+        b1 = _mm256_loadu_pd(b + 4);
+
+        ai = _mm256_broadcast_sd(a + 0);
+        c00 = _mm256_fmadd_pd(ai, b0, c00);
+        c01 = _mm256_fmadd_pd(ai, b1, c01);
+        ai = _mm256_broadcast_sd(a + 1);
+        c10 = _mm256_fmadd_pd(ai, b0, c10);
+        c11 = _mm256_fmadd_pd(ai, b1, c11);
+        ai = _mm256_broadcast_sd(a + 2);
+        c20 = _mm256_fmadd_pd(ai, b0, c20);
+        c21 = _mm256_fmadd_pd(ai, b1, c21);
+        ai = _mm256_broadcast_sd(a + 3);
+        c30 = _mm256_fmadd_pd(ai, b0, c30);
+        c31 = _mm256_fmadd_pd(ai, b1, c31);
+        ai = _mm256_broadcast_sd(a + 4);
+        c40 = _mm256_fmadd_pd(ai, b0, c40);
+        c41 = _mm256_fmadd_pd(ai, b1, c41);
+        ai = _mm256_broadcast_sd(a + 5);
+        c50 = _mm256_fmadd_pd(ai, b0, c50);
+        c51 = _mm256_fmadd_pd(ai, b1, c51);
+
+        a += 6;
+        b += 8;
+    }
+
+    _mm256_storeu_pd(t + 0, c00);  _mm256_storeu_pd(t + 4, c01);
+    _mm256_storeu_pd(t + 8, c10);  _mm256_storeu_pd(t + 12, c11);
+    _mm256_storeu_pd(t + 16, c20); _mm256_storeu_pd(t + 20, c21);
+    _mm256_storeu_pd(t + 24, c30); _mm256_storeu_pd(t + 28, c31);
+    _mm256_storeu_pd(t + 32, c40); _mm256_storeu_pd(t + 36, c41);
+    _mm256_storeu_pd(t + 40, c50); _mm256_storeu_pd(t + 44, c51);
+}
+
+#endif
+
+#if NMOD_VEC_SIMD && HAVE_AVX512_DISPATCH
+
+__attribute__((target("avx512f")))
+static void
+_dkernel_12x8_avx512(double * t, const double * a, const double * b, slong kc)
+{
+    __m512d c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11;
+    __m512d b0;
+    slong p;
+
+    c0 = c1 = c2 = c3 = c4 = c5 = _mm512_setzero_pd();
+    c6 = c7 = c8 = c9 = c10 = c11 = _mm512_setzero_pd();
+
+    for (p = 0; p < kc; p++)
+    {
+        b0 = _mm512_loadu_pd(b);
+
+        c0 = _mm512_fmadd_pd(_mm512_set1_pd(a[0]), b0, c0);
+        c1 = _mm512_fmadd_pd(_mm512_set1_pd(a[1]), b0, c1);
+        c2 = _mm512_fmadd_pd(_mm512_set1_pd(a[2]), b0, c2);
+        c3 = _mm512_fmadd_pd(_mm512_set1_pd(a[3]), b0, c3);
+        c4 = _mm512_fmadd_pd(_mm512_set1_pd(a[4]), b0, c4);
+        c5 = _mm512_fmadd_pd(_mm512_set1_pd(a[5]), b0, c5);
+        c6 = _mm512_fmadd_pd(_mm512_set1_pd(a[6]), b0, c6);
+        c7 = _mm512_fmadd_pd(_mm512_set1_pd(a[7]), b0, c7);
+        c8 = _mm512_fmadd_pd(_mm512_set1_pd(a[8]), b0, c8);
+        c9 = _mm512_fmadd_pd(_mm512_set1_pd(a[9]), b0, c9);
+        c10 = _mm512_fmadd_pd(_mm512_set1_pd(a[10]), b0, c10);
+        c11 = _mm512_fmadd_pd(_mm512_set1_pd(a[11]), b0, c11);
+
+        a += 12;
+        b += 8;
+    }
+
+    _mm512_storeu_pd(t + 0, c0);   _mm512_storeu_pd(t + 8, c1);
+    _mm512_storeu_pd(t + 16, c2);  _mm512_storeu_pd(t + 24, c3);
+    _mm512_storeu_pd(t + 32, c4);  _mm512_storeu_pd(t + 40, c5);
+    _mm512_storeu_pd(t + 48, c6);  _mm512_storeu_pd(t + 56, c7);
+    _mm512_storeu_pd(t + 64, c8);  _mm512_storeu_pd(t + 72, c9);
+    _mm512_storeu_pd(t + 80, c10); _mm512_storeu_pd(t + 88, c11);
+}
+
+#endif
+
+/* integer micro-kernels ******************************************************/
+
+/*
+   The integer kernels write each entry of the tile as a (hi, lo) pair of
+   limbs. Single limb sums of at most kc1 products are folded into the
+   double limb totals.
+*/
+
+typedef void (*lkernel_func)(mp_ptr t, mp_srcptr a,
+                                    mp_srcptr b, slong kc, slong kc1);
+
+#define FOLD1(i, c) add_ssaaaa(t[2*(i)], t[2*(i) + 1], \
+                               t[2*(i)], t[2*(i) + 1], UWORD(0), c)
+
+/* single limb accumulators, 4 x 4 */
+static void
+_lkernel1_4x4(mp_ptr t, mp_srcptr a, mp_srcptr b, slong kc, slong kc1)
+{
+    mp_limb_t c00, c01, c02, c03, c10, c11, c12, c13;
+    mp_limb_t c20, c21, c22, c23, c30, c31, c32, c33;
+    mp_limb_t a0, a1, a2, a3, b0, b1, b2, b3;
+    slong p, q, len;
+
+    flint_mpn_zero(t, 32);
+
+    for (q = 0; q < kc; q += kc1)
+    {
+        len = FLINT_MIN(kc1, kc - q);
+
+        c00 = c01 = c02 = c03 = c10 = c11 = c12 = c13 = 0;
+        c20 = c21 = c22 = c23 = c30 = c31 = c32 = c33 = 0;
+
+        for (p = 0; p < len; p++)
+        {
+            a0 = a[0]; a1 = a[1]; a2 = a[2]; a3 = a[3];
+            b0 = b[0]; b1 = b[1]; b2 = b[2]; b3 = b[3];
+
+            c00 += a0 * b0; c01 += a0 * b1; c02 += a0 * b2; c03 += a0 * b3;
+            c10 += a1 * b0; c11 += a1 * b1; c12 += a1 * b2; c13 += a1 * b3;
+            c20 += a2 * b0; c21 += a2 * b1; c22 += a2 * b2; c23 += a2 * b3;
+            c30 += a3 * b0; c31 += a3 * b1; c32 += a3 * b2; c33 += a3 * b3;
+
+            a += 4;
+            b += 4;
+        }
+
+        FOLD1(0, c00); FOLD1(1, c01); FOLD1(2, c02); FOLD1(3, c03);
+        FOLD1(4, c10); FOLD1(5, c11); FOLD1(6, c12); FOLD1(7, c13);
+        FOLD1(8, c20); FOLD1(9, c21); FOLD1(10, c22); FOLD1(11, c23);
+        FOLD1(12, c30); FOLD1(13, c31); FOLD1(14, c32); FOLD1(15, c33);
+    }
+}
+
+/* double limb accumulators, 2 x 2 */
+static void
+_lkernel2_2x2(mp_ptr t, mp_srcptr a, mp_srcptr b, slong kc, slong kc1)
+{
+    mp_limb_t h00 = 0, l00 = 0, h01 = 0, l01 = 0;
+    mp_limb_t h10 = 0, l10 = 0, h11 = 0, l11 = 0;
+    mp_limb_t ph, pl;
+    slong p;
+
+    for (p = 0; p < kc; p++)
+    {
+        umul_ppmm(ph, pl, a[0], b[0]);
+        add_ssaaaa(h00, l00, h00, l00, ph, pl);
+        umul_ppmm(ph, pl, a[0], b[1]);
+        add_ssaaaa(h01, l01, h01, l01, ph, pl);
+        umul_ppmm(ph, pl, a[1], b[0]);
+        add_ssaaaa(h10, l10, h10, l10, ph, pl);
+        umul_ppmm(ph, pl, a[1], b[1]);
+        add_ssaaaa(h11, l11, h11, l11, ph, pl);
+
+        a += 2;
+        b += 2;
+    }
+
+    t[0] = h00; t[1] = l00; t[2] = h01; t[3] = l01;
+    t[4] = h10; t[5] = l10; t[6] = h11; t[7] = l11;
+}
+
+/*
+   Vectorised kernels for entries below 2^32, using 32 x 32 -> 64 bit
+   multiplications. Each lane folds its single limb sum into separate
+   totals of its low and high 32-bit halves.
+*/
+
+#if NMOD_VEC_SIMD && (HAVE_AVX2_DISPATCH || HAVE_AVX512_DISPATCH)
+
+static void
+_lkernel32_combine(mp_ptr t, const mp_limb_t * lo, const mp_limb_t * hi,
+                                                                    slong len)
+{
+    slong i;
+    mp_limb_t l;
+
+    for (i = 0; i < len; i++)
+    {
+        l = (hi[i] << 32) + lo[i];
+        t[2*i] = (hi[i] >> 32) + (l < lo[i]);
+        t[2*i + 1] = l;
+    }
+}
+
+#endif
+
+#if NMOD_VEC_SIMD && HAVE_AVX2_DISPATCH
+
+#define ROW_AVX2(i) \
+    do { \
+        ai = _mm256_set1_epi64x(a[i]); \
+        c##i##0 = _mm256_add_epi64(c##i##0, _mm256_mul_epu32(ai, b0)); \
+        c##i##1 = _mm256_add_epi64(c##i##1, _mm256_mul_epu32(ai, b1)); \
+    } while (0)
+
+#define FOLD_AVX2(i, j) \
+    do { \
+        __m256i s = _mm256_loadu_si256((const __m256i *) (lo + 8*(i) + 4*(j))); \
+        s = _mm256_add_epi64(s, _mm256_and_si256(c##i##j, mask)); \
+        _mm256_storeu_si256((__m256i *) (lo + 8*(i) + 4*(j)), s); \
+        s = _mm256_loadu_si256((const __m256i *) (hi + 8*(i) + 4*(j))); \
+        s = _mm256_add_epi64(s, _mm256_srli_epi64(c##i##j, 32)); \
+        _mm256_storeu_si256((__m256i *) (hi + 8*(i) + 4*(j)), s); \
+    } while (0)
+
+__attribute__((target("avx2")))
+static void
+_lkernel32_6x8_avx2(mp_ptr t, mp_srcptr a, mp_srcptr b, slong kc, slong kc1)
+{
+    __m256i c00, c01, c10, c11, c20, c21, c30, c31, c40, c41, c50, c51;
+    __m256i b0, b1, ai;
+    const __m256i mask = _mm256_set1_epi64x(UWORD(0xffffffff));
+    mp_limb_t lo[48], hi[48];
+    slong p, q, len;
+
+    flint_mpn_zero(lo, 48);
+    flint_mpn_zero(hi, 48);
+
+    for (q = 0; q < kc; q += kc1)
+    {
+        len = FLINT_MIN(kc1, kc - q);
+
+        c00 = c01 = c10 = c11 = c20 = c21 = _mm256_setzero_si256();
+        c30 = c31 = c40 = c41 = c50 = c51 = _mm256_setzero_si256();
+
+        for (p = 0; p < len; p++)
+        {
+            b0 = _mm256_loadu_si256((const __m256i *) b);
+            b1 = _mm256_loadu_si256((const __m256i *) (b + 4));
+
+            ROW_AVX2(0); ROW_AVX2(1); ROW_AVX2(2);
+            ROW_AVX2(3); ROW_AVX2(4); ROW_AVX2(5);
+
+            a += 6;
+            b += 8;
+        }
+
+        FOLD_AVX2(0, 0); FOLD_AVX2(0, 1); FOLD_AVX2(1, 0); FOLD_AVX2(1, 1);
+        FOLD_AVX2(2, 0); FOLD_AVX2(2, 1); FOLD_AVX2(3, 0); FOLD_AVX2(3, 1);
+        FOLD_AVX2(4, 0); FOLD_AVX2(4, 1); FOLD_AVX2(5, 0); FOLD_AVX2(5, 1);
+    }
+
+    _lkernel32_combine(t, lo, hi, 48);
+}
+
+#endif
+
+#if NMOD_VEC_SIMD && HAVE_AVX512_DISPATCH
+
+#define ROW_AVX512(i) \
+    c##i = _mm512_add_epi64(c##i, _mm512_mul_epu32(_mm512_set1_epi64(a[i]), b0))
+
+#define FOLD_AVX512(i) \
+    do { \
+        __m512i s = _mm512_loadu_si512(lo + 8*(i)); \
+        s = _mm512_add_epi64(s, _mm512_and_si512(c##i, mask)); \
+        _mm512_storeu_si512(lo + 8*(i), s); \
+        s = _mm512_loadu_si512(hi + 8*(i)); \
+        s = _mm512_add_epi64(s, _mm512_srli_epi64(c##i, 32)); \
+        _mm512_storeu_si512(hi + 8*(i), s); \
+    } while (0)
+
+__attribute__((target("avx512f")))
+static void
+_lkernel32_12x8_avx512(mp_ptr t, mp_srcptr a, mp_srcptr b, slong kc, slong kc1)
+{
+    __m512i c0, c1, c2, c3, c4, c5, c6, c7, c8, c9, c10, c11;
+    __m512i b0;
+    const __m512i mask = _mm512_set1_epi64(UWORD(0xffffffff));
+    mp_limb_t lo[96], hi[96];
+    slong p, q, len;
+
+    flint_mpn_zero(lo, 96);
+    flint_mpn_zero(hi, 96);
+
+    for (q = 0; q < kc; q += kc1)
+    {
+        len = FLINT_MIN(kc1, kc - q);
+
+        c0 = c1 = c2 = c3 = c4 = c5 = _mm512_setzero_si512();
+        c6 = c7 = c8 = c9 = c10 = c11 = _mm512_setzero_si512();
+
+        for (p = 0; p < len; p++)
+        {
+            b0 = _mm512_loadu_si512(b);
+
+            ROW_AVX512(0); ROW_AVX512(1); ROW_AVX512(2); ROW_AVX512(3);
+            ROW_AVX512(4); ROW_AVX512(5); ROW_AVX512(6); ROW_AVX512(7);
+            ROW_AVX512(8); ROW_AVX512(9); ROW_AVX512(10); ROW_AVX512(11);
+
+            a += 12;
+            b += 8;
+        }
+
+        FOLD_AVX512(0); FOLD_AVX512(1); FOLD_AVX512(2); FOLD_AVX512(3);
+        FOLD_AVX512(4); FOLD_AVX512(5); FOLD_AVX512(6); FOLD_AVX512(7);
+        FOLD_AVX512(8); FOLD_AVX512(9); FOLD_AVX512(10); FOLD_AVX512(11);
+    }
+
+    _lkernel32_combine(t, lo, hi, 96);
+}
+
+#endif
+
+/* packing ********************************************************************/
+
+static void
+_pack_a_d(double * buf, mp_ptr * const A, slong i0, slong mb,
+                                            slong p0, slong kb, slong mr)
+{
+    slong ip, p, r;
+
+    for (ip = 0; ip < mb; ip += mr)
+        for (p = 0; p < kb; p++)
+            for (r = 0; r < mr; r++)
+                *buf++ = (ip + r < mb) ? (double) A[i0 + ip + r][p0 + p] : 0.0;
+}
+
+static void
+_pack_b_d(double * buf, mp_ptr * const B, slong p0, slong kb,
+                                            slong j0, slong nb, slong nr)
+{
+    slong jp, p, c;
+
+    for (jp = 0; jp < nb; jp += nr)
+        for (p = 0; p < kb; p++)
+            for (c = 0; c < nr; c++)
+                *buf++ = (jp + c < nb) ? (double) B[p0 + p][j0 + jp + c] : 0.0;
+}
+
+static void
+_pack_a_l(mp_ptr buf, mp_ptr * const A, slong i0, slong mb,
+                                            slong p0, slong kb, slong mr)
+{
+    slong ip, p, r;
+
+    for (ip = 0; ip < mb; ip += mr)
+        for (p = 0; p < kb; p++)
+            for (r = 0; r < mr; r++)
+                *buf++ = (ip + r < mb) ? A[i0 + ip + r][p0 + p] : 0;
+}
+
+static void
+_pack_b_l(mp_ptr buf, mp_ptr * const B, slong p0, slong kb,
+                                            slong j0, slong nb, slong nr)
+{
+    slong jp, p, c;
+
+    for (jp = 0; jp < nb; jp += nr)
+        for (p = 0; p < kb; p++)
+            for (c = 0; c < nr; c++)
+                *buf++ = (jp + c < nb) ? B[p0 + p][j0 + jp + c] : 0;
+}
+
+/* accumulate a reduced entry x into D[i][j] */
+static __inline__ void
+_store_entry(mp_ptr * D, mp_ptr * const C, slong i, slong j, mp_limb_t x,
+                                                int first, int op, nmod_t mod)
+{
+    if (first)
+    {
+        if (op == 1)
+            x = nmod_add(C[i][j], x, mod);
+        else if (op == -1)
+            x = nmod_sub(C[i][j], x, mod);
+    }
+    else
+    {
+        if (op == -1)
+            x = nmod_sub(D[i][j], x, mod);
+        else
+            x = nmod_add(D[i][j], x, mod);
+    }
+
+    D[i][j] = x;
+}
+
+/* main loop ******************************************************************/
+
+typedef struct
+{
+    mp_ptr * D;
+    mp_ptr * C;
+    mp_ptr * A;
+    mp_ptr * B;
+    slong m;
+    slong k;
+    slong n;
+    int op;
+    nmod_t mod;
+    int method;
+    int level;
+}
+_nmod_mat_mul_blocked_arg_t;
+
+static void
+_nmod_mat_mul_blocked_serial(_nmod_mat_mul_blocked_arg_t * arg)
+{
+    mp_ptr * D = arg->D;
+    mp_ptr * C = arg->C;
+    mp_ptr * A = arg->A;
+    mp_ptr * B = arg->B;
+    slong m = arg->m, k = arg->k, n = arg->n;
+    nmod_t mod = arg->mod;
+    int op = arg->op, method = arg->method;
+    slong mr, nr, kc, kc1, i0, j0, p0, ip, jp, mb, nb, kb, r, c, bits;
+    double * apack_d = NULL, * bpack_d = NULL, * tile_d = NULL;
+    mp_ptr apack_l = NULL, bpack_l = NULL, tile_l = NULL;
+    dkernel_func dkernel = _dkernel_4x4;
+    lkernel_func lkernel = _lkernel2_2x2;
+    mp_limb_t x;
+
+    /* products of two entries are smaller than 2^bits */
+    bits = 2 * FLINT_BIT_COUNT(mod.n - 1);
+
+    if (method == METHOD_DOUBLE)
+    {
+        kc = WORD(1) << FLINT_MIN(DOUBLE_BITS - bits, 30);
+        kc1 = kc;
+        mr = nr = 4;
+#if NMOD_VEC_SIMD && HAVE_AVX512_DISPATCH
+        if (arg->level == NMOD_VEC_SIMD_AVX512)
+        {
+            dkernel = _dkernel_12x8_avx512;
+            mr = 12;
+            nr = 8;
+        }
+#endif
+#if NMOD_VEC_SIMD && HAVE_AVX2_DISPATCH
+        if (arg->level == NMOD_VEC_SIMD_AVX2)
+        {
+            dkernel = _dkernel_6x8_avx2;
+            mr = 6;
+            nr = 8;
+        }
+#endif
+    }
+    else if (method == METHOD_LIMB1)
+    {
+        kc = BLOCK_KC;
+        kc1 = WORD(1) << FLINT_MIN(FLINT_BITS - bits, 30);
+        lkernel = _lkernel1_4x4;
+        mr = nr = 4;
+#if NMOD_VEC_SIMD && HAVE_AVX512_DISPATCH
+        if (arg->level == NMOD_VEC_SIMD_AVX512)
+        {
+            lkernel = _lkernel32_12x8_avx512;
+            mr = 12;
+            nr = 8;
+        }
+#endif
+#if NMOD_VEC_SIMD && HAVE_AVX2_DISPATCH
+        if (arg->level == NMOD_VEC_SIMD_AVX2)
+        {
+            lkernel = _lkernel32_6x8_avx2;
+            mr = 6;
+            nr = 8;
+        }
+#endif
+    }
+    else
+    {
+        kc = (bits >= 2 * FLINT_BITS - 30) ?
+                WORD(1) << (2 * FLINT_BITS - bits) : BLOCK_KC;
+        kc1 = kc;
+        lkernel = _lkernel2_2x2;
+        mr = nr = 2;
+    }
+
+    kc = FLINT_MIN(kc, BLOCK_KC);
+
+    if (method == METHOD_DOUBLE)
+    {
+        apack_d = flint_malloc(sizeof(double) * (BLOCK_MC + mr) * kc);
+        bpack_d = flint_malloc(sizeof(double) * (BLOCK_NC + nr) * kc);
+        tile_d = flint_malloc(sizeof(double) * mr * nr);
+    }
+    else
+    {
+        apack_l = flint_malloc(sizeof(mp_limb_t) * (BLOCK_MC + mr) * kc);
+        bpack_l = flint_malloc(sizeof(mp_limb_t) * (BLOCK_NC + nr) * kc);
+        tile_l = flint_malloc(sizeof(mp_limb_t) * 2 * mr * nr);
+    }
+
+    for (j0 = 0; j0 < n; j0 += BLOCK_NC)
+    {
+        nb = FLINT_MIN(BLOCK_NC, n - j0);
+
+        for (p0 = 0; p0 < k; p0 += kc)
+        {
+            kb = FLINT_MIN(kc, k - p0);
+
+            if (method == METHOD_DOUBLE)
+                _pack_b_d(bpack_d, B, p0, kb, j0, nb, nr);
+            else
+                _pack_b_l(bpack_l, B, p0, kb, j0, nb, nr);
+
+            for (i0 = 0; i0 < m; i0 += BLOCK_MC)
+            {
+                mb = FLINT_MIN(BLOCK_MC, m - i0);
+
+                if (method == METHOD_DOUBLE)
+                    _pack_a_d(apack_d, A, i0, mb, p0, kb, mr);
+                else
+                    _pack_a_l(apack_l, A, i0, mb, p0, kb, mr);
+
+                for (jp = 0; jp < nb; jp += nr)
+                {
+                    for (ip = 0; ip < mb; ip += mr)
+                    {
+                        slong rmax = FLINT_MIN(mr, mb - ip);
+                        slong cmax = FLINT_MIN(nr, nb - jp);
+
+                        if (method == METHOD_DOUBLE)
+                        {
+                            dkernel(tile_d, apack_d + ip * kb,
+                                            bpack_d + jp * kb, kb);
+
+                            for (r = 0; r < rmax; r++)
+                            {
+                                for (c = 0; c < cmax; c++)
+                                {
+                                    x = (mp_limb_t) tile_d[r * nr + c];
+                                    NMOD_RED(x, x, mod);
+                                    _store_entry(D, C, i0 + ip + r,
+                                        j0 + jp + c, x, p0 == 0, op, mod);
+                                }
+                            }
+                        }
+                        else
+                        {
+                            lkernel(tile_l, apack_l + ip * kb,
+                                            bpack_l + jp * kb, kb, kc1);
+
+                            for (r = 0; r < rmax; r++)
+                            {
+                                for (c = 0; c < cmax; c++)
+                                {
+                                    NMOD2_RED2(x, tile_l[2 * (r * nr + c)],
+                                        tile_l[2 * (r * nr + c) + 1], mod);
+                                    _store_entry(D, C, i0 + ip + r,
+                                        j0 + jp + c, x, p0 == 0, op, mod);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    if (method == METHOD_DOUBLE)
+    {
+        flint_free(apack_d);
+        flint_free(bpack_d);
+        flint_free(tile_d);
+    }
+    else
+    {
+        flint_free(apack_l);
+        flint_free(bpack_l);
+        flint_free(tile_l);
+    }
+}
+
+static void
+_nmod_mat_mul_blocked_worker(void * arg_ptr)
+{
+    _nmod_mat_mul_blocked_serial((_nmod_mat_mul_blocked_arg_t *) arg_ptr);
+}
+
+void
+_nmod_mat_mul_blocked(nmod_mat_t D, const nmod_mat_t C,
+                                const nmod_mat_t A, const nmod_mat_t B, int op)
+{
+    slong m, k, n, i, num_threads;
+    _nmod_mat_mul_blocked_arg_t * args;
+    int method;
+
+    m = A->r;
+    k = A->c;
+    n = B->c;
+
+    if (m == 0 || n == 0)
+        return;
+
+    if (k == 0)
+    {
+        if (op == 0)
+            nmod_mat_zero(D);
+        else
+            nmod_mat_set(D, C);
+        return;
+    }
+
+    if (A->mod.n <= (UWORD(1) << NMOD_MAT_MUL_BLOCKED_FP_BITS))
+        method = METHOD_DOUBLE;
+    else if (A->mod.n <= (UWORD(1) << NMOD_MAT_MUL_BLOCKED_HALF_BITS))
+        method = METHOD_LIMB1;
+    else
+        method = METHOD_LIMB2;
+
+    /* split the rows of the output between the threads */
+    num_threads = flint_get_num_threads();
+    num_threads = FLINT_MIN(num_threads, (m + BLOCK_MC / 4 - 1) / (BLOCK_MC / 4));
+    if ((double) m * (double) n * (double) k < 1e6)
+        num_threads = 1;
+    num_threads = FLINT_MAX(num_threads, 1);
+
+    args = flint_malloc(sizeof(_nmod_mat_mul_blocked_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        slong m0 = (m * i) / num_threads;
+        slong m1 = (m * (i + 1)) / num_threads;
+
+        args[i].D = D->rows + m0;
+        args[i].C = (op == 0) ? NULL : C->rows + m0;
+        args[i].A = A->rows + m0;
+        args[i].B = B->rows;
+        args[i].m = m1 - m0;
+        args[i].k = k;
+        args[i].n = n;
+        args[i].op = op;
+        args[i].mod = A->mod;
+        args[i].method = method;
+        args[i].level = _nmod_vec_simd_level();
+    }
+
+    flint_parallel_do(_nmod_mat_mul_blocked_worker, args, num_threads,
+                            sizeof(_nmod_mat_mul_blocked_arg_t), num_threads);
+
+    flint_free(args);
+}
+
+void
+nmod_mat_mul_blocked(nmod_mat_t C, const nmod_mat_t A, const nmod_mat_t B)
+{
+    _nmod_mat_mul_blocked(C, NULL, A, B, 0);
+}
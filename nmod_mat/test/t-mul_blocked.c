@@ -0,0 +1,130 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_blocked....");
+    fflush(stdout);
+
+    for (i = 0; i < 300 * flint_test_multiplier(); i++)
+    {
+        nmod_mat_t A, B, C, D, E;
+        mp_limb_t mod;
+        slong m, k, n;
+        int op;
+
+        if (n_randint(state, 10) == 0)
+        {
+            m = n_randint(state, 300);
+            k = n_randint(state, 600);
+            n = n_randint(state, 300);
+        }
+        else
+        {
+            m = n_randint(state, 50);
+            k = n_randint(state, 50);
+            n = n_randint(state, 50);
+        }
+
+        /* cover each accumulation strategy and its overflow boundary */
+        switch (n_randint(state, 5))
+        {
+            case 0:
+                mod = n_randtest_not_zero(state);
+                break;
+            case 1:
+                mod = n_randtest_bits(state, n_randint(state, 24) + 1);
+                break;
+            case 2:
+                mod = (UWORD(1) << n_randint(state, FLINT_BITS / 2 + 1))
+                                                    - n_randint(state, 2);
+                break;
+            case 3:
+                mod = UWORD_MAX/2 + 1 - n_randbits(state, 4);
+                break;
+            default:
+                mod = UWORD_MAX - n_randbits(state, 4);
+                break;
+        }
+
+        if (mod == 0)
+            mod = 1;
+
+        nmod_mat_init(A, m, k, mod);
+        nmod_mat_init(B, k, n, mod);
+        nmod_mat_init(C, m, n, mod);
+        nmod_mat_init(D, m, n, mod);
+        nmod_mat_init(E, m, n, mod);
+
+        if (n_randint(state, 2))
+            nmod_mat_randtest(A, state);
+        else
+            nmod_mat_randfull(A, state);
+
+        if (n_randint(state, 2))
+            nmod_mat_randtest(B, state);
+        else
+            nmod_mat_randfull(B, state);
+
+        nmod_mat_randtest(C, state);
+        nmod_mat_randtest(D, state);  /* make sure noise in the output is ok */
+
+        op = n_randint(state, 3) - 1;
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        _nmod_mat_mul_blocked(D, C, A, B, op);
+        _nmod_mat_mul_classical(E, C, A, B, op);
+
+        if (!nmod_mat_equal(D, E))
+        {
+            flint_printf("FAIL: results not equal\n");
+            flint_printf("m = %wd, k = %wd, n = %wd, mod = %wu, op = %d\n",
+                m, k, n, mod, op);
+            abort();
+        }
+
+        /* check aliasing of C and D */
+        _nmod_mat_mul_blocked(C, C, A, B, op);
+
+        if (!nmod_mat_equal(C, E))
+        {
+            flint_printf("FAIL: aliasing\n");
+            flint_printf("m = %wd, k = %wd, n = %wd, mod = %wu, op = %d\n",
+                m, k, n, mod, op);
+            abort();
+        }
+
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+        nmod_mat_clear(C);
+        nmod_mat_clear(D);
+        nmod_mat_clear(E);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,399 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NMOD_MPOLY_H
+#define NMOD_MPOLY_H
+
+#ifdef NMOD_MPOLY_INLINES_C
+#define NMOD_MPOLY_INLINE FLINT_DLL
+#else
+#define NMOD_MPOLY_INLINE static __inline__
+#endif
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdio.h>
+#undef ulong
+
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "longlong.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "mpoly.h"
+#include "fmpz_mpoly.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*  Type definitions *********************************************************/
+
+typedef struct
+{
+   slong n;        /* number of elements in exponent vector (including deg) */
+   ordering_t ord; /* polynomial ordering */
+   nmod_t mod;     /* modulus of the coefficients */
+} nmod_mpoly_ctx_struct;
+
+typedef nmod_mpoly_ctx_struct nmod_mpoly_ctx_t[1];
+
+typedef struct
+{
+   mp_limb_t * coeffs; /* alloc limbs, reduced and nonzero up to length */
+   ulong * exps;
+   slong alloc;
+   slong length;
+   slong bits;     /* number of bits per exponent */
+} nmod_mpoly_struct;
+
+typedef nmod_mpoly_struct nmod_mpoly_t[1];
+
+/* Context object ************************************************************/
+
+FLINT_DLL void nmod_mpoly_ctx_init(nmod_mpoly_ctx_t ctx,
+                           slong nvars, const ordering_t ord, mp_limb_t modulus);
+
+NMOD_MPOLY_INLINE
+void nmod_mpoly_ctx_clear(nmod_mpoly_ctx_t ctx)
+{
+   /* nothing to be done at the moment */
+}
+
+/*  Memory management ********************************************************/
+
+FLINT_DLL void nmod_mpoly_init(nmod_mpoly_t poly, const nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL void nmod_mpoly_init2(nmod_mpoly_t poly, slong alloc,
+                                                   const nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL void _nmod_mpoly_realloc(mp_limb_t ** poly, ulong ** exps,
+                                            slong * alloc, slong len, slong N);
+
+FLINT_DLL void nmod_mpoly_realloc(nmod_mpoly_t poly, slong alloc,
+                                                   const nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL void _nmod_mpoly_fit_length(mp_limb_t ** poly,
+                             ulong ** exps, slong * alloc, slong len, slong N);
+
+FLINT_DLL void nmod_mpoly_fit_length(nmod_mpoly_t poly, slong len,
+                                                   const nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL void nmod_mpoly_clear(nmod_mpoly_t poly, const nmod_mpoly_ctx_t ctx);
+
+NMOD_MPOLY_INLINE
+void _nmod_mpoly_set_length(nmod_mpoly_t poly, slong newlen,
+                                                   const nmod_mpoly_ctx_t ctx)
+{
+   poly->length = newlen;
+}
+
+NMOD_MPOLY_INLINE
+void nmod_mpoly_truncate(nmod_mpoly_t poly, slong newlen,
+                                                   const nmod_mpoly_ctx_t ctx)
+{
+   if (poly->length > newlen)
+      poly->length = newlen;
+}
+
+/*
+   if poly->bits < bits, set poly->bits = bits and reallocate poly->exps
+*/
+NMOD_MPOLY_INLINE
+void nmod_mpoly_fit_bits(nmod_mpoly_t poly,
+                                        slong bits, const nmod_mpoly_ctx_t ctx)
+{
+   slong N;
+   ulong * t;
+
+   FLINT_ASSERT(bits <= FLINT_BITS);
+
+   if (poly->bits < bits)
+   {
+      if (poly->alloc != 0)
+      {
+         N = words_per_exp(ctx->n, bits);
+         t = flint_malloc(N*poly->alloc*sizeof(ulong));
+         mpoly_unpack_monomials(t, bits, poly->exps,
+                                             poly->bits, poly->length, ctx->n);
+         flint_free(poly->exps);
+         poly->exps = t;
+      }
+
+      poly->bits = bits;
+   }
+}
+
+/*  Basic manipulation *******************************************************/
+
+FLINT_DLL void nmod_mpoly_gen(nmod_mpoly_t poly, slong i,
+                                                   const nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL void nmod_mpoly_set_ui(nmod_mpoly_t poly,
+                                          ulong c, const nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL int nmod_mpoly_equal_ui(const nmod_mpoly_t poly,
+                                          ulong c, const nmod_mpoly_ctx_t ctx);
+
+NMOD_MPOLY_INLINE
+void nmod_mpoly_swap(nmod_mpoly_t poly1,
+                                nmod_mpoly_t poly2, const nmod_mpoly_ctx_t ctx)
+{
+   nmod_mpoly_struct t = *poly1;
+   *poly1 = *poly2;
+   *poly2 = t;
+}
+
+NMOD_MPOLY_INLINE
+void nmod_mpoly_zero(nmod_mpoly_t poly, const nmod_mpoly_ctx_t ctx)
+{
+   _nmod_mpoly_set_length(poly, 0, ctx);
+}
+
+NMOD_MPOLY_INLINE
+void nmod_mpoly_one(nmod_mpoly_t poly, const nmod_mpoly_ctx_t ctx)
+{
+   nmod_mpoly_set_ui(poly, UWORD(1), ctx);
+}
+
+NMOD_MPOLY_INLINE
+int nmod_mpoly_is_zero(const nmod_mpoly_t poly, const nmod_mpoly_ctx_t ctx)
+{
+   return poly->length == 0;
+}
+
+NMOD_MPOLY_INLINE
+int nmod_mpoly_is_one(const nmod_mpoly_t poly, const nmod_mpoly_ctx_t ctx)
+{
+   return nmod_mpoly_equal_ui(poly, 1, ctx);
+}
+
+FLINT_DLL ulong nmod_mpoly_get_coeff_ui(const nmod_mpoly_t poly,
+                                          slong n, const nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL void nmod_mpoly_set_coeff_ui(nmod_mpoly_t poly,
+                                 slong n, ulong x, const nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL void nmod_mpoly_get_monomial(ulong * exps, const nmod_mpoly_t poly,
+                                          slong n, const nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL void nmod_mpoly_set_monomial(nmod_mpoly_t poly,
+                      slong n, const ulong * exps, const nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL void nmod_mpoly_set_term_ui(nmod_mpoly_t poly,
+                       ulong const * exp, ulong c, const nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL ulong nmod_mpoly_get_term_ui(const nmod_mpoly_t poly,
+                                ulong const * exp, const nmod_mpoly_ctx_t ctx);
+
+/* Set, negate and conversion ************************************************/
+
+FLINT_DLL void nmod_mpoly_set(nmod_mpoly_t poly1, const nmod_mpoly_t poly2,
+                                                   const nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL void nmod_mpoly_neg(nmod_mpoly_t poly1, const nmod_mpoly_t poly2,
+                                                   const nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL void nmod_mpoly_set_fmpz_mpoly(nmod_mpoly_t poly1,
+                        const fmpz_mpoly_t poly2, const nmod_mpoly_ctx_t ctx);
+
+/* Comparison ****************************************************************/
+
+FLINT_DLL int nmod_mpoly_equal(const nmod_mpoly_t poly1,
+                         const nmod_mpoly_t poly2, const nmod_mpoly_ctx_t ctx);
+
+/* Basic arithmetic **********************************************************/
+
+FLINT_DLL void nmod_mpoly_add_ui(nmod_mpoly_t poly1,
+                const nmod_mpoly_t poly2, ulong c, const nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL void nmod_mpoly_sub_ui(nmod_mpoly_t poly1,
+                const nmod_mpoly_t poly2, ulong c, const nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL slong _nmod_mpoly_add(mp_limb_t * poly1, ulong * exps1,
+            const mp_limb_t * poly2, const ulong * exps2, slong len2,
+            const mp_limb_t * poly3, const ulong * exps3, slong len3, slong N,
+                                       ulong maskhi, ulong masklo, nmod_t mod);
+
+FLINT_DLL void nmod_mpoly_add(nmod_mpoly_t poly1, const nmod_mpoly_t poly2,
+                         const nmod_mpoly_t poly3, const nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL slong _nmod_mpoly_sub(mp_limb_t * poly1, ulong * exps1,
+            const mp_limb_t * poly2, const ulong * exps2, slong len2,
+            const mp_limb_t * poly3, const ulong * exps3, slong len3, slong N,
+                                       ulong maskhi, ulong masklo, nmod_t mod);
+
+FLINT_DLL void nmod_mpoly_sub(nmod_mpoly_t poly1, const nmod_mpoly_t poly2,
+                         const nmod_mpoly_t poly3, const nmod_mpoly_ctx_t ctx);
+
+/* Scalar operations *********************************************************/
+
+FLINT_DLL void nmod_mpoly_scalar_mul_ui(nmod_mpoly_t poly1,
+                const nmod_mpoly_t poly2, ulong c, const nmod_mpoly_ctx_t ctx);
+
+/* Multiplication ************************************************************/
+
+FLINT_DLL slong _nmod_mpoly_mul_johnson(mp_limb_t ** poly1, ulong ** exp1,
+        slong * alloc, const mp_limb_t * poly2, const ulong * exp2, slong len2,
+           const mp_limb_t * poly3, const ulong * exp3, slong len3, slong N,
+                                       ulong maskhi, ulong masklo, nmod_t mod);
+
+FLINT_DLL void nmod_mpoly_mul_johnson(nmod_mpoly_t poly1,
+                 const nmod_mpoly_t poly2, const nmod_mpoly_t poly3,
+                                                   const nmod_mpoly_ctx_t ctx);
+
+/* Divisibility **************************************************************/
+
+FLINT_DLL slong _nmod_mpoly_divides_monagan_pearce(mp_limb_t ** poly1,
+                  ulong ** exp1, slong * alloc, const mp_limb_t * poly2,
+                    const ulong * exp2, slong len2, const mp_limb_t * poly3,
+                          const ulong * exp3, slong len3, slong bits, slong N,
+                                       ulong maskhi, ulong masklo, nmod_t mod);
+
+FLINT_DLL int nmod_mpoly_divides_monagan_pearce(nmod_mpoly_t poly1,
+                  const nmod_mpoly_t poly2, const nmod_mpoly_t poly3,
+                                                   const nmod_mpoly_ctx_t ctx);
+
+/* Division ******************************************************************/
+
+FLINT_DLL slong _nmod_mpoly_divrem_monagan_pearce(slong * lenr,
+  mp_limb_t ** polyq, ulong ** expq, slong * allocq, mp_limb_t ** polyr,
+                  ulong ** expr, slong * allocr, const mp_limb_t * poly2,
+   const ulong * exp2, slong len2, const mp_limb_t * poly3, const ulong * exp3,
+      slong len3, slong bits, slong N, ulong maskhi, ulong masklo, nmod_t mod);
+
+FLINT_DLL void nmod_mpoly_divrem_monagan_pearce(nmod_mpoly_t q, nmod_mpoly_t r,
+                  const nmod_mpoly_t poly2, const nmod_mpoly_t poly3,
+                                                   const nmod_mpoly_ctx_t ctx);
+
+/* GCD ***********************************************************************/
+
+/* minimum length of the inputs for the images of a gcd to use threads */
+#define NMOD_MPOLY_GCD_THREAD_CUTOFF 20
+
+FLINT_DLL int _nmod_mpoly_gcd_brown(nmod_mpoly_t G, const nmod_mpoly_t A,
+       const nmod_mpoly_t B, const nmod_mpoly_ctx_t ctx, slong num_threads);
+
+FLINT_DLL int nmod_mpoly_gcd_brown(nmod_mpoly_t G, const nmod_mpoly_t A,
+                         const nmod_mpoly_t B, const nmod_mpoly_ctx_t ctx);
+
+FLINT_DLL int _nmod_mpoly_gcd_zippel(nmod_mpoly_t G, const nmod_mpoly_t A,
+                  const nmod_mpoly_t B, const nmod_mpoly_t Gform,
+        const nmod_mpoly_ctx_t ctx, flint_rand_t state, slong num_threads);
+
+FLINT_DLL int nmod_mpoly_gcd_zippel(nmod_mpoly_t G, const nmod_mpoly_t A,
+                  const nmod_mpoly_t B, const nmod_mpoly_t Gform,
+                            const nmod_mpoly_ctx_t ctx, flint_rand_t state);
+
+/* Input/output **************************************************************/
+
+FLINT_DLL int _nmod_mpoly_fprint_pretty(FILE * file, const mp_limb_t * poly,
+                           const ulong * exps, slong len, const char ** x,
+                               slong bits, slong n, int deg, int rev, slong N);
+
+FLINT_DLL int nmod_mpoly_fprint_pretty(FILE * file,
+         const nmod_mpoly_t poly, const char ** x, const nmod_mpoly_ctx_t ctx);
+
+NMOD_MPOLY_INLINE
+int nmod_mpoly_print_pretty(const nmod_mpoly_t poly,
+                                   const char ** x, const nmod_mpoly_ctx_t ctx)
+{
+   return nmod_mpoly_fprint_pretty(stdout, poly, x, ctx);
+}
+
+/* Random generation *********************************************************/
+
+FLINT_DLL void nmod_mpoly_randtest(nmod_mpoly_t poly, flint_rand_t state,
+                  slong length, slong exp_bound, const nmod_mpoly_ctx_t ctx);
+
+/******************************************************************************
+
+   Internal functions (guaranteed to change without notice)
+
+******************************************************************************/
+
+/*
+   Sums of products of reduced coefficients are accumulated in nlimbs words,
+   as given by _nmod_vec_dot_bound_limbs for the number of products, and
+   reduced once at the end.
+*/
+NMOD_MPOLY_INLINE
+void _nmod_mpoly_addmul_acc(ulong * c, ulong a, ulong b, int nlimbs)
+{
+   ulong p[2];
+
+   if (nlimbs <= 1)
+      c[0] += a*b;
+   else
+   {
+      umul_ppmm(p[1], p[0], a, b);
+
+      if (nlimbs == 2)
+         add_ssaaaa(c[1], c[0], c[1], c[0], p[1], p[0]);
+      else
+         add_sssaaaaaa(c[2], c[1], c[0], c[2], c[1], c[0], 0, p[1], p[0]);
+   }
+}
+
+NMOD_MPOLY_INLINE
+ulong _nmod_mpoly_reduce_acc(const ulong * c, int nlimbs, nmod_t mod)
+{
+   ulong r, hi;
+
+   if (nlimbs <= 1)
+      NMOD_RED(r, c[0], mod);
+   else if (nlimbs == 2)
+      NMOD2_RED2(r, c[1], c[0], mod);
+   else
+   {
+      NMOD_RED(hi, c[2], mod);
+      NMOD_RED3(r, hi, c[1], c[0], mod);
+   }
+
+   return r;
+}
+
+/******************************************************************************
+
+   Internal consistency checks
+
+******************************************************************************/
+
+/*
+   test that the terms in poly are in the correct order and that the
+   coefficients are reduced and nonzero
+*/
+NMOD_MPOLY_INLINE
+void nmod_mpoly_test(const nmod_mpoly_t poly, const nmod_mpoly_ctx_t ctx)
+{
+   slong i, N;
+   ulong maskhi, masklo;
+
+   masks_from_bits_ord(maskhi, masklo, poly->bits, ctx->ord);
+   N = words_per_exp(ctx->n, poly->bits);
+
+   if (!mpoly_monomials_test(poly->exps, poly->length, N, maskhi, masklo))
+      flint_throw(FLINT_ERROR, "Polynomial invalid");
+
+   for (i = 0; i < poly->length; i++)
+   {
+      if (poly->coeffs[i] == 0 || poly->coeffs[i] >= ctx->mod.n)
+         flint_throw(FLINT_ERROR, "Polynomial invalid");
+   }
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,55 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "nmod_mpoly.h"
+
+void nmod_mpoly_add_ui(nmod_mpoly_t poly1,
+                 const nmod_mpoly_t poly2, ulong c, const nmod_mpoly_ctx_t ctx)
+{
+   slong N;
+   slong len2 = poly2->length;
+
+   NMOD_RED(c, c, ctx->mod);
+
+   if (len2 == 0)
+   {
+      nmod_mpoly_set_ui(poly1, c, ctx);
+      return;
+   }
+
+   nmod_mpoly_set(poly1, poly2, ctx);
+
+   if (c == 0)
+      return;
+
+   N = words_per_exp(ctx->n, poly1->bits);
+
+   /* the constant term, if any, is the last one */
+   if (mpoly_monomial_is_zero(poly1->exps + (len2 - 1)*N, N))
+   {
+      poly1->coeffs[len2 - 1] = nmod_add(poly1->coeffs[len2 - 1], c,
+                                                                    ctx->mod);
+
+      if (poly1->coeffs[len2 - 1] == 0)
+         _nmod_mpoly_set_length(poly1, len2 - 1, ctx);
+   } else
+   {
+      nmod_mpoly_fit_length(poly1, len2 + 1, ctx);
+
+      flint_mpn_zero(poly1->exps + len2*N, N);
+      poly1->coeffs[len2] = c;
+
+      _nmod_mpoly_set_length(poly1, len2 + 1, ctx);
+   }
+}
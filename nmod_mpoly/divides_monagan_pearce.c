@@ -0,0 +1,660 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mpoly.h"
+
+/*
+   Set poly1 to poly2/poly3 if the division is exact, and return the length
+   of the quotient. Otherwise return 0. This version of the function assumes
+   the exponent vectors all fit in a single word. The exponent vectors are
+   assumed to have fields with the given number of bits. Assumes input polys
+   are nonzero. Implements "Polynomial division using dynamic arrays, heaps
+   and packed exponents" by Michael Monagan and Roman Pearce [1], except that
+   we divide from right to left and use a heap with smallest exponent at head.
+   [1] http://www.cecm.sfu.ca/~rpearcea/sdmp/sdmp_paper.pdf
+*/
+slong _nmod_mpoly_divides_monagan_pearce1(mp_limb_t ** poly1, ulong ** exp1,
+    slong * alloc, const mp_limb_t * poly2, const ulong * exp2, slong len2,
+           const mp_limb_t * poly3, const ulong * exp3, slong len3, slong bits,
+                                                      ulong maskhi, nmod_t mod)
+{
+   slong i, k, s;
+   slong next_free, Q_len = 0;
+   slong reuse_len = 0, heap_len = 2; /* heap zero index unused */
+   mpoly_heap1_s * heap;
+   mpoly_heap_t * chain;
+   mpoly_heap_t ** Q, ** reuse;
+   mpoly_heap_t * x, * x2;
+   mp_limb_t * p1 = *poly1;
+   ulong * e1 = *exp1;
+   ulong exp, maxexp = exp2[len2 - 1];
+   ulong c[3]; /* for accumulating coefficients */
+   int first, d1;
+   ulong mask = 0, lc_inv, acc;
+   int nlimbs;
+   TMP_INIT;
+
+   TMP_START;
+
+   /* at most len3 products contribute to each quotient coefficient */
+   nlimbs = _nmod_vec_dot_bound_limbs(len3, mod);
+
+   heap = (mpoly_heap1_s *) TMP_ALLOC((len3 + 1)*sizeof(mpoly_heap1_s));
+   /* alloc array of heap nodes which can be chained together */
+   chain = (mpoly_heap_t *) TMP_ALLOC(len3*sizeof(mpoly_heap_t));
+   /* space for temporary storage of pointers to heap nodes */
+   Q = (mpoly_heap_t **) TMP_ALLOC(len3*sizeof(mpoly_heap_t *));
+   /* space for pointers to heap nodes which can be reused */
+   reuse = (mpoly_heap_t **) TMP_ALLOC(len3*sizeof(mpoly_heap_t *));
+
+   /* start with no heap nodes in use */
+   next_free = 0;
+
+   /* mask with high bit set in each field of exponent vector */
+   for (i = 0; i < FLINT_BITS/bits; i++)
+      mask = (mask << bits) + (UWORD(1) << (bits - 1));
+
+   /* output poly index starts at -1, will be immediately updated to 0 */
+   k = -WORD(1);
+
+   /* see description of divisor heap division in paper */
+   s = len3;
+
+   /* insert (-1, 0, exp2[0]) into heap */
+   x = chain + next_free++;
+   x->i = -WORD(1);
+   x->j = 0;
+   x->next = NULL;
+
+   HEAP_ASSIGN(heap[1], exp2[0], x);
+
+   /* precompute the inverse of the leading coefficient of poly3 */
+   lc_inv = n_invmod(poly3[0], mod.n);
+
+   /* while heap is nonempty */
+   while (heap_len > 1)
+   {
+      /* get exponent field of heap top */
+      exp = heap[1].exp;
+
+      /* check for overflow in exponent: not an exact division */
+      if (mpoly_monomial_overflows1(exp, mask))
+      {
+            k = 0;
+
+            goto cleanup;
+      }
+
+      /* realloc output poly ready for next quotient term */
+      k++;
+      _nmod_mpoly_fit_length(&p1, &e1, alloc, k + 1, 1);
+
+      /* whether we are on first heap node for this exponent */
+      first = 1;
+
+      /* whether current exponent is divisible by exp3[0] */
+      d1 = 0;
+
+      /* set temporary coeff to zero */
+      c[0] = c[1] = c[2] = 0;
+      acc = 0;
+
+      /* while heap nonempty and contains chain with current output exponent */
+      while (heap_len > 1 && heap[1].exp == exp)
+      {
+         /* pop chain from heap */
+         x = _mpoly_heap_pop1(heap, &heap_len, maskhi);
+
+         /* if first heap node for this exp, check it's divisible by exp3[0] */
+         if (first)
+         {
+            d1 = mpoly_monomial_divides1(e1 + k, exp, exp3[0], mask);
+
+            first = 0;
+         }
+
+         if (x->i == -WORD(1))
+         {
+            /* this is the term poly2[j] */
+            acc = poly2[x->j];
+         } else
+         {
+            /* accumulate poly3[i]*q[j] */
+            _nmod_mpoly_addmul_acc(c, poly3[x->i], p1[x->j], nlimbs);
+         }
+
+         /* temporarily store pointer to this node, or designate for reuse */
+         if (x->i != -WORD(1) || x->j < len2 - 1)
+            Q[Q_len++] = x;
+         else
+            reuse[reuse_len++] = x;
+
+         /* for every node in this chain */
+         while ((x = x->next) != NULL)
+         {
+            if (x->i == -WORD(1))
+            {
+               /* this is the term poly2[j] */
+               acc = poly2[x->j];
+            } else
+            {
+               /* accumulate poly3[i]*q[j] */
+               _nmod_mpoly_addmul_acc(c, poly3[x->i], p1[x->j], nlimbs);
+            }
+
+            /* temporarily store pointer to node, or designate for reuse */
+            if (x->i != -WORD(1) || x->j < len2 - 1)
+               Q[Q_len++] = x;
+            else
+               reuse[reuse_len++] = x;
+         }
+      }
+
+      /* for each node temporarily stored */
+      while (Q_len > 0)
+      {
+         /* take node from store */
+         x = Q[--Q_len];
+
+         if (x->i == -WORD(1))
+         {
+            x->j++;
+            x->next = NULL;
+
+            /* insert (x->i, x->j + 1, exp2[x->j]) in heap */
+            _mpoly_heap_insert1(heap, exp2[x->j], x, &heap_len, maskhi);
+         } else if (x->j < k - 1)
+         {
+            x->j++;
+            x->next = NULL;
+
+            /* insert (x->i, x->j + 1, exp3[x->j] + e1[x->j]) in heap */
+            _mpoly_heap_insert1(heap, exp3[x->i] + e1[x->j], x, &heap_len,
+                                                                       maskhi);
+         } else if (x->j == k - 1)
+         {
+            s++;
+
+            /* node x no longer needed, designate for reuse */
+            reuse[reuse_len++] = x;
+         }
+      }
+
+      /* coefficient is poly2 term minus the accumulated products */
+      acc = nmod_sub(acc, _nmod_mpoly_reduce_acc(c, nlimbs, mod), mod);
+
+      /* if coeff is zero, no output coeff to be written */
+      if (acc == 0)
+         k--;
+      else
+      {
+         p1[k] = nmod_mul(acc, lc_inv, mod);
+
+         /* if monomials don't divide, or exponent too large */
+         if (!d1 || (exp^maskhi) < (maxexp^maskhi))
+         {
+            k = 0;
+
+            goto cleanup;
+         }
+
+         /* see paper */
+         for (i = 1; i < s; i++)
+         {
+            /* get an empty node, from reuse array if possible */
+            if (reuse_len != 0)
+               x2 = reuse[--reuse_len];
+            else
+               x2 = chain + next_free++;
+
+            x2->i = i;
+            x2->j = k;
+            x2->next = NULL;
+
+            /* insert (i, k, exp3[i] + e1[k]) in heap */
+            _mpoly_heap_insert1(heap, exp3[i] + e1[k], x2, &heap_len, maskhi);
+         }
+
+         s = 1;
+      }
+   }
+
+   k++;
+
+cleanup:
+
+   (*poly1) = p1;
+   (*exp1) = e1;
+
+   TMP_END;
+
+   /* return length of quotient, or zero if division not exact */
+   return k;
+}
+
+/*
+   Set poly1 to poly2/poly3 if the division is exact, and return the length
+   of the quotient. Otherwise return 0. This version allows exponent vectors
+   that each fit in "N" word. The exponent vectors are assumed to have fields
+   with the given number of bits. Assumes input polys are nonzero. Implements
+   "Polynomial division using dynamic arrays, heaps and packed exponents" by
+   Michael Monagan and Roman Pearce [1], except that we divide from right to
+   left and use a heap with smallest exponent at head.
+   [1] http://www.cecm.sfu.ca/~rpearcea/sdmp/sdmp_paper.pdf
+*/
+slong _nmod_mpoly_divides_monagan_pearce(mp_limb_t ** poly1, ulong ** exp1,
+    slong * alloc, const mp_limb_t * poly2, const ulong * exp2, slong len2,
+                const mp_limb_t * poly3, const ulong * exp3, slong len3,
+                   slong bits, slong N, ulong maskhi, ulong masklo, nmod_t mod)
+{
+   slong i, k, s;
+   slong next_free, Q_len = 0;
+   slong reuse_len = 0, heap_len = 2; /* heap zero index unused */
+   mpoly_heap_s * heap;
+   mpoly_heap_t * chain;
+   mpoly_heap_t ** Q, ** reuse;
+   mpoly_heap_t * x, * x2;
+   mp_limb_t * p1 = *poly1;
+   ulong * e1 = *exp1;
+   ulong * exp, * exps;
+   ulong ** exp_list;
+   ulong c[3]; /* for accumulating coefficients */
+   slong exp_next;
+   int first, d1;
+   ulong mask = 0, lc_inv, acc;
+   int nlimbs;
+   TMP_INIT;
+
+   /* if exponent vectors are all one word, call specialised version */
+   if (N == 1)
+      return _nmod_mpoly_divides_monagan_pearce1(poly1, exp1, alloc,
+                      poly2, exp2, len2, poly3, exp3, len3, bits, maskhi, mod);
+
+   TMP_START;
+
+   /* at most len3 products contribute to each quotient coefficient */
+   nlimbs = _nmod_vec_dot_bound_limbs(len3, mod);
+
+   heap = (mpoly_heap_s *) TMP_ALLOC((len3 + 1)*sizeof(mpoly_heap_s));
+   /* alloc array of heap nodes which can be chained together */
+   chain = (mpoly_heap_t *) TMP_ALLOC(len3*sizeof(mpoly_heap_t));
+   /* space for temporary storage of pointers to heap nodes */
+   Q = (mpoly_heap_t **) TMP_ALLOC(len3*sizeof(mpoly_heap_t *));
+   /* space for pointers to heap nodes which can be reused */
+   reuse = (mpoly_heap_t **) TMP_ALLOC(len3*sizeof(mpoly_heap_t *));
+   /* array of exponent vectors, each of "N" words */
+   exps = (ulong *) TMP_ALLOC(len3*N*sizeof(ulong));
+   /* list of pointers to available exponent vectors */
+   exp_list = (ulong **) TMP_ALLOC(len3*sizeof(ulong *));
+
+   /* set up list of available exponent vectors */
+   for (i = 0; i < len3; i++)
+      exp_list[i] = exps + i*N;
+
+   /* start with no heap nodes or exponents in use */
+   next_free = 0;
+   exp_next = 0;
+
+   /* mask with high bit set in each word of each field of exponent vector */
+   for (i = 0; i < FLINT_BITS/bits; i++)
+      mask = (mask << bits) + (UWORD(1) << (bits - 1));
+
+   /* output poly index starts at -1, will be immediately updated to 0 */
+   k = -WORD(1);
+
+   /* see description of divisor heap division in paper */
+   s = len3;
+
+   /* insert (-1, 0, exp2[0]) into heap */
+   x = chain + next_free++;
+   x->i = -WORD(1);
+   x->j = 0;
+   x->next = NULL;
+
+   heap[1].next = x;
+   heap[1].exp = exp_list[exp_next++];
+
+   mpoly_monomial_set(heap[1].exp, exp2, N);
+
+   /* precompute the inverse of the leading coefficient of poly3 */
+   lc_inv = n_invmod(poly3[0], mod.n);
+
+   /* while heap is nonempty */
+   while (heap_len > 1)
+   {
+      /* get pointer to exponent field of heap top */
+      exp = heap[1].exp;
+
+      /* check for overflow in exponent: not an exact division */
+      if (mpoly_monomial_overflows(exp, N, mask))
+      {
+            k = 0;
+
+            goto cleanup;
+      }
+
+      /* realloc output poly ready for next quotient term */
+      k++;
+      _nmod_mpoly_fit_length(&p1, &e1, alloc, k + 1, N);
+
+      /* whether we are on first heap node for this exponent */
+      first = 1;
+
+      /* whether current exponent is divisible by exp3[0] */
+      d1 = 0;
+
+      /* set temporary coeff to zero */
+      c[0] = c[1] = c[2] = 0;
+      acc = 0;
+
+      /* while heap nonempty and contains chain with current output exponent */
+      while (heap_len > 1 && mpoly_monomial_equal(heap[1].exp, exp, N))
+      {
+         /* put pointer to exponent on heap top into list of available exps */
+         exp_list[--exp_next] = heap[1].exp;
+
+         /* pop chain from heap */
+         x = _mpoly_heap_pop(heap, &heap_len, N, maskhi, masklo);
+
+         /* if first heap node for this exp, check it's divisible by exp3[0] */
+         if (first)
+         {
+            d1 = mpoly_monomial_divides(e1 + k*N, exp, exp3, N, mask);
+
+            first = 0;
+         }
+
+         if (x->i == -WORD(1))
+         {
+            /* this is the term poly2[j] */
+            acc = poly2[x->j];
+         } else
+         {
+            /* accumulate poly3[i]*q[j] */
+            _nmod_mpoly_addmul_acc(c, poly3[x->i], p1[x->j], nlimbs);
+         }
+
+         /* temporarily store pointer to this node, or designate for reuse */
+         if (x->i != -WORD(1) || x->j < len2 - 1)
+            Q[Q_len++] = x;
+         else
+            reuse[reuse_len++] = x;
+
+         /* for every node in this chain */
+         while ((x = x->next) != NULL)
+         {
+            if (x->i == -WORD(1))
+            {
+               /* this is the term poly2[j] */
+               acc = poly2[x->j];
+            } else
+            {
+               /* accumulate poly3[i]*q[j] */
+               _nmod_mpoly_addmul_acc(c, poly3[x->i], p1[x->j], nlimbs);
+            }
+
+            /* temporarily store pointer to node, or designate for reuse */
+            if (x->i != -WORD(1) || x->j < len2 - 1)
+               Q[Q_len++] = x;
+            else
+               reuse[reuse_len++] = x;
+         }
+      }
+
+      /* for each node temporarily stored */
+      while (Q_len > 0)
+      {
+         /* take node from store */
+         x = Q[--Q_len];
+
+         if (x->i == -WORD(1))
+         {
+            x->j++;
+            x->next = NULL;
+
+            mpoly_monomial_set(exp_list[exp_next], exp2 + x->j*N, N);
+
+            /* insert (x->i, x->j + 1, exp2[x->j]) in heap */
+            if (!_mpoly_heap_insert(heap, exp_list[exp_next++], x, &heap_len,
+                                                            N, maskhi, masklo))
+               exp_next--;
+         } else if (x->j < k - 1)
+         {
+            x->j++;
+            x->next = NULL;
+
+            mpoly_monomial_add(exp_list[exp_next], exp3 + x->i*N,
+                                                             e1 + x->j*N, N);
+
+            /* insert (x->i, x->j + 1, exp3[x->j] + e1[x->j]) in heap */
+            if (!_mpoly_heap_insert(heap, exp_list[exp_next++], x, &heap_len,
+                                                            N, maskhi, masklo))
+               exp_next--;
+         } else if (x->j == k - 1)
+         {
+            s++;
+
+            /* node x no longer needed, designate for reuse */
+            reuse[reuse_len++] = x;
+         }
+      }
+
+      /* coefficient is poly2 term minus the accumulated products */
+      acc = nmod_sub(acc, _nmod_mpoly_reduce_acc(c, nlimbs, mod), mod);
+
+      /* if coeff is zero, no output coeff to be written */
+      if (acc == 0)
+         k--;
+      else
+      {
+         p1[k] = nmod_mul(acc, lc_inv, mod);
+
+         /* if monomials don't divide, or exponent too large */
+         if (!d1 ||
+             mpoly_monomial_gt(exp, exp2 + (len2 - 1)*N, N, maskhi, masklo))
+         {
+            k = 0;
+
+            goto cleanup;
+         }
+
+         /* see paper */
+         for (i = 1; i < s; i++)
+         {
+            if (reuse_len != 0)
+               x2 = reuse[--reuse_len];
+            else
+               x2 = chain + next_free++;
+
+            x2->i = i;
+            x2->j = k;
+            x2->next = NULL;
+
+            mpoly_monomial_add(exp_list[exp_next], exp3 + i*N, e1 + k*N, N);
+
+            /* insert (i, k, exp3[i] + e1[k]) in heap */
+            if (!_mpoly_heap_insert(heap, exp_list[exp_next++], x2, &heap_len,
+                                                            N, maskhi, masklo))
+               exp_next--;
+         }
+
+         s = 1;
+      }
+   }
+
+   k++;
+
+cleanup:
+
+   (*poly1) = p1;
+   (*exp1) = e1;
+
+   TMP_END;
+
+   /* return length of quotient, or zero if division not exact */
+   return k;
+}
+
+/* return 1 if quotient is exact */
+int nmod_mpoly_divides_monagan_pearce(nmod_mpoly_t poly1,
+                  const nmod_mpoly_t poly2, const nmod_mpoly_t poly3,
+                                                    const nmod_mpoly_ctx_t ctx)
+{
+   slong i, bits, exp_bits, N, len = 0;
+   ulong * max_degs2, * max_degs3;
+   ulong max = 0;
+   ulong maskhi, masklo;
+   ulong * exp2 = poly2->exps, * exp3 = poly3->exps, * expq;
+   int free2 = 0, free3 = 0;
+   ulong mask = 0;
+   TMP_INIT;
+
+   /* check divisor is nonzero */
+   if (poly3->length == 0)
+      flint_throw(FLINT_DIVZERO,
+                  "Divide by zero in nmod_mpoly_divides_monagan_pearce");
+
+   /* dividend zero, write out quotient */
+   if (poly2->length == 0)
+   {
+      nmod_mpoly_zero(poly1, ctx);
+
+      return 1;
+   }
+
+   TMP_START;
+
+   max_degs2 = (ulong *) TMP_ALLOC(ctx->n*sizeof(ulong));
+   max_degs3 = (ulong *) TMP_ALLOC(ctx->n*sizeof(ulong));
+
+   /* compute maximum degree appearing in inputs and outputs */
+
+   mpoly_max_degrees(max_degs2, poly2->exps, poly2->length,
+                                                         poly2->bits, ctx->n);
+   mpoly_max_degrees(max_degs3, poly3->exps, poly3->length,
+                                                         poly3->bits, ctx->n);
+
+   for (i = 0; i < ctx->n; i++)
+   {
+      if (max_degs2[i] > max)
+         max = max_degs2[i];
+
+      /* cannot be exact division if poly2 degrees less than those of poly3 */
+      if (max_degs2[i] < max_degs3[i])
+      {
+         len = 0;
+
+         goto cleanup;
+      }
+   }
+
+   /* compute number of bits required for exponent fields */
+   bits = FLINT_BIT_COUNT(max);
+
+   exp_bits = 8;
+   while (bits >= exp_bits)
+      exp_bits += 1;
+
+   exp_bits = FLINT_MAX(exp_bits, poly2->bits);
+   exp_bits = FLINT_MAX(exp_bits, poly3->bits);
+   exp_bits = mpoly_optimize_bits(exp_bits, ctx->n);
+
+   masks_from_bits_ord(maskhi, masklo, exp_bits, ctx->ord);
+   N = words_per_exp(ctx->n, exp_bits);
+
+   /* temporary space to check leading monomials divide */
+   expq = (ulong *) TMP_ALLOC(N*sizeof(ulong));
+
+   /* quick check for easy case of inexact division of leading monomials */
+   if (poly2->bits == poly3->bits && N == 1 &&
+       poly2->exps[0] < poly3->exps[0])
+   {
+      goto cleanup;
+   }
+
+   /* ensure input exponents packed to same size as output exponents */
+   if (exp_bits > poly2->bits)
+   {
+      free2 = 1;
+      exp2 = (ulong *) flint_malloc(N*poly2->length*sizeof(ulong));
+      mpoly_unpack_monomials(exp2, exp_bits, poly2->exps, poly2->bits,
+                                                        poly2->length, ctx->n);
+   }
+
+   if (exp_bits > poly3->bits)
+   {
+      free3 = 1;
+      exp3 = (ulong *) flint_malloc(N*poly3->length*sizeof(ulong));
+      mpoly_unpack_monomials(exp3, exp_bits, poly3->exps, poly3->bits,
+                                                        poly3->length, ctx->n);
+   }
+
+   /* mask with high bit of each exponent vector field set */
+   for (i = 0; i < FLINT_BITS/exp_bits; i++)
+      mask = (mask << exp_bits) + (UWORD(1) << (exp_bits - 1));
+
+   /* check leading monomial divides exactly */
+   if (!mpoly_monomial_divides(expq, exp2, exp3, N, mask))
+   {
+      len = 0;
+
+      goto cleanup;
+   }
+
+   /* deal with aliasing and divide polynomials */
+   if (poly1 == poly2 || poly1 == poly3)
+   {
+      nmod_mpoly_t temp;
+
+      nmod_mpoly_init2(temp, poly2->length/poly3->length + 1, ctx);
+      nmod_mpoly_fit_bits(temp, exp_bits, ctx);
+      temp->bits = exp_bits;
+
+      len = _nmod_mpoly_divides_monagan_pearce(&temp->coeffs, &temp->exps,
+                            &temp->alloc, poly2->coeffs, exp2, poly2->length,
+                              poly3->coeffs, exp3, poly3->length, exp_bits, N,
+                                                    maskhi, masklo, ctx->mod);
+
+      nmod_mpoly_swap(temp, poly1, ctx);
+
+      nmod_mpoly_clear(temp, ctx);
+   } else
+   {
+      nmod_mpoly_fit_length(poly1, poly2->length/poly3->length + 1, ctx);
+      nmod_mpoly_fit_bits(poly1, exp_bits, ctx);
+      poly1->bits = exp_bits;
+
+      len = _nmod_mpoly_divides_monagan_pearce(&poly1->coeffs, &poly1->exps,
+                            &poly1->alloc, poly2->coeffs, exp2, poly2->length,
+                              poly3->coeffs, exp3, poly3->length, exp_bits, N,
+                                                    maskhi, masklo, ctx->mod);
+   }
+
+cleanup:
+
+   _nmod_mpoly_set_length(poly1, len, ctx);
+
+   if (free2)
+      flint_free(exp2);
+
+   if (free3)
+      flint_free(exp3);
+
+   TMP_END;
+
+   /* division is exact if len is nonzero */
+   return (len != 0);
+}
@@ -0,0 +1,702 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mpoly.h"
+
+/*
+   Set polyq, polyr to the quotient and remainder of poly2 by poly3, whose
+   leading coefficient must be invertible, and return the length of the
+   quotient. This version of the function assumes the exponent vectors all
+   fit in a single word. The exponent vectors are assumed to have fields
+   with the given number of bits. Assumes input polys are nonzero.
+   Implements "Polynomial division using dynamic arrays, heaps and packed
+   exponents" by Michael Monagan and Roman Pearce [1], except that we use a heap with smallest exponent at head. Note that if a < b then
+   (n - b) < (n - b) where n is the maximum value a and b can take. The word
+   "maxn" is set to an exponent vector whose fields are all set to such a
+   value n. This allows division from left to right with a heap with smallest
+   exponent at the head. Quotient and remainder polys are written in reverse
+   order.
+   [1] http://www.cecm.sfu.ca/~rpearcea/sdmp/sdmp_paper.pdf
+*/
+slong _nmod_mpoly_divrem_monagan_pearce1(slong * lenr,
+   mp_limb_t ** polyq, ulong ** expq, slong * allocq, mp_limb_t ** polyr,
+  ulong ** expr, slong * allocr, const mp_limb_t * poly2, const ulong * exp2,
+            slong len2, const mp_limb_t * poly3, const ulong * exp3, slong len3,
+                                         slong bits, ulong maskhi, nmod_t mod)
+{
+   slong i, k, l, s;
+   slong next_free, Q_len = 0;
+   slong reuse_len = 0, heap_len = 2; /* heap zero index unused */
+   mpoly_heap1_s * heap;
+   mpoly_heap_t * chain;
+   mpoly_heap_t ** Q, ** reuse;
+   mpoly_heap_t * x, * x2;
+   mp_limb_t * p1 = *polyq;
+   mp_limb_t * p2 = *polyr;
+   ulong * e1 = *expq;
+   ulong * e2 = *expr;
+   ulong exp;
+   ulong c[3]; /* for accumulating coefficients */
+   ulong mask = 0, lc_inv, acc;
+   int d1, nlimbs;
+   TMP_INIT;
+
+   TMP_START;
+
+   /* at most len3 products contribute to each coefficient */
+   nlimbs = _nmod_vec_dot_bound_limbs(len3, mod);
+
+   heap = (mpoly_heap1_s *) TMP_ALLOC((len3 + 1)*sizeof(mpoly_heap1_s));
+   /* alloc array of heap nodes which can be chained together */
+   chain = (mpoly_heap_t *) TMP_ALLOC(len3*sizeof(mpoly_heap_t));
+   /* space for temporary storage of pointers to heap nodes */
+   Q = (mpoly_heap_t **) TMP_ALLOC(len3*sizeof(mpoly_heap_t *));
+   /* space for pointers to heap nodes which can be reused */
+   reuse = (mpoly_heap_t **) TMP_ALLOC(len3*sizeof(mpoly_heap_t *));
+
+   /* start with no heap nodes in use */
+   next_free = 0;
+
+   /* mask with high bit set in each field of exponent vector */
+   for (i = 0; i < FLINT_BITS/bits; i++)
+      mask = (mask << bits) + (UWORD(1) << (bits - 1));
+
+   /* quotient and remainder poly indices start at -1 */
+   k = -WORD(1);
+   l = -WORD(1);
+
+   /* see description of divisor heap division in paper */
+   s = len3;
+
+   x = chain + next_free++;
+   x->i = -WORD(1);
+   x->j = 0;
+   x->next = NULL;
+
+   /* insert (-1, 0, exp2[0]) into heap */
+   HEAP_ASSIGN(heap[1], exp2[0], x);
+
+   /* precompute the inverse of the leading coefficient of poly3 */
+   lc_inv = n_invmod(poly3[0], mod.n);
+
+   /* while heap is nonempty */
+   while (heap_len > 1)
+   {
+      /* get exponent field of heap top */
+      exp = heap[1].exp;
+
+      /* check there has been no overflow */
+      if ((exp & mask) != 0)
+      {
+         k = 0;
+         l = 0;
+
+         goto cleanup;
+      }
+
+      /* realloc quotient poly ready for next quotient term */
+      k++;
+      _nmod_mpoly_fit_length(&p1, &e1, allocq, k + 1, 1);
+
+      /* set temporary coeff to zero */
+      c[0] = c[1] = c[2] = 0;
+      acc = 0;
+
+      /* while heap nonempty and contains chain with current output exponent */
+      while (heap_len > 1 && heap[1].exp == exp)
+      {
+         /* pop chain from heap */
+         x = _mpoly_heap_pop1(heap, &heap_len, maskhi);
+
+         if (x->i == -WORD(1))
+         {
+            /* this is the poly2 coeff */
+            acc = poly2[x->j];
+         } else
+         {
+            /* accumulate q[j]*poly3 coeff */
+            _nmod_mpoly_addmul_acc(c, poly3[x->i], p1[x->j], nlimbs);
+         }
+
+         /* temporarily store pointer to this node, or designate for reuse */
+         if (x->i != -WORD(1) || x->j < len2 - 1)
+            Q[Q_len++] = x;
+         else
+            reuse[reuse_len++] = x;
+
+         /* for every node in this chain */
+         while ((x = x->next) != NULL)
+         {
+            if (x->i == -WORD(1))
+            {
+               /* this is the poly2 coeff */
+               acc = poly2[x->j];
+            } else
+            {
+               /* accumulate q[j]*poly3 coeff */
+               _nmod_mpoly_addmul_acc(c, poly3[x->i], p1[x->j], nlimbs);
+            }
+
+            /* temporarily store pointer to node, or designate for reuse */
+            if (x->i != -WORD(1) || x->j < len2 - 1)
+               Q[Q_len++] = x;
+            else
+               reuse[reuse_len++] = x;
+         }
+      }
+
+      /* for each node temporarily stored */
+      while (Q_len > 0)
+      {
+         /* take node from store */
+         x = Q[--Q_len];
+
+         if (x->i == -WORD(1))
+         {
+            x->j++;
+            x->next = NULL;
+
+            /* insert (x->i, x->j + 1, exp2[x->j]) in heap */
+            _mpoly_heap_insert1(heap, exp2[x->j], x, &heap_len, maskhi);
+         } else if (x->j < k - 1)
+         {
+            x->j++;
+            x->next = NULL;
+
+            /* insert (x->i, x->j + 1, exp3[x->i] + e1[x->j]) in heap */
+            _mpoly_heap_insert1(heap, exp3[x->i] + e1[x->j], x, &heap_len,
+                                                                       maskhi);
+         } else if (x->j == k - 1)
+         {
+            s++;
+
+            /* node x no longer needed, designate for reuse */
+            reuse[reuse_len++] = x;
+         }
+      }
+
+      /* coefficient is poly2 term minus the accumulated products */
+      acc = nmod_sub(acc, _nmod_mpoly_reduce_acc(c, nlimbs, mod), mod);
+
+      /* if coeff is zero, no output coeffs to be written */
+      if (acc == 0)
+         k--;
+      else
+      {
+         /* check current exp divisible by leading exp of poly3... */
+         d1 = mpoly_monomial_divides1(e1 + k, exp, exp3[0], mask);
+
+         /* ... if not, remainder term */
+         if (!d1)
+         {
+            /* reallocate remainder poly */
+            l++;
+            _nmod_mpoly_fit_length(&p2, &e2, allocr, l + 1, 1);
+
+            /* write out remainder coeff and exponent */
+            p2[l] = acc;
+            e2[l] = exp;
+
+            /* no quotient term in this case */
+            k--;
+         } else /* monomial exact division, so quotient term */
+         {
+            /* write out quotient coeff, nonzero since lc(poly3) is a unit */
+            p1[k] = nmod_mul(acc, lc_inv, mod);
+
+            /* see paper */
+            for (i = 1; i < s; i++)
+            {
+               /* get an empty node, from reuse array if possible */
+               if (reuse_len != 0)
+                  x2 = reuse[--reuse_len];
+               else
+                  x2 = chain + next_free++;
+
+               x2->i = i;
+               x2->j = k;
+               x2->next = NULL;
+
+               /* insert (i, k, exp3[i] + e1[k]) */
+               _mpoly_heap_insert1(heap, exp3[i] + e1[k], x2, &heap_len,
+                                                                       maskhi);
+            }
+            s = 1;
+         }
+      }
+   }
+
+   k++;
+   l++;
+
+cleanup:
+
+   (*polyq) = p1;
+   (*expq) = e1;
+   (*polyr) = p2;
+   (*expr) = e2;
+
+   /* set length of remainder poly */
+   (*lenr) = l;
+
+   TMP_END;
+
+   /* return length of quotient poly */
+   return k;
+}
+
+/*
+   Set polyq, polyr to the quotient and remainder of poly2 by poly3, whose
+   leading coefficient must be invertible, and return the length of the
+   quotient. This version of the function assumes the exponent vectors each
+   fit in "N" words. The exponent vectors are assumed to have fields with the given number of bits. Assumes input polys are
+   nonzero. Implements "Polynomial division using dynamic arrays, heaps and
+   packed exponents" by Michael Monagan and Roman Pearce [1], except that
+   we use a heap with smallest exponent at head. Note that if a < b then
+   (n - b) < (n - b) where n is the maximum value a and b can take. The word
+   "maxn" is set to an exponent vector whose fields are all set to such a
+   value n. This allows division from left to right with a heap with smallest
+   exponent at the head. Quotient and remainder polys are written in reverse
+   order.
+   [1] http://www.cecm.sfu.ca/~rpearcea/sdmp/sdmp_paper.pdf
+*/
+slong _nmod_mpoly_divrem_monagan_pearce(slong * lenr,
+  mp_limb_t ** polyq, ulong ** expq, slong * allocq, mp_limb_t ** polyr,
+                  ulong ** expr, slong * allocr, const mp_limb_t * poly2,
+   const ulong * exp2, slong len2, const mp_limb_t * poly3, const ulong * exp3,
+      slong len3, slong bits, slong N, ulong maskhi, ulong masklo, nmod_t mod)
+{
+   slong i, k, l, s;
+   slong next_free, Q_len = 0;
+   slong reuse_len = 0, heap_len = 2; /* heap zero index unused */
+   mpoly_heap_s * heap;
+   mpoly_heap_t * chain;
+   mpoly_heap_t ** Q, ** reuse;
+   mpoly_heap_t * x, * x2;
+   mp_limb_t * p1 = *polyq;
+   mp_limb_t * p2 = *polyr;
+   ulong * e1 = *expq;
+   ulong * e2 = *expr;
+   ulong * exp, * exps;
+   ulong ** exp_list;
+   ulong c[3]; /* for accumulating coefficients */
+   slong exp_next;
+   ulong mask = 0, lc_inv, acc;
+   int d1, nlimbs;
+   TMP_INIT;
+
+   /* if exponent vectors fit in one word, call specialised version */
+   if (N == 1)
+      return _nmod_mpoly_divrem_monagan_pearce1(lenr, polyq, expq, allocq,
+                         polyr, expr, allocr, poly2, exp2, len2,
+                                      poly3, exp3, len3, bits, maskhi, mod);
+
+   TMP_START;
+
+   /* at most len3 products contribute to each coefficient */
+   nlimbs = _nmod_vec_dot_bound_limbs(len3, mod);
+
+   heap = (mpoly_heap_s *) TMP_ALLOC((len3 + 1)*sizeof(mpoly_heap_s));
+   /* alloc array of heap nodes which can be chained together */
+   chain = (mpoly_heap_t *) TMP_ALLOC(len3*sizeof(mpoly_heap_t));
+   /* space for temporary storage of pointers to heap nodes */
+   Q = (mpoly_heap_t **) TMP_ALLOC(len3*sizeof(mpoly_heap_t *));
+   /* space for pointers to heap nodes which can be reused */
+   reuse = (mpoly_heap_t **) TMP_ALLOC(len3*sizeof(mpoly_heap_t *));
+   /* array of exponents of N words each */
+   exps = (ulong *) TMP_ALLOC(len3*N*sizeof(ulong));
+   /* array of pointers to unused exponent vectors */
+   exp_list = (ulong **) TMP_ALLOC(len3*sizeof(ulong *));
+   /* space to save copy of current exponent vector */
+   exp = (ulong *) TMP_ALLOC(N*sizeof(ulong));
+
+   /* set up list of available exponent vectors */
+   for (i = 0; i < len3; i++)
+      exp_list[i] = exps + i*N;
+
+   /* start with no heap nodes and no exponent vectors in use */
+   next_free = 0;
+   exp_next = 0;
+
+   /* mask with high bit set in each field of exponent vector */
+   for (i = 0; i < FLINT_BITS/bits; i++)
+      mask = (mask << bits) + (UWORD(1) << (bits - 1));
+
+   /* quotient and remainder poly indices start at -1 */
+   k = -WORD(1);
+   l = -WORD(1);
+
+   /* see description of divisor heap division in paper */
+   s = len3;
+
+   /* insert (-1, 0, exp2[0]) into heap */
+   x = chain + next_free++;
+   x->i = -WORD(1);
+   x->j = 0;
+   x->next = NULL;
+
+   heap[1].next = x;
+   heap[1].exp = exp_list[exp_next++];
+
+   mpoly_monomial_set(heap[1].exp, exp2, N);
+
+   /* precompute the inverse of the leading coefficient of poly3 */
+   lc_inv = n_invmod(poly3[0], mod.n);
+
+   /* while heap is nonempty */
+   while (heap_len > 1)
+   {
+      /* make temporary copy of exponent at top of heap */
+      mpoly_monomial_set(exp, heap[1].exp, N);
+
+      /* check there has been no overflow */
+      if (mpoly_monomial_overflows(exp, N, mask))
+      {
+         k = 0;
+         l = 0;
+
+         goto cleanup2;
+      }
+
+      /* realloc quotient poly, for next quotient term */
+      k++;
+      _nmod_mpoly_fit_length(&p1, &e1, allocq, k + 1, N);
+
+      /* set temporary coeff to zero */
+      c[0] = c[1] = c[2] = 0;
+      acc = 0;
+
+      /* while heap nonempty and contains chain with current output exponent */
+      while (heap_len > 1 && mpoly_monomial_equal(heap[1].exp, exp, N))
+      {
+         /* put pointer to exponent at heap top into list of available exps */
+         exp_list[--exp_next] = heap[1].exp;
+
+         /* pop chain from heap */
+         x = _mpoly_heap_pop(heap, &heap_len, N, maskhi, masklo);
+
+         if (x->i == -WORD(1))
+         {
+            /* this is the poly2 coeff */
+            acc = poly2[x->j];
+         } else
+         {
+            /* accumulate q[j]*poly3 coeff */
+            _nmod_mpoly_addmul_acc(c, poly3[x->i], p1[x->j], nlimbs);
+         }
+
+         /* temporarily store pointer to this node, or designate for reuse */
+         if (x->i != -WORD(1) || x->j < len2 - 1)
+            Q[Q_len++] = x;
+         else
+            reuse[reuse_len++] = x;
+
+         /* for every node in this chain */
+         while ((x = x->next) != NULL)
+         {
+            if (x->i == -WORD(1))
+            {
+               /* this is the poly2 coeff */
+               acc = poly2[x->j];
+            } else
+            {
+               /* accumulate q[j]*poly3 coeff */
+               _nmod_mpoly_addmul_acc(c, poly3[x->i], p1[x->j], nlimbs);
+            }
+
+            /* temporarily store pointer to node, or designate for reuse */
+            if (x->i != -WORD(1) || x->j < len2 - 1)
+               Q[Q_len++] = x;
+            else
+               reuse[reuse_len++] = x;
+         }
+      }
+
+      /* for each node temporarily stored */
+      while (Q_len > 0)
+      {
+         /* take node from store */
+         x = Q[--Q_len];
+
+         if (x->i == -WORD(1))
+         {
+            x->j++;
+            x->next = NULL;
+
+            mpoly_monomial_set(exp_list[exp_next], exp2 + x->j*N, N);
+
+            /* insert (x->i, x->j + 1, exp2[x->j]) in heap */
+            if (!_mpoly_heap_insert(heap, exp_list[exp_next++], x, &heap_len,
+                                                            N, maskhi, masklo))
+               exp_next--;
+         } else if (x->j < k - 1)
+         {
+            x->j++;
+            x->next = NULL;
+
+            mpoly_monomial_add(exp_list[exp_next], exp3 + x->i*N,
+                                                             e1 + x->j*N, N);
+
+            /* insert (x->i, x->j + 1, exp3[x->i] + e1[x->j]) in heap */
+            if (!_mpoly_heap_insert(heap, exp_list[exp_next++], x, &heap_len,
+                                                            N, maskhi, masklo))
+               exp_next--;
+         } else if (x->j == k - 1)
+         {
+            s++;
+
+            /* node x no longer needed, designate for reuse */
+            reuse[reuse_len++] = x;
+         }
+      }
+
+      /* coefficient is poly2 term minus the accumulated products */
+      acc = nmod_sub(acc, _nmod_mpoly_reduce_acc(c, nlimbs, mod), mod);
+
+      /* if coeff is zero, no output coeffs to be written */
+      if (acc == 0)
+         k--;
+      else
+      {
+         /* check current exp divisible by leading exp of poly3... */
+         d1 = mpoly_monomial_divides(e1 + k*N, exp, exp3, N, mask);
+
+         /* ... if not, remainder term */
+         if (!d1)
+         {
+            /* reallocate remainder poly */
+            l++;
+            _nmod_mpoly_fit_length(&p2, &e2, allocr, l + 1, N);
+
+            /* write out remainder coeff and exponent */
+            p2[l] = acc;
+            mpoly_monomial_set(e2 + l*N, exp, N);
+
+            /* no quotient term in this case */
+            k--;
+         } else /* monomial exact division, so quotient term */
+         {
+            /* write out quotient coeff, nonzero since lc(poly3) is a unit */
+            p1[k] = nmod_mul(acc, lc_inv, mod);
+
+            /* see paper */
+            for (i = 1; i < s; i++)
+            {
+               /* get an empty node, from reuse array if possible */
+               if (reuse_len != 0)
+                  x2 = reuse[--reuse_len];
+               else
+                  x2 = chain + next_free++;
+
+               x2->i = i;
+               x2->j = k;
+               x2->next = NULL;
+
+               mpoly_monomial_add(exp_list[exp_next], exp3 + i*N,
+                                                                e1 + k*N, N);
+
+               /* insert (i, k, exp3[i] + e1[k]) */
+               if (!_mpoly_heap_insert(heap, exp_list[exp_next++], x2,
+                                                 &heap_len, N, maskhi, masklo))
+                  exp_next--;
+            }
+            s = 1;
+         }
+      }
+   }
+
+   k++;
+   l++;
+
+cleanup2:
+
+   (*polyq) = p1;
+   (*expq) = e1;
+   (*polyr) = p2;
+   (*expr) = e2;
+
+   /* set remainder poly length */
+   (*lenr) = l;
+
+   TMP_END;
+
+   /* return quotient poly length */
+   return k;
+}
+
+void nmod_mpoly_divrem_monagan_pearce(nmod_mpoly_t q, nmod_mpoly_t r,
+                  const nmod_mpoly_t poly2, const nmod_mpoly_t poly3,
+                                                    const nmod_mpoly_ctx_t ctx)
+{
+   slong exp_bits, N, lenq = 0, lenr = 0;
+   ulong * exp2 = poly2->exps, * exp3 = poly3->exps;
+   ulong maskhi, masklo;
+   int free2 = 0, free3 = 0;
+   nmod_mpoly_t temp1, temp2;
+   nmod_mpoly_struct * tq, * tr;
+
+   /* check divisor is nonzero */
+   if (poly3->length == 0)
+      flint_throw(FLINT_DIVZERO,
+                   "Divide by zero in nmod_mpoly_divrem_monagan_pearce");
+
+   /* dividend zero, write out quotient and remainder */
+   if (poly2->length == 0)
+   {
+      nmod_mpoly_zero(q, ctx);
+      nmod_mpoly_zero(r, ctx);
+
+      return;
+   }
+
+   /* compute maximum degree appearing in inputs */
+
+   /* maximum bits in quotient and remainder exps is max for poly2 and poly3 */
+   exp_bits = FLINT_MAX(poly2->bits, poly3->bits);
+
+   masks_from_bits_ord(maskhi, masklo, exp_bits, ctx->ord);
+   /* number of words required for exponent vectors */
+   N = words_per_exp(ctx->n, exp_bits);
+
+   /* ensure input exponents packed to same size as output exponents */
+   if (exp_bits > poly2->bits)
+   {
+      free2 = 1;
+      exp2 = (ulong *) flint_malloc(N*poly2->length*sizeof(ulong));
+      mpoly_unpack_monomials(exp2, exp_bits, poly2->exps, poly2->bits,
+                                                        poly2->length, ctx->n);
+   }
+
+   if (exp_bits > poly3->bits)
+   {
+      free3 = 1;
+      exp3 = (ulong *) flint_malloc(N*poly3->length*sizeof(ulong));
+      mpoly_unpack_monomials(exp3, exp_bits, poly3->exps, poly3->bits,
+                                                        poly3->length, ctx->n);
+   }
+
+   /* check divisor leading monomial is at most that of the dividend */
+   if (mpoly_monomial_lt(exp3, exp2, N, maskhi, masklo))
+   {
+      nmod_mpoly_set(r, poly2, ctx);
+      nmod_mpoly_zero(q, ctx);
+
+      goto cleanup3;
+   }
+
+   /* take care of aliasing */
+   if (q == poly2 || q == poly3)
+   {
+      nmod_mpoly_init2(temp1, FLINT_MAX(poly2->length/poly3->length + 1, 1),
+                                                                          ctx);
+      nmod_mpoly_fit_bits(temp1, exp_bits, ctx);
+      temp1->bits = exp_bits;
+
+      tq = temp1;
+   } else
+   {
+      nmod_mpoly_fit_length(q, FLINT_MAX(poly2->length/poly3->length + 1, 1),
+                                                                          ctx);
+      nmod_mpoly_fit_bits(q, exp_bits, ctx);
+      q->bits = exp_bits;
+
+      tq = q;
+   }
+
+   if (r == poly2 || r == poly3)
+   {
+      nmod_mpoly_init2(temp2, poly3->length, ctx);
+      nmod_mpoly_fit_bits(temp2, exp_bits, ctx);
+      temp2->bits = exp_bits;
+
+      tr = temp2;
+   } else
+   {
+      nmod_mpoly_fit_length(r, poly3->length, ctx);
+      nmod_mpoly_fit_bits(r, exp_bits, ctx);
+      r->bits = exp_bits;
+
+      tr = r;
+   }
+
+   /* do division with remainder */
+   while ((lenq = _nmod_mpoly_divrem_monagan_pearce(&lenr, &tq->coeffs,
+         &tq->exps, &tq->alloc, &tr->coeffs, &tr->exps, &tr->alloc,
+         poly2->coeffs, exp2, poly2->length, poly3->coeffs, exp3,
+               poly3->length, exp_bits, N, maskhi, masklo, ctx->mod)) == 0
+         && lenr == 0 && exp_bits < FLINT_BITS)
+   {
+      ulong * old_exp2 = exp2, * old_exp3 = exp3;
+      slong old_exp_bits = exp_bits;
+
+      exp_bits = mpoly_optimize_bits(exp_bits + 1, ctx->n);
+
+      masks_from_bits_ord(maskhi, masklo, exp_bits, ctx->ord);
+      N = words_per_exp(ctx->n, exp_bits);
+
+      exp2 = (ulong *) flint_malloc(N*poly2->length*sizeof(ulong));
+      mpoly_unpack_monomials(exp2, exp_bits, old_exp2, old_exp_bits,
+                                                        poly2->length, ctx->n);
+
+      exp3 = (ulong *) flint_malloc(N*poly3->length*sizeof(ulong));
+      mpoly_unpack_monomials(exp3, exp_bits, old_exp3, old_exp_bits,
+                                                        poly3->length, ctx->n);
+
+      if (free2)
+         flint_free(old_exp2);
+
+      if (free3)
+         flint_free(old_exp3);
+
+      free2 = free3 = 1;
+
+      nmod_mpoly_fit_bits(tq, exp_bits, ctx);
+      tq->bits = exp_bits;
+
+      nmod_mpoly_fit_bits(tr, exp_bits, ctx);
+      tr->bits = exp_bits;
+   }
+
+   if (lenq == 0 && lenr == 0)
+      flint_throw(FLINT_EXPOF,
+                      "Exponent overflow in nmod_mpoly_divrem_monagan_pearce");
+
+   /* deal with aliasing */
+   if (q == poly2 || q == poly3)
+   {
+      nmod_mpoly_swap(temp1, q, ctx);
+
+      nmod_mpoly_clear(temp1, ctx);
+   }
+
+   if (r == poly2 || r == poly3)
+   {
+      nmod_mpoly_swap(temp2, r, ctx);
+
+      nmod_mpoly_clear(temp2, ctx);
+   }
+
+   _nmod_mpoly_set_length(q, lenq, ctx);
+   _nmod_mpoly_set_length(r, lenr, ctx);
+
+cleanup3:
+
+   if (free2)
+      flint_free(exp2);
+
+   if (free3)
+      flint_free(exp3);
+}
@@ -0,0 +1,65 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "nmod_mpoly.h"
+
+int nmod_mpoly_equal(const nmod_mpoly_t poly1, const nmod_mpoly_t poly2,
+                                                    const nmod_mpoly_ctx_t ctx)
+{
+   ulong * ptr1 = poly1->exps, * ptr2 = poly2->exps;
+   slong i, max_bits, N;
+   int r = 1, free1 = 0, free2 = 0;
+
+   if (poly1 == poly2)
+      return 1;
+
+   if (poly1->length != poly2->length)
+      return 0;
+
+   for (i = 0; i < poly1->length; i++)
+   {
+      if (poly1->coeffs[i] != poly2->coeffs[i])
+         return 0;
+   }
+
+   max_bits = FLINT_MAX(poly1->bits, poly2->bits);
+   N = words_per_exp(ctx->n, max_bits);
+
+   if (max_bits > poly1->bits)
+   {
+      free1 = 1;
+      ptr1 = (ulong *) flint_malloc(N*poly1->length*sizeof(ulong));
+      mpoly_unpack_monomials(ptr1, max_bits, poly1->exps, poly1->bits,
+                                                        poly1->length, ctx->n);
+   }
+
+   if (max_bits > poly2->bits)
+   {
+      free2 = 1;
+      ptr2 = (ulong *) flint_malloc(N*poly2->length*sizeof(ulong));
+      mpoly_unpack_monomials(ptr2, max_bits, poly2->exps, poly2->bits,
+                                                        poly2->length, ctx->n);
+   }
+
+   for (i = 0; r && i < N*poly1->length; i++)
+      r = (ptr1[i] == ptr2[i]);
+
+   if (free1)
+      flint_free(ptr1);
+
+   if (free2)
+      flint_free(ptr2);
+
+   return r;
+}
@@ -0,0 +1,775 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "nmod_poly.h"
+#include "nmod_mpoly.h"
+#include "thread_pool.h"
+
+/*
+   Working representation: terms with unpacked exponent vectors of nvars
+   words each, sorted in descending lex order. At level k only the variables
+   x_0, ..., x_k occur, and the polynomial is viewed as a polynomial in
+   x_0, ..., x_{k-1} with coefficients in Z/pZ[x_k]; the coefficient of a
+   monomial is the run of adjacent terms which agree in their first k
+   exponents.
+*/
+typedef struct
+{
+    mp_limb_t * coeffs;
+    ulong * exps;
+    slong length;
+    slong alloc;
+}
+_brown_poly_struct;
+
+typedef _brown_poly_struct _brown_poly_t[1];
+
+typedef struct
+{
+    slong nvars;
+    nmod_t mod;
+    const nmod_mpoly_ctx_struct * lexctx;
+}
+_brown_info_t;
+
+static void _brown_poly_init(_brown_poly_t P)
+{
+    P->coeffs = NULL;
+    P->exps = NULL;
+    P->length = 0;
+    P->alloc = 0;
+}
+
+static void _brown_poly_clear(_brown_poly_t P)
+{
+    if (P->alloc != 0)
+    {
+        flint_free(P->coeffs);
+        flint_free(P->exps);
+    }
+}
+
+static void _brown_poly_swap(_brown_poly_t P, _brown_poly_t Q)
+{
+    _brown_poly_struct t = *P;
+    *P = *Q;
+    *Q = t;
+}
+
+static void _brown_poly_fit_length(_brown_poly_t P, slong len, slong nvars)
+{
+    if (len > P->alloc)
+    {
+        len = FLINT_MAX(len, 2*P->alloc);
+
+        if (P->alloc == 0)
+        {
+            P->coeffs = (mp_limb_t *) flint_malloc(len*sizeof(mp_limb_t));
+            P->exps = (ulong *) flint_malloc(len*nvars*sizeof(ulong));
+        } else
+        {
+            P->coeffs = (mp_limb_t *) flint_realloc(P->coeffs,
+                                                       len*sizeof(mp_limb_t));
+            P->exps = (ulong *) flint_realloc(P->exps,
+                                                     len*nvars*sizeof(ulong));
+        }
+
+        P->alloc = len;
+    }
+}
+
+/*
+   append the term c*x_0^e_0...x_{k-1}^e_{k-1}*x_k^ek, taking e from exp,
+   or e = 0 if exp is NULL
+*/
+static void _brown_poly_append(_brown_poly_t P, mp_limb_t c,
+                       const ulong * exp, slong k, ulong ek, slong nvars)
+{
+    slong i;
+    ulong * e;
+
+    _brown_poly_fit_length(P, P->length + 1, nvars);
+
+    e = P->exps + nvars*P->length;
+    for (i = 0; i < nvars; i++)
+    {
+        if (i < k)
+            e[i] = (exp == NULL) ? 0 : exp[i];
+        else
+            e[i] = (i == k) ? ek : 0;
+    }
+
+    P->coeffs[P->length] = c;
+    P->length++;
+}
+
+/* append the terms of c(x_k) times the monomial in x_0, ..., x_{k-1} */
+static void _brown_poly_append_poly(_brown_poly_t P, const nmod_poly_t c,
+                                     const ulong * exp, slong k, slong nvars)
+{
+    slong i;
+
+    for (i = nmod_poly_length(c) - 1; i >= 0; i--)
+    {
+        if (c->coeffs[i] != 0)
+            _brown_poly_append(P, c->coeffs[i], exp, k, i, nvars);
+    }
+}
+
+/* index one past the run of terms agreeing with term i in x_0, ..., x_{k-1} */
+static slong _brown_poly_group_end(const _brown_poly_t P, slong i,
+                                                        slong k, slong nvars)
+{
+    slong j;
+
+    for (j = i + 1; j < P->length; j++)
+    {
+        if (!mpoly_monomial_equal(P->exps + nvars*i, P->exps + nvars*j, k))
+            break;
+    }
+
+    return j;
+}
+
+static void _brown_poly_get_group(nmod_poly_t c, const _brown_poly_t P,
+                               slong i, slong iend, slong k, slong nvars)
+{
+    nmod_poly_zero(c);
+
+    for ( ; i < iend; i++)
+        nmod_poly_set_coeff_ui(c, P->exps[nvars*i + k], P->coeffs[i]);
+}
+
+static ulong _brown_poly_degree(const _brown_poly_t P, slong k, slong nvars)
+{
+    slong i;
+    ulong d = 0;
+
+    for (i = 0; i < P->length; i++)
+        d = FLINT_MAX(d, P->exps[nvars*i + k]);
+
+    return d;
+}
+
+/* whether P is an element of Z/pZ[x_k] */
+static int _brown_poly_is_const(const _brown_poly_t P, slong k, slong nvars)
+{
+    slong i;
+
+    for (i = 0; i < k; i++)
+    {
+        if (P->exps[i] != 0)
+            return 0;
+    }
+
+    return 1;
+}
+
+static void _brown_poly_scalar_mul(_brown_poly_t P, mp_limb_t c, nmod_t mod)
+{
+    _nmod_vec_scalar_mul_nmod(P->coeffs, P->coeffs, P->length, c, mod);
+}
+
+static void _brown_poly_make_monic(_brown_poly_t P, nmod_t mod)
+{
+    if (P->length != 0 && P->coeffs[0] != 1)
+        _brown_poly_scalar_mul(P, n_invmod(P->coeffs[0], mod.n), mod);
+}
+
+/* monic gcd in Z/pZ[x_k] of the coefficients of P */
+static void _brown_poly_content(nmod_poly_t c, const _brown_poly_t P,
+                                                        slong k, slong nvars)
+{
+    slong i, iend;
+    nmod_poly_t t;
+
+    nmod_poly_init_preinv(t, c->mod.n, c->mod.ninv);
+    nmod_poly_zero(c);
+
+    for (i = 0; i < P->length && nmod_poly_degree(c) != 0; i = iend)
+    {
+        iend = _brown_poly_group_end(P, i, k, nvars);
+        _brown_poly_get_group(t, P, i, iend, k, nvars);
+        nmod_poly_gcd(c, c, t);
+    }
+
+    nmod_poly_clear(t);
+}
+
+/* Q = P/c or P*c coefficientwise for c in Z/pZ[x_k] */
+static void _brown_poly_mul_div_poly(_brown_poly_t Q, const _brown_poly_t P,
+                               const nmod_poly_t c, int div, slong k, slong nvars)
+{
+    slong i, iend;
+    nmod_poly_t t;
+
+    nmod_poly_init_preinv(t, c->mod.n, c->mod.ninv);
+    Q->length = 0;
+
+    for (i = 0; i < P->length; i = iend)
+    {
+        iend = _brown_poly_group_end(P, i, k, nvars);
+        _brown_poly_get_group(t, P, i, iend, k, nvars);
+        if (div)
+            nmod_poly_div(t, t, c);
+        else
+            nmod_poly_mul(t, t, c);
+        _brown_poly_append_poly(Q, t, P->exps + nvars*i, k, nvars);
+    }
+
+    nmod_poly_clear(t);
+}
+
+/* Q = P(x_k = alpha), which is at level k - 1 */
+static void _brown_poly_evaluate(_brown_poly_t Q, const _brown_poly_t P,
+                                     slong k, mp_limb_t alpha, _brown_info_t * info)
+{
+    slong i, iend, nvars = info->nvars;
+    mp_limb_t v;
+    nmod_poly_t t;
+
+    nmod_poly_init_preinv(t, info->mod.n, info->mod.ninv);
+    Q->length = 0;
+
+    for (i = 0; i < P->length; i = iend)
+    {
+        iend = _brown_poly_group_end(P, i, k, nvars);
+        _brown_poly_get_group(t, P, i, iend, k, nvars);
+        v = nmod_poly_evaluate_nmod(t, alpha);
+        if (v != 0)
+            _brown_poly_append(Q, v, P->exps + nvars*i, k, 0, nvars);
+    }
+
+    nmod_poly_clear(t);
+}
+
+/*
+   Newton interpolation step: H = H + (g - H(alpha))*M/M(alpha) where g is
+   at level k - 1 and H is at level k.
+*/
+static void _brown_poly_interpolate(_brown_poly_t H, const _brown_poly_t g,
+          slong k, mp_limb_t alpha, const nmod_poly_t M, _brown_info_t * info)
+{
+    slong i, j, iend, nvars = info->nvars;
+    mp_limb_t Minv, v;
+    int cmp;
+    const ulong * exp;
+    nmod_poly_t t;
+    _brown_poly_t T;
+
+    nmod_poly_init_preinv(t, info->mod.n, info->mod.ninv);
+    _brown_poly_init(T);
+
+    Minv = n_invmod(nmod_poly_evaluate_nmod(M, alpha), info->mod.n);
+
+    i = j = 0;
+    while (i < H->length || j < g->length)
+    {
+        if (i >= H->length)
+            cmp = -1;
+        else if (j >= g->length)
+            cmp = 1;
+        else
+            cmp = mpoly_monomial_cmp(H->exps + nvars*i, g->exps + nvars*j,
+                                                                     k, 0, 0);
+
+        if (cmp >= 0)
+        {
+            exp = H->exps + nvars*i;
+            iend = _brown_poly_group_end(H, i, k, nvars);
+            _brown_poly_get_group(t, H, i, iend, k, nvars);
+            i = iend;
+        } else
+        {
+            exp = g->exps + nvars*j;
+            nmod_poly_zero(t);
+        }
+
+        v = nmod_neg(nmod_poly_evaluate_nmod(t, alpha), info->mod);
+        if (cmp <= 0)
+            v = nmod_add(v, g->coeffs[j++], info->mod);
+
+        v = nmod_mul(v, Minv, info->mod);
+        if (v != 0)
+        {
+            nmod_poly_t s;
+            nmod_poly_init_preinv(s, info->mod.n, info->mod.ninv);
+            nmod_poly_scalar_mul_nmod(s, M, v);
+            nmod_poly_add(t, t, s);
+            nmod_poly_clear(s);
+        }
+
+        _brown_poly_append_poly(T, t, exp, k, nvars);
+    }
+
+    _brown_poly_swap(H, T);
+
+    _brown_poly_clear(T);
+    nmod_poly_clear(t);
+}
+
+/* pack a lex sorted working polynomial into an nmod_mpoly in lex order */
+static void _brown_poly_get_nmod_mpoly(nmod_mpoly_t A, const _brown_poly_t P,
+                                   const nmod_mpoly_ctx_t ctx, slong nvars)
+{
+    slong i, N, bits;
+    ulong max = 0;
+
+    for (i = 0; i < nvars*P->length; i++)
+        max = FLINT_MAX(max, P->exps[i]);
+
+    bits = 8;
+    while (FLINT_BIT_COUNT(max) >= bits) /* extra bit required for signs */
+        bits++;
+    bits = mpoly_optimize_bits(bits, ctx->n);
+
+    nmod_mpoly_fit_length(A, P->length, ctx);
+    nmod_mpoly_fit_bits(A, bits, ctx);
+    A->bits = bits;
+    N = words_per_exp(ctx->n, bits);
+
+    for (i = 0; i < P->length; i++)
+    {
+        A->coeffs[i] = P->coeffs[i];
+        mpoly_set_monomial(A->exps + N*i, P->exps + nvars*i, bits,
+                                                               ctx->n, 0, 0);
+    }
+
+    _nmod_mpoly_set_length(A, P->length, ctx);
+}
+
+/* sort perm so that the monomials exps + N*perm[i] are decreasing */
+static void _brown_sort(slong * perm, slong * tmp, const ulong * exps,
+                           slong len, slong N, ulong maskhi, ulong masklo)
+{
+    slong i, j, k, mid;
+
+    if (len < 2)
+        return;
+
+    mid = len/2;
+    _brown_sort(perm, tmp, exps, mid, N, maskhi, masklo);
+    _brown_sort(perm + mid, tmp, exps, len - mid, N, maskhi, masklo);
+
+    for (i = 0, j = mid, k = 0; i < mid || j < len; k++)
+    {
+        if (j >= len || (i < mid && mpoly_monomial_cmp(exps + N*perm[i],
+                                 exps + N*perm[j], N, maskhi, masklo) >= 0))
+            tmp[k] = perm[i++];
+        else
+            tmp[k] = perm[j++];
+    }
+
+    for (k = 0; k < len; k++)
+        perm[k] = tmp[k];
+}
+
+static void _brown_poly_set_nmod_mpoly(_brown_poly_t P, const nmod_mpoly_t A,
+                                    const nmod_mpoly_ctx_t ctx, slong nvars)
+{
+    slong i, N, * perm, * tmp;
+    ulong * exps;
+    int deg, rev;
+
+    degrev_from_ord(deg, rev, ctx->ord);
+    N = words_per_exp(ctx->n, A->bits);
+
+    exps = (ulong *) flint_malloc(FLINT_MAX(nvars, 1)*A->length*sizeof(ulong));
+    perm = (slong *) flint_malloc(2*A->length*sizeof(slong));
+    tmp = perm + A->length;
+
+    for (i = 0; i < A->length; i++)
+    {
+        mpoly_get_monomial(exps + nvars*i, A->exps + N*i, A->bits,
+                                                          ctx->n, deg, rev);
+        perm[i] = i;
+    }
+
+    /* unpacked exponent vectors compare lexicographically without masks */
+    _brown_sort(perm, tmp, exps, A->length, nvars, 0, 0);
+
+    _brown_poly_fit_length(P, A->length, nvars);
+    for (i = 0; i < A->length; i++)
+    {
+        P->coeffs[i] = A->coeffs[perm[i]];
+        mpoly_monomial_set(P->exps + nvars*i, exps + nvars*perm[i], nvars);
+    }
+    P->length = A->length;
+
+    flint_free(perm);
+    flint_free(exps);
+}
+
+/* pack P into A with the given number of bits, sorted in the order of ctx */
+static void _nmod_mpoly_set_brown_poly(nmod_mpoly_t A, slong bits,
+              const _brown_poly_t P, const nmod_mpoly_ctx_t ctx, slong nvars)
+{
+    slong i, N, * perm, * tmp;
+    ulong * exps, maskhi, masklo;
+    int deg, rev;
+
+    degrev_from_ord(deg, rev, ctx->ord);
+    masks_from_bits_ord(maskhi, masklo, bits, ctx->ord);
+    N = words_per_exp(ctx->n, bits);
+
+    exps = (ulong *) flint_malloc(N*P->length*sizeof(ulong));
+    perm = (slong *) flint_malloc(2*P->length*sizeof(slong));
+    tmp = perm + P->length;
+
+    for (i = 0; i < P->length; i++)
+    {
+        mpoly_set_monomial(exps + N*i, P->exps + nvars*i, bits,
+                                                           ctx->n, deg, rev);
+        perm[i] = i;
+    }
+
+    _brown_sort(perm, tmp, exps, P->length, N, maskhi, masklo);
+
+    nmod_mpoly_fit_length(A, P->length, ctx);
+    nmod_mpoly_fit_bits(A, bits, ctx);
+    A->bits = bits;
+
+    for (i = 0; i < P->length; i++)
+    {
+        A->coeffs[i] = P->coeffs[perm[i]];
+        mpoly_monomial_set(A->exps + N*i, exps + N*perm[i], N);
+    }
+    _nmod_mpoly_set_length(A, P->length, ctx);
+
+    flint_free(perm);
+    flint_free(exps);
+}
+
+static int _brown_poly_divides(const _brown_poly_t A, const _brown_poly_t G,
+                                                       _brown_info_t * info)
+{
+    int res;
+    nmod_mpoly_t a, g, q;
+
+    nmod_mpoly_init(a, info->lexctx);
+    nmod_mpoly_init(g, info->lexctx);
+    nmod_mpoly_init(q, info->lexctx);
+
+    _brown_poly_get_nmod_mpoly(a, A, info->lexctx, info->nvars);
+    _brown_poly_get_nmod_mpoly(g, G, info->lexctx, info->nvars);
+    res = nmod_mpoly_divides_monagan_pearce(q, a, g, info->lexctx);
+
+    nmod_mpoly_clear(a, info->lexctx);
+    nmod_mpoly_clear(g, info->lexctx);
+    nmod_mpoly_clear(q, info->lexctx);
+
+    return res;
+}
+
+static int _brown_gcd(_brown_poly_t G, const _brown_poly_t A,
+   const _brown_poly_t B, slong k, _brown_info_t * info, slong num_threads);
+
+typedef struct
+{
+    const _brown_poly_struct * A;
+    const _brown_poly_struct * B;
+    _brown_poly_t g;
+    slong k;
+    mp_limb_t alpha;
+    _brown_info_t * info;
+    int success;
+}
+_brown_image_arg_t;
+
+/* gcd of the images at x_k = alpha */
+static void _brown_image_worker(void * arg_ptr)
+{
+    _brown_image_arg_t * arg = (_brown_image_arg_t *) arg_ptr;
+    _brown_poly_t Ae, Be;
+
+    _brown_poly_init(Ae);
+    _brown_poly_init(Be);
+
+    _brown_poly_evaluate(Ae, arg->A, arg->k, arg->alpha, arg->info);
+    _brown_poly_evaluate(Be, arg->B, arg->k, arg->alpha, arg->info);
+
+    arg->success = _brown_gcd(arg->g, Ae, Be, arg->k - 1, arg->info, 1);
+
+    _brown_poly_clear(Ae);
+    _brown_poly_clear(Be);
+}
+
+/*
+   Monic (in lex order) gcd of nonzero A and B at level k, following
+   algorithm PGCD of Geddes, Czapor and Labahn. The images at the points
+   x_k = alpha are computed num_threads at a time. Returns 0 if Z/pZ has
+   too few points.
+*/
+static int _brown_gcd(_brown_poly_t G, const _brown_poly_t A,
+    const _brown_poly_t B, slong k, _brown_info_t * info, slong num_threads)
+{
+    slong i, j, count, bound, nvars = info->nvars;
+    mp_limb_t alpha, gam;
+    int success = 0, cmp;
+    nmod_poly_t a, b, c, gamma, M, t;
+    _brown_poly_t Ap, Bp, H;
+    _brown_image_arg_t * args;
+
+    if (k < 0) /* nonzero constants */
+    {
+        G->length = 0;
+        _brown_poly_append(G, 1, NULL, 0, 0, nvars);
+        return 1;
+    }
+
+    nmod_poly_init_preinv(a, info->mod.n, info->mod.ninv);
+    nmod_poly_init_preinv(b, info->mod.n, info->mod.ninv);
+
+    if (k == 0) /* univariate */
+    {
+        _brown_poly_get_group(a, A, 0, A->length, 0, nvars);
+        _brown_poly_get_group(b, B, 0, B->length, 0, nvars);
+        nmod_poly_gcd(a, a, b);
+        G->length = 0;
+        _brown_poly_append_poly(G, a, NULL, 0, nvars);
+
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        return 1;
+    }
+
+    if (_brown_poly_degree(A, k, nvars) == 0 &&
+        _brown_poly_degree(B, k, nvars) == 0)
+    {
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        return _brown_gcd(G, A, B, k - 1, info, num_threads);
+    }
+
+    nmod_poly_init_preinv(c, info->mod.n, info->mod.ninv);
+    nmod_poly_init_preinv(gamma, info->mod.n, info->mod.ninv);
+    nmod_poly_init_preinv(M, info->mod.n, info->mod.ninv);
+    nmod_poly_init_preinv(t, info->mod.n, info->mod.ninv);
+    _brown_poly_init(Ap);
+    _brown_poly_init(Bp);
+    _brown_poly_init(H);
+
+    /* remove contents in Z/pZ[x_k] */
+    _brown_poly_content(a, A, k, nvars);
+    _brown_poly_content(b, B, k, nvars);
+    nmod_poly_gcd(c, a, b);
+    _brown_poly_mul_div_poly(Ap, A, a, 1, k, nvars);
+    _brown_poly_mul_div_poly(Bp, B, b, 1, k, nvars);
+
+    if (_brown_poly_is_const(Ap, k, nvars) ||
+        _brown_poly_is_const(Bp, k, nvars))
+    {
+        G->length = 0;
+        _brown_poly_append_poly(G, c, NULL, k, nvars);
+        success = 1;
+        goto cleanup;
+    }
+
+    /* gcd of leading coefficients */
+    _brown_poly_get_group(a, Ap, 0, _brown_poly_group_end(Ap, 0, k, nvars),
+                                                                   k, nvars);
+    _brown_poly_get_group(b, Bp, 0, _brown_poly_group_end(Bp, 0, k, nvars),
+                                                                   k, nvars);
+    nmod_poly_gcd(gamma, a, b);
+
+    bound = nmod_poly_degree(gamma) + FLINT_MIN(
+                _brown_poly_degree(Ap, k, nvars), _brown_poly_degree(Bp, k, nvars));
+
+    num_threads = FLINT_MAX(num_threads, 1);
+    args = (_brown_image_arg_t *) flint_malloc(
+                                      num_threads*sizeof(_brown_image_arg_t));
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].A = Ap;
+        args[i].B = Bp;
+        args[i].k = k;
+        args[i].info = info;
+        _brown_poly_init(args[i].g);
+    }
+
+    count = 0;
+    alpha = info->mod.n;
+
+    while (1)
+    {
+        /* choose the next batch of points, avoiding the roots of gamma */
+        for (i = 0; i < num_threads && alpha > 0; )
+        {
+            alpha--;
+            if (nmod_poly_evaluate_nmod(gamma, alpha) != 0)
+                args[i++].alpha = alpha;
+        }
+
+        if (i == 0) /* out of points */
+            break;
+
+        if (i == 1)
+            _brown_image_worker(args);
+        else
+            flint_parallel_do(_brown_image_worker, args, i,
+                                            sizeof(_brown_image_arg_t), i);
+
+        for (j = 0; j < i; j++)
+        {
+            _brown_poly_struct * g = args[j].g;
+
+            if (!args[j].success)
+                goto done;
+
+            /* gcd of the primitive parts is 1 */
+            if (_brown_poly_is_const(g, k, nvars))
+            {
+                G->length = 0;
+                _brown_poly_append_poly(G, c, NULL, k, nvars);
+                success = 1;
+                goto done;
+            }
+
+            if (count > 0)
+            {
+                cmp = mpoly_monomial_cmp(g->exps, H->exps, k, 0, 0);
+                if (cmp > 0) /* unlucky point */
+                    continue;
+                if (cmp < 0) /* all previous points were unlucky */
+                    count = 0;
+            }
+
+            gam = nmod_poly_evaluate_nmod(gamma, args[j].alpha);
+            _brown_poly_scalar_mul(g, gam, info->mod);
+
+            if (count == 0)
+            {
+                _brown_poly_swap(H, g);
+                nmod_poly_one(M);
+            } else
+                _brown_poly_interpolate(H, g, k, args[j].alpha, M, info);
+
+            /* M = M*(x - alpha) */
+            nmod_poly_zero(t);
+            nmod_poly_set_coeff_ui(t, 1, 1);
+            nmod_poly_set_coeff_ui(t, 0, nmod_neg(args[j].alpha, info->mod));
+            nmod_poly_mul(M, M, t);
+            count++;
+
+            if (count > bound)
+            {
+                _brown_poly_t T;
+
+                _brown_poly_init(T);
+                _brown_poly_content(t, H, k, nvars);
+                _brown_poly_mul_div_poly(T, H, t, 1, k, nvars);
+
+                if (_brown_poly_divides(Ap, T, info) &&
+                    _brown_poly_divides(Bp, T, info))
+                {
+                    _brown_poly_mul_div_poly(G, T, c, 0, k, nvars);
+                    _brown_poly_make_monic(G, info->mod);
+                    success = 1;
+                }
+
+                _brown_poly_clear(T);
+
+                if (success)
+                    goto done;
+            }
+        }
+    }
+
+done:
+
+    for (i = 0; i < num_threads; i++)
+        _brown_poly_clear(args[i].g);
+    flint_free(args);
+
+cleanup:
+
+    nmod_poly_clear(a);
+    nmod_poly_clear(b);
+    nmod_poly_clear(c);
+    nmod_poly_clear(gamma);
+    nmod_poly_clear(M);
+    nmod_poly_clear(t);
+    _brown_poly_clear(Ap);
+    _brown_poly_clear(Bp);
+    _brown_poly_clear(H);
+
+    return success;
+}
+
+int _nmod_mpoly_gcd_brown(nmod_mpoly_t G, const nmod_mpoly_t A,
+      const nmod_mpoly_t B, const nmod_mpoly_ctx_t ctx, slong num_threads)
+{
+    slong nvars;
+    int success, deg, rev;
+    nmod_mpoly_ctx_t lexctx;
+    _brown_poly_t Af, Bf, Gf;
+    _brown_info_t info[1];
+
+    if (A->length == 0 || B->length == 0)
+    {
+        if (A->length == 0)
+            nmod_mpoly_set(G, B, ctx);
+        else
+            nmod_mpoly_set(G, A, ctx);
+
+        if (G->length != 0)
+            nmod_mpoly_scalar_mul_ui(G, G,
+                                   n_invmod(G->coeffs[0], ctx->mod.n), ctx);
+        return 1;
+    }
+
+    degrev_from_ord(deg, rev, ctx->ord);
+    nvars = ctx->n - deg;
+
+    nmod_mpoly_ctx_init(lexctx, nvars, ORD_LEX, ctx->mod.n);
+    info->nvars = nvars;
+    info->mod = ctx->mod;
+    info->lexctx = lexctx;
+
+    _brown_poly_init(Af);
+    _brown_poly_init(Bf);
+    _brown_poly_init(Gf);
+
+    _brown_poly_set_nmod_mpoly(Af, A, ctx, nvars);
+    _brown_poly_set_nmod_mpoly(Bf, B, ctx, nvars);
+
+    success = _brown_gcd(Gf, Af, Bf, nvars - 1, info, num_threads);
+
+    if (success)
+    {
+        /* a divisor of A and B fits in the exponent fields of either */
+        _nmod_mpoly_set_brown_poly(G, FLINT_MIN(A->bits, B->bits),
+                                                           Gf, ctx, nvars);
+        nmod_mpoly_scalar_mul_ui(G, G,
+                                   n_invmod(G->coeffs[0], ctx->mod.n), ctx);
+    }
+
+    _brown_poly_clear(Af);
+    _brown_poly_clear(Bf);
+    _brown_poly_clear(Gf);
+    nmod_mpoly_ctx_clear(lexctx);
+
+    return success;
+}
+
+int nmod_mpoly_gcd_brown(nmod_mpoly_t G, const nmod_mpoly_t A,
+                        const nmod_mpoly_t B, const nmod_mpoly_ctx_t ctx)
+{
+    slong num_threads = flint_get_num_threads();
+
+    if (FLINT_MIN(A->length, B->length) < NMOD_MPOLY_GCD_THREAD_CUTOFF)
+        num_threads = 1;
+
+    return _nmod_mpoly_gcd_brown(G, A, B, ctx, num_threads);
+}
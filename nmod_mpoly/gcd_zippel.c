@@ -0,0 +1,470 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "nmod_poly.h"
+#include "nmod_mpoly.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+    const mp_limb_t * Acoeffs;
+    const mp_limb_t * Avals;
+    const ulong * Aexps;
+    slong Alen;
+    ulong Adeg;
+    const mp_limb_t * Bcoeffs;
+    const mp_limb_t * Bvals;
+    const ulong * Bexps;
+    slong Blen;
+    ulong Bdeg;
+    ulong D;
+    mp_limb_t lcval;
+    slong j0;
+    slong j1;
+    slong T;
+    mp_ptr Y;
+    nmod_t mod;
+    int success;
+}
+_zippel_image_arg_t;
+
+/*
+   For j0 <= j < j1, the gcd of the univariate images of A and B at the
+   point beta^j, scaled so that it is the image of the gcd whose leading
+   coefficient in the main variable is the monomial with value lcval at beta.
+   Coefficient d of the j-th image is written to Y[d*T + j].
+*/
+static void _zippel_image_worker(void * arg_ptr)
+{
+    _zippel_image_arg_t * arg = (_zippel_image_arg_t *) arg_ptr;
+    slong i, j;
+    ulong d;
+    mp_limb_t scale;
+    mp_ptr wA, wB;
+    nmod_poly_t a, b;
+    nmod_t mod = arg->mod;
+
+    nmod_poly_init_preinv(a, mod.n, mod.ninv);
+    nmod_poly_init_preinv(b, mod.n, mod.ninv);
+    wA = _nmod_vec_init(arg->Alen);
+    wB = _nmod_vec_init(arg->Blen);
+
+    /* values of the terms at beta^j0, other than the main variable */
+    for (i = 0; i < arg->Alen; i++)
+        wA[i] = n_powmod2_preinv(arg->Avals[i], arg->j0, mod.n, mod.ninv);
+    for (i = 0; i < arg->Blen; i++)
+        wB[i] = n_powmod2_preinv(arg->Bvals[i], arg->j0, mod.n, mod.ninv);
+    scale = n_powmod2_preinv(arg->lcval, arg->j0, mod.n, mod.ninv);
+
+    arg->success = 1;
+
+    for (j = arg->j0; j < arg->j1; j++)
+    {
+        nmod_poly_zero(a);
+        for (i = 0; i < arg->Alen; i++)
+        {
+            nmod_poly_set_coeff_ui(a, arg->Aexps[i], nmod_add(
+                nmod_poly_get_coeff_ui(a, arg->Aexps[i]),
+                nmod_mul(arg->Acoeffs[i], wA[i], mod), mod));
+            wA[i] = nmod_mul(wA[i], arg->Avals[i], mod);
+        }
+
+        nmod_poly_zero(b);
+        for (i = 0; i < arg->Blen; i++)
+        {
+            nmod_poly_set_coeff_ui(b, arg->Bexps[i], nmod_add(
+                nmod_poly_get_coeff_ui(b, arg->Bexps[i]),
+                nmod_mul(arg->Bcoeffs[i], wB[i], mod), mod));
+            wB[i] = nmod_mul(wB[i], arg->Bvals[i], mod);
+        }
+
+        /* a leading coefficient vanishes at this point */
+        if (nmod_poly_degree(a) != (slong) arg->Adeg ||
+            nmod_poly_degree(b) != (slong) arg->Bdeg)
+        {
+            arg->success = 0;
+            break;
+        }
+
+        nmod_poly_gcd(a, a, b);
+
+        if (nmod_poly_degree(a) != (slong) arg->D)
+        {
+            arg->success = 0;
+            break;
+        }
+
+        for (d = 0; d <= arg->D; d++)
+            arg->Y[d*arg->T + j] = nmod_mul(a->coeffs[d], scale, mod);
+
+        scale = nmod_mul(scale, arg->lcval, mod);
+    }
+
+    _nmod_vec_clear(wA);
+    _nmod_vec_clear(wB);
+    nmod_poly_clear(a);
+    nmod_poly_clear(b);
+}
+
+/*
+   Solve the transposed Vandermonde system sum_l c[l]*v[l]^j = y[j] for
+   0 <= j < t, where the v[l] are distinct.
+*/
+static void _zippel_solve_vandermonde(mp_ptr c, mp_srcptr v, mp_srcptr y,
+                                                          slong t, nmod_t mod)
+{
+    slong i, l;
+    mp_limb_t num, den;
+    mp_ptr P, q;
+
+    P = _nmod_vec_init(t + 1);
+    q = _nmod_vec_init(t);
+
+    /* P = prod_l (z - v[l]) */
+    P[0] = 1;
+    for (l = 0; l < t; l++)
+    {
+        P[l + 1] = P[l];
+        for (i = l; i > 0; i--)
+            P[i] = nmod_sub(P[i - 1], nmod_mul(v[l], P[i], mod), mod);
+        P[0] = nmod_neg(nmod_mul(v[l], P[0], mod), mod);
+    }
+
+    for (l = 0; l < t; l++)
+    {
+        /* q = P/(z - v[l]) */
+        q[t - 1] = P[t];
+        for (i = t - 1; i > 0; i--)
+            q[i - 1] = nmod_add(P[i], nmod_mul(v[l], q[i], mod), mod);
+
+        num = 0;
+        den = 0;
+        for (i = t - 1; i >= 0; i--)
+        {
+            num = nmod_add(num, nmod_mul(q[i], y[i], mod), mod);
+            den = nmod_add(nmod_mul(den, v[l], mod), q[i], mod);
+        }
+
+        c[l] = nmod_mul(num, n_invmod(den, mod.n), mod);
+    }
+
+    _nmod_vec_clear(P);
+    _nmod_vec_clear(q);
+}
+
+static int _zippel_ulong_cmp(const void * a, const void * b)
+{
+    ulong x = *(const ulong *) a, y = *(const ulong *) b;
+    return (x > y) - (x < y);
+}
+
+/*
+   Values at beta of the monomials in the variables other than v, given the
+   unpacked exponent vectors.
+*/
+static void _zippel_monomial_values(mp_ptr vals, const ulong * exps,
+            slong len, slong nvars, slong v, mp_srcptr beta, nmod_t mod)
+{
+    slong i, k;
+
+    for (i = 0; i < len; i++)
+    {
+        vals[i] = 1;
+        for (k = 0; k < nvars; k++)
+        {
+            if (k != v && exps[nvars*i + k] != 0)
+                vals[i] = nmod_mul(vals[i], n_powmod2_preinv(beta[k],
+                                exps[nvars*i + k], mod.n, mod.ninv), mod);
+        }
+    }
+}
+
+static void _zippel_unpack(ulong * exps, const nmod_mpoly_t A,
+                                                   const nmod_mpoly_ctx_t ctx)
+{
+    slong i, nvars, N = words_per_exp(ctx->n, A->bits);
+    int deg, rev;
+
+    degrev_from_ord(deg, rev, ctx->ord);
+    nvars = ctx->n - deg;
+
+    for (i = 0; i < A->length; i++)
+        mpoly_get_monomial(exps + nvars*i, A->exps + N*i, A->bits,
+                                                           ctx->n, deg, rev);
+}
+
+int _nmod_mpoly_gcd_zippel(nmod_mpoly_t G, const nmod_mpoly_t A,
+                 const nmod_mpoly_t B, const nmod_mpoly_t Gform,
+       const nmod_mpoly_ctx_t ctx, flint_rand_t state, slong num_threads)
+{
+    slong i, j, k, l, v, nvars, T, Slen = Gform->length, N, tries;
+    ulong D, degA, degB, e;
+    int deg, rev, success = 0;
+    ulong * Sexps, * Aexps, * Bexps, * Av, * Bv;
+    slong * start, * order;
+    mp_ptr beta, Svals, Avals, Bvals, Y, c, vals, sorted;
+    mp_limb_t * Gcoeffs;
+    nmod_mpoly_t Q, R;
+    _zippel_image_arg_t * args;
+    nmod_t mod = ctx->mod;
+
+    if (A->length == 0 || B->length == 0 || Slen == 0)
+        return 0;
+
+    degrev_from_ord(deg, rev, ctx->ord);
+    nvars = ctx->n - deg;
+
+    Sexps = (ulong *) flint_malloc(nvars*(Slen + A->length + B->length)
+                                                              *sizeof(ulong));
+    Aexps = Sexps + nvars*Slen;
+    Bexps = Aexps + nvars*A->length;
+    _zippel_unpack(Sexps, Gform, ctx);
+    _zippel_unpack(Aexps, A, ctx);
+    _zippel_unpack(Bexps, B, ctx);
+
+    /* main variable: one in which the leading coefficient is a monomial */
+    D = 0;
+    for (v = 0; v < nvars; v++)
+    {
+        D = 0;
+        j = 0;
+        for (i = 0; i < Slen; i++)
+        {
+            e = Sexps[nvars*i + v];
+            if (e > D)
+            {
+                D = e;
+                j = 0;
+            }
+            j += (e == D);
+        }
+
+        if (j == 1)
+            break;
+    }
+
+    if (v >= nvars)
+    {
+        flint_free(Sexps);
+        return 0;
+    }
+
+    degA = degB = 0;
+    for (i = 0; i < A->length; i++)
+        degA = FLINT_MAX(degA, Aexps[nvars*i + v]);
+    for (i = 0; i < B->length; i++)
+        degB = FLINT_MAX(degB, Bexps[nvars*i + v]);
+
+    if (degA < D || degB < D)
+    {
+        flint_free(Sexps);
+        return 0;
+    }
+
+    /* group the monomials of the form by their degree in the main variable */
+    start = (slong *) flint_calloc(D + 2, sizeof(slong));
+    order = (slong *) flint_malloc(Slen*sizeof(slong));
+    for (i = 0; i < Slen; i++)
+        start[Sexps[nvars*i + v] + 1]++;
+    T = 0;
+    for (e = 0; e <= D; e++)
+    {
+        T = FLINT_MAX(T, start[e + 1]);
+        start[e + 1] += start[e];
+    }
+    for (i = 0; i < Slen; i++)
+        order[start[Sexps[nvars*i + v]]++] = i;
+    for (e = D + 1; e > 0; e--)
+        start[e] = start[e - 1];
+    start[0] = 0;
+
+    beta = _nmod_vec_init(nvars);
+    Svals = _nmod_vec_init(Slen + A->length + B->length);
+    Avals = Svals + Slen;
+    Bvals = Avals + A->length;
+    vals = _nmod_vec_init(2*T);
+    sorted = vals + T;
+    c = _nmod_vec_init(T);
+    Y = _nmod_vec_init((D + 1)*T);
+    Av = (ulong *) flint_malloc((A->length + B->length)*sizeof(ulong));
+    Bv = Av + A->length;
+    Gcoeffs = (mp_limb_t *) flint_malloc(Slen*sizeof(mp_limb_t));
+
+    for (i = 0; i < A->length; i++)
+        Av[i] = Aexps[nvars*i + v];
+    for (i = 0; i < B->length; i++)
+        Bv[i] = Bexps[nvars*i + v];
+
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads, T));
+    args = (_zippel_image_arg_t *) flint_malloc(
+                                     num_threads*sizeof(_zippel_image_arg_t));
+
+    /*
+       choose a point at which the monomials of each degree in the main
+       variable have distinct values
+    */
+    for (tries = 0; tries < 4 && !success; tries++)
+    {
+        for (k = 0; k < nvars; k++)
+            beta[k] = (mod.n == 1) ? 0 : 1 + n_randint(state, mod.n - 1);
+
+        _zippel_monomial_values(Svals, Sexps, Slen, nvars, v, beta, mod);
+
+        success = 1;
+        for (e = 0; e <= D && success; e++)
+        {
+            slong t = start[e + 1] - start[e];
+
+            for (l = 0; l < t; l++)
+                sorted[l] = Svals[order[start[e] + l]];
+            qsort(sorted, t, sizeof(mp_limb_t), _zippel_ulong_cmp);
+            for (l = 1; l < t; l++)
+                success = success && (sorted[l] != sorted[l - 1]);
+        }
+    }
+
+    if (!success)
+        goto cleanup;
+
+    _zippel_monomial_values(Avals, Aexps, A->length, nvars, v, beta, mod);
+    _zippel_monomial_values(Bvals, Bexps, B->length, nvars, v, beta, mod);
+
+    /* images at the points beta^j for 0 <= j < T */
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].Acoeffs = A->coeffs;
+        args[i].Avals = Avals;
+        args[i].Aexps = Av;
+        args[i].Alen = A->length;
+        args[i].Adeg = degA;
+        args[i].Bcoeffs = B->coeffs;
+        args[i].Bvals = Bvals;
+        args[i].Bexps = Bv;
+        args[i].Blen = B->length;
+        args[i].Bdeg = degB;
+        args[i].D = D;
+        args[i].lcval = Svals[order[start[D]]];
+        args[i].j0 = (T*i)/num_threads;
+        args[i].j1 = (T*(i + 1))/num_threads;
+        args[i].T = T;
+        args[i].Y = Y;
+        args[i].mod = mod;
+    }
+
+    if (num_threads == 1)
+        _zippel_image_worker(args);
+    else
+        flint_parallel_do(_zippel_image_worker, args, num_threads,
+                                 sizeof(_zippel_image_arg_t), num_threads);
+
+    for (i = 0; i < num_threads; i++)
+        success = success && args[i].success;
+
+    /* solve for the coefficients of each degree in the main variable */
+    for (e = 0; e <= D && success; e++)
+    {
+        slong t = start[e + 1] - start[e];
+        mp_srcptr y = Y + e*T;
+
+        for (l = 0; l < t; l++)
+            vals[l] = Svals[order[start[e] + l]];
+
+        _zippel_solve_vandermonde(c, vals, y, t, mod);
+
+        for (l = 0; l < t; l++)
+            Gcoeffs[order[start[e] + l]] = c[l];
+
+        /* the remaining images must agree with the solution */
+        for (l = 0; l < t; l++)
+            sorted[l] = n_powmod2_preinv(vals[l], t, mod.n, mod.ninv);
+
+        for (j = t; j < T && success; j++)
+        {
+            mp_limb_t s = 0;
+
+            for (l = 0; l < t; l++)
+            {
+                s = nmod_add(s, nmod_mul(c[l], sorted[l], mod), mod);
+                sorted[l] = nmod_mul(sorted[l], vals[l], mod);
+            }
+
+            success = (s == y[j]);
+        }
+    }
+
+    if (!success)
+        goto cleanup;
+
+    /* assemble the candidate gcd, in the order of the form */
+    N = words_per_exp(ctx->n, Gform->bits);
+    nmod_mpoly_init2(R, Slen, ctx);
+    nmod_mpoly_fit_bits(R, Gform->bits, ctx);
+    R->bits = Gform->bits;
+    k = 0;
+    for (i = 0; i < Slen; i++)
+    {
+        if (Gcoeffs[i] != 0)
+        {
+            R->coeffs[k] = Gcoeffs[i];
+            mpoly_monomial_set(R->exps + N*k, Gform->exps + N*i, N);
+            k++;
+        }
+    }
+    _nmod_mpoly_set_length(R, k, ctx);
+
+    success = (k != 0);
+
+    if (success)
+    {
+        nmod_mpoly_scalar_mul_ui(R, R, n_invmod(R->coeffs[0], mod.n), ctx);
+
+        nmod_mpoly_init(Q, ctx);
+        success = nmod_mpoly_divides_monagan_pearce(Q, A, R, ctx) &&
+                  nmod_mpoly_divides_monagan_pearce(Q, B, R, ctx);
+        nmod_mpoly_clear(Q, ctx);
+
+        if (success)
+            nmod_mpoly_swap(G, R, ctx);
+    }
+
+    nmod_mpoly_clear(R, ctx);
+
+cleanup:
+
+    flint_free(args);
+    flint_free(Gcoeffs);
+    flint_free(Av);
+    _nmod_vec_clear(Y);
+    _nmod_vec_clear(c);
+    _nmod_vec_clear(vals);
+    _nmod_vec_clear(Svals);
+    _nmod_vec_clear(beta);
+    flint_free(order);
+    flint_free(start);
+    flint_free(Sexps);
+
+    return success;
+}
+
+int nmod_mpoly_gcd_zippel(nmod_mpoly_t G, const nmod_mpoly_t A,
+                 const nmod_mpoly_t B, const nmod_mpoly_t Gform,
+                           const nmod_mpoly_ctx_t ctx, flint_rand_t state)
+{
+    slong num_threads = flint_get_num_threads();
+
+    if (FLINT_MIN(A->length, B->length) < NMOD_MPOLY_GCD_THREAD_CUTOFF)
+        num_threads = 1;
+
+    return _nmod_mpoly_gcd_zippel(G, A, B, Gform, ctx, state, num_threads);
+}
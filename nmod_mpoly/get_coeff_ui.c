@@ -0,0 +1,22 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "nmod_mpoly.h"
+
+ulong
+nmod_mpoly_get_coeff_ui(const nmod_mpoly_t poly,
+                                           slong n, const nmod_mpoly_ctx_t ctx)
+{
+    return (n < poly->length) ? poly->coeffs[n] : UWORD(0);
+}
@@ -0,0 +1,505 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+
+#include <gmp.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mpoly.h"
+
+/*
+   Set poly1 to poly2*poly3 using Johnson's heap method. The function
+   reallocates its output and returns the length of the product. This
+   version of the function assumes the exponent vectors all fit in a
+   single word. Assumes input polys are nonzero.
+*/
+slong _nmod_mpoly_mul_johnson1(mp_limb_t ** poly1, ulong ** exp1, slong * alloc,
+              const mp_limb_t * poly2, const ulong * exp2, slong len2,
+              const mp_limb_t * poly3, const ulong * exp3, slong len3,
+                                                      ulong maskhi, nmod_t mod)
+{
+   slong i, j, k;
+   slong Q_len = 0, heap_len = 2; /* heap zero index unused */
+   mpoly_heap1_s * heap;
+   mpoly_heap_t * chain;
+   slong * Q;
+   mpoly_heap_t * x;
+   mp_limb_t * p1 = *poly1;
+   ulong * e1 = *exp1;
+   slong * hind;
+   ulong exp;
+   ulong c[3]; /* for accumulating coefficients */
+   int first, nlimbs;
+   TMP_INIT;
+
+   TMP_START;
+
+   /* number of words needed to accumulate a coefficient without reduction */
+   nlimbs = _nmod_vec_dot_bound_limbs(FLINT_MIN(len2, len3), mod);
+
+   heap = (mpoly_heap1_s *) TMP_ALLOC((len2 + 1)*sizeof(mpoly_heap1_s));
+   /* alloc array of heap nodes which can be chained together */
+   chain = (mpoly_heap_t *) TMP_ALLOC(len2*sizeof(mpoly_heap_t));
+   /* space for temporary storage of pointers to heap nodes */
+   Q = (slong *) TMP_ALLOC(2*len2*sizeof(slong));
+
+    /* space for heap indices */
+    hind = (slong *) TMP_ALLOC(len2*sizeof(slong));
+    for (i = 0; i < len2; i++)
+        hind[i] = 1;
+
+   /* put (0, 0, exp2[0] + exp3[0]) on heap */
+   x = chain + 0;
+   x->i = 0;
+   x->j = 0;
+   x->next = NULL;
+
+   HEAP_ASSIGN(heap[1], exp2[0] + exp3[0], x);
+   hind[0] = 2*1 + 0;
+
+   /* output poly index starts at -1, will be immediately updated to 0 */
+   k = -WORD(1);
+
+   /* while heap is nonempty */
+   while (heap_len > 1)
+   {
+      /* get exponent field of heap top */
+      exp = heap[1].exp;
+
+      /* realloc output poly ready for next product term */
+      k++;
+      _nmod_mpoly_fit_length(&p1, &e1, alloc, k + 1, 1);
+
+      /* whether we are on first coeff product for this output exponent */
+      first = 1;
+
+      /* set temporary coeff to zero */
+      c[0] = c[1] = c[2] = 0;
+
+      /* while heap nonempty and contains chain with current output exponent */
+      while (heap_len > 1 && heap[1].exp == exp)
+      {
+         /* pop chain from heap */
+         x = _mpoly_heap_pop1(heap, &heap_len, maskhi);
+
+         /* take node out of heap and put into store */
+         hind[x->i] |= WORD(1);
+         Q[Q_len++] = x->i;
+         Q[Q_len++] = x->j;
+
+         if (first)
+         {
+            /* set output monomial */
+            e1[k] = exp;
+
+            first = 0;
+         }
+
+         /* addmul product of input poly coeffs */
+         _nmod_mpoly_addmul_acc(c, poly2[x->i], poly3[x->j], nlimbs);
+
+         /* for every node in this chain */
+         while ((x = x->next) != NULL)
+         {
+            /* addmul product of input poly coeffs */
+            _nmod_mpoly_addmul_acc(c, poly2[x->i], poly3[x->j], nlimbs);
+
+            /* take node out of heap and put into store */
+            hind[x->i] |= WORD(1);
+            Q[Q_len++] = x->i;
+            Q[Q_len++] = x->j;
+         }
+      }
+
+      /* for each node temporarily stored */
+      while (Q_len > 0)
+      {
+         /* take node from store */
+         j = Q[--Q_len];
+         i = Q[--Q_len];
+
+         /* should we go right? */
+         if (  (i + 1 < len2)
+            && (hind[i + 1] == 2*j + 1)
+            )
+         {
+            x = chain + i + 1;
+            x->i = i + 1;
+            x->j = j;
+            x->next = NULL;
+
+            hind[x->i] = 2*(x->j+1) + 0;
+            _mpoly_heap_insert1(heap, exp2[x->i] + exp3[x->j], x, &heap_len,
+                                                                       maskhi);
+         }
+
+         /* should we go up? */
+         if (  (j + 1 < len3)
+            && ((hind[i] & 1) == 1)
+            && (  (i == 0)
+               || (hind[i - 1] >  2*(j + 2) + 1)
+               || (hind[i - 1] == 2*(j + 2) + 1) /* gcc should fuse */
+               )
+            )
+         {
+            x = chain + i;
+            x->i = i;
+            x->j = j + 1;
+            x->next = NULL;
+
+            hind[x->i] = 2*(x->j+1) + 0;
+            _mpoly_heap_insert1(heap, exp2[x->i] + exp3[x->j], x, &heap_len,
+                                                                       maskhi);
+         }
+      }
+
+      /* reduce the accumulated coefficient once */
+      p1[k] = _nmod_mpoly_reduce_acc(c, nlimbs, mod);
+
+      if (p1[k] == 0)
+         k--;
+   }
+
+   k++;
+
+   (*poly1) = p1;
+   (*exp1) = e1;
+
+   TMP_END;
+
+   return k;
+}
+
+/*
+   Set poly1 to poly2*poly3 using Johnson's heap method. The function
+   reallocates its output and returns the length of the product. This
+   version of the function assumes the exponent vectors take N words.
+*/
+slong _nmod_mpoly_mul_johnson(mp_limb_t ** poly1, ulong ** exp1, slong * alloc,
+                 const mp_limb_t * poly2, const ulong * exp2, slong len2,
+                 const mp_limb_t * poly3, const ulong * exp3, slong len3,
+                              slong N, ulong maskhi, ulong masklo, nmod_t mod)
+{
+   slong i, j, k;
+   slong Q_len = 0, heap_len = 2; /* heap zero index unused */
+   mpoly_heap_s * heap;
+   mpoly_heap_t * chain;
+   slong * Q;
+   mpoly_heap_t * x;
+   mp_limb_t * p1 = *poly1;
+   ulong * e1 = *exp1;
+   ulong c[3]; /* for accumulating coefficients */
+   ulong * exp, * exps;
+   ulong ** exp_list;
+   slong exp_next;
+   slong * hind;
+   int first, nlimbs;
+   TMP_INIT;
+
+   /* if exponent vectors fit in single word, call special version */
+   if (N == 1)
+      return _nmod_mpoly_mul_johnson1(poly1, exp1, alloc,
+                             poly2, exp2, len2, poly3, exp3, len3, maskhi, mod);
+
+   TMP_START;
+
+   /* number of words needed to accumulate a coefficient without reduction */
+   nlimbs = _nmod_vec_dot_bound_limbs(FLINT_MIN(len2, len3), mod);
+
+   heap = (mpoly_heap_s *) TMP_ALLOC((len2 + 1)*sizeof(mpoly_heap_s));
+   /* alloc array of heap nodes which can be chained together */
+   chain = (mpoly_heap_t *) TMP_ALLOC(len2*sizeof(mpoly_heap_t));
+   /* space for temporary storage of pointers to heap nodes */
+   Q = (slong *) TMP_ALLOC(2*len2*sizeof(slong));
+   /* allocate space for exponent vectors of N words */
+   exps = (ulong *) TMP_ALLOC(len2*N*sizeof(ulong));
+   /* list of pointers to allocated exponent vectors */
+   exp_list = (ulong **) TMP_ALLOC(len2*sizeof(ulong *));
+   for (i = 0; i < len2; i++)
+      exp_list[i] = exps + i*N;
+
+   /* space for heap indices */
+   hind = (slong *) TMP_ALLOC(len2*sizeof(slong));
+   for (i = 0; i < len2; i++)
+       hind[i] = 1;
+
+   /* start with no heap nodes and no exponent vectors in use */
+   exp_next = 0;
+
+   /* put (0, 0, exp2[0] + exp3[0]) on heap */
+   x = chain + 0;
+   x->i = 0;
+   x->j = 0;
+   x->next = NULL;
+
+   heap[1].next = x;
+   heap[1].exp = exp_list[exp_next++];
+
+   mpoly_monomial_add(heap[1].exp, exp2, exp3, N);
+
+    hind[0] = 2*1 + 0;
+
+   /* output poly index starts at -1, will be immediately updated to 0 */
+   k = -WORD(1);
+
+   /* while heap is nonempty */
+   while (heap_len > 1)
+   {
+      /* get pointer to exponent field of heap top */
+      exp = heap[1].exp;
+
+      /* realloc output poly ready for next product term */
+      k++;
+      _nmod_mpoly_fit_length(&p1, &e1, alloc, k + 1, N);
+
+      /* whether we are on first coeff product for this output exponent */
+      first = 1;
+
+      /* set temporary coeff to zero */
+      c[0] = c[1] = c[2] = 0;
+
+      /* while heap nonempty and contains chain with current output exponent */
+      while (heap_len > 1 && mpoly_monomial_equal(heap[1].exp, exp, N))
+      {
+         /* pop chain from heap and set exponent field to be reused */
+         exp_list[--exp_next] = heap[1].exp;
+
+         x = _mpoly_heap_pop(heap, &heap_len, N, maskhi, masklo);
+
+         /* take node out of heap and put into store */
+         hind[x->i] |= WORD(1);
+         Q[Q_len++] = x->i;
+         Q[Q_len++] = x->j;
+
+         if (first)
+         {
+            /* set output monomial */
+            mpoly_monomial_set(e1 + k*N, exp, N);
+
+            first = 0;
+         }
+
+         /* addmul product of input poly coeffs */
+         _nmod_mpoly_addmul_acc(c, poly2[x->i], poly3[x->j], nlimbs);
+
+         /* for every node in this chain */
+         while ((x = x->next) != NULL)
+         {
+            /* addmul product of input poly coeffs */
+            _nmod_mpoly_addmul_acc(c, poly2[x->i], poly3[x->j], nlimbs);
+
+            /* take node out of heap and put into store */
+            hind[x->i] |= WORD(1);
+            Q[Q_len++] = x->i;
+            Q[Q_len++] = x->j;
+         }
+      }
+
+      /* for each node temporarily stored */
+      while (Q_len > 0)
+      {
+         /* take node from store */
+         j = Q[--Q_len];
+         i = Q[--Q_len];
+
+         /* should we go right? */
+         if (  (i + 1 < len2)
+            && (hind[i + 1] == 2*j + 1)
+            )
+         {
+            x = chain + i + 1;
+            x->i = i + 1;
+            x->j = j;
+            x->next = NULL;
+
+            hind[x->i] = 2*(x->j+1) + 0;
+            mpoly_monomial_add(exp_list[exp_next], exp2 + x->i*N,
+                                                   exp3 + x->j*N, N);
+            if (!_mpoly_heap_insert(heap, exp_list[exp_next++], x,
+                                                 &heap_len, N, maskhi, masklo))
+               exp_next--;
+         }
+
+         /* should we go up? */
+         if (  (j + 1 < len3)
+            && ((hind[i] & 1) == 1)
+            && (  (i == 0)
+               || (hind[i - 1] >  2*(j + 2) + 1)
+               || (hind[i - 1] == 2*(j + 2) + 1) /* gcc should fuse */
+               )
+            )
+         {
+            x = chain + i;
+            x->i = i;
+            x->j = j + 1;
+            x->next = NULL;
+
+            hind[x->i] = 2*(x->j+1) + 0;
+            mpoly_monomial_add(exp_list[exp_next], exp2 + x->i*N,
+                                                   exp3 + x->j*N, N);
+            if (!_mpoly_heap_insert(heap, exp_list[exp_next++], x,
+                                                 &heap_len, N, maskhi, masklo))
+               exp_next--;
+         }
+      }
+
+      /* reduce the accumulated coefficient once */
+      p1[k] = _nmod_mpoly_reduce_acc(c, nlimbs, mod);
+
+      if (p1[k] == 0)
+         k--;
+   }
+
+   k++;
+
+   (*poly1) = p1;
+   (*exp1) = e1;
+
+   TMP_END;
+
+   return k;
+}
+
+void nmod_mpoly_mul_johnson(nmod_mpoly_t poly1, const nmod_mpoly_t poly2,
+                          const nmod_mpoly_t poly3, const nmod_mpoly_ctx_t ctx)
+{
+   slong i, bits, exp_bits, N, len = 0;
+   ulong * max_degs2;
+   ulong * max_degs3;
+   ulong maskhi, masklo;
+   ulong max;
+   ulong * exp2 = poly2->exps, * exp3 = poly3->exps;
+   int free2 = 0, free3 = 0;
+
+   TMP_INIT;
+
+   /* one of the input polynomials is zero */
+   if (poly2->length == 0 || poly3->length == 0)
+   {
+      nmod_mpoly_zero(poly1, ctx);
+
+      return;
+   }
+
+   TMP_START;
+
+   /* compute maximum degree of any variable */
+   max_degs2 = (ulong *) TMP_ALLOC(ctx->n*sizeof(ulong));
+   max_degs3 = (ulong *) TMP_ALLOC(ctx->n*sizeof(ulong));
+
+   mpoly_max_degrees(max_degs2, poly2->exps, poly2->length,
+                                                         poly2->bits, ctx->n);
+   mpoly_max_degrees(max_degs3, poly3->exps, poly3->length,
+                                                         poly3->bits, ctx->n);
+
+   max = 0;
+
+   for (i = 0; i < ctx->n; i++)
+   {
+      max_degs3[i] += max_degs2[i];
+      /*check exponents won't overflow */
+      if (max_degs3[i] < max_degs2[i] || 0 > (slong) max_degs3[i])
+         flint_throw(FLINT_EXPOF,
+                             "Exponent overflow in nmod_mpoly_mul_johnson");
+
+      if (max_degs3[i] > max)
+         max = max_degs3[i];
+   }
+
+   /* compute number of bits to store maximum degree */
+   bits = FLINT_BIT_COUNT(max);
+   if (bits >= FLINT_BITS)
+      flint_throw(FLINT_EXPOF, "Exponent overflow in nmod_mpoly_mul_johnson");
+
+   exp_bits = 8;
+   while (bits >= exp_bits) /* extra bit required for signs */
+       exp_bits += 1;
+
+   exp_bits = FLINT_MAX(exp_bits, poly2->bits);
+   exp_bits = FLINT_MAX(exp_bits, poly3->bits);
+   exp_bits = mpoly_optimize_bits(exp_bits, ctx->n);
+
+   masks_from_bits_ord(maskhi, masklo, exp_bits, ctx->ord);
+   N = words_per_exp(ctx->n, exp_bits);
+
+   /* ensure input exponents are packed into same sized fields as output */
+   if (exp_bits > poly2->bits)
+   {
+      free2 = 1;
+      exp2 = (ulong *) flint_malloc(N*poly2->length*sizeof(ulong));
+      mpoly_unpack_monomials(exp2, exp_bits, poly2->exps, poly2->bits,
+                                                        poly2->length, ctx->n);
+   }
+
+   if (exp_bits > poly3->bits)
+   {
+      free3 = 1;
+      exp3 = (ulong *) flint_malloc(N*poly3->length*sizeof(ulong));
+      mpoly_unpack_monomials(exp3, exp_bits, poly3->exps, poly3->bits,
+                                                        poly3->length, ctx->n);
+   }
+
+   /* deal with aliasing and do multiplication */
+   if (poly1 == poly2 || poly1 == poly3)
+   {
+      nmod_mpoly_t temp;
+
+      nmod_mpoly_init2(temp, poly2->length + poly3->length - 1, ctx);
+      nmod_mpoly_fit_bits(temp, exp_bits, ctx);
+      temp->bits = exp_bits;
+
+      /* algorithm more efficient if smaller poly first */
+      if (poly2->length >= poly3->length)
+         len = _nmod_mpoly_mul_johnson(&temp->coeffs, &temp->exps, &temp->alloc,
+                                      poly3->coeffs, exp3, poly3->length,
+                                      poly2->coeffs, exp2, poly2->length,
+                                                 N, maskhi, masklo, ctx->mod);
+      else
+         len = _nmod_mpoly_mul_johnson(&temp->coeffs, &temp->exps, &temp->alloc,
+                                      poly2->coeffs, exp2, poly2->length,
+                                      poly3->coeffs, exp3, poly3->length,
+                                                 N, maskhi, masklo, ctx->mod);
+
+      nmod_mpoly_swap(temp, poly1, ctx);
+
+      nmod_mpoly_clear(temp, ctx);
+   } else
+   {
+      nmod_mpoly_fit_length(poly1, poly2->length + poly3->length - 1, ctx);
+      nmod_mpoly_fit_bits(poly1, exp_bits, ctx);
+      poly1->bits = exp_bits;
+
+      /* algorithm more efficient if smaller poly first */
+      if (poly2->length > poly3->length)
+         len = _nmod_mpoly_mul_johnson(&poly1->coeffs, &poly1->exps,
+                                                               &poly1->alloc,
+                                      poly3->coeffs, exp3, poly3->length,
+                                      poly2->coeffs, exp2, poly2->length,
+                                                 N, maskhi, masklo, ctx->mod);
+      else
+         len = _nmod_mpoly_mul_johnson(&poly1->coeffs, &poly1->exps,
+                                                               &poly1->alloc,
+                                      poly2->coeffs, exp2, poly2->length,
+                                      poly3->coeffs, exp3, poly3->length,
+                                                 N, maskhi, masklo, ctx->mod);
+   }
+
+   if (free2)
+      flint_free(exp2);
+
+   if (free3)
+      flint_free(exp3);
+
+   _nmod_mpoly_set_length(poly1, len, ctx);
+
+   TMP_END;
+}
@@ -0,0 +1,34 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "nmod_mpoly.h"
+
+void nmod_mpoly_neg(nmod_mpoly_t poly1, const nmod_mpoly_t poly2,
+                                                    const nmod_mpoly_ctx_t ctx)
+{
+   slong N;
+
+   N = words_per_exp(ctx->n, poly2->bits);
+
+   nmod_mpoly_fit_length(poly1, poly2->length, ctx);
+   nmod_mpoly_fit_bits(poly1, poly2->bits, ctx);
+
+   _nmod_vec_neg(poly1->coeffs, poly2->coeffs, poly2->length, ctx->mod);
+
+   if (poly1 != poly2)
+      flint_mpn_copyi(poly1->exps, poly2->exps, N*poly2->length);
+
+   _nmod_mpoly_set_length(poly1, poly2->length, ctx);
+   poly1->bits = poly2->bits;
+}
@@ -0,0 +1,44 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "nmod_mpoly.h"
+
+void nmod_mpoly_randtest(nmod_mpoly_t poly, flint_rand_t state,
+                   slong length, slong exp_bound, const nmod_mpoly_ctx_t ctx)
+{
+   slong i, j, vars;
+   ulong * exp;
+   int deg, rev;
+   TMP_INIT;
+
+   TMP_START;
+
+   degrev_from_ord(deg, rev, ctx->ord);
+
+   vars = ctx->n - deg;
+
+   exp = (ulong *) TMP_ALLOC(vars*sizeof(ulong));
+
+   nmod_mpoly_zero(poly, ctx);
+
+   for (i = 0; i < length; i++)
+   {
+      for (j = 0; j < vars; j++)
+         exp[j] = n_randint(state, exp_bound);
+
+      nmod_mpoly_set_term_ui(poly, exp, n_randint(state, ctx->mod.n), ctx);
+   }
+
+   TMP_END;
+}
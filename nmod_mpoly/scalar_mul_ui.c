@@ -0,0 +1,49 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "nmod_mpoly.h"
+
+void nmod_mpoly_scalar_mul_ui(nmod_mpoly_t poly1, const nmod_mpoly_t poly2,
+                                          ulong c, const nmod_mpoly_ctx_t ctx)
+{
+   slong i, k, N;
+
+   NMOD_RED(c, c, ctx->mod);
+
+   if (c == 0)
+   {
+      _nmod_mpoly_set_length(poly1, 0, ctx);
+      return;
+   }
+
+   N = words_per_exp(ctx->n, poly2->bits);
+
+   nmod_mpoly_fit_length(poly1, poly2->length, ctx);
+   nmod_mpoly_fit_bits(poly1, poly2->bits, ctx);
+
+   /* products can vanish if the modulus is not prime */
+   for (i = 0, k = 0; i < poly2->length; i++)
+   {
+      poly1->coeffs[k] = nmod_mul(poly2->coeffs[i], c, ctx->mod);
+
+      if (poly1->coeffs[k] != 0)
+      {
+         mpoly_monomial_set(poly1->exps + k*N, poly2->exps + i*N, N);
+         k++;
+      }
+   }
+
+   _nmod_mpoly_set_length(poly1, k, ctx);
+   poly1->bits = poly2->bits;
+}
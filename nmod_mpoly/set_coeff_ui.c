@@ -0,0 +1,52 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "nmod_mpoly.h"
+
+void
+nmod_mpoly_set_coeff_ui(nmod_mpoly_t poly,
+                                  slong n, ulong x, const nmod_mpoly_ctx_t ctx)
+{
+    NMOD_RED(x, x, ctx->mod);
+
+    if (x == 0)
+    {
+       slong i, N;
+
+       if (n >= poly->length)
+          return;
+
+       for (i = n; i < poly->length - 1; i++)
+          poly->coeffs[i] = poly->coeffs[i + 1];
+
+       N = words_per_exp(ctx->n, poly->bits);
+
+       for (i = n*N; i < (poly->length - 1)*N; i++)
+          poly->exps[i] = poly->exps[i + N];
+
+       poly->length--;
+    }
+    else
+    {
+        nmod_mpoly_fit_length(poly, n + 1, ctx);
+
+        if (n == poly->length)
+           poly->length++;
+        else if (n > poly->length)
+           flint_throw(FLINT_ERROR,
+                                   "Invalid index in nmod_mpoly_set_coeff_ui");
+
+        poly->coeffs[n] = x;
+    }
+}
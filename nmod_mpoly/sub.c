@@ -0,0 +1,196 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "nmod_mpoly.h"
+
+slong _nmod_mpoly_sub1(mp_limb_t * poly1, ulong * exps1,
+                 const mp_limb_t * poly2, const ulong * exps2, slong len2,
+                 const mp_limb_t * poly3, const ulong * exps3, slong len3,
+                                                      ulong maskhi, nmod_t mod)
+{
+   slong i = 0, j = 0, k = 0;
+
+   while (i < len2 && j < len3)
+   {
+      if ((exps2[i]^maskhi) > (exps3[j]^maskhi))
+      {
+         poly1[k] = poly2[i];
+         exps1[k] = exps2[i];
+         i++;
+      } else if ((exps2[i]^maskhi) == (exps3[j]^maskhi))
+      {
+         poly1[k] = nmod_sub(poly2[i], poly3[j], mod);
+         exps1[k] = exps2[i];
+         if (poly1[k] == 0)
+            k--;
+         i++;
+         j++;
+      } else
+      {
+         poly1[k] = nmod_neg(poly3[j], mod);
+         exps1[k] = exps3[j];
+         j++;
+      }
+      k++;
+   }
+
+   while (i < len2)
+   {
+      poly1[k] = poly2[i];
+      exps1[k] = exps2[i];
+      i++;
+      k++;
+   }
+
+   while (j < len3)
+   {
+      poly1[k] = nmod_neg(poly3[j], mod);
+      exps1[k] = exps3[j];
+      j++;
+      k++;
+   }
+
+   return k;
+}
+
+slong _nmod_mpoly_sub(mp_limb_t * poly1, ulong * exps1,
+            const mp_limb_t * poly2, const ulong * exps2, slong len2,
+            const mp_limb_t * poly3, const ulong * exps3, slong len3, slong N,
+                                       ulong maskhi, ulong masklo, nmod_t mod)
+{
+   slong i = 0, j = 0, k = 0;
+
+   if (N == 1)
+      return _nmod_mpoly_sub1(poly1, exps1, poly2, exps2, len2,
+                                              poly3, exps3, len3, maskhi, mod);
+
+   while (i < len2 && j < len3)
+   {
+      int cmp = mpoly_monomial_cmp(exps2 + i*N, exps3 + j*N, N, maskhi, masklo);
+
+      if (cmp > 0)
+      {
+         poly1[k] = poly2[i];
+         mpoly_monomial_set(exps1 + k*N, exps2 + i*N, N);
+         i++;
+      } else if (cmp == 0)
+      {
+         poly1[k] = nmod_sub(poly2[i], poly3[j], mod);
+         mpoly_monomial_set(exps1 + k*N, exps2 + i*N, N);
+         if (poly1[k] == 0)
+            k--;
+         i++;
+         j++;
+      } else
+      {
+         poly1[k] = nmod_neg(poly3[j], mod);
+         mpoly_monomial_set(exps1 + k*N, exps3 + j*N, N);
+         j++;
+      }
+      k++;
+   }
+
+   while (i < len2)
+   {
+      poly1[k] = poly2[i];
+      mpoly_monomial_set(exps1 + k*N, exps2 + i*N, N);
+      i++;
+      k++;
+   }
+
+   while (j < len3)
+   {
+      poly1[k] = nmod_neg(poly3[j], mod);
+      mpoly_monomial_set(exps1 + k*N, exps3 + j*N, N);
+      j++;
+      k++;
+   }
+
+   return k;
+}
+
+void nmod_mpoly_sub(nmod_mpoly_t poly1, const nmod_mpoly_t poly2,
+                          const nmod_mpoly_t poly3, const nmod_mpoly_ctx_t ctx)
+{
+   slong len = 0, max_bits, N;
+   ulong * exp2 = poly2->exps, * exp3 = poly3->exps;
+   ulong maskhi, masklo;
+   int free2 = 0, free3 = 0;
+
+   max_bits = FLINT_MAX(poly2->bits, poly3->bits);
+   masks_from_bits_ord(maskhi, masklo, max_bits, ctx->ord);
+   N = words_per_exp(ctx->n, max_bits);
+
+   if (poly2->length == 0)
+   {
+      nmod_mpoly_neg(poly1, poly3, ctx);
+      return;
+   } else if (poly3->length == 0)
+   {
+      nmod_mpoly_set(poly1, poly2, ctx);
+      return;
+   }
+
+   if (max_bits > poly2->bits)
+   {
+      free2 = 1;
+      exp2 = (ulong *) flint_malloc(N*poly2->length*sizeof(ulong));
+      mpoly_unpack_monomials(exp2, max_bits, poly2->exps, poly2->bits,
+                                                        poly2->length, ctx->n);
+   }
+
+   if (max_bits > poly3->bits)
+   {
+      free3 = 1;
+      exp3 = (ulong *) flint_malloc(N*poly3->length*sizeof(ulong));
+      mpoly_unpack_monomials(exp3, max_bits, poly3->exps, poly3->bits,
+                                                        poly3->length, ctx->n);
+   }
+
+   if (poly1 == poly2 || poly1 == poly3)
+   {
+      nmod_mpoly_t temp;
+
+      nmod_mpoly_init2(temp, poly2->length + poly3->length, ctx);
+      nmod_mpoly_fit_bits(temp, max_bits, ctx);
+      temp->bits = max_bits;
+
+      len = _nmod_mpoly_sub(temp->coeffs, temp->exps,
+                    poly2->coeffs, exp2, poly2->length,
+                    poly3->coeffs, exp3, poly3->length,
+                                          N, maskhi, masklo, ctx->mod);
+
+      nmod_mpoly_swap(temp, poly1, ctx);
+
+      nmod_mpoly_clear(temp, ctx);
+   } else
+   {
+      nmod_mpoly_fit_length(poly1, poly2->length + poly3->length, ctx);
+      nmod_mpoly_fit_bits(poly1, max_bits, ctx);
+      poly1->bits = max_bits;
+
+      len = _nmod_mpoly_sub(poly1->coeffs, poly1->exps,
+                       poly2->coeffs, exp2, poly2->length,
+                       poly3->coeffs, exp3, poly3->length,
+                                          N, maskhi, masklo, ctx->mod);
+   }
+
+   if (free2)
+      flint_free(exp2);
+
+   if (free3)
+      flint_free(exp3);
+
+   _nmod_mpoly_set_length(poly1, len, ctx);
+}
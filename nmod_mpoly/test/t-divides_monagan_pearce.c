@@ -0,0 +1,361 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mpoly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, j, result, ok1, ok2;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("divides_monagan_pearce....");
+    fflush(stdout);
+
+    /* Check f*g/g = f */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+       nmod_mpoly_ctx_t ctx;
+       nmod_mpoly_t f, g, h, k, r;
+       ordering_t ord;
+       mp_limb_t modulus;
+       slong nvars, len, len1, len2, exp_bound, exp_bound1, exp_bound2;
+       slong exp_bits, exp_bits1, exp_bits2;
+
+       ord = mpoly_ordering_randtest(state);
+       nvars = n_randint(state, 10) + 1;
+       modulus = n_randtest_prime(state, 0);
+
+       nmod_mpoly_ctx_init(ctx, nvars, ord, modulus);
+
+       nmod_mpoly_init(f, ctx);
+       nmod_mpoly_init(g, ctx);
+       nmod_mpoly_init(h, ctx);
+       nmod_mpoly_init(k, ctx);
+       nmod_mpoly_init(r, ctx);
+
+       len = n_randint(state, 100);
+       len1 = n_randint(state, 100);
+       len2 = n_randint(state, 100) + 1;
+
+       exp_bits = n_randint(state, FLINT_BITS - 1 -
+                  mpoly_ordering_isdeg(ord)*FLINT_BIT_COUNT(nvars)) + 1;
+       exp_bits1 = n_randint(state, FLINT_BITS - 2 -
+                  mpoly_ordering_isdeg(ord)*FLINT_BIT_COUNT(nvars)) + 1;
+       exp_bits2 = n_randint(state, FLINT_BITS - 2 -
+                  mpoly_ordering_isdeg(ord)*FLINT_BIT_COUNT(nvars)) + 1;
+
+       exp_bound = n_randbits(state, exp_bits);
+       exp_bound1 = n_randbits(state, exp_bits1);
+       exp_bound2 = n_randbits(state, exp_bits2);
+
+       for (j = 0; j < 4; j++)
+       {
+          nmod_mpoly_randtest(f, state, len1, exp_bound1, ctx);
+          do {
+             nmod_mpoly_randtest(g, state, len2, exp_bound2, ctx);
+          } while (g->length == 0);
+          nmod_mpoly_randtest(k, state, len, exp_bound, ctx);
+
+          nmod_mpoly_mul_johnson(h, f, g, ctx);
+          nmod_mpoly_test(h, ctx);
+
+          ok1 = nmod_mpoly_divides_monagan_pearce(k, h, g, ctx);
+          nmod_mpoly_test(k, ctx);
+
+          result = ok1 && nmod_mpoly_equal(f, k, ctx);
+
+          if (!result)
+          {
+             printf("FAIL\n");
+
+             printf("ord = "); mpoly_ordering_print(ord);
+             flint_printf(", n = %wu, len = %wd, exp_bound = %wd, "
+                    "len1 = %wd, exp_bound1 = %wd, "
+                    "len2 = %wd, exp_bound2 = %wd, nvars = %wd\n\n",
+                       modulus, len, exp_bound, len1, exp_bound1,
+                                                   len2, exp_bound2, nvars);
+
+             nmod_mpoly_print_pretty(f, NULL, ctx); printf("\n\n");
+             nmod_mpoly_print_pretty(g, NULL, ctx); printf("\n\n");
+             nmod_mpoly_print_pretty(h, NULL, ctx); printf("\n\n");
+             nmod_mpoly_print_pretty(k, NULL, ctx); printf("\n\n");
+
+             flint_abort();
+          }
+       }
+
+       nmod_mpoly_clear(f, ctx);
+       nmod_mpoly_clear(g, ctx);
+       nmod_mpoly_clear(h, ctx);
+       nmod_mpoly_clear(k, ctx);
+       nmod_mpoly_clear(r, ctx);
+    }
+
+    /* Check random polys don't divide unless f = g*q */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+       nmod_mpoly_ctx_t ctx;
+       nmod_mpoly_t f, g, h, k, r;
+       ordering_t ord;
+       mp_limb_t modulus;
+       slong nvars, len, len1, len2, exp_bound, exp_bound1, exp_bound2;
+       slong exp_bits, exp_bits1, exp_bits2;
+
+       ord = mpoly_ordering_randtest(state);
+       nvars = n_randint(state, 10) + 1;
+       modulus = n_randtest_prime(state, 0);
+
+       nmod_mpoly_ctx_init(ctx, nvars, ord, modulus);
+
+       nmod_mpoly_init(f, ctx);
+       nmod_mpoly_init(g, ctx);
+       nmod_mpoly_init(h, ctx);
+       nmod_mpoly_init(k, ctx);
+       nmod_mpoly_init(r, ctx);
+
+       len = n_randint(state, 10);
+       len1 = n_randint(state, 10);
+       len2 = n_randint(state, 10) + 1;
+
+       exp_bits = n_randint(state, 14/(nvars +
+                            mpoly_ordering_isdeg(ord) + (nvars == 1)) + 1) + 1;
+       exp_bits1 = n_randint(state, 14/(nvars +
+                            mpoly_ordering_isdeg(ord) + (nvars == 1)) + 1) + 1;
+       exp_bits2 = n_randint(state, 14/(nvars +
+                            mpoly_ordering_isdeg(ord) + (nvars == 1)) + 1) + 1;
+
+       exp_bound = n_randbits(state, exp_bits);
+       exp_bound1 = n_randbits(state, exp_bits1);
+       exp_bound2 = n_randbits(state, exp_bits2);
+
+       for (j = 0; j < 4; j++)
+       {
+          nmod_mpoly_randtest(f, state, len1, exp_bound1, ctx);
+          do {
+             nmod_mpoly_randtest(g, state, len2, exp_bound2, ctx);
+          } while (g->length == 0);
+
+          ok1 = nmod_mpoly_divides_monagan_pearce(h, f, g, ctx);
+          nmod_mpoly_test(h, ctx);
+
+          if (ok1)
+          {
+             nmod_mpoly_mul_johnson(k, h, g, ctx);
+             nmod_mpoly_test(k, ctx);
+          }
+
+          result = !ok1 || nmod_mpoly_equal(f, k, ctx);
+
+          if (!result)
+          {
+             printf("FAIL\n");
+
+             printf("ord = "); mpoly_ordering_print(ord);
+             flint_printf(", n = %wu, len = %wd, exp_bound = %wd, "
+                    "len1 = %wd, exp_bound1 = %wd, "
+                    "len2 = %wd, exp_bound2 = %wd, nvars = %wd\n\n",
+                       modulus, len, exp_bound, len1, exp_bound1,
+                                                   len2, exp_bound2, nvars);
+
+             nmod_mpoly_print_pretty(f, NULL, ctx); printf("\n\n");
+             nmod_mpoly_print_pretty(g, NULL, ctx); printf("\n\n");
+             nmod_mpoly_print_pretty(h, NULL, ctx); printf("\n\n");
+
+             flint_abort();
+          }
+       }
+
+       nmod_mpoly_clear(f, ctx);
+       nmod_mpoly_clear(g, ctx);
+       nmod_mpoly_clear(h, ctx);
+       nmod_mpoly_clear(k, ctx);
+       nmod_mpoly_clear(r, ctx);
+    }
+
+    /* Check aliasing first argument, exact division */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+       nmod_mpoly_ctx_t ctx;
+       nmod_mpoly_t f, g, h, k, r;
+       ordering_t ord;
+       mp_limb_t modulus;
+       slong nvars, len, len1, len2, exp_bound, exp_bound1, exp_bound2;
+       slong exp_bits, exp_bits1, exp_bits2;
+
+       ord = mpoly_ordering_randtest(state);
+       nvars = n_randint(state, 10) + 1;
+       modulus = n_randtest_prime(state, 0);
+
+       nmod_mpoly_ctx_init(ctx, nvars, ord, modulus);
+
+       nmod_mpoly_init(f, ctx);
+       nmod_mpoly_init(g, ctx);
+       nmod_mpoly_init(h, ctx);
+       nmod_mpoly_init(k, ctx);
+       nmod_mpoly_init(r, ctx);
+
+       len = n_randint(state, 100);
+       len1 = n_randint(state, 100);
+       len2 = n_randint(state, 100) + 1;
+
+       exp_bits = n_randint(state, FLINT_BITS - 1 -
+                  mpoly_ordering_isdeg(ord)*FLINT_BIT_COUNT(nvars)) + 1;
+       exp_bits1 = n_randint(state, FLINT_BITS - 2 -
+                  mpoly_ordering_isdeg(ord)*FLINT_BIT_COUNT(nvars)) + 1;
+       exp_bits2 = n_randint(state, FLINT_BITS - 2 -
+                  mpoly_ordering_isdeg(ord)*FLINT_BIT_COUNT(nvars)) + 1;
+
+       exp_bound = n_randbits(state, exp_bits);
+       exp_bound1 = n_randbits(state, exp_bits1);
+       exp_bound2 = n_randbits(state, exp_bits2);
+
+       for (j = 0; j < 4; j++)
+       {
+          nmod_mpoly_randtest(f, state, len1, exp_bound1, ctx);
+          do {
+             nmod_mpoly_randtest(g, state, len2, exp_bound2, ctx);
+          } while (g->length == 0);
+
+          nmod_mpoly_mul_johnson(h, f, g, ctx);
+          nmod_mpoly_test(h, ctx);
+
+          ok1 = nmod_mpoly_divides_monagan_pearce(k, h, g, ctx);
+          nmod_mpoly_test(k, ctx);
+
+          ok2 = nmod_mpoly_divides_monagan_pearce(h, h, g, ctx);
+          nmod_mpoly_test(h, ctx);
+
+          result = ok1 == ok2 && nmod_mpoly_equal(h, k, ctx);
+
+          if (!result)
+          {
+             printf("FAIL\n");
+
+             printf("Aliasing test1\n");
+
+             printf("ord = "); mpoly_ordering_print(ord);
+             flint_printf(", n = %wu, len = %wd, exp_bound = %wd, "
+                    "len1 = %wd, exp_bound1 = %wd, "
+                    "len2 = %wd, exp_bound2 = %wd, nvars = %wd\n\n",
+                       modulus, len, exp_bound, len1, exp_bound1,
+                                                   len2, exp_bound2, nvars);
+
+             nmod_mpoly_print_pretty(f, NULL, ctx); printf("\n\n");
+             nmod_mpoly_print_pretty(g, NULL, ctx); printf("\n\n");
+             nmod_mpoly_print_pretty(h, NULL, ctx); printf("\n\n");
+             nmod_mpoly_print_pretty(k, NULL, ctx); printf("\n\n");
+
+             flint_abort();
+          }
+       }
+
+       nmod_mpoly_clear(f, ctx);
+       nmod_mpoly_clear(g, ctx);
+       nmod_mpoly_clear(h, ctx);
+       nmod_mpoly_clear(k, ctx);
+       nmod_mpoly_clear(r, ctx);
+    }
+
+    /* Check aliasing second argument, exact division */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+       nmod_mpoly_ctx_t ctx;
+       nmod_mpoly_t f, g, h, k, r;
+       ordering_t ord;
+       mp_limb_t modulus;
+       slong nvars, len, len1, len2, exp_bound, exp_bound1, exp_bound2;
+       slong exp_bits, exp_bits1, exp_bits2;
+
+       ord = mpoly_ordering_randtest(state);
+       nvars = n_randint(state, 10) + 1;
+       modulus = n_randtest_prime(state, 0);
+
+       nmod_mpoly_ctx_init(ctx, nvars, ord, modulus);
+
+       nmod_mpoly_init(f, ctx);
+       nmod_mpoly_init(g, ctx);
+       nmod_mpoly_init(h, ctx);
+       nmod_mpoly_init(k, ctx);
+       nmod_mpoly_init(r, ctx);
+
+       len = n_randint(state, 100);
+       len1 = n_randint(state, 100);
+       len2 = n_randint(state, 100) + 1;
+
+       exp_bits = n_randint(state, FLINT_BITS - 1 -
+                  mpoly_ordering_isdeg(ord)*FLINT_BIT_COUNT(nvars)) + 1;
+       exp_bits1 = n_randint(state, FLINT_BITS - 2 -
+                  mpoly_ordering_isdeg(ord)*FLINT_BIT_COUNT(nvars)) + 1;
+       exp_bits2 = n_randint(state, FLINT_BITS - 2 -
+                  mpoly_ordering_isdeg(ord)*FLINT_BIT_COUNT(nvars)) + 1;
+
+       exp_bound = n_randbits(state, exp_bits);
+       exp_bound1 = n_randbits(state, exp_bits1);
+       exp_bound2 = n_randbits(state, exp_bits2);
+
+       for (j = 0; j < 4; j++)
+       {
+          nmod_mpoly_randtest(f, state, len1, exp_bound1, ctx);
+          do {
+             nmod_mpoly_randtest(g, state, len2, exp_bound2, ctx);
+          } while (g->length == 0);
+
+          nmod_mpoly_mul_johnson(h, f, g, ctx);
+          nmod_mpoly_test(h, ctx);
+
+          ok1 = nmod_mpoly_divides_monagan_pearce(k, h, g, ctx);
+          nmod_mpoly_test(k, ctx);
+
+          ok2 = nmod_mpoly_divides_monagan_pearce(g, h, g, ctx);
+          nmod_mpoly_test(g, ctx);
+
+          result = ok1 == ok2 && nmod_mpoly_equal(g, k, ctx);
+
+          if (!result)
+          {
+             printf("FAIL\n");
+
+             printf("Aliasing test2\n");
+
+             printf("ord = "); mpoly_ordering_print(ord);
+             flint_printf(", n = %wu, len = %wd, exp_bound = %wd, "
+                    "len1 = %wd, exp_bound1 = %wd, "
+                    "len2 = %wd, exp_bound2 = %wd, nvars = %wd\n\n",
+                       modulus, len, exp_bound, len1, exp_bound1,
+                                                   len2, exp_bound2, nvars);
+
+             nmod_mpoly_print_pretty(f, NULL, ctx); printf("\n\n");
+             nmod_mpoly_print_pretty(g, NULL, ctx); printf("\n\n");
+             nmod_mpoly_print_pretty(h, NULL, ctx); printf("\n\n");
+             nmod_mpoly_print_pretty(k, NULL, ctx); printf("\n\n");
+
+             flint_abort();
+          }
+       }
+
+       nmod_mpoly_clear(f, ctx);
+       nmod_mpoly_clear(g, ctx);
+       nmod_mpoly_clear(h, ctx);
+       nmod_mpoly_clear(k, ctx);
+       nmod_mpoly_clear(r, ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,201 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mpoly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, j, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("gcd_brown....");
+    fflush(stdout);
+
+    /* Check gcd(a*g, b*g) is divisible by g and has coprime cofactors */
+    for (i = 0; i < 300 * flint_test_multiplier(); i++)
+    {
+       nmod_mpoly_ctx_t ctx;
+       nmod_mpoly_t a, b, g, A, B, G, Q1, Q2, T;
+       ordering_t ord;
+       mp_limb_t modulus;
+       slong nvars, len, len1, len2, exp_bound, exp_bound1, exp_bound2;
+       int ok1, ok2, ok3, success;
+
+       ord = mpoly_ordering_randtest(state);
+       nvars = n_randint(state, 4) + 1;
+
+       if (n_randint(state, 10) == 0)
+          modulus = n_randtest_prime(state, 0);
+       else
+          modulus = n_randprime(state, n_randint(state, FLINT_BITS - 20) + 20, 1);
+
+       nmod_mpoly_ctx_init(ctx, nvars, ord, modulus);
+
+       nmod_mpoly_init(a, ctx);
+       nmod_mpoly_init(b, ctx);
+       nmod_mpoly_init(g, ctx);
+       nmod_mpoly_init(A, ctx);
+       nmod_mpoly_init(B, ctx);
+       nmod_mpoly_init(G, ctx);
+       nmod_mpoly_init(Q1, ctx);
+       nmod_mpoly_init(Q2, ctx);
+       nmod_mpoly_init(T, ctx);
+
+       len = n_randint(state, 10) + 1;
+       len1 = n_randint(state, 10);
+       len2 = n_randint(state, 10);
+
+       exp_bound = n_randint(state, 5) + 1;
+       exp_bound1 = n_randint(state, 5) + 1;
+       exp_bound2 = n_randint(state, 5) + 1;
+
+       /* large enough to use threads */
+       if (n_randint(state, 10) == 0)
+       {
+          len1 = 30;
+          len2 = 30;
+       }
+
+       flint_set_num_threads(n_randint(state, 4) + 1);
+
+       for (j = 0; j < 2; j++)
+       {
+          nmod_mpoly_randtest(a, state, len1, exp_bound1, ctx);
+          nmod_mpoly_randtest(b, state, len2, exp_bound2, ctx);
+          nmod_mpoly_randtest(g, state, len, exp_bound, ctx);
+
+          nmod_mpoly_mul_johnson(A, a, g, ctx);
+          nmod_mpoly_mul_johnson(B, b, g, ctx);
+
+          success = nmod_mpoly_gcd_brown(G, A, B, ctx);
+
+          if (!success)
+          {
+             /* only a small field can run out of evaluation points */
+             if (modulus < 1000)
+                continue;
+
+             printf("FAIL\n");
+             flint_printf("gcd failed, n = %wu\n", modulus);
+             flint_abort();
+          }
+
+          nmod_mpoly_test(G, ctx);
+
+          if (A->length == 0 && B->length == 0)
+          {
+             result = (G->length == 0);
+          } else
+          {
+             ok1 = nmod_mpoly_divides_monagan_pearce(Q1, A, G, ctx);
+             ok2 = nmod_mpoly_divides_monagan_pearce(Q2, B, G, ctx);
+             ok3 = g->length == 0 ||
+                   nmod_mpoly_divides_monagan_pearce(T, G, g, ctx);
+
+             result = G->length != 0 && G->coeffs[0] == 1 && ok1 && ok2 && ok3;
+
+             if (result)
+             {
+                success = nmod_mpoly_gcd_brown(T, Q1, Q2, ctx);
+                result = !success || nmod_mpoly_is_one(T, ctx);
+             }
+          }
+
+          if (!result)
+          {
+             printf("FAIL\n");
+             printf("ord = "); mpoly_ordering_print(ord);
+             flint_printf(", n = %wu, nvars = %wd\n\n", modulus, nvars);
+
+             nmod_mpoly_print_pretty(A, NULL, ctx); printf("\n\n");
+             nmod_mpoly_print_pretty(B, NULL, ctx); printf("\n\n");
+             nmod_mpoly_print_pretty(g, NULL, ctx); printf("\n\n");
+             nmod_mpoly_print_pretty(G, NULL, ctx); printf("\n\n");
+
+             flint_abort();
+          }
+       }
+
+       nmod_mpoly_clear(a, ctx);
+       nmod_mpoly_clear(b, ctx);
+       nmod_mpoly_clear(g, ctx);
+       nmod_mpoly_clear(A, ctx);
+       nmod_mpoly_clear(B, ctx);
+       nmod_mpoly_clear(G, ctx);
+       nmod_mpoly_clear(Q1, ctx);
+       nmod_mpoly_clear(Q2, ctx);
+       nmod_mpoly_clear(T, ctx);
+    }
+
+    /* Check aliasing of the gcd with either input */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+       nmod_mpoly_ctx_t ctx;
+       nmod_mpoly_t a, b, g, G;
+       ordering_t ord;
+       mp_limb_t modulus;
+       slong nvars;
+
+       ord = mpoly_ordering_randtest(state);
+       nvars = n_randint(state, 4) + 1;
+       modulus = n_randprime(state, n_randint(state, FLINT_BITS - 20) + 20, 1);
+
+       nmod_mpoly_ctx_init(ctx, nvars, ord, modulus);
+
+       nmod_mpoly_init(a, ctx);
+       nmod_mpoly_init(b, ctx);
+       nmod_mpoly_init(g, ctx);
+       nmod_mpoly_init(G, ctx);
+
+       nmod_mpoly_randtest(g, state, 5, 4, ctx);
+       nmod_mpoly_randtest(a, state, 5, 4, ctx);
+       nmod_mpoly_randtest(b, state, 5, 4, ctx);
+       nmod_mpoly_mul_johnson(a, a, g, ctx);
+       nmod_mpoly_mul_johnson(b, b, g, ctx);
+
+       nmod_mpoly_gcd_brown(G, a, b, ctx);
+
+       if (n_randint(state, 2))
+       {
+          nmod_mpoly_gcd_brown(a, a, b, ctx);
+          result = nmod_mpoly_equal(a, G, ctx);
+       } else
+       {
+          nmod_mpoly_gcd_brown(b, a, b, ctx);
+          result = nmod_mpoly_equal(b, G, ctx);
+       }
+
+       if (!result)
+       {
+          printf("FAIL\n");
+          printf("aliasing\n");
+          flint_abort();
+       }
+
+       nmod_mpoly_clear(a, ctx);
+       nmod_mpoly_clear(b, ctx);
+       nmod_mpoly_clear(g, ctx);
+       nmod_mpoly_clear(G, ctx);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    printf("PASS\n");
+    return 0;
+}
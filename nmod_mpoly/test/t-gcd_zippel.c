@@ -0,0 +1,136 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mpoly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, result;
+    slong count = 0;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("gcd_zippel....");
+    fflush(stdout);
+
+    /* Check a successful sparse interpolation agrees with the dense gcd */
+    for (i = 0; i < 300 * flint_test_multiplier(); i++)
+    {
+       nmod_mpoly_ctx_t ctx;
+       nmod_mpoly_t a, b, g, A, B, G1, G2;
+       ordering_t ord;
+       mp_limb_t modulus;
+       slong nvars, len, len1, len2, exp_bound, exp_bound1, exp_bound2;
+
+       ord = mpoly_ordering_randtest(state);
+       nvars = n_randint(state, 4) + 1;
+       modulus = n_randprime(state, n_randint(state, FLINT_BITS - 20) + 20, 1);
+
+       nmod_mpoly_ctx_init(ctx, nvars, ord, modulus);
+
+       nmod_mpoly_init(a, ctx);
+       nmod_mpoly_init(b, ctx);
+       nmod_mpoly_init(g, ctx);
+       nmod_mpoly_init(A, ctx);
+       nmod_mpoly_init(B, ctx);
+       nmod_mpoly_init(G1, ctx);
+       nmod_mpoly_init(G2, ctx);
+
+       len = n_randint(state, 10) + 1;
+       len1 = n_randint(state, 10) + 1;
+       len2 = n_randint(state, 10) + 1;
+
+       exp_bound = n_randint(state, 6) + 1;
+       exp_bound1 = n_randint(state, 6) + 1;
+       exp_bound2 = n_randint(state, 6) + 1;
+
+       if (n_randint(state, 10) == 0)
+       {
+          len1 = 30;
+          len2 = 30;
+       }
+
+       flint_set_num_threads(n_randint(state, 4) + 1);
+
+       nmod_mpoly_randtest(a, state, len1, exp_bound1, ctx);
+       nmod_mpoly_randtest(b, state, len2, exp_bound2, ctx);
+       nmod_mpoly_randtest(g, state, len, exp_bound, ctx);
+
+       nmod_mpoly_mul_johnson(A, a, g, ctx);
+       nmod_mpoly_mul_johnson(B, b, g, ctx);
+
+       if (nmod_mpoly_gcd_brown(G1, A, B, ctx))
+       {
+          if (nmod_mpoly_gcd_zippel(G2, A, B, G1, ctx, state))
+          {
+             count++;
+
+             nmod_mpoly_test(G2, ctx);
+
+             result = nmod_mpoly_equal(G1, G2, ctx);
+
+             if (!result)
+             {
+                printf("FAIL\n");
+                printf("ord = "); mpoly_ordering_print(ord);
+                flint_printf(", n = %wu, nvars = %wd\n\n", modulus, nvars);
+
+                nmod_mpoly_print_pretty(A, NULL, ctx); printf("\n\n");
+                nmod_mpoly_print_pretty(B, NULL, ctx); printf("\n\n");
+                nmod_mpoly_print_pretty(G1, NULL, ctx); printf("\n\n");
+                nmod_mpoly_print_pretty(G2, NULL, ctx); printf("\n\n");
+
+                flint_abort();
+             }
+
+             /* aliasing */
+             nmod_mpoly_gcd_zippel(A, A, B, G1, ctx, state);
+
+             result = nmod_mpoly_equal(A, G2, ctx);
+
+             if (!result)
+             {
+                printf("FAIL\n");
+                printf("aliasing\n");
+                flint_abort();
+             }
+          }
+       }
+
+       nmod_mpoly_clear(a, ctx);
+       nmod_mpoly_clear(b, ctx);
+       nmod_mpoly_clear(g, ctx);
+       nmod_mpoly_clear(A, ctx);
+       nmod_mpoly_clear(B, ctx);
+       nmod_mpoly_clear(G1, ctx);
+       nmod_mpoly_clear(G2, ctx);
+    }
+
+    flint_set_num_threads(1);
+
+    /* the leading coefficient condition holds for most random inputs */
+    if (count < 30 * flint_test_multiplier())
+    {
+       printf("FAIL\n");
+       flint_printf("too few successes: %wd\n", count);
+       flint_abort();
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,99 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_mpoly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, j, k, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("get/set_term_ui....");
+    fflush(stdout);
+
+    /* Set term and get term and compare */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+       nmod_mpoly_ctx_t ctx;
+       nmod_mpoly_t f;
+       ordering_t ord;
+       mp_limb_t modulus;
+       ulong c, d;
+       slong nvars, len, exp_bound, exp_bits;
+
+       ord = mpoly_ordering_randtest(state);
+       nvars = n_randint(state, 20) + 1;
+       modulus = n_randtest_not_zero(state);
+
+       nmod_mpoly_ctx_init(ctx, nvars, ord, modulus);
+
+       nmod_mpoly_init(f, ctx);
+
+       len = n_randint(state, 100);
+
+       exp_bits = n_randint(state, FLINT_BITS -
+                     mpoly_ordering_isdeg(ord)*FLINT_BIT_COUNT(nvars) - 1) + 1;
+       exp_bound = n_randbits(state, exp_bits);
+
+       nmod_mpoly_randtest(f, state, len, exp_bound, ctx);
+
+       for (j = 0; j < 10; j++)
+       {
+          ulong * exp = (ulong *) flint_malloc(nvars*sizeof(ulong));
+
+          for (k = 0; k < nvars; k++)
+          {
+             slong bits = n_randint(state, FLINT_BITS -
+                     mpoly_ordering_isdeg(ord)*FLINT_BIT_COUNT(nvars) - 1) + 1;
+             exp[k] = n_randbits(state, bits);
+          }
+
+          c = n_randtest(state);
+
+          nmod_mpoly_set_term_ui(f, exp, c, ctx);
+          nmod_mpoly_test(f, ctx);
+
+          d = nmod_mpoly_get_term_ui(f, exp, ctx);
+
+          result = (c % modulus) == d;
+
+          if (!result)
+          {
+             printf("FAIL\n");
+
+             printf("ord = "); mpoly_ordering_print(ord);
+             flint_printf(", n = %wu, len = %wd, exp_bits = %wd, "
+                          "exp_bound = %wd, nvars = %wd\n\n",
+                                 modulus, len, exp_bits, exp_bound, nvars);
+
+             flint_printf("c = %wu\n", c);
+             flint_printf("d = %wu\n", d);
+
+             flint_abort();
+          }
+
+          flint_free(exp);
+       }
+
+       nmod_mpoly_clear(f, ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
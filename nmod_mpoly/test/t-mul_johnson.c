@@ -0,0 +1,338 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "fmpz_mpoly.h"
+#include "nmod_mpoly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, j, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_johnson....");
+    fflush(stdout);
+
+    /* Check mul_johnson matches fmpz_mpoly_mul_johnson reduced mod n */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+       fmpz_mpoly_ctx_t zctx;
+       nmod_mpoly_ctx_t ctx;
+       fmpz_mpoly_t zf, zg, zh;
+       nmod_mpoly_t f, g, h, k;
+       ordering_t ord;
+       mp_limb_t modulus;
+       slong nvars, len1, len2, exp_bound1, exp_bound2;
+       slong coeff_bits, exp_bits1, exp_bits2;
+
+       ord = mpoly_ordering_randtest(state);
+       nvars = n_randint(state, 10) + 1;
+       modulus = n_randtest_not_zero(state);
+
+       fmpz_mpoly_ctx_init(zctx, nvars, ord);
+       nmod_mpoly_ctx_init(ctx, nvars, ord, modulus);
+
+       fmpz_mpoly_init(zf, zctx);
+       fmpz_mpoly_init(zg, zctx);
+       fmpz_mpoly_init(zh, zctx);
+       nmod_mpoly_init(f, ctx);
+       nmod_mpoly_init(g, ctx);
+       nmod_mpoly_init(h, ctx);
+       nmod_mpoly_init(k, ctx);
+
+       len1 = n_randint(state, 100);
+       len2 = n_randint(state, 100);
+
+       exp_bits1 = n_randint(state, 20/(nvars +
+                            mpoly_ordering_isdeg(ord) + (nvars == 1)) + 1) + 1;
+       exp_bits2 = n_randint(state, 20/(nvars +
+                            mpoly_ordering_isdeg(ord) + (nvars == 1)) + 1) + 1;
+       exp_bound1 = n_randbits(state, exp_bits1);
+       exp_bound2 = n_randbits(state, exp_bits2);
+
+       coeff_bits = n_randint(state, 200);
+
+       for (j = 0; j < 4; j++)
+       {
+          fmpz_mpoly_randtest(zf, state, len1, exp_bound1, coeff_bits, zctx);
+          fmpz_mpoly_randtest(zg, state, len2, exp_bound2, coeff_bits, zctx);
+          nmod_mpoly_randtest(k, state, len1, exp_bound1, ctx);
+
+          fmpz_mpoly_mul_johnson(zh, zf, zg, zctx);
+
+          nmod_mpoly_set_fmpz_mpoly(f, zf, ctx);
+          nmod_mpoly_test(f, ctx);
+          nmod_mpoly_set_fmpz_mpoly(g, zg, ctx);
+          nmod_mpoly_test(g, ctx);
+          nmod_mpoly_set_fmpz_mpoly(h, zh, ctx);
+          nmod_mpoly_test(h, ctx);
+
+          nmod_mpoly_mul_johnson(k, f, g, ctx);
+          nmod_mpoly_test(k, ctx);
+
+          result = nmod_mpoly_equal(h, k, ctx);
+
+          if (!result)
+          {
+             printf("FAIL\n");
+
+             printf("ord = "); mpoly_ordering_print(ord);
+             flint_printf(", n = %wu, len1 = %wd, exp_bound1 = %wd, "
+                    "len2 = %wd, exp_bound2 = %wd, nvars = %wd\n\n",
+                       modulus, len1, exp_bound1, len2, exp_bound2, nvars);
+
+             nmod_mpoly_print_pretty(f, NULL, ctx); printf("\n\n");
+             nmod_mpoly_print_pretty(g, NULL, ctx); printf("\n\n");
+             nmod_mpoly_print_pretty(h, NULL, ctx); printf("\n\n");
+             nmod_mpoly_print_pretty(k, NULL, ctx); printf("\n\n");
+
+             flint_abort();
+          }
+       }
+
+       fmpz_mpoly_clear(zf, zctx);
+       fmpz_mpoly_clear(zg, zctx);
+       fmpz_mpoly_clear(zh, zctx);
+       nmod_mpoly_clear(f, ctx);
+       nmod_mpoly_clear(g, ctx);
+       nmod_mpoly_clear(h, ctx);
+       nmod_mpoly_clear(k, ctx);
+    }
+
+    /* Check f*(g + h) = f*g + f*h */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+       nmod_mpoly_ctx_t ctx;
+       nmod_mpoly_t f, g, h, k1, k2, t1, t2;
+       ordering_t ord;
+       mp_limb_t modulus;
+       slong nvars, len, len1, len2, exp_bound, exp_bound1, exp_bound2;
+       slong exp_bits, exp_bits1, exp_bits2;
+
+       ord = mpoly_ordering_randtest(state);
+       nvars = n_randint(state, 10) + 1;
+       modulus = n_randtest_not_zero(state);
+
+       nmod_mpoly_ctx_init(ctx, nvars, ord, modulus);
+
+       nmod_mpoly_init(f, ctx);
+       nmod_mpoly_init(g, ctx);
+       nmod_mpoly_init(h, ctx);
+       nmod_mpoly_init(t1, ctx);
+       nmod_mpoly_init(t2, ctx);
+       nmod_mpoly_init(k1, ctx);
+       nmod_mpoly_init(k2, ctx);
+
+       len = n_randint(state, 100);
+       len1 = n_randint(state, 100);
+       len2 = n_randint(state, 100);
+
+       exp_bits = n_randint(state, FLINT_BITS - 1 -
+                  mpoly_ordering_isdeg(ord)*FLINT_BIT_COUNT(nvars)) + 1;
+       exp_bits1 = n_randint(state, FLINT_BITS - 2 -
+                  mpoly_ordering_isdeg(ord)*FLINT_BIT_COUNT(nvars)) + 1;
+       exp_bits2 = n_randint(state, FLINT_BITS - 2 -
+                  mpoly_ordering_isdeg(ord)*FLINT_BIT_COUNT(nvars)) + 1;
+
+       exp_bound = n_randbits(state, exp_bits);
+       exp_bound1 = n_randbits(state, exp_bits1);
+       exp_bound2 = n_randbits(state, exp_bits2);
+
+       nmod_mpoly_randtest(k1, state, len, exp_bound, ctx);
+       nmod_mpoly_randtest(k2, state, len, exp_bound, ctx);
+
+       for (j = 0; j < 4; j++)
+       {
+          nmod_mpoly_randtest(f, state, len1, exp_bound1, ctx);
+          nmod_mpoly_randtest(g, state, len2, exp_bound2, ctx);
+          nmod_mpoly_randtest(h, state, len2, exp_bound2, ctx);
+
+          nmod_mpoly_add(t1, g, h, ctx);
+          nmod_mpoly_test(t1, ctx);
+          nmod_mpoly_mul_johnson(k1, f, t1, ctx);
+          nmod_mpoly_test(k1, ctx);
+
+          nmod_mpoly_mul_johnson(t1, f, g, ctx);
+          nmod_mpoly_test(t1, ctx);
+          nmod_mpoly_mul_johnson(t2, f, h, ctx);
+          nmod_mpoly_test(t2, ctx);
+          nmod_mpoly_add(k2, t1, t2, ctx);
+          nmod_mpoly_test(k2, ctx);
+
+          result = nmod_mpoly_equal(k1, k2, ctx);
+
+          if (!result)
+          {
+             printf("FAIL\n");
+
+             printf("ord = "); mpoly_ordering_print(ord);
+             flint_printf(", n = %wu, len = %wd, exp_bound = %wd, "
+                    "len1 = %wd, exp_bound1 = %wd, "
+                    "len2 = %wd, exp_bound2 = %wd, nvars = %wd\n\n",
+                       modulus, len, exp_bound, len1, exp_bound1,
+                                                   len2, exp_bound2, nvars);
+
+             nmod_mpoly_print_pretty(f, NULL, ctx); printf("\n\n");
+             nmod_mpoly_print_pretty(g, NULL, ctx); printf("\n\n");
+             nmod_mpoly_print_pretty(h, NULL, ctx); printf("\n\n");
+             nmod_mpoly_print_pretty(k1, NULL, ctx); printf("\n\n");
+             nmod_mpoly_print_pretty(k2, NULL, ctx); printf("\n\n");
+
+             flint_abort();
+          }
+       }
+
+       nmod_mpoly_clear(f, ctx);
+       nmod_mpoly_clear(g, ctx);
+       nmod_mpoly_clear(h, ctx);
+       nmod_mpoly_clear(k1, ctx);
+       nmod_mpoly_clear(k2, ctx);
+       nmod_mpoly_clear(t1, ctx);
+       nmod_mpoly_clear(t2, ctx);
+    }
+
+    /* Check aliasing first argument */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+       nmod_mpoly_ctx_t ctx;
+       nmod_mpoly_t f, g, h;
+       ordering_t ord;
+       mp_limb_t modulus;
+       slong nvars, len1, len2, exp_bound1, exp_bound2;
+       slong exp_bits1, exp_bits2;
+
+       ord = mpoly_ordering_randtest(state);
+       nvars = n_randint(state, 10) + 1;
+       modulus = n_randtest_not_zero(state);
+
+       nmod_mpoly_ctx_init(ctx, nvars, ord, modulus);
+
+       nmod_mpoly_init(f, ctx);
+       nmod_mpoly_init(g, ctx);
+       nmod_mpoly_init(h, ctx);
+
+       len1 = n_randint(state, 100);
+       len2 = n_randint(state, 100);
+
+       exp_bits1 = n_randint(state, FLINT_BITS - 2 -
+                  mpoly_ordering_isdeg(ord)*FLINT_BIT_COUNT(nvars)) + 1;
+       exp_bits2 = n_randint(state, FLINT_BITS - 2 -
+                  mpoly_ordering_isdeg(ord)*FLINT_BIT_COUNT(nvars)) + 1;
+
+       exp_bound1 = n_randbits(state, exp_bits1);
+       exp_bound2 = n_randbits(state, exp_bits2);
+
+       for (j = 0; j < 4; j++)
+       {
+          nmod_mpoly_randtest(f, state, len1, exp_bound1, ctx);
+          nmod_mpoly_randtest(g, state, len2, exp_bound2, ctx);
+
+          nmod_mpoly_mul_johnson(h, f, g, ctx);
+          nmod_mpoly_test(h, ctx);
+
+          nmod_mpoly_mul_johnson(f, f, g, ctx);
+          nmod_mpoly_test(f, ctx);
+
+          result = nmod_mpoly_equal(h, f, ctx);
+
+          if (!result)
+          {
+             printf("FAIL\n");
+
+             printf("Aliasing test1\n");
+             printf("ord = "); mpoly_ordering_print(ord);
+             flint_printf(", n = %wu, len1 = %wd, exp_bound1 = %wd, "
+                    "len2 = %wd, exp_bound2 = %wd, nvars = %wd\n\n",
+                       modulus, len1, exp_bound1, len2, exp_bound2, nvars);
+
+             flint_abort();
+          }
+       }
+
+       nmod_mpoly_clear(f, ctx);
+       nmod_mpoly_clear(g, ctx);
+       nmod_mpoly_clear(h, ctx);
+    }
+
+    /* Check aliasing second argument */
+    for (i = 0; i < 10 * flint_test_multiplier(); i++)
+    {
+       nmod_mpoly_ctx_t ctx;
+       nmod_mpoly_t f, g, h;
+       ordering_t ord;
+       mp_limb_t modulus;
+       slong nvars, len1, len2, exp_bound1, exp_bound2;
+       slong exp_bits1, exp_bits2;
+
+       ord = mpoly_ordering_randtest(state);
+       nvars = n_randint(state, 10) + 1;
+       modulus = n_randtest_not_zero(state);
+
+       nmod_mpoly_ctx_init(ctx, nvars, ord, modulus);
+
+       nmod_mpoly_init(f, ctx);
+       nmod_mpoly_init(g, ctx);
+       nmod_mpoly_init(h, ctx);
+
+       len1 = n_randint(state, 100);
+       len2 = n_randint(state, 100);
+
+       exp_bits1 = n_randint(state, FLINT_BITS - 2 -
+                  mpoly_ordering_isdeg(ord)*FLINT_BIT_COUNT(nvars)) + 1;
+       exp_bits2 = n_randint(state, FLINT_BITS - 2 -
+                  mpoly_ordering_isdeg(ord)*FLINT_BIT_COUNT(nvars)) + 1;
+
+       exp_bound1 = n_randbits(state, exp_bits1);
+       exp_bound2 = n_randbits(state, exp_bits2);
+
+       for (j = 0; j < 4; j++)
+       {
+          nmod_mpoly_randtest(f, state, len1, exp_bound1, ctx);
+          nmod_mpoly_randtest(g, state, len2, exp_bound2, ctx);
+
+          nmod_mpoly_mul_johnson(h, f, g, ctx);
+          nmod_mpoly_test(h, ctx);
+
+          nmod_mpoly_mul_johnson(g, f, g, ctx);
+          nmod_mpoly_test(g, ctx);
+
+          result = nmod_mpoly_equal(h, g, ctx);
+
+          if (!result)
+          {
+             printf("FAIL\n");
+
+             printf("Aliasing test2\n");
+             printf("ord = "); mpoly_ordering_print(ord);
+             flint_printf(", n = %wu, len1 = %wd, exp_bound1 = %wd, "
+                    "len2 = %wd, exp_bound2 = %wd, nvars = %wd\n\n",
+                       modulus, len1, exp_bound1, len2, exp_bound2, nvars);
+
+             flint_abort();
+          }
+       }
+
+       nmod_mpoly_clear(f, ctx);
+       nmod_mpoly_clear(g, ctx);
+       nmod_mpoly_clear(h, ctx);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -130,6 +130,67 @@ typedef struct
 }
 nmod_poly_compose_mod_precomp_preinv_arg_t;
 
+/* Number theoretic transforms over word-size FFT primes  ******************/
+
+#if FLINT64
+#define NMOD_POLY_NTT_NUM_PRIMES 3
+#define NMOD_POLY_NTT_MAX_DEPTH 54
+#else
+#define NMOD_POLY_NTT_NUM_PRIMES 4
+#define NMOD_POLY_NTT_MAX_DEPTH 23
+#endif
+
+#define NMOD_POLY_NTT_CUTOFF 6000  /* mul: KS4 -> NTT (length of shorter) */
+
+/* transforms are not truncated, so they only pay off when nearly full */
+NMOD_POLY_INLINE
+int _nmod_poly_ntt_fill_ok(slong len_out)
+{
+    slong d = FLINT_CLOG2(len_out);
+
+    return d < 3 || len_out > (WORD(7) << (d - 3));
+}
+
+FLINT_DLL extern const mp_limb_t nmod_poly_ntt_primes[NMOD_POLY_NTT_NUM_PRIMES];
+FLINT_DLL extern const mp_limb_t nmod_poly_ntt_primitive_roots[NMOD_POLY_NTT_NUM_PRIMES];
+
+typedef struct
+{
+    nmod_t mod;
+    slong depth;
+    mp_ptr w;           /* w[m - 1 + j] = w_{2m}^j, m = 2^i < 2^depth, j < m */
+    mp_ptr w_pre;       /* Shoup precomputations for w */
+    mp_ptr winv;        /* inverse roots, same layout as w */
+    mp_ptr winv_pre;
+    mp_limb_t inv_len;  /* 2^-depth mod p */
+    mp_limb_t inv_len_pre;
+} nmod_poly_ntt_plan_struct;
+
+typedef nmod_poly_ntt_plan_struct nmod_poly_ntt_plan_t[1];
+
+typedef struct
+{
+    nmod_t mod;         /* modulus of the polynomials being multiplied */
+    slong depth;
+    slong num_primes;
+    nmod_poly_ntt_plan_struct plans[NMOD_POLY_NTT_NUM_PRIMES];
+    mp_limb_t crt_inv[NMOD_POLY_NTT_NUM_PRIMES][NMOD_POLY_NTT_NUM_PRIMES];
+    mp_limb_t crt_inv_pre[NMOD_POLY_NTT_NUM_PRIMES][NMOD_POLY_NTT_NUM_PRIMES];
+    mp_limb_t crt_pmod[NMOD_POLY_NTT_NUM_PRIMES];  /* p_i mod n */
+} nmod_poly_ntt_ctx_struct;
+
+typedef nmod_poly_ntt_ctx_struct nmod_poly_ntt_ctx_t[1];
+
+typedef struct
+{
+    nmod_poly_ntt_ctx_struct ctx;
+    mp_ptr coeffs[NMOD_POLY_NTT_NUM_PRIMES];
+    slong length;
+    slong max_len;
+} nmod_poly_ntt_precomp_struct;
+
+typedef nmod_poly_ntt_precomp_struct nmod_poly_ntt_precomp_t[1];
+
 /* zn_poly helper functions  ************************************************
 
 Copyright (C) 2007, 2008 David Harvey
@@ -526,6 +587,43 @@ FLINT_DLL void _nmod_poly_mullow_KS(mp_ptr out, mp_srcptr in1, slong len1,
 FLINT_DLL void nmod_poly_mullow_KS(nmod_poly_t res, const nmod_poly_t poly1, 
                              const nmod_poly_t poly2, mp_bitcnt_t bits, slong n);
 
+FLINT_DLL void nmod_poly_ntt_plan_init(nmod_poly_ntt_plan_t plan,
+                                              mp_limb_t p, mp_limb_t g, slong depth);
+
+FLINT_DLL void nmod_poly_ntt_plan_clear(nmod_poly_ntt_plan_t plan);
+
+FLINT_DLL void _nmod_poly_ntt(mp_ptr a, const nmod_poly_ntt_plan_t plan);
+
+FLINT_DLL void _nmod_poly_intt(mp_ptr a, const nmod_poly_ntt_plan_t plan);
+
+FLINT_DLL void nmod_poly_ntt_ctx_init(nmod_poly_ntt_ctx_t ctx,
+                                   slong len_out, slong len2, nmod_t mod);
+
+FLINT_DLL void nmod_poly_ntt_ctx_clear(nmod_poly_ntt_ctx_t ctx);
+
+FLINT_DLL void _nmod_poly_ntt_transform(mp_ptr * t, mp_srcptr poly, slong len,
+                                            const nmod_poly_ntt_ctx_t ctx);
+
+FLINT_DLL void _nmod_poly_ntt_pointwise_mul(mp_ptr * t, mp_ptr const * u,
+                                            const nmod_poly_ntt_ctx_t ctx);
+
+FLINT_DLL void _nmod_poly_ntt_crt(mp_ptr res, slong len, mp_ptr * t,
+                                            const nmod_poly_ntt_ctx_t ctx);
+
+FLINT_DLL void _nmod_poly_mul_ntt(mp_ptr res, mp_srcptr poly1, slong len1,
+                                       mp_srcptr poly2, slong len2, nmod_t mod);
+
+FLINT_DLL void nmod_poly_mul_ntt(nmod_poly_t res,
+                             const nmod_poly_t poly1, const nmod_poly_t poly2);
+
+FLINT_DLL void nmod_poly_ntt_precomp_init(nmod_poly_ntt_precomp_t pre,
+                                       const nmod_poly_t poly, slong max_len);
+
+FLINT_DLL void nmod_poly_ntt_precomp_clear(nmod_poly_ntt_precomp_t pre);
+
+FLINT_DLL void nmod_poly_mul_ntt_precomp(nmod_poly_t res,
+                     const nmod_poly_t poly, const nmod_poly_ntt_precomp_t pre);
+
 FLINT_DLL void _nmod_poly_mul(mp_ptr res, mp_srcptr poly1, slong len1, 
                                        mp_srcptr poly2, slong len2, nmod_t mod);
 
@@ -0,0 +1,97 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+/* Cooley-Tukey butterfly, inputs and outputs in [0, 4p) */
+#define NTT_DIT_BFLY(X, Y, W, W_PRE)     \
+    do {                                 \
+        mp_limb_t __u = (X), __v = (Y);  \
+        mp_limb_t __q, __lo;             \
+        __u = FLINT_MIN(__u, __u - p2);  \
+        umul_ppmm(__q, __lo, (W_PRE), __v); \
+        __v = (W)*__v - __q*p;           \
+        (X) = __u + __v;                 \
+        (Y) = __u - __v + p2;            \
+    } while (0)
+
+/*
+   Decimation in time inverse transform with Harvey's lazy reduction,
+   processing two layers per pass. Input in bit-reversed order with entries
+   in [0, 2p), output in natural order, fully reduced and not scaled by the
+   inverse of the length.
+*/
+void _nmod_poly_intt(mp_ptr a, const nmod_poly_ntt_plan_t plan)
+{
+    slong j, k, m, len = WORD(1) << plan->depth;
+    const mp_limb_t p = plan->mod.n, p2 = 2*p;
+    mp_limb_t a0, a1, a2, a3;
+    mp_ptr x;
+    mp_srcptr w1, w1_pre, w2, w2_pre;
+
+    m = 1;
+
+    /* an odd number of layers starts with one with trivial twiddle factors */
+    if (plan->depth & 1)
+    {
+        for (k = 0; k < len; k += 2)
+        {
+            a0 = a[k];
+            a1 = a[k + 1];
+
+            a[k] = a0 + a1;
+            a[k + 1] = a0 - a1 + p2;
+        }
+
+        m = 2;
+    }
+
+    for ( ; m < len; m *= 4)
+    {
+        w1 = plan->winv + m - 1;
+        w1_pre = plan->winv_pre + m - 1;
+        w2 = plan->winv + 2*m - 1;
+        w2_pre = plan->winv_pre + 2*m - 1;
+
+        for (k = 0; k < len; k += 4*m)
+        {
+            x = a + k;
+
+            for (j = 0; j < m; j++)
+            {
+                a0 = x[j];
+                a1 = x[j + m];
+                a2 = x[j + 2*m];
+                a3 = x[j + 3*m];
+
+                NTT_DIT_BFLY(a0, a1, w1[j], w1_pre[j]);
+                NTT_DIT_BFLY(a2, a3, w1[j], w1_pre[j]);
+                NTT_DIT_BFLY(a0, a2, w2[j], w2_pre[j]);
+                NTT_DIT_BFLY(a1, a3, w2[j + m], w2_pre[j + m]);
+
+                x[j] = a0;
+                x[j + m] = a1;
+                x[j + 2*m] = a2;
+                x[j + 3*m] = a3;
+            }
+        }
+    }
+
+    for (k = 0; k < len; k++)
+    {
+        a0 = a[k];
+        a0 = FLINT_MIN(a0, a0 - p2);
+        a[k] = FLINT_MIN(a0, a0 - p);
+    }
+}
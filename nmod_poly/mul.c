@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2010 William Hart
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -31,6 +32,8 @@ void _nmod_poly_mul(mp_ptr res, mp_srcptr poly1, slong len1,
 
     if (2 * bits + bits2 <= FLINT_BITS && len1 + len2 < 16)
         _nmod_poly_mul_classical(res, poly1, len1, poly2, len2, mod);
+    else if (len2 >= NMOD_POLY_NTT_CUTOFF && _nmod_poly_ntt_fill_ok(len1 + len2 - 1))
+        _nmod_poly_mul_ntt(res, poly1, len1, poly2, len2, mod);
     else if (bits * len2 > 2000)
         _nmod_poly_mul_KS4(res, poly1, len1, poly2, len2, mod);
     else if (bits * len2 > 200)
@@ -55,6 +58,8 @@ void nmod_poly_mul(nmod_poly_t res, const nmod_poly_t poly1, const nmod_poly_t p
 
     len_out = poly1->length + poly2->length - 1;
 
+    FLINT_MEMSTATS_PUSH_TAG("nmod_poly_mul");
+
     if (res == poly1 || res == poly2)
     {
         nmod_poly_t temp;
@@ -84,4 +89,6 @@ void nmod_poly_mul(nmod_poly_t res, const nmod_poly_t poly1, const nmod_poly_t p
 
     res->length = len_out;
     _nmod_poly_normalise(res);
+
+    FLINT_MEMSTATS_POP_TAG();
 }
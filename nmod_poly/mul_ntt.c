@@ -0,0 +1,94 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void _nmod_poly_mul_ntt(mp_ptr res, mp_srcptr poly1, slong len1,
+                                        mp_srcptr poly2, slong len2, nmod_t mod)
+{
+    nmod_poly_ntt_ctx_t ctx;
+    mp_ptr t[NMOD_POLY_NTT_NUM_PRIMES], u[NMOD_POLY_NTT_NUM_PRIMES];
+    slong i, n, len_out = len1 + len2 - 1;
+    int squaring = (poly1 == poly2 && len1 == len2);
+
+    nmod_poly_ntt_ctx_init(ctx, len_out, len2, mod);
+    n = WORD(1) << ctx->depth;
+
+    for (i = 0; i < ctx->num_primes; i++)
+    {
+        t[i] = _nmod_vec_init(n);
+        u[i] = squaring ? t[i] : _nmod_vec_init(n);
+    }
+
+    _nmod_poly_ntt_transform(t, poly1, len1, ctx);
+    if (!squaring)
+        _nmod_poly_ntt_transform(u, poly2, len2, ctx);
+
+    _nmod_poly_ntt_pointwise_mul(t, u, ctx);
+    _nmod_poly_ntt_crt(res, len_out, t, ctx);
+
+    for (i = 0; i < ctx->num_primes; i++)
+    {
+        _nmod_vec_clear(t[i]);
+        if (!squaring)
+            _nmod_vec_clear(u[i]);
+    }
+
+    nmod_poly_ntt_ctx_clear(ctx);
+}
+
+void nmod_poly_mul_ntt(nmod_poly_t res,
+                             const nmod_poly_t poly1, const nmod_poly_t poly2)
+{
+    slong len_out;
+
+    if ((poly1->length == 0) || (poly2->length == 0))
+    {
+        nmod_poly_zero(res);
+        return;
+    }
+
+    len_out = poly1->length + poly2->length - 1;
+
+    if (res == poly1 || res == poly2)
+    {
+        nmod_poly_t temp;
+        nmod_poly_init2_preinv(temp, poly1->mod.n, poly1->mod.ninv, len_out);
+        if (poly1->length >= poly2->length)
+            _nmod_poly_mul_ntt(temp->coeffs, poly1->coeffs, poly1->length,
+                              poly2->coeffs, poly2->length,
+                              poly1->mod);
+        else
+            _nmod_poly_mul_ntt(temp->coeffs, poly2->coeffs, poly2->length,
+                              poly1->coeffs, poly1->length,
+                              poly1->mod);
+        nmod_poly_swap(res, temp);
+        nmod_poly_clear(temp);
+    }
+    else
+    {
+        nmod_poly_fit_length(res, len_out);
+        if (poly1->length >= poly2->length)
+            _nmod_poly_mul_ntt(res->coeffs, poly1->coeffs, poly1->length,
+                              poly2->coeffs, poly2->length,
+                              poly1->mod);
+        else
+            _nmod_poly_mul_ntt(res->coeffs, poly2->coeffs, poly2->length,
+                              poly1->coeffs, poly1->length,
+                              poly1->mod);
+    }
+
+    res->length = len_out;
+    _nmod_poly_normalise(res);
+}
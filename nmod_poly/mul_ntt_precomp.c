@@ -0,0 +1,54 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void nmod_poly_mul_ntt_precomp(nmod_poly_t res,
+                      const nmod_poly_t poly, const nmod_poly_ntt_precomp_t pre)
+{
+    mp_ptr t[NMOD_POLY_NTT_NUM_PRIMES];
+    slong i, n, len = poly->length, len_out;
+
+    if (len > pre->max_len)
+    {
+        flint_printf("Exception (nmod_poly_mul_ntt_precomp). "
+                     "Length exceeds precomputed bound.\n");
+        flint_abort();
+    }
+
+    if (len == 0 || pre->length == 0)
+    {
+        nmod_poly_zero(res);
+        return;
+    }
+
+    len_out = len + pre->length - 1;
+    n = WORD(1) << pre->ctx.depth;
+
+    for (i = 0; i < pre->ctx.num_primes; i++)
+        t[i] = _nmod_vec_init(n);
+
+    _nmod_poly_ntt_transform(t, poly->coeffs, len, &pre->ctx);
+    _nmod_poly_ntt_pointwise_mul(t, pre->coeffs, &pre->ctx);
+
+    /* the input has been consumed, so res may alias poly */
+    nmod_poly_fit_length(res, len_out);
+    _nmod_poly_ntt_crt(res->coeffs, len_out, t, &pre->ctx);
+
+    for (i = 0; i < pre->ctx.num_primes; i++)
+        _nmod_vec_clear(t[i]);
+
+    res->length = len_out;
+    _nmod_poly_normalise(res);
+}
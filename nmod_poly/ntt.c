@@ -0,0 +1,90 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+/* Gentleman-Sande butterfly, inputs and outputs in [0, 2p) */
+#define NTT_DIF_BFLY(X, Y, W, W_PRE)     \
+    do {                                 \
+        mp_limb_t __u = (X), __v = (Y);  \
+        mp_limb_t __r, __q, __lo;        \
+        __r = __u + __v;                 \
+        (X) = FLINT_MIN(__r, __r - p2);  \
+        __r = __u - __v + p2;            \
+        umul_ppmm(__q, __lo, (W_PRE), __r); \
+        (Y) = (W)*__r - __q*p;           \
+    } while (0)
+
+/*
+   Decimation in frequency transform with Harvey's lazy reduction,
+   processing two layers per pass. Input in natural order with entries in
+   [0, 2p), output in bit-reversed order with entries in [0, 2p).
+*/
+void _nmod_poly_ntt(mp_ptr a, const nmod_poly_ntt_plan_t plan)
+{
+    slong j, k, m, h, len = WORD(1) << plan->depth;
+    const mp_limb_t p = plan->mod.n, p2 = 2*p;
+    mp_limb_t a0, a1, a2, a3;
+    mp_ptr x;
+    mp_srcptr w1, w1_pre, w2, w2_pre;
+
+    for (m = len/2; m >= 2; m /= 4)
+    {
+        h = m/2;
+
+        w1 = plan->w + m - 1;
+        w1_pre = plan->w_pre + m - 1;
+        w2 = plan->w + h - 1;
+        w2_pre = plan->w_pre + h - 1;
+
+        for (k = 0; k < len; k += 2*m)
+        {
+            x = a + k;
+
+            for (j = 0; j < h; j++)
+            {
+                a0 = x[j];
+                a1 = x[j + h];
+                a2 = x[j + m];
+                a3 = x[j + m + h];
+
+                NTT_DIF_BFLY(a0, a2, w1[j], w1_pre[j]);
+                NTT_DIF_BFLY(a1, a3, w1[j + h], w1_pre[j + h]);
+                NTT_DIF_BFLY(a0, a1, w2[j], w2_pre[j]);
+                NTT_DIF_BFLY(a2, a3, w2[j], w2_pre[j]);
+
+                x[j] = a0;
+                x[j + h] = a1;
+                x[j + m] = a2;
+                x[j + m + h] = a3;
+            }
+        }
+    }
+
+    /* an odd number of layers leaves one with trivial twiddle factors */
+    if (m == 1)
+    {
+        for (k = 0; k < len; k += 2)
+        {
+            a0 = a[k];
+            a1 = a[k + 1];
+
+            a2 = a0 + a1;
+            a[k] = FLINT_MIN(a2, a2 - p2);
+
+            a2 = a0 - a1 + p2;
+            a[k + 1] = FLINT_MIN(a2, a2 - p2);
+        }
+    }
+}
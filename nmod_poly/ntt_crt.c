@@ -0,0 +1,64 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void _nmod_poly_ntt_crt(mp_ptr res, slong len, mp_ptr * t,
+                                            const nmod_poly_ntt_ctx_t ctx)
+{
+    slong i, j, k, num = ctx->num_primes;
+    mp_limb_t x, y, hi, lo, c[NMOD_POLY_NTT_NUM_PRIMES];
+
+    for (i = 0; i < num; i++)
+        _nmod_poly_intt(t[i], ctx->plans + i);
+
+    for (k = 0; k < len; k++)
+    {
+        /*
+           Garner: write the integer coefficient in mixed radix
+           c_0 + p_0 (c_1 + p_1 (c_2 + ...)) with 0 <= c_i < p_i
+        */
+        for (i = 0; i < num; i++)
+        {
+            const mp_limb_t p = ctx->plans[i].mod.n;
+
+            x = t[i][k];
+
+            for (j = 0; j < i; j++)
+            {
+                y = c[j];
+                while (y >= p)
+                    y -= p;
+                x = n_submod(x, y, p);
+                x = n_mulmod_shoup(ctx->crt_inv[i][j], x,
+                                                ctx->crt_inv_pre[i][j], p);
+            }
+
+            c[i] = x;
+        }
+
+        /* Horner evaluation of the mixed radix representation mod n */
+        NMOD_RED(x, c[num - 1], ctx->mod);
+
+        for (i = num - 2; i >= 0; i--)
+        {
+            umul_ppmm(hi, lo, x, ctx->crt_pmod[i]);
+            add_ssaaaa(hi, lo, hi, lo, UWORD(0), c[i]);
+            NMOD_RED2(x, hi, lo, ctx->mod);
+        }
+
+        res[k] = x;
+    }
+}
@@ -0,0 +1,60 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void nmod_poly_ntt_ctx_init(nmod_poly_ntt_ctx_t ctx,
+                                    slong len_out, slong len2, nmod_t mod)
+{
+    slong i, j, depth;
+    mp_bitcnt_t bits, pbits;
+    mp_limb_t p, r;
+
+    depth = FLINT_CLOG2(len_out);
+
+    if (depth > NMOD_POLY_NTT_MAX_DEPTH)
+    {
+        flint_printf("Exception (nmod_poly_ntt_ctx_init). Length too large.\n");
+        flint_abort();
+    }
+
+    /* coefficients of the integer product are bounded by len2*(n - 1)^2 */
+    bits = 2*(FLINT_BITS - mod.norm) + FLINT_BIT_COUNT(len2);
+
+    ctx->mod = mod;
+    ctx->depth = depth;
+    ctx->num_primes = 0;
+
+    for (pbits = 0; pbits < bits; ctx->num_primes++)
+        pbits += FLINT_BIT_COUNT(nmod_poly_ntt_primes[ctx->num_primes]) - 1;
+
+    for (i = 0; i < ctx->num_primes; i++)
+    {
+        p = nmod_poly_ntt_primes[i];
+
+        nmod_poly_ntt_plan_init(ctx->plans + i, p,
+                                      nmod_poly_ntt_primitive_roots[i], depth);
+
+        /* Garner constants p_j^-1 mod p_i for j < i */
+        for (j = 0; j < i; j++)
+        {
+            NMOD_RED(r, nmod_poly_ntt_primes[j], ctx->plans[i].mod);
+            ctx->crt_inv[i][j] = nmod_inv(r, ctx->plans[i].mod);
+            ctx->crt_inv_pre[i][j] = n_mulmod_precomp_shoup(ctx->crt_inv[i][j], p);
+        }
+
+        NMOD_RED(ctx->crt_pmod[i], p, mod);
+    }
+}
@@ -0,0 +1,23 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void nmod_poly_ntt_plan_clear(nmod_poly_ntt_plan_t plan)
+{
+    _nmod_vec_clear(plan->w);
+    _nmod_vec_clear(plan->w_pre);
+    _nmod_vec_clear(plan->winv);
+    _nmod_vec_clear(plan->winv_pre);
+}
@@ -0,0 +1,55 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void nmod_poly_ntt_plan_init(nmod_poly_ntt_plan_t plan,
+                                               mp_limb_t p, mp_limb_t g, slong depth)
+{
+    slong i, j, m, len = WORD(1) << depth;
+    mp_limb_t w, winv, x, xinv;
+
+    nmod_init(&plan->mod, p);
+    plan->depth = depth;
+
+    plan->w = _nmod_vec_init(len);
+    plan->w_pre = _nmod_vec_init(len);
+    plan->winv = _nmod_vec_init(len);
+    plan->winv_pre = _nmod_vec_init(len);
+
+    /* roots of unity of order 2m are stored contiguously from index m - 1 */
+    for (i = 0; i < depth; i++)
+    {
+        m = WORD(1) << i;
+
+        w = nmod_pow_ui(g, (p - 1) >> (i + 1), plan->mod);
+        winv = nmod_inv(w, plan->mod);
+
+        x = xinv = 1;
+        for (j = 0; j < m; j++)
+        {
+            plan->w[m - 1 + j] = x;
+            plan->w_pre[m - 1 + j] = n_mulmod_precomp_shoup(x, p);
+            plan->winv[m - 1 + j] = xinv;
+            plan->winv_pre[m - 1 + j] = n_mulmod_precomp_shoup(xinv, p);
+
+            x = nmod_mul(x, w, plan->mod);
+            xinv = nmod_mul(xinv, winv, plan->mod);
+        }
+    }
+
+    plan->inv_len = nmod_inv(nmod_pow_ui(2, depth, plan->mod), plan->mod);
+    plan->inv_len_pre = n_mulmod_precomp_shoup(plan->inv_len, p);
+}
@@ -0,0 +1,45 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void _nmod_poly_ntt_pointwise_mul(mp_ptr * t, mp_ptr const * u,
+                                            const nmod_poly_ntt_ctx_t ctx)
+{
+    slong i, k, n = WORD(1) << ctx->depth;
+    mp_limb_t a, b, hi, lo;
+
+    for (i = 0; i < ctx->num_primes; i++)
+    {
+        const nmod_t p = ctx->plans[i].mod;
+        const mp_limb_t c = ctx->plans[i].inv_len;
+        const mp_limb_t c_pre = ctx->plans[i].inv_len_pre;
+
+        /* entries are lazily reduced in [0, 2p) */
+        for (k = 0; k < n; k++)
+        {
+            a = t[i][k];
+            b = u[i][k];
+            if (a >= p.n)
+                a -= p.n;
+            if (b >= p.n)
+                b -= p.n;
+
+            umul_ppmm(hi, lo, a, b);
+            NMOD_RED2(a, hi, lo, p);
+            t[i][k] = n_mulmod_shoup(c, a, c_pre, p.n);
+        }
+    }
+}
@@ -0,0 +1,41 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void nmod_poly_ntt_precomp_init(nmod_poly_ntt_precomp_t pre,
+                                        const nmod_poly_t poly, slong max_len)
+{
+    slong i, n, len = poly->length;
+
+    pre->length = len;
+    pre->max_len = max_len;
+
+    if (len == 0 || max_len <= 0)
+    {
+        pre->ctx.mod = poly->mod;
+        pre->ctx.depth = 0;
+        pre->ctx.num_primes = 0;
+        return;
+    }
+
+    nmod_poly_ntt_ctx_init(&pre->ctx, len + max_len - 1,
+                                         FLINT_MIN(len, max_len), poly->mod);
+    n = WORD(1) << pre->ctx.depth;
+
+    for (i = 0; i < pre->ctx.num_primes; i++)
+        pre->coeffs[i] = _nmod_vec_init(n);
+
+    _nmod_poly_ntt_transform(pre->coeffs, poly->coeffs, len, &pre->ctx);
+}
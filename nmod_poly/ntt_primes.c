@@ -0,0 +1,51 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_poly.h"
+
+/*
+   Primes p < 2^(FLINT_BITS - 2) of the form c*2^k + 1 with large k, in
+   decreasing order, together with a primitive root modulo each. The bound
+   on p allows the transforms to keep values lazily reduced in [0, 4p).
+*/
+
+#if FLINT64
+
+const mp_limb_t nmod_poly_ntt_primes[NMOD_POLY_NTT_NUM_PRIMES] =
+{
+    UWORD(4179340454199820289), /* 29*2^57 + 1 */
+    UWORD(3188548536178311169), /* 177*2^54 + 1 */
+    UWORD(2936346957045563393)  /* 163*2^54 + 1 */
+};
+
+const mp_limb_t nmod_poly_ntt_primitive_roots[NMOD_POLY_NTT_NUM_PRIMES] =
+{
+    UWORD(3), UWORD(7), UWORD(3)
+};
+
+#else
+
+const mp_limb_t nmod_poly_ntt_primes[NMOD_POLY_NTT_NUM_PRIMES] =
+{
+    UWORD(998244353), /* 119*2^23 + 1 */
+    UWORD(754974721), /* 45*2^24 + 1 */
+    UWORD(469762049), /* 7*2^26 + 1 */
+    UWORD(167772161)  /* 5*2^25 + 1 */
+};
+
+const mp_limb_t nmod_poly_ntt_primitive_roots[NMOD_POLY_NTT_NUM_PRIMES] =
+{
+    UWORD(3), UWORD(11), UWORD(3), UWORD(3)
+};
+
+#endif
@@ -0,0 +1,36 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+
+void _nmod_poly_ntt_transform(mp_ptr * t, mp_srcptr poly, slong len,
+                                            const nmod_poly_ntt_ctx_t ctx)
+{
+    slong i, k, n = WORD(1) << ctx->depth;
+
+    for (i = 0; i < ctx->num_primes; i++)
+    {
+        const nmod_t p = ctx->plans[i].mod;
+
+        if (ctx->mod.n <= p.n)
+            flint_mpn_copyi(t[i], poly, len);
+        else
+            for (k = 0; k < len; k++)
+                NMOD_RED(t[i][k], poly[k], p);
+
+        flint_mpn_zero(t[i] + len, n - len);
+
+        _nmod_poly_ntt(t[i], ctx->plans + i);
+    }
+}
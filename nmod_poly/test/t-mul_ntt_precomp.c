@@ -0,0 +1,108 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_poly.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, j, result;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_ntt_precomp....");
+    fflush(stdout);
+
+    /* Compare with mul, reusing the transformed operand */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t a1, a2, b, c;
+        nmod_poly_ntt_precomp_t pre;
+        slong max_len = n_randint(state, 300);
+        mp_limb_t n = n_randtest_not_zero(state);
+
+        nmod_poly_init(a1, n);
+        nmod_poly_init(a2, n);
+        nmod_poly_init(b, n);
+        nmod_poly_init(c, n);
+        nmod_poly_randtest(c, state, n_randint(state, 300));
+
+        nmod_poly_ntt_precomp_init(pre, c, max_len);
+
+        for (j = 0; j < 5; j++)
+        {
+            nmod_poly_randtest(b, state, n_randint(state, max_len + 1));
+
+            nmod_poly_mul(a1, b, c);
+            nmod_poly_mul_ntt_precomp(a2, b, pre);
+
+            result = (nmod_poly_equal(a1, a2));
+            if (!result)
+            {
+                flint_printf("FAIL:\n");
+                nmod_poly_print(a1), flint_printf("\n\n");
+                nmod_poly_print(a2), flint_printf("\n\n");
+                abort();
+            }
+        }
+
+        nmod_poly_ntt_precomp_clear(pre);
+
+        nmod_poly_clear(a1);
+        nmod_poly_clear(a2);
+        nmod_poly_clear(b);
+        nmod_poly_clear(c);
+    }
+
+    /* Check aliasing of res and poly */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        nmod_poly_t a, b, c;
+        nmod_poly_ntt_precomp_t pre;
+        mp_limb_t n = n_randtest_not_zero(state);
+
+        nmod_poly_init(a, n);
+        nmod_poly_init(b, n);
+        nmod_poly_init(c, n);
+        nmod_poly_randtest(b, state, n_randint(state, 100));
+        nmod_poly_randtest(c, state, n_randint(state, 100));
+
+        nmod_poly_ntt_precomp_init(pre, c, b->length);
+
+        nmod_poly_mul_ntt_precomp(a, b, pre);
+        nmod_poly_mul_ntt_precomp(b, b, pre);
+
+        result = (nmod_poly_equal(a, b));
+        if (!result)
+        {
+            flint_printf("FAIL (aliasing):\n");
+            nmod_poly_print(a), flint_printf("\n\n");
+            nmod_poly_print(b), flint_printf("\n\n");
+            abort();
+        }
+
+        nmod_poly_ntt_precomp_clear(pre);
+
+        nmod_poly_clear(a);
+        nmod_poly_clear(b);
+        nmod_poly_clear(c);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+    
+    flint_printf("PASS\n");
+    return 0;
+}
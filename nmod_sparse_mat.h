@@ -0,0 +1,187 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef NMOD_SPARSE_MAT_H
+#define NMOD_SPARSE_MAT_H
+
+#ifdef NMOD_SPARSE_MAT_INLINES_C
+#define NMOD_SPARSE_MAT_INLINE FLINT_DLL
+#else
+#define NMOD_SPARSE_MAT_INLINE static __inline__
+#endif
+
+#undef ulong
+#define ulong ulongxx /* interferes with system includes */
+#include <stdlib.h>
+#undef ulong
+#include <gmp.h>
+#define ulong mp_limb_t
+
+#include "flint.h"
+#include "longlong.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/*
+   Compressed sparse rows: the nonzero entries of row i are
+   entries[row_starts[i]], ..., entries[row_starts[i + 1] - 1], in
+   columns cols[row_starts[i]], ... which are strictly increasing.
+*/
+typedef struct
+{
+    mp_limb_t * entries;
+    slong * cols;
+    slong * row_starts;
+    slong r;
+    slong c;
+    slong nnz;
+    slong alloc;
+    nmod_t mod;
+}
+nmod_sparse_mat_struct;
+
+typedef nmod_sparse_mat_struct nmod_sparse_mat_t[1];
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_nrows(const nmod_sparse_mat_t mat)
+{
+   return mat->r;
+}
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_ncols(const nmod_sparse_mat_t mat)
+{
+   return mat->c;
+}
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_nnz(const nmod_sparse_mat_t mat)
+{
+   return mat->nnz;
+}
+
+NMOD_SPARSE_MAT_INLINE
+slong nmod_sparse_mat_row_nnz(const nmod_sparse_mat_t mat, slong i)
+{
+   return mat->row_starts[i + 1] - mat->row_starts[i];
+}
+
+/* Memory management */
+
+FLINT_DLL void nmod_sparse_mat_init(nmod_sparse_mat_t mat,
+                                            slong rows, slong cols, mp_limb_t n);
+FLINT_DLL void nmod_sparse_mat_clear(nmod_sparse_mat_t mat);
+FLINT_DLL void nmod_sparse_mat_fit_nnz(nmod_sparse_mat_t mat, slong nnz);
+FLINT_DLL void nmod_sparse_mat_swap(nmod_sparse_mat_t mat1,
+                                                     nmod_sparse_mat_t mat2);
+
+/* Assignment and conversions */
+
+FLINT_DLL void nmod_sparse_mat_zero(nmod_sparse_mat_t mat);
+FLINT_DLL void nmod_sparse_mat_set(nmod_sparse_mat_t mat,
+                                                const nmod_sparse_mat_t src);
+FLINT_DLL void nmod_sparse_mat_set_entries(nmod_sparse_mat_t mat,
+        const slong * rows, const slong * cols, mp_srcptr vals, slong nnz);
+FLINT_DLL mp_limb_t nmod_sparse_mat_get_entry(const nmod_sparse_mat_t mat,
+                                                           slong i, slong j);
+FLINT_DLL void nmod_sparse_mat_set_nmod_mat(nmod_sparse_mat_t mat,
+                                                           const nmod_mat_t A);
+FLINT_DLL void nmod_sparse_mat_get_nmod_mat(nmod_mat_t A,
+                                                const nmod_sparse_mat_t mat);
+FLINT_DLL void nmod_sparse_mat_transpose(nmod_sparse_mat_t B,
+                                                  const nmod_sparse_mat_t A);
+
+/* Comparison */
+
+FLINT_DLL int nmod_sparse_mat_equal(const nmod_sparse_mat_t mat1,
+                                               const nmod_sparse_mat_t mat2);
+
+/* Random generation */
+
+FLINT_DLL void nmod_sparse_mat_randtest(nmod_sparse_mat_t mat,
+                                       flint_rand_t state, slong row_nnz);
+
+/* Multiplication */
+
+/* minimum number of nonzero entries for products to use threads */
+#define NMOD_SPARSE_MAT_MUL_THREAD_CUTOFF 10000
+
+FLINT_DLL void _nmod_sparse_mat_row_ranges(slong * bounds,
+                                   const nmod_sparse_mat_t A, slong num);
+FLINT_DLL void nmod_sparse_mat_mul_vec(mp_ptr y, const nmod_sparse_mat_t A,
+                                                                 mp_srcptr x);
+FLINT_DLL void nmod_sparse_mat_mul_mat(nmod_mat_t Y,
+                                  const nmod_sparse_mat_t A, const nmod_mat_t X);
+
+/* Structured Gaussian elimination */
+
+/*
+   Sparse elimination stops, and the remaining rows are handed to dense
+   nmod_mat functions, once they have more than this proportion
+   (in percent) of nonzero entries.
+*/
+#define NMOD_SPARSE_MAT_DENSE_PERCENT 10
+
+/*
+   Larger blocks of remaining rows (counting all entries) are first
+   tried with block Lanczos rather than made dense.
+*/
+#define NMOD_SPARSE_MAT_DENSE_LIMIT (WORD(1) << 24)
+
+FLINT_DLL slong _nmod_sparse_mat_eliminate(nmod_sparse_mat_t P,
+                slong * pivots, nmod_sparse_mat_t D, slong * dcols,
+                slong * drows, slong * ndcols, const nmod_sparse_mat_t A);
+
+FLINT_DLL slong nmod_sparse_mat_rank(const nmod_sparse_mat_t A);
+FLINT_DLL slong nmod_sparse_mat_nullspace(nmod_mat_t X,
+                                                     const nmod_sparse_mat_t A);
+
+/* Block Lanczos */
+
+/* default block size, the least N >= MIN_BLOCK with N * bits(p) >= BITS */
+#define NMOD_SPARSE_MAT_LANCZOS_BITS 64
+#define NMOD_SPARSE_MAT_LANCZOS_MIN_BLOCK 4
+
+/* number of runs in a row without new kernel vectors before giving up */
+#define NMOD_SPARSE_MAT_LANCZOS_TRIES 3
+
+NMOD_SPARSE_MAT_INLINE
+slong _nmod_sparse_mat_lanczos_block_size(nmod_t mod)
+{
+   slong bits = FLINT_BIT_COUNT(mod.n);
+
+   return FLINT_MAX((NMOD_SPARSE_MAT_LANCZOS_BITS + bits - 1) / bits,
+                                        NMOD_SPARSE_MAT_LANCZOS_MIN_BLOCK);
+}
+
+FLINT_DLL slong _nmod_sparse_mat_lanczos_kernel(nmod_mat_t K, slong * dim,
+                   const nmod_sparse_mat_t A, slong N, flint_rand_t state);
+FLINT_DLL int nmod_sparse_mat_nullspace_lanczos(nmod_mat_t X,
+                                                    const nmod_sparse_mat_t A);
+FLINT_DLL slong nmod_sparse_mat_rank_lanczos(const nmod_sparse_mat_t A);
+FLINT_DLL int nmod_sparse_mat_solve_lanczos(mp_ptr x,
+                                     const nmod_sparse_mat_t A, mp_srcptr b);
+
+/* Wiedemann */
+
+FLINT_DLL int nmod_sparse_mat_solve_wiedemann(mp_ptr x,
+                                     const nmod_sparse_mat_t A, mp_srcptr b);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
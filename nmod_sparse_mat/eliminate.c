@@ -0,0 +1,418 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+typedef struct
+{
+    slong * cols;
+    mp_limb_t * vals;
+    slong len;
+    slong alloc;
+}
+_elim_row_t;
+
+/* rows that contain, or once contained, a column */
+typedef struct
+{
+    slong * rows;
+    slong len;
+    slong alloc;
+}
+_elim_col_t;
+
+/* binary heap of columns keyed by weight, with stale entries skipped */
+typedef struct
+{
+    slong * weight;
+    slong * col;
+    slong len;
+    slong alloc;
+}
+_elim_heap_t;
+
+static void
+_elim_row_fit(_elim_row_t * row, slong len)
+{
+    if (len > row->alloc)
+    {
+        slong alloc = FLINT_MAX(len, 2*row->alloc);
+
+        row->cols = flint_realloc(row->cols, alloc * sizeof(slong));
+        row->vals = flint_realloc(row->vals, alloc * sizeof(mp_limb_t));
+        row->alloc = alloc;
+    }
+}
+
+static void
+_elim_col_push(_elim_col_t * col, slong i)
+{
+    if (col->len == col->alloc)
+    {
+        col->alloc = FLINT_MAX(4, 2*col->alloc);
+        col->rows = flint_realloc(col->rows, col->alloc * sizeof(slong));
+    }
+
+    col->rows[col->len++] = i;
+}
+
+static void
+_elim_heap_push(_elim_heap_t * h, slong w, slong c)
+{
+    slong i;
+
+    if (h->len == h->alloc)
+    {
+        h->alloc = FLINT_MAX(16, 2*h->alloc);
+        h->weight = flint_realloc(h->weight, h->alloc * sizeof(slong));
+        h->col = flint_realloc(h->col, h->alloc * sizeof(slong));
+    }
+
+    for (i = h->len++; i > 0 && h->weight[(i - 1)/2] > w; i = (i - 1)/2)
+    {
+        h->weight[i] = h->weight[(i - 1)/2];
+        h->col[i] = h->col[(i - 1)/2];
+    }
+
+    h->weight[i] = w;
+    h->col[i] = c;
+}
+
+static void
+_elim_heap_pop(slong * w, slong * c, _elim_heap_t * h)
+{
+    slong i, j, lw, lc;
+
+    *w = h->weight[0];
+    *c = h->col[0];
+
+    lw = h->weight[--h->len];
+    lc = h->col[h->len];
+
+    for (i = 0; (j = 2*i + 1) < h->len; i = j)
+    {
+        if (j + 1 < h->len && h->weight[j + 1] < h->weight[j])
+            j++;
+
+        if (h->weight[j] >= lw)
+            break;
+
+        h->weight[i] = h->weight[j];
+        h->col[i] = h->col[j];
+    }
+
+    h->weight[i] = lw;
+    h->col[i] = lc;
+}
+
+/* position of column j in the row, or -1 */
+static slong
+_elim_row_find(const _elim_row_t * row, slong j)
+{
+    slong lo = 0, hi = row->len;
+
+    while (lo < hi)
+    {
+        slong mid = lo + (hi - lo) / 2;
+
+        if (row->cols[mid] < j)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    return (lo < row->len && row->cols[lo] == j) ? lo : -1;
+}
+
+slong
+_nmod_sparse_mat_eliminate(nmod_sparse_mat_t P, slong * pivots,
+                nmod_sparse_mat_t D, slong * dcols, slong * drows,
+                slong * ndcols, const nmod_sparse_mat_t A)
+{
+    slong r = A->r, c = A->c;
+    nmod_t mod = A->mod;
+    _elim_row_t * rows, tmp;
+    _elim_col_t * cols;
+    _elim_heap_t heap;
+    slong * weight, * cand, * cmap, * prows;
+    char * active, * pivoted, * mark;
+    slong i, j, k, t, w, num_piv, nnz;
+    slong active_rows, active_cols, active_nnz, cand_alloc;
+
+    rows = flint_malloc(FLINT_MAX(r, 1) * sizeof(_elim_row_t));
+    cols = flint_calloc(FLINT_MAX(c, 1), sizeof(_elim_col_t));
+    weight = flint_calloc(FLINT_MAX(c, 1), sizeof(slong));
+    active = flint_malloc(FLINT_MAX(r, 1));
+    pivoted = flint_calloc(FLINT_MAX(c, 1), 1);
+    mark = flint_calloc(FLINT_MAX(r, 1), 1);
+    prows = flint_malloc(FLINT_MAX(FLINT_MIN(r, c), 1) * sizeof(slong));
+
+    heap.weight = heap.col = NULL;
+    heap.len = heap.alloc = 0;
+    tmp.cols = NULL;
+    tmp.vals = NULL;
+    tmp.len = tmp.alloc = 0;
+    cand_alloc = 16;
+    cand = flint_malloc(cand_alloc * sizeof(slong));
+
+    active_rows = active_cols = active_nnz = 0;
+
+    for (i = 0; i < r; i++)
+    {
+        slong len = A->row_starts[i + 1] - A->row_starts[i];
+
+        rows[i].cols = NULL;
+        rows[i].vals = NULL;
+        rows[i].len = rows[i].alloc = 0;
+        _elim_row_fit(rows + i, len);
+
+        for (k = 0; k < len; k++)
+        {
+            j = A->cols[A->row_starts[i] + k];
+            rows[i].cols[k] = j;
+            rows[i].vals[k] = A->entries[A->row_starts[i] + k];
+            _elim_col_push(cols + j, i);
+            active_cols += (weight[j]++ == 0);
+        }
+
+        rows[i].len = len;
+        active[i] = (len > 0);
+        active_rows += active[i];
+        active_nnz += len;
+    }
+
+    for (j = 0; j < c; j++)
+        if (weight[j] > 0)
+            _elim_heap_push(&heap, weight[j], j);
+
+    num_piv = 0;
+
+    while (heap.len > 0)
+    {
+        slong p, num_cand, pos;
+        mp_limb_t inv;
+
+        /* the remaining rows are handed to dense elimination */
+        if ((double) active_nnz * 100 >
+                (double) NMOD_SPARSE_MAT_DENSE_PERCENT * active_rows * active_cols)
+            break;
+
+        _elim_heap_pop(&w, &j, &heap);
+
+        if (pivoted[j] || w != weight[j] || w == 0)
+            continue;
+
+        /* the active rows containing column j, the shortest as pivot */
+        num_cand = 0;
+        p = -1;
+        for (k = 0; k < cols[j].len; k++)
+        {
+            i = cols[j].rows[k];
+
+            if (!active[i] || mark[i] || _elim_row_find(rows + i, j) < 0)
+                continue;
+
+            mark[i] = 1;
+
+            if (num_cand == cand_alloc)
+            {
+                cand_alloc *= 2;
+                cand = flint_realloc(cand, cand_alloc * sizeof(slong));
+            }
+
+            cand[num_cand++] = i;
+
+            if (p < 0 || rows[i].len < rows[p].len)
+                p = i;
+        }
+
+        for (k = 0; k < num_cand; k++)
+            mark[cand[k]] = 0;
+
+        flint_free(cols[j].rows);
+        cols[j].rows = NULL;
+        cols[j].len = cols[j].alloc = 0;
+
+        pivoted[j] = 1;
+        pivots[num_piv] = j;
+        prows[num_piv++] = p;
+
+        active[p] = 0;
+        active_rows--;
+        active_nnz -= rows[p].len;
+        for (k = 0; k < rows[p].len; k++)
+            active_cols -= (--weight[rows[p].cols[k]] == 0);
+
+        pos = _elim_row_find(rows + p, j);
+        inv = n_invmod(rows[p].vals[pos], mod.n);
+
+        /* row_i -= (b / a) row_p, b and a their entries in column j */
+        for (t = 0; t < num_cand; t++)
+        {
+            _elim_row_t * ri, * rp = rows + p;
+            slong a, b, len;
+            mp_limb_t f;
+
+            i = cand[t];
+            if (i == p)
+                continue;
+
+            ri = rows + i;
+            f = nmod_neg(nmod_mul(ri->vals[_elim_row_find(ri, j)], inv, mod), mod);
+
+            _elim_row_fit(&tmp, ri->len + rp->len);
+
+            for (a = 0, b = 0, len = 0; a < ri->len || b < rp->len; )
+            {
+                if (b == rp->len || (a < ri->len && ri->cols[a] < rp->cols[b]))
+                {
+                    tmp.cols[len] = ri->cols[a];
+                    tmp.vals[len++] = ri->vals[a++];
+                }
+                else if (a == ri->len || rp->cols[b] < ri->cols[a])
+                {
+                    /* fill in */
+                    slong cb = rp->cols[b];
+
+                    tmp.cols[len] = cb;
+                    tmp.vals[len++] = nmod_mul(f, rp->vals[b++], mod);
+                    _elim_col_push(cols + cb, i);
+                    active_cols += (weight[cb]++ == 0);
+                }
+                else
+                {
+                    mp_limb_t v = nmod_add(ri->vals[a],
+                                        nmod_mul(f, rp->vals[b], mod), mod);
+
+                    if (v != 0)
+                    {
+                        tmp.cols[len] = ri->cols[a];
+                        tmp.vals[len++] = v;
+                    }
+                    else
+                        active_cols -= (--weight[ri->cols[a]] == 0);
+
+                    a++;
+                    b++;
+                }
+            }
+
+            active_nnz += len - ri->len;
+            tmp.len = len;
+
+            {
+                _elim_row_t s = *ri;
+                *ri = tmp;
+                tmp = s;
+            }
+
+            if (ri->len == 0)
+            {
+                active[i] = 0;
+                active_rows--;
+            }
+        }
+
+        for (k = 0; k < rows[p].len; k++)
+        {
+            slong cb = rows[p].cols[k];
+
+            if (!pivoted[cb] && weight[cb] > 0)
+                _elim_heap_push(&heap, weight[cb], cb);
+        }
+    }
+
+    /* pivot rows, in order */
+    for (k = 0, nnz = 0; k < num_piv; k++)
+        nnz += rows[prows[k]].len;
+
+    nmod_sparse_mat_fit_nnz(P, nnz);
+
+    for (k = 0, nnz = 0; k < num_piv; k++)
+    {
+        _elim_row_t * rp = rows + prows[k];
+
+        P->row_starts[k] = nnz;
+        for (t = 0; t < rp->len; t++)
+        {
+            P->cols[nnz] = rp->cols[t];
+            P->entries[nnz++] = rp->vals[t];
+        }
+    }
+
+    for (k = num_piv; k <= P->r; k++)
+        P->row_starts[k] = nnz;
+    P->nnz = nnz;
+
+    /* remaining rows, on the columns they still involve */
+    cmap = flint_malloc(FLINT_MAX(c, 1) * sizeof(slong));
+
+    for (j = 0, t = 0; j < c; j++)
+    {
+        if (!pivoted[j] && weight[j] > 0)
+        {
+            dcols[t] = j;
+            cmap[j] = t++;
+        }
+        else
+            cmap[j] = -1;
+    }
+
+    *ndcols = t;
+
+    nmod_sparse_mat_fit_nnz(D, active_nnz);
+
+    for (i = 0, k = 0, nnz = 0; i < r; i++)
+    {
+        if (!active[i])
+            continue;
+
+        D->row_starts[k++] = nnz;
+        for (t = 0; t < rows[i].len; t++)
+        {
+            D->cols[nnz] = cmap[rows[i].cols[t]];
+            D->entries[nnz++] = rows[i].vals[t];
+        }
+    }
+
+    *drows = k;
+
+    for ( ; k <= D->r; k++)
+        D->row_starts[k] = nnz;
+    D->nnz = nnz;
+
+    for (i = 0; i < r; i++)
+    {
+        flint_free(rows[i].cols);
+        flint_free(rows[i].vals);
+    }
+
+    for (j = 0; j < c; j++)
+        flint_free(cols[j].rows);
+
+    flint_free(rows);
+    flint_free(cols);
+    flint_free(weight);
+    flint_free(active);
+    flint_free(pivoted);
+    flint_free(mark);
+    flint_free(prows);
+    flint_free(heap.weight);
+    flint_free(heap.col);
+    flint_free(tmp.cols);
+    flint_free(tmp.vals);
+    flint_free(cand);
+    flint_free(cmap);
+
+    return num_piv;
+}
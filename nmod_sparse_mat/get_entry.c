@@ -0,0 +1,37 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+mp_limb_t
+nmod_sparse_mat_get_entry(const nmod_sparse_mat_t mat, slong i, slong j)
+{
+    slong lo = mat->row_starts[i], hi = mat->row_starts[i + 1];
+
+    /* binary search for column j */
+    while (lo < hi)
+    {
+        slong mid = lo + (hi - lo) / 2;
+
+        if (mat->cols[mid] < j)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+
+    if (lo < mat->row_starts[i + 1] && mat->cols[lo] == j)
+        return mat->entries[lo];
+
+    return 0;
+}
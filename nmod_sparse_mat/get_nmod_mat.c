@@ -0,0 +1,27 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_get_nmod_mat(nmod_mat_t A, const nmod_sparse_mat_t mat)
+{
+    slong i, k;
+
+    nmod_mat_zero(A);
+
+    for (i = 0; i < mat->r; i++)
+        for (k = mat->row_starts[i]; k < mat->row_starts[i + 1]; k++)
+            nmod_mat_entry(A, i, mat->cols[k]) = mat->entries[k];
+}
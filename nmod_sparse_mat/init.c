@@ -0,0 +1,29 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_init(nmod_sparse_mat_t mat, slong rows, slong cols, mp_limb_t n)
+{
+    mat->entries = NULL;
+    mat->cols = NULL;
+    mat->row_starts = flint_calloc(rows + 1, sizeof(slong));
+    mat->r = rows;
+    mat->c = cols;
+    mat->nnz = 0;
+    mat->alloc = 0;
+
+    nmod_init(&mat->mod, n);
+}
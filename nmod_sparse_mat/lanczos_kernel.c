@@ -0,0 +1,334 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+/*
+   Montgomery's choice of the columns S of V_i, given T = V_i^T B V_i and
+   the previous choice, the columns left out last time being taken first.
+   Gauss-Jordan elimination on [T | I] sets Winv = S (S^T T S)^-1 S^T.
+   Returns the number of columns chosen.
+*/
+static slong
+_lanczos_select(nmod_mat_t Winv, char * S, const nmod_mat_t T,
+                                            const char * Sprev, nmod_t mod)
+{
+    slong i, j, k, l, N = T->r, num = 0;
+    slong * c;
+    nmod_mat_t M;
+
+    c = flint_malloc(N * sizeof(slong));
+    nmod_mat_init(M, N, 2*N, mod.n);
+
+    for (i = 0; i < N; i++)
+    {
+        _nmod_vec_set(M->rows[i], T->rows[i], N);
+        M->rows[i][N + i] = 1;
+    }
+
+    for (i = 0, k = 0; i < N; i++)
+        if (!Sprev[i])
+            c[k++] = i;
+    for (i = 0; i < N; i++)
+        if (Sprev[i])
+            c[k++] = i;
+
+    for (j = 0; j < N; j++)
+    {
+        slong cj = c[j], col = cj;
+        mp_limb_t inv;
+
+        for (k = j; k < N && M->rows[c[k]][cj] == 0; k++) ;
+
+        S[cj] = (k < N);
+
+        if (k == N)
+        {
+            col = N + cj;
+            for (k = j; k < N && M->rows[c[k]][col] == 0; k++) ;
+
+            if (k == N)     /* not reached for a prime modulus */
+                continue;
+        }
+
+        MP_PTR_SWAP(M->rows[c[k]], M->rows[cj]);
+
+        inv = n_invmod(M->rows[cj][col], mod.n);
+        _nmod_vec_scalar_mul_nmod(M->rows[cj], M->rows[cj], 2*N, inv, mod);
+
+        for (l = 0; l < N; l++)
+        {
+            if (l != cj && M->rows[l][col] != 0)
+                _nmod_vec_scalar_addmul_nmod(M->rows[l], M->rows[cj], 2*N,
+                                   nmod_neg(M->rows[l][col], mod), mod);
+        }
+
+        if (S[cj])
+            num++;
+        else
+            _nmod_vec_zero(M->rows[cj], 2*N);
+    }
+
+    for (i = 0; i < N; i++)
+        _nmod_vec_set(Winv->rows[i], M->rows[i] + N, N);
+
+    nmod_mat_clear(M);
+    flint_free(c);
+
+    return num;
+}
+
+/* zeroes the columns of A which are not in S */
+static void
+_lanczos_mask(nmod_mat_t A, const char * S)
+{
+    slong i, j;
+
+    for (i = 0; i < A->r; i++)
+        for (j = 0; j < A->c; j++)
+            if (!S[j])
+                A->rows[i][j] = 0;
+}
+
+/* T = V^T W, Vt being space for the transpose of V */
+static void
+_lanczos_inner(nmod_mat_t T, nmod_mat_t Vt, const nmod_mat_t V,
+                                                         const nmod_mat_t W)
+{
+    nmod_mat_transpose(Vt, V);
+    nmod_mat_mul(T, Vt, W);
+}
+
+/* BV = Mt diag(delta) M V */
+static void
+_lanczos_apply(nmod_mat_t BV, nmod_mat_t tmp, const nmod_sparse_mat_t M,
+                const nmod_sparse_mat_t Mt, mp_srcptr delta, const nmod_mat_t V)
+{
+    slong i;
+
+    nmod_sparse_mat_mul_mat(tmp, M, V);
+
+    for (i = 0; i < M->r; i++)
+        _nmod_vec_scalar_mul_nmod(tmp->rows[i], tmp->rows[i], tmp->c,
+                                                          delta[i], M->mod);
+
+    nmod_sparse_mat_mul_mat(BV, Mt, tmp);
+}
+
+/*
+   Block Lanczos (Montgomery) on B = Mg^T D Mg, where Mg is A with its
+   columns scaled by random nonzero g_j and D is a random nonzero diagonal.
+   Starting from V_0 = B Y for a random block Y, it accumulates
+   X = sum_i V_i Winv_i V_i^T V_0, so that B (X - Y) vanishes when the
+   iteration ends with V_m = 0. Combinations of the columns of
+   [X - Y | V_m] killed by Mg give the kernel vectors.
+*/
+slong
+_nmod_sparse_mat_lanczos_kernel(nmod_mat_t K, slong * dim,
+                   const nmod_sparse_mat_t A, slong N, flint_rand_t state)
+{
+    slong r = A->r, c = A->c, i, j, iter, u;
+    nmod_t mod = A->mod;
+    nmod_sparse_mat_t Mg, Mgt;
+    mp_ptr gamma, delta;
+    nmod_mat_t Y, V0, X, V, Vp, Vpp, AV, Vt, tmp;
+    nmod_mat_t Winv, Winv1, Winv2, vAv, vAv1, vA2v, vA2v1;
+    nmod_mat_t vv0, T1, T2, D, E, F, Z, R, U, Uw;
+    char * S, * S1;
+
+    *dim = 0;
+
+    /* preconditioning */
+    gamma = _nmod_vec_init(FLINT_MAX(c, 1));
+    delta = _nmod_vec_init(FLINT_MAX(r, 1));
+
+    for (j = 0; j < c; j++)
+        gamma[j] = (mod.n == 1) ? 0 : 1 + n_randint(state, mod.n - 1);
+    for (i = 0; i < r; i++)
+        delta[i] = (mod.n == 1) ? 0 : 1 + n_randint(state, mod.n - 1);
+
+    nmod_sparse_mat_init(Mg, r, c, mod.n);
+    nmod_sparse_mat_init(Mgt, c, r, mod.n);
+    nmod_sparse_mat_set(Mg, A);
+    for (i = 0; i < Mg->nnz; i++)
+        Mg->entries[i] = nmod_mul(Mg->entries[i], gamma[Mg->cols[i]], mod);
+    nmod_sparse_mat_transpose(Mgt, Mg);
+
+    nmod_mat_init(Y, c, N, mod.n);
+    nmod_mat_init(V0, c, N, mod.n);
+    nmod_mat_init(X, c, N, mod.n);
+    nmod_mat_init(V, c, N, mod.n);
+    nmod_mat_init(Vp, c, N, mod.n);
+    nmod_mat_init(Vpp, c, N, mod.n);
+    nmod_mat_init(AV, c, N, mod.n);
+    nmod_mat_init(Vt, N, c, mod.n);
+    nmod_mat_init(tmp, r, N, mod.n);
+
+    nmod_mat_init(Winv, N, N, mod.n);
+    nmod_mat_init(Winv1, N, N, mod.n);
+    nmod_mat_init(Winv2, N, N, mod.n);
+    nmod_mat_init(vAv, N, N, mod.n);
+    nmod_mat_init(vAv1, N, N, mod.n);
+    nmod_mat_init(vA2v, N, N, mod.n);
+    nmod_mat_init(vA2v1, N, N, mod.n);
+    nmod_mat_init(vv0, N, N, mod.n);
+    nmod_mat_init(T1, N, N, mod.n);
+    nmod_mat_init(T2, N, N, mod.n);
+    nmod_mat_init(D, N, N, mod.n);
+    nmod_mat_init(E, N, N, mod.n);
+    nmod_mat_init(F, N, N, mod.n);
+
+    S = flint_malloc(N);
+    S1 = flint_malloc(N);
+    for (j = 0; j < N; j++)
+        S1[j] = 1;
+
+    for (i = 0; i < c; i++)
+        for (j = 0; j < N; j++)
+            Y->rows[i][j] = n_randint(state, mod.n);
+
+    _lanczos_apply(V0, tmp, Mg, Mgt, delta, Y);
+    nmod_mat_set(V, V0);
+
+    for (iter = 0; iter < c + 8; iter++)
+    {
+        _lanczos_apply(AV, tmp, Mg, Mgt, delta, V);
+        _lanczos_inner(vAv, Vt, V, AV);
+
+        if (nmod_mat_is_zero(vAv))
+            break;
+
+        _lanczos_inner(vA2v, Vt, AV, AV);
+
+        *dim += _lanczos_select(Winv, S, vAv, S1, mod);
+
+        /* X += V_i Winv_i V_i^T V_0 */
+        _lanczos_inner(vv0, Vt, V, V0);
+        nmod_mat_mul(T1, Winv, vv0);
+        nmod_mat_addmul(X, X, V, T1);
+
+        /* D = I - Winv_i (V_i^T B^2 V_i S_i S_i^T + V_i^T B V_i) */
+        nmod_mat_set(T1, vA2v);
+        _lanczos_mask(T1, S);
+        nmod_mat_add(T1, T1, vAv);
+        nmod_mat_mul(D, Winv, T1);
+        nmod_mat_neg(D, D);
+        for (j = 0; j < N; j++)
+            D->rows[j][j] = nmod_add(D->rows[j][j], 1, mod);
+
+        /* E = -Winv_{i-1} V_i^T B V_i S_i S_i^T */
+        nmod_mat_set(T1, vAv);
+        _lanczos_mask(T1, S);
+        nmod_mat_mul(E, Winv1, T1);
+        nmod_mat_neg(E, E);
+
+        /* F = -Winv_{i-2} (I - V_{i-1}^T B V_{i-1} Winv_{i-1})
+               (V_{i-1}^T B^2 V_{i-1} S_{i-1} S_{i-1}^T + V_{i-1}^T B V_{i-1})
+               S_i S_i^T */
+        nmod_mat_mul(T1, vAv1, Winv1);
+        nmod_mat_neg(T1, T1);
+        for (j = 0; j < N; j++)
+            T1->rows[j][j] = nmod_add(T1->rows[j][j], 1, mod);
+        nmod_mat_set(T2, vA2v1);
+        _lanczos_mask(T2, S1);
+        nmod_mat_add(T2, T2, vAv1);
+        nmod_mat_mul(F, T1, T2);
+        _lanczos_mask(F, S);
+        nmod_mat_mul(T1, Winv2, F);
+        nmod_mat_neg(F, T1);
+
+        /* V_{i+1} = B V_i S_i S_i^T + V_i D + V_{i-1} E + V_{i-2} F */
+        _lanczos_mask(AV, S);
+        nmod_mat_addmul(AV, AV, V, D);
+        nmod_mat_addmul(AV, AV, Vp, E);
+        nmod_mat_addmul(AV, AV, Vpp, F);
+
+        nmod_mat_swap(Vpp, Vp);
+        nmod_mat_swap(Vp, V);
+        nmod_mat_swap(V, AV);
+
+        nmod_mat_swap(Winv2, Winv1);
+        nmod_mat_swap(Winv1, Winv);
+        nmod_mat_swap(vAv1, vAv);
+        nmod_mat_swap(vA2v1, vA2v);
+        for (j = 0; j < N; j++)
+            S1[j] = S[j];
+    }
+
+    /* kernel vectors of Mg among the combinations of [X - Y | V_m] */
+    nmod_mat_init(Z, c, 2*N, mod.n);
+    nmod_mat_init(R, r, 2*N, mod.n);
+    nmod_mat_init(U, 2*N, 2*N, mod.n);
+
+    for (i = 0; i < c; i++)
+    {
+        _nmod_vec_sub(Z->rows[i], X->rows[i], Y->rows[i], N, mod);
+        _nmod_vec_set(Z->rows[i] + N, V->rows[i], N);
+    }
+
+    nmod_sparse_mat_mul_mat(R, Mg, Z);
+    u = nmod_mat_nullspace(U, R);
+
+    nmod_mat_clear(K);
+    nmod_mat_init(K, c, u, mod.n);
+
+    if (u > 0)
+    {
+        nmod_mat_window_init(Uw, U, 0, 0, 2*N, u);
+        nmod_mat_mul(K, Z, Uw);
+        nmod_mat_window_clear(Uw);
+
+        /* back to the columns of A */
+        for (i = 0; i < c; i++)
+            _nmod_vec_scalar_mul_nmod(K->rows[i], K->rows[i], u,
+                                                             gamma[i], mod);
+    }
+
+    nmod_mat_clear(Z);
+    nmod_mat_clear(R);
+    nmod_mat_clear(U);
+
+    flint_free(S);
+    flint_free(S1);
+
+    nmod_mat_clear(Y);
+    nmod_mat_clear(V0);
+    nmod_mat_clear(X);
+    nmod_mat_clear(V);
+    nmod_mat_clear(Vp);
+    nmod_mat_clear(Vpp);
+    nmod_mat_clear(AV);
+    nmod_mat_clear(Vt);
+    nmod_mat_clear(tmp);
+
+    nmod_mat_clear(Winv);
+    nmod_mat_clear(Winv1);
+    nmod_mat_clear(Winv2);
+    nmod_mat_clear(vAv);
+    nmod_mat_clear(vAv1);
+    nmod_mat_clear(vA2v);
+    nmod_mat_clear(vA2v1);
+    nmod_mat_clear(vv0);
+    nmod_mat_clear(T1);
+    nmod_mat_clear(T2);
+    nmod_mat_clear(D);
+    nmod_mat_clear(E);
+    nmod_mat_clear(F);
+
+    nmod_sparse_mat_clear(Mg);
+    nmod_sparse_mat_clear(Mgt);
+    _nmod_vec_clear(gamma);
+    _nmod_vec_clear(delta);
+
+    return u;
+}
@@ -0,0 +1,97 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+    nmod_mat_struct * Y;
+    const nmod_sparse_mat_struct * A;
+    const nmod_mat_struct * X;
+    slong i0;
+    slong i1;
+}
+_nmod_sparse_mat_mul_mat_arg_t;
+
+/* row i of Y is the combination of the rows of X given by row i of A */
+static void
+_nmod_sparse_mat_mul_mat_worker(void * arg_ptr)
+{
+    _nmod_sparse_mat_mul_mat_arg_t * arg =
+                              (_nmod_sparse_mat_mul_mat_arg_t *) arg_ptr;
+    const nmod_sparse_mat_struct * A = arg->A;
+    const nmod_mat_struct * X = arg->X;
+    slong i, k, n = X->c;
+
+    for (i = arg->i0; i < arg->i1; i++)
+    {
+        mp_ptr y = arg->Y->rows[i];
+
+        _nmod_vec_zero(y, n);
+
+        for (k = A->row_starts[i]; k < A->row_starts[i + 1]; k++)
+            _nmod_vec_scalar_addmul_nmod(y, X->rows[A->cols[k]], n,
+                                                     A->entries[k], A->mod);
+    }
+}
+
+void
+nmod_sparse_mat_mul_mat(nmod_mat_t Y, const nmod_sparse_mat_t A,
+                                                        const nmod_mat_t X)
+{
+    _nmod_sparse_mat_mul_mat_arg_t * args;
+    slong i, num_threads, * bounds;
+
+    if (X == Y)
+    {
+        nmod_mat_t T;
+        nmod_mat_init(T, Y->r, Y->c, Y->mod.n);
+        nmod_sparse_mat_mul_mat(T, A, X);
+        nmod_mat_swap(T, Y);
+        nmod_mat_clear(T);
+        return;
+    }
+
+    if (Y->c == 0)
+        return;
+
+    num_threads = flint_get_num_threads();
+    if ((double) A->nnz * X->c < NMOD_SPARSE_MAT_MUL_THREAD_CUTOFF)
+        num_threads = 1;
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads, A->r));
+
+    args = flint_malloc(sizeof(_nmod_sparse_mat_mul_mat_arg_t) * num_threads);
+    bounds = flint_malloc(sizeof(slong) * (num_threads + 1));
+
+    /* split the rows so that each thread gets as many entries */
+    _nmod_sparse_mat_row_ranges(bounds, A, num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].Y = Y;
+        args[i].A = A;
+        args[i].X = X;
+        args[i].i0 = bounds[i];
+        args[i].i1 = bounds[i + 1];
+    }
+
+    if (num_threads == 1)
+        _nmod_sparse_mat_mul_mat_worker(args);
+    else
+        flint_parallel_do(_nmod_sparse_mat_mul_mat_worker, args, num_threads,
+                       sizeof(_nmod_sparse_mat_mul_mat_arg_t), num_threads);
+
+    flint_free(args);
+    flint_free(bounds);
+}
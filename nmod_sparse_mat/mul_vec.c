@@ -0,0 +1,87 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+    mp_ptr y;
+    const nmod_sparse_mat_struct * A;
+    mp_srcptr x;
+    slong i0;
+    slong i1;
+}
+_nmod_sparse_mat_mul_vec_arg_t;
+
+/* each row is a dot product accumulated in three limbs */
+static void
+_nmod_sparse_mat_mul_vec_worker(void * arg_ptr)
+{
+    _nmod_sparse_mat_mul_vec_arg_t * arg =
+                              (_nmod_sparse_mat_mul_vec_arg_t *) arg_ptr;
+    const nmod_sparse_mat_struct * A = arg->A;
+    nmod_t mod = A->mod;
+    slong i, k;
+
+    for (i = arg->i0; i < arg->i1; i++)
+    {
+        mp_limb_t a2 = 0, a1 = 0, a0 = 0, hi, lo;
+
+        for (k = A->row_starts[i]; k < A->row_starts[i + 1]; k++)
+        {
+            umul_ppmm(hi, lo, A->entries[k], arg->x[A->cols[k]]);
+            add_sssaaaaaa(a2, a1, a0, a2, a1, a0, 0, hi, lo);
+        }
+
+        if (a2 >= mod.n)
+            NMOD_RED(a2, a2, mod);
+        NMOD_RED3(arg->y[i], a2, a1, a0, mod);
+    }
+}
+
+void
+nmod_sparse_mat_mul_vec(mp_ptr y, const nmod_sparse_mat_t A, mp_srcptr x)
+{
+    _nmod_sparse_mat_mul_vec_arg_t * args;
+    slong i, num_threads, * bounds;
+
+    num_threads = flint_get_num_threads();
+    if (A->nnz < NMOD_SPARSE_MAT_MUL_THREAD_CUTOFF)
+        num_threads = 1;
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads, A->r));
+
+    args = flint_malloc(sizeof(_nmod_sparse_mat_mul_vec_arg_t) * num_threads);
+    bounds = flint_malloc(sizeof(slong) * (num_threads + 1));
+
+    /* split the rows so that each thread gets as many entries */
+    _nmod_sparse_mat_row_ranges(bounds, A, num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].y = y;
+        args[i].A = A;
+        args[i].x = x;
+        args[i].i0 = bounds[i];
+        args[i].i1 = bounds[i + 1];
+    }
+
+    if (num_threads == 1)
+        _nmod_sparse_mat_mul_vec_worker(args);
+    else
+        flint_parallel_do(_nmod_sparse_mat_mul_vec_worker, args, num_threads,
+                       sizeof(_nmod_sparse_mat_mul_vec_arg_t), num_threads);
+
+    flint_free(args);
+    flint_free(bounds);
+}
@@ -0,0 +1,137 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+/* solves the pivot rows for their pivot variables, last pivot first */
+static void
+_nmod_sparse_mat_back_substitute(mp_ptr v, const nmod_sparse_mat_t P,
+                                               const slong * pivots, slong k)
+{
+    slong i, t;
+
+    for (i = k - 1; i >= 0; i--)
+    {
+        mp_limb_t s = 0, a = 0;
+
+        for (t = P->row_starts[i]; t < P->row_starts[i + 1]; t++)
+        {
+            if (P->cols[t] == pivots[i])
+                a = P->entries[t];
+            else
+                s = nmod_add(s, nmod_mul(P->entries[t], v[P->cols[t]],
+                                                           P->mod), P->mod);
+        }
+
+        v[pivots[i]] = nmod_neg(nmod_mul(s, n_invmod(a, P->mod.n), P->mod),
+                                                                     P->mod);
+    }
+}
+
+slong
+nmod_sparse_mat_nullspace(nmod_mat_t X, const nmod_sparse_mat_t A)
+{
+    nmod_sparse_mat_t P, D;
+    nmod_mat_t Dd, Xd;
+    slong * pivots, * dcols;
+    char * bound;
+    mp_ptr v;
+    slong i, j, k, t, m, d, nd, nullity, col;
+    int lanczos = 0;
+
+    nmod_sparse_mat_init(P, A->r, A->c, A->mod.n);
+    nmod_sparse_mat_init(D, A->r, A->c, A->mod.n);
+    pivots = flint_malloc(FLINT_MAX(FLINT_MIN(A->r, A->c), 1) * sizeof(slong));
+    dcols = flint_malloc(FLINT_MAX(A->c, 1) * sizeof(slong));
+
+    k = _nmod_sparse_mat_eliminate(P, pivots, D, dcols, &m, &d, A);
+
+    /* kernel of the remaining rows on the columns they involve */
+    nmod_mat_init(Xd, d, d, A->mod.n);
+
+    if ((double) m * d > NMOD_SPARSE_MAT_DENSE_LIMIT)
+    {
+        D->r = m;
+        D->c = d;
+
+        lanczos = nmod_sparse_mat_nullspace_lanczos(Xd, D);
+    }
+
+    if (lanczos)
+        nd = Xd->c;
+    else
+    {
+        nmod_mat_clear(Xd);
+        nmod_mat_init(Xd, d, d, A->mod.n);
+        nmod_mat_init(Dd, m, d, A->mod.n);
+
+        for (i = 0; i < m; i++)
+            for (t = D->row_starts[i]; t < D->row_starts[i + 1]; t++)
+                nmod_mat_entry(Dd, i, D->cols[t]) = D->entries[t];
+
+        nd = (d > 0) ? nmod_mat_nullspace(Xd, Dd) : 0;
+
+        nmod_mat_clear(Dd);
+    }
+
+    nullity = A->c - k - (d - nd);
+
+    nmod_mat_clear(X);
+    nmod_mat_init(X, A->c, nullity, A->mod.n);
+
+    /* columns which are neither pivots nor in the dense part are free */
+    bound = flint_calloc(FLINT_MAX(A->c, 1), 1);
+    for (i = 0; i < k; i++)
+        bound[pivots[i]] = 1;
+    for (i = 0; i < d; i++)
+        bound[dcols[i]] = 1;
+
+    v = _nmod_vec_init(A->c);
+    col = 0;
+
+    for (j = 0; j < A->c; j++)
+    {
+        if (bound[j])
+            continue;
+
+        _nmod_vec_zero(v, A->c);
+        v[j] = 1;
+        _nmod_sparse_mat_back_substitute(v, P, pivots, k);
+
+        for (i = 0; i < A->c; i++)
+            nmod_mat_entry(X, i, col) = v[i];
+        col++;
+    }
+
+    for (t = 0; t < nd; t++)
+    {
+        _nmod_vec_zero(v, A->c);
+        for (i = 0; i < d; i++)
+            v[dcols[i]] = nmod_mat_entry(Xd, i, t);
+        _nmod_sparse_mat_back_substitute(v, P, pivots, k);
+
+        for (i = 0; i < A->c; i++)
+            nmod_mat_entry(X, i, col) = v[i];
+        col++;
+    }
+
+    _nmod_vec_clear(v);
+    flint_free(bound);
+    nmod_mat_clear(Xd);
+    nmod_sparse_mat_clear(P);
+    nmod_sparse_mat_clear(D);
+    flint_free(pivots);
+    flint_free(dcols);
+
+    return nullity;
+}
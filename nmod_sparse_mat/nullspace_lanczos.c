@@ -0,0 +1,98 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+/*
+   Kernel vectors from independent block Lanczos runs are kept in echelon
+   form: vector k is normalised at its pivot and vanishes at the pivots of
+   the earlier vectors. Each run also bounds the rank from below by the
+   dimension of its Krylov space, and the basis is complete once the two
+   bounds meet. A run can find at most about 2N new vectors, so the block
+   size is doubled whenever it finds N of them.
+*/
+int
+nmod_sparse_mat_nullspace_lanczos(nmod_mat_t X, const nmod_sparse_mat_t A)
+{
+    slong c = A->c, i, j, k, t, u, dim, rank_lower = 0, num = 0, alloc = 0;
+    slong N, stall = 0, * piv = NULL;
+    mp_ptr * vecs = NULL, v;
+    nmod_t mod = A->mod;
+    flint_rand_t state;
+    nmod_mat_t K;
+
+    N = _nmod_sparse_mat_lanczos_block_size(mod);
+    flint_randinit(state);
+    nmod_mat_init(K, 0, 0, mod.n);
+    v = _nmod_vec_init(FLINT_MAX(c, 1));
+
+    while (rank_lower < c - num && stall < NMOD_SPARSE_MAT_LANCZOS_TRIES)
+    {
+        slong added = 0;
+
+        u = _nmod_sparse_mat_lanczos_kernel(K, &dim, A, N, state);
+        rank_lower = FLINT_MAX(rank_lower, dim);
+
+        for (t = 0; t < u; t++)
+        {
+            for (i = 0; i < c; i++)
+                v[i] = nmod_mat_entry(K, i, t);
+
+            for (k = 0; k < num; k++)
+                if (v[piv[k]] != 0)
+                    _nmod_vec_scalar_addmul_nmod(v, vecs[k], c,
+                                            nmod_neg(v[piv[k]], mod), mod);
+
+            for (j = 0; j < c && v[j] == 0; j++) ;
+
+            if (j == c)
+                continue;
+
+            if (num == alloc)
+            {
+                alloc = FLINT_MAX(2*alloc, 8);
+                vecs = flint_realloc(vecs, alloc * sizeof(mp_ptr));
+                piv = flint_realloc(piv, alloc * sizeof(slong));
+            }
+
+            vecs[num] = _nmod_vec_init(c);
+            _nmod_vec_scalar_mul_nmod(vecs[num], v, c,
+                                               n_invmod(v[j], mod.n), mod);
+            piv[num++] = j;
+            added++;
+        }
+
+        stall = (added == 0) ? stall + 1 : 0;
+
+        if (added >= N && 2*N <= c)
+            N *= 2;
+    }
+
+    nmod_mat_clear(X);
+    nmod_mat_init(X, c, num, mod.n);
+
+    for (k = 0; k < num; k++)
+    {
+        for (i = 0; i < c; i++)
+            nmod_mat_entry(X, i, k) = vecs[k][i];
+        _nmod_vec_clear(vecs[k]);
+    }
+
+    flint_free(vecs);
+    flint_free(piv);
+    _nmod_vec_clear(v);
+    nmod_mat_clear(K);
+    flint_randclear(state);
+
+    return rank_lower == c - num;
+}
@@ -0,0 +1,71 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdlib.h>
+#include <string.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_randtest(nmod_sparse_mat_t mat, flint_rand_t state,
+                                                              slong row_nnz)
+{
+    slong i, j, k, len, nnz;
+
+    /* there are no nonzero values modulo 1 */
+    if (mat->mod.n == 1)
+        row_nnz = 0;
+
+    row_nnz = FLINT_MIN(row_nnz, mat->c);
+    nmod_sparse_mat_fit_nnz(mat, mat->r * row_nnz);
+
+    nnz = 0;
+    for (i = 0; i < mat->r; i++)
+    {
+        mat->row_starts[i] = nnz;
+        len = n_randint(state, row_nnz + 1);
+
+        /* distinct random columns, kept in increasing order */
+        for (k = 0; k < len; k++)
+        {
+            slong c = n_randint(state, mat->c);
+
+            for (j = nnz; j < nnz + k && mat->cols[j] < c; j++) ;
+
+            if (j < nnz + k && mat->cols[j] == c)
+            {
+                len--;
+                k--;
+                continue;
+            }
+
+            memmove(mat->cols + j + 1, mat->cols + j,
+                                         (nnz + k - j) * sizeof(slong));
+            mat->cols[j] = c;
+        }
+
+        for (k = 0; k < len; k++)
+        {
+            mp_limb_t v;
+
+            do {
+                v = n_randtest(state) % mat->mod.n;
+            } while (v == 0);
+
+            mat->entries[nnz + k] = v;
+        }
+
+        nnz += len;
+    }
+
+    mat->row_starts[mat->r] = nnz;
+    mat->nnz = nnz;
+}
@@ -0,0 +1,60 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+slong
+nmod_sparse_mat_rank(const nmod_sparse_mat_t A)
+{
+    nmod_sparse_mat_t P, D;
+    nmod_mat_t Dd;
+    slong * pivots, * dcols;
+    slong i, k, rank, m, d, lrank = -1;
+
+    nmod_sparse_mat_init(P, A->r, A->c, A->mod.n);
+    nmod_sparse_mat_init(D, A->r, A->c, A->mod.n);
+    pivots = flint_malloc(FLINT_MAX(FLINT_MIN(A->r, A->c), 1) * sizeof(slong));
+    dcols = flint_malloc(FLINT_MAX(A->c, 1) * sizeof(slong));
+
+    rank = _nmod_sparse_mat_eliminate(P, pivots, D, dcols, &m, &d, A);
+
+    if (m > 0 && (double) m * d > NMOD_SPARSE_MAT_DENSE_LIMIT)
+    {
+        D->r = m;
+        D->c = d;
+
+        lrank = nmod_sparse_mat_rank_lanczos(D);
+    }
+
+    if (lrank >= 0)
+        rank += lrank;
+    else if (m > 0)
+    {
+        nmod_mat_init(Dd, m, d, A->mod.n);
+
+        for (i = 0; i < m; i++)
+            for (k = D->row_starts[i]; k < D->row_starts[i + 1]; k++)
+                nmod_mat_entry(Dd, i, D->cols[k]) = D->entries[k];
+
+        rank += nmod_mat_rank(Dd);
+
+        nmod_mat_clear(Dd);
+    }
+
+    nmod_sparse_mat_clear(P);
+    nmod_sparse_mat_clear(D);
+    flint_free(pivots);
+    flint_free(dcols);
+
+    return rank;
+}
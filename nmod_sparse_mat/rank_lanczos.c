@@ -0,0 +1,27 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+slong
+nmod_sparse_mat_rank_lanczos(const nmod_sparse_mat_t A)
+{
+    nmod_mat_t X;
+    slong rank;
+
+    nmod_mat_init(X, 0, 0, A->mod.n);
+    rank = nmod_sparse_mat_nullspace_lanczos(X, A) ? A->c - X->c : -1;
+    nmod_mat_clear(X);
+
+    return rank;
+}
@@ -0,0 +1,44 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+void
+_nmod_sparse_mat_row_ranges(slong * bounds, const nmod_sparse_mat_t A,
+                                                                   slong num)
+{
+    slong i;
+
+    bounds[0] = 0;
+
+    /* first row at which the prefix sum of row lengths reaches the target */
+    for (i = 1; i < num; i++)
+    {
+        slong lo = bounds[i - 1], hi = A->r;
+        slong target = (slong) (((double) A->nnz * i) / num);
+
+        while (lo < hi)
+        {
+            slong mid = lo + (hi - lo) / 2;
+
+            if (A->row_starts[mid] < target)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+
+        bounds[i] = lo;
+    }
+
+    bounds[num] = A->r;
+}
@@ -0,0 +1,37 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+void
+nmod_sparse_mat_set(nmod_sparse_mat_t mat, const nmod_sparse_mat_t src)
+{
+    slong i;
+
+    if (mat == src)
+        return;
+
+    nmod_sparse_mat_fit_nnz(mat, src->nnz);
+
+    for (i = 0; i <= src->r; i++)
+        mat->row_starts[i] = src->row_starts[i];
+
+    for (i = 0; i < src->nnz; i++)
+    {
+        mat->cols[i] = src->cols[i];
+        mat->entries[i] = src->entries[i];
+    }
+
+    mat->nnz = src->nnz;
+}
@@ -0,0 +1,109 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+typedef struct
+{
+    slong col;
+    mp_limb_t val;
+}
+_nmod_sparse_entry_t;
+
+static int
+_nmod_sparse_entry_cmp(const void * a, const void * b)
+{
+    slong x = ((const _nmod_sparse_entry_t *) a)->col;
+    slong y = ((const _nmod_sparse_entry_t *) b)->col;
+
+    return (x > y) - (x < y);
+}
+
+/*
+   The entries are bucketed by row with a counting sort and each row is
+   then sorted by column, repeated positions being added together.
+*/
+void
+nmod_sparse_mat_set_entries(nmod_sparse_mat_t mat, const slong * rows,
+                        const slong * cols, mp_srcptr vals, slong nnz)
+{
+    _nmod_sparse_entry_t * tmp;
+    slong i, k, * pos, len;
+
+    pos = flint_calloc(mat->r + 1, sizeof(slong));
+    tmp = flint_malloc(FLINT_MAX(nnz, 1) * sizeof(_nmod_sparse_entry_t));
+
+    for (k = 0; k < nnz; k++)
+    {
+        if (rows[k] < 0 || rows[k] >= mat->r || cols[k] < 0 || cols[k] >= mat->c)
+        {
+            flint_printf("Exception (nmod_sparse_mat_set_entries). "
+                         "Index out of range.\n");
+            flint_abort();
+        }
+
+        pos[rows[k] + 1]++;
+    }
+
+    for (i = 0; i < mat->r; i++)
+        pos[i + 1] += pos[i];
+
+    for (k = 0; k < nnz; k++)
+    {
+        slong j = pos[rows[k]]++;
+        mp_limb_t v;
+
+        NMOD_RED(v, vals[k], mat->mod);
+        tmp[j].col = cols[k];
+        tmp[j].val = v;
+    }
+
+    nmod_sparse_mat_fit_nnz(mat, nnz);
+
+    len = 0;
+    for (i = 0; i < mat->r; i++)
+    {
+        slong start = (i == 0) ? 0 : pos[i - 1], end = pos[i];
+
+        qsort(tmp + start, end - start, sizeof(_nmod_sparse_entry_t),
+                                                    _nmod_sparse_entry_cmp);
+
+        mat->row_starts[i] = len;
+
+        for (k = start; k < end; k++)
+        {
+            if (len > mat->row_starts[i] && mat->cols[len - 1] == tmp[k].col)
+                mat->entries[len - 1] = nmod_add(mat->entries[len - 1],
+                                                     tmp[k].val, mat->mod);
+            else
+            {
+                /* remove an entry that cancelled before appending */
+                if (len > mat->row_starts[i] && mat->entries[len - 1] == 0)
+                    len--;
+
+                mat->cols[len] = tmp[k].col;
+                mat->entries[len] = tmp[k].val;
+                len++;
+            }
+        }
+
+        if (len > mat->row_starts[i] && mat->entries[len - 1] == 0)
+            len--;
+    }
+
+    mat->row_starts[mat->r] = len;
+    mat->nnz = len;
+
+    flint_free(pos);
+    flint_free(tmp);
+}
@@ -0,0 +1,95 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+/*
+   A kernel vector (x, t) of [A | b] with t != 0 gives the solution -x/t.
+*/
+int
+nmod_sparse_mat_solve_lanczos(mp_ptr x, const nmod_sparse_mat_t A,
+                                                               mp_srcptr b)
+{
+    slong r = A->r, c = A->c, i, k, t, u, dim, attempt, N;
+    nmod_t mod = A->mod;
+    nmod_sparse_mat_t Ab;
+    flint_rand_t state;
+    nmod_mat_t K;
+    mp_ptr y;
+    int success = 0;
+
+    if (_nmod_vec_is_zero(b, r))
+    {
+        _nmod_vec_zero(x, c);
+        return 1;
+    }
+
+    nmod_sparse_mat_init(Ab, r, c + 1, mod.n);
+    nmod_sparse_mat_fit_nnz(Ab, A->nnz + r);
+
+    for (i = 0, k = 0; i < r; i++)
+    {
+        slong s;
+
+        Ab->row_starts[i] = k;
+
+        for (s = A->row_starts[i]; s < A->row_starts[i + 1]; s++, k++)
+        {
+            Ab->cols[k] = A->cols[s];
+            Ab->entries[k] = A->entries[s];
+        }
+
+        if (b[i] != 0)
+        {
+            Ab->cols[k] = c;
+            Ab->entries[k++] = b[i];
+        }
+    }
+
+    Ab->row_starts[r] = k;
+    Ab->nnz = k;
+
+    flint_randinit(state);
+    nmod_mat_init(K, 0, 0, mod.n);
+    y = _nmod_vec_init(FLINT_MAX(r, 1));
+    N = _nmod_sparse_mat_lanczos_block_size(mod);
+
+    for (attempt = 0; attempt < NMOD_SPARSE_MAT_LANCZOS_TRIES && !success;
+                                                                  attempt++)
+    {
+        u = _nmod_sparse_mat_lanczos_kernel(K, &dim, Ab, N, state);
+
+        for (t = 0; t < u && !success; t++)
+        {
+            mp_limb_t f;
+
+            if (nmod_mat_entry(K, c, t) == 0)
+                continue;
+
+            f = nmod_neg(n_invmod(nmod_mat_entry(K, c, t), mod.n), mod);
+
+            for (i = 0; i < c; i++)
+                x[i] = nmod_mul(nmod_mat_entry(K, i, t), f, mod);
+
+            nmod_sparse_mat_mul_vec(y, A, x);
+            success = _nmod_vec_equal(y, b, r);
+        }
+    }
+
+    _nmod_vec_clear(y);
+    nmod_mat_clear(K);
+    flint_randclear(state);
+    nmod_sparse_mat_clear(Ab);
+
+    return success;
+}
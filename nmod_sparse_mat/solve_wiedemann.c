@@ -0,0 +1,202 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+/* attempts with a new random projection before giving up */
+#define WIEDEMANN_TRIES 4
+
+/*
+   Sets C = 1 + c_1 x + ... + c_L x^L to the connection polynomial of the
+   sequence s_0, ..., s_{N-1}, i.e. s_k + c_1 s_{k-1} + ... + c_L s_{k-L} = 0
+   for L <= k < N, with L minimal, and returns L. C needs space for N + 1
+   coefficients. Returns -1 if a discrepancy is not invertible, which can
+   only happen for a composite modulus.
+*/
+static slong
+_nmod_berlekamp_massey(mp_ptr C, mp_srcptr s, slong N, nmod_t mod)
+{
+    mp_ptr B, T;
+    mp_limb_t binv = 1, d;
+    slong i, k, L = 0, m = 1, lenB = 1, lenC = 1, lenT;
+
+    B = _nmod_vec_init(N + 1);
+    T = _nmod_vec_init(N + 1);
+
+    _nmod_vec_zero(C, N + 1);
+    C[0] = 1;
+    B[0] = 1;
+
+    for (k = 0; k < N; k++)
+    {
+        mp_limb_t a2 = 0, a1 = 0, a0 = 0, hi, lo;
+
+        /* discrepancy */
+        for (i = 0; i <= L; i++)
+        {
+            umul_ppmm(hi, lo, C[i], s[k - i]);
+            add_sssaaaaaa(a2, a1, a0, a2, a1, a0, 0, hi, lo);
+        }
+
+        if (a2 >= mod.n)
+            NMOD_RED(a2, a2, mod);
+        NMOD_RED3(d, a2, a1, a0, mod);
+
+        if (d == 0)
+        {
+            m++;
+        }
+        else
+        {
+            mp_limb_t f = nmod_neg(nmod_mul(d, binv, mod), mod);
+
+            if (2*L <= k)
+            {
+                if (n_gcdinv(&binv, d, mod.n) != 1)
+                {
+                    L = -1;
+                    break;
+                }
+
+                _nmod_vec_set(T, C, lenC);
+                lenT = lenC;
+
+                /* C = C - (d/b) x^m B */
+                _nmod_vec_scalar_addmul_nmod(C + m, B, lenB, f, mod);
+                lenC = FLINT_MAX(lenC, lenB + m);
+
+                L = k + 1 - L;
+                _nmod_vec_set(B, T, lenT);
+                lenB = lenT;
+                m = 1;
+            }
+            else
+            {
+                _nmod_vec_scalar_addmul_nmod(C + m, B, lenB, f, mod);
+                lenC = FLINT_MAX(lenC, lenB + m);
+                m++;
+            }
+        }
+    }
+
+    _nmod_vec_clear(B);
+    _nmod_vec_clear(T);
+
+    return L;
+}
+
+/*
+   The minimal polynomial f of the sequence u^T A^i b, i < 2n, for a random
+   u is with high probability that of A on b. Then f(A) b = 0 and, if
+   f(0) != 0, the solution is a combination of A^i b, i < deg f.
+*/
+int
+nmod_sparse_mat_solve_wiedemann(mp_ptr x, const nmod_sparse_mat_t A,
+                                                             mp_srcptr b)
+{
+    slong i, n = A->r, L, N, attempt;
+    nmod_t mod = A->mod;
+    mp_ptr u, s, C, v, w, y;
+    flint_rand_t state;
+    int nlimbs, success = 0;
+
+    if (A->r != A->c)
+    {
+        flint_printf("Exception (nmod_sparse_mat_solve_wiedemann). "
+                     "Non-square system matrix.\n");
+        flint_abort();
+    }
+
+    if (n == 0)
+        return 1;
+
+    if (_nmod_vec_is_zero(b, n))
+    {
+        _nmod_vec_zero(x, n);
+        return 1;
+    }
+
+    N = 2*n;
+    u = _nmod_vec_init(n);
+    v = _nmod_vec_init(n);
+    w = _nmod_vec_init(n);
+    y = _nmod_vec_init(n);
+    s = _nmod_vec_init(N);
+    C = _nmod_vec_init(N + 1);
+
+    flint_randinit(state);
+    nlimbs = _nmod_vec_dot_bound_limbs(n, mod);
+
+    for (attempt = 0; attempt < WIEDEMANN_TRIES && !success; attempt++)
+    {
+        mp_limb_t c0, c0inv;
+
+        for (i = 0; i < n; i++)
+            u[i] = n_randint(state, mod.n);
+
+        /* s_i = u^T A^i b */
+        _nmod_vec_set(v, b, n);
+        for (i = 0; i < N; i++)
+        {
+            s[i] = _nmod_vec_dot(u, v, n, mod, nlimbs);
+
+            if (i + 1 < N)
+            {
+                nmod_sparse_mat_mul_vec(w, A, v);
+                MP_PTR_SWAP(v, w);
+            }
+        }
+
+        L = _nmod_berlekamp_massey(C, s, N, mod);
+
+        if (L == -1)
+            break;        /* non-invertible discrepancy */
+
+        if (L == 0)
+            continue;
+
+        /* f(z) = z^L + c_1 z^(L-1) + ... + c_L and f(0) = c_L */
+        c0 = C[L];
+        if (c0 == 0)
+            break;        /* A is singular */
+
+        if (n_gcdinv(&c0inv, c0, mod.n) != 1)
+            break;
+
+        /* y = A^(L-1) b + c_1 A^(L-2) b + ... + c_(L-1) b */
+        _nmod_vec_set(y, b, n);
+        for (i = 1; i < L; i++)
+        {
+            nmod_sparse_mat_mul_vec(w, A, y);
+            _nmod_vec_scalar_addmul_nmod(w, b, n, C[i], mod);
+            MP_PTR_SWAP(y, w);
+        }
+
+        _nmod_vec_scalar_mul_nmod(x, y, n, nmod_neg(c0inv, mod), mod);
+
+        /* check A x = b */
+        nmod_sparse_mat_mul_vec(w, A, x);
+        success = _nmod_vec_equal(w, b, n);
+    }
+
+    flint_randclear(state);
+
+    _nmod_vec_clear(u);
+    _nmod_vec_clear(v);
+    _nmod_vec_clear(w);
+    _nmod_vec_clear(y);
+    _nmod_vec_clear(s);
+    _nmod_vec_clear(C);
+
+    return success;
+}
@@ -0,0 +1,86 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_mat....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t S;
+        nmod_mat_t A, X, Y, Z;
+        slong m, n, k;
+        mp_limb_t mod;
+
+        m = n_randint(state, 50);
+        n = n_randint(state, 50);
+        k = n_randint(state, 50);
+
+        /* large enough to use threads */
+        if (n_randint(state, 20) == 0)
+        {
+            m = 200 + n_randint(state, 200);
+            n = 200 + n_randint(state, 200);
+        }
+
+        mod = n_randtest_not_zero(state);
+
+        nmod_sparse_mat_init(S, m, n, mod);
+        nmod_mat_init(A, m, n, mod);
+        nmod_mat_init(X, n, k, mod);
+        nmod_mat_init(Y, m, k, mod);
+        nmod_mat_init(Z, m, k, mod);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        nmod_sparse_mat_randtest(S, state, n_randint(state, 20));
+        nmod_mat_randtest(X, state);
+        nmod_mat_randtest(Y, state);
+
+        nmod_sparse_mat_mul_mat(Y, S, X);
+
+        nmod_sparse_mat_get_nmod_mat(A, S);
+        nmod_mat_mul(Z, A, X);
+
+        if (!nmod_mat_equal(Y, Z))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("m = %wd, n = %wd, k = %wd\n", m, n, k);
+            abort();
+        }
+
+        nmod_sparse_mat_clear(S);
+        nmod_mat_clear(A);
+        nmod_mat_clear(X);
+        nmod_mat_clear(Y);
+        nmod_mat_clear(Z);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,114 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mul_vec....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t S;
+        nmod_mat_t A, x, y;
+        mp_ptr u, v;
+        slong j, m, n;
+        mp_limb_t mod;
+
+        m = n_randint(state, 40);
+        n = n_randint(state, 40);
+
+        /* large enough to use threads */
+        if (n_randint(state, 20) == 0)
+        {
+            m = 1000 + n_randint(state, 2000);
+            n = 1000 + n_randint(state, 2000);
+        }
+
+        mod = n_randtest_not_zero(state);
+
+        nmod_sparse_mat_init(S, m, n, mod);
+        nmod_mat_init(A, m, n, mod);
+        nmod_mat_init(x, n, 1, mod);
+        nmod_mat_init(y, m, 1, mod);
+        u = _nmod_vec_init(n);
+        v = _nmod_vec_init(m);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        nmod_sparse_mat_randtest(S, state, n_randint(state, 20));
+        nmod_mat_randtest(x, state);
+
+        for (j = 0; j < n; j++)
+            u[j] = nmod_mat_entry(x, j, 0);
+
+        nmod_sparse_mat_mul_vec(v, S, u);
+
+        if (m < 100 && n < 100)
+        {
+            nmod_sparse_mat_get_nmod_mat(A, S);
+            nmod_mat_mul(y, A, x);
+        } else
+        {
+            /* compare against the transpose */
+            nmod_sparse_mat_t T;
+            slong k;
+
+            nmod_sparse_mat_init(T, n, m, mod);
+            nmod_sparse_mat_transpose(T, S);
+            nmod_mat_zero(y);
+
+            for (j = 0; j < n; j++)
+                for (k = T->row_starts[j]; k < T->row_starts[j + 1]; k++)
+                    nmod_mat_entry(y, T->cols[k], 0) = n_addmod(
+                        nmod_mat_entry(y, T->cols[k], 0),
+                        n_mulmod2_preinv(T->entries[k], u[j], mod, S->mod.ninv),
+                        mod);
+
+            nmod_sparse_mat_clear(T);
+        }
+
+        for (j = 0; j < m; j++)
+        {
+            if (v[j] != nmod_mat_entry(y, j, 0))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("m = %wd, n = %wd, j = %wd\n", m, n, j);
+                abort();
+            }
+        }
+
+        nmod_sparse_mat_clear(S);
+        nmod_mat_clear(A);
+        nmod_mat_clear(x);
+        nmod_mat_clear(y);
+        _nmod_vec_clear(u);
+        _nmod_vec_clear(v);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
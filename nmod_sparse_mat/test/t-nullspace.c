@@ -0,0 +1,73 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("nullspace....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t S;
+        nmod_mat_t A, X, AX;
+        slong m, n, nullity;
+        mp_limb_t mod;
+
+        m = n_randint(state, 40);
+        n = n_randint(state, 40);
+        mod = n_randtest_prime(state, 0);
+
+        nmod_sparse_mat_init(S, m, n, mod);
+        nmod_mat_init(A, m, n, mod);
+        nmod_mat_init(X, 1, 1, mod);
+
+        nmod_sparse_mat_randtest(S, state, n_randint(state, 8));
+        nmod_sparse_mat_get_nmod_mat(A, S);
+
+        nullity = nmod_sparse_mat_nullspace(X, S);
+
+        nmod_mat_init(AX, m, nullity, mod);
+        nmod_mat_mul(AX, A, X);
+
+        if (nullity != n - nmod_mat_rank(A) || X->r != n || X->c != nullity
+                || !nmod_mat_is_zero(AX) || nmod_mat_rank(X) != nullity)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("nullity = %wd, rank = %wd\n", nullity,
+                                                            nmod_mat_rank(A));
+            nmod_mat_print_pretty(A);
+            nmod_mat_print_pretty(X);
+            abort();
+        }
+
+        nmod_sparse_mat_clear(S);
+        nmod_mat_clear(A);
+        nmod_mat_clear(X);
+        nmod_mat_clear(AX);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
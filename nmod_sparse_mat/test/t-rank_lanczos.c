@@ -0,0 +1,95 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("rank_lanczos....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t S;
+        nmod_mat_t A, B, C;
+        slong m, n, k, r1, r2;
+        mp_limb_t mod;
+
+        m = n_randint(state, 60);
+        n = n_randint(state, 60);
+        mod = n_randint(state, 2) ? 2 : n_randtest_prime(state, 0);
+
+        nmod_sparse_mat_init(S, m, n, mod);
+        nmod_mat_init(A, m, n, mod);
+
+        if (n_randint(state, 2))
+        {
+            nmod_sparse_mat_randtest(S, state, n_randint(state, 8));
+        }
+        else
+        {
+            /* a product of sparse matrices, of rank at most k */
+            k = n_randint(state, 20);
+            nmod_mat_init(B, m, k, mod);
+            nmod_mat_init(C, k, n, mod);
+            nmod_sparse_mat_clear(S);
+
+            nmod_sparse_mat_init(S, m, k, mod);
+            nmod_sparse_mat_randtest(S, state, 2);
+            nmod_sparse_mat_get_nmod_mat(B, S);
+            nmod_sparse_mat_clear(S);
+
+            nmod_sparse_mat_init(S, k, n, mod);
+            nmod_sparse_mat_randtest(S, state, 3);
+            nmod_sparse_mat_get_nmod_mat(C, S);
+            nmod_sparse_mat_clear(S);
+
+            nmod_sparse_mat_init(S, m, n, mod);
+            nmod_mat_mul(A, B, C);
+            nmod_sparse_mat_set_nmod_mat(S, A);
+
+            nmod_mat_clear(B);
+            nmod_mat_clear(C);
+        }
+
+        nmod_sparse_mat_get_nmod_mat(A, S);
+
+        r1 = nmod_sparse_mat_rank_lanczos(S);
+        r2 = nmod_mat_rank(A);
+
+        /* only small fields can keep the rank bounds apart */
+        if ((r1 >= 0 && r1 != r2) || (r1 < 0 && mod > 1000))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("r1 = %wd, r2 = %wd\n", r1, r2);
+            nmod_mat_print_pretty(A);
+            abort();
+        }
+
+        nmod_sparse_mat_clear(S);
+        nmod_mat_clear(A);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
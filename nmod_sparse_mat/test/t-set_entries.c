@@ -0,0 +1,114 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("set_entries....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t S, T;
+        nmod_mat_t A, B;
+        slong m, n, nnz, k, * rows, * cols;
+        mp_ptr vals;
+        mp_limb_t mod;
+
+        m = n_randint(state, 20);
+        n = n_randint(state, 20);
+        mod = n_randtest_not_zero(state);
+        nnz = (m == 0 || n == 0) ? 0 : n_randint(state, 3*m*n/2 + 1);
+
+        nmod_sparse_mat_init(S, m, n, mod);
+        nmod_sparse_mat_init(T, m, n, mod);
+        nmod_mat_init(A, m, n, mod);
+        nmod_mat_init(B, m, n, mod);
+
+        rows = flint_malloc(FLINT_MAX(nnz, 1) * sizeof(slong));
+        cols = flint_malloc(FLINT_MAX(nnz, 1) * sizeof(slong));
+        vals = _nmod_vec_init(FLINT_MAX(nnz, 1));
+
+        /* positions may repeat and values need not be reduced */
+        for (k = 0; k < nnz; k++)
+        {
+            rows[k] = n_randint(state, m);
+            cols[k] = n_randint(state, n);
+            vals[k] = n_randtest(state);
+
+            nmod_mat_entry(A, rows[k], cols[k]) = n_addmod(
+                 nmod_mat_entry(A, rows[k], cols[k]), vals[k] % mod, mod);
+        }
+
+        nmod_sparse_mat_set_entries(S, rows, cols, vals, nnz);
+        nmod_sparse_mat_get_nmod_mat(B, S);
+
+        if (!nmod_mat_equal(A, B))
+        {
+            flint_printf("FAIL: entries\n");
+            nmod_mat_print_pretty(A);
+            nmod_mat_print_pretty(B);
+            abort();
+        }
+
+        for (k = 0; k < S->nnz; k++)
+        {
+            if (S->entries[k] == 0)
+            {
+                flint_printf("FAIL: zero entry stored\n");
+                abort();
+            }
+        }
+
+        for (k = 0; k < 10 && m > 0 && n > 0; k++)
+        {
+            slong r = n_randint(state, m), c = n_randint(state, n);
+
+            if (nmod_sparse_mat_get_entry(S, r, c) != nmod_mat_entry(A, r, c))
+            {
+                flint_printf("FAIL: get_entry\n");
+                abort();
+            }
+        }
+
+        nmod_sparse_mat_set_nmod_mat(T, A);
+
+        if (!nmod_sparse_mat_equal(S, T))
+        {
+            flint_printf("FAIL: set_nmod_mat\n");
+            abort();
+        }
+
+        nmod_sparse_mat_clear(S);
+        nmod_sparse_mat_clear(T);
+        nmod_mat_clear(A);
+        nmod_mat_clear(B);
+        flint_free(rows);
+        flint_free(cols);
+        _nmod_vec_clear(vals);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
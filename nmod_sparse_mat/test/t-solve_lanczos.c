@@ -0,0 +1,98 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("solve_lanczos....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t S;
+        nmod_mat_t A, Ab;
+        mp_ptr x, b, y;
+        slong j, m, n;
+        mp_limb_t mod;
+        int success, consistent;
+
+        m = n_randint(state, 60);
+        n = n_randint(state, 60);
+        mod = n_randint(state, 4) ? n_randtest_prime(state, 0) : 2;
+
+        nmod_sparse_mat_init(S, m, n, mod);
+        nmod_mat_init(A, m, n, mod);
+        nmod_mat_init(Ab, m, n + 1, mod);
+        x = _nmod_vec_init(n);
+        b = _nmod_vec_init(m);
+        y = _nmod_vec_init(m);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        nmod_sparse_mat_randtest(S, state, n_randint(state, 6) + 1);
+        nmod_sparse_mat_get_nmod_mat(A, S);
+
+        /* mostly right hand sides in the image */
+        if (n_randint(state, 4))
+        {
+            _nmod_vec_randtest(x, state, n, S->mod);
+            nmod_sparse_mat_mul_vec(b, S, x);
+        }
+        else
+            _nmod_vec_randtest(b, state, m, S->mod);
+
+        for (j = 0; j < m; j++)
+        {
+            _nmod_vec_set(Ab->rows[j], A->rows[j], n);
+            nmod_mat_entry(Ab, j, n) = b[j];
+        }
+
+        consistent = (nmod_mat_rank(Ab) == nmod_mat_rank(A));
+
+        success = nmod_sparse_mat_solve_lanczos(x, S, b);
+
+        if (success)
+            nmod_sparse_mat_mul_vec(y, S, x);
+
+        if ((success && !_nmod_vec_equal(y, b, m)) || (success && !consistent)
+                || (!success && consistent && mod > 1000))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("m = %wd, n = %wd, success = %d, consistent = %d\n",
+                                                m, n, success, consistent);
+            nmod_mat_print_pretty(A);
+            abort();
+        }
+
+        nmod_sparse_mat_clear(S);
+        nmod_mat_clear(A);
+        nmod_mat_clear(Ab);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(b);
+        _nmod_vec_clear(y);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,129 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "nmod_mat.h"
+#include "nmod_sparse_mat.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("solve_wiedemann....");
+    fflush(stdout);
+
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t S;
+        nmod_mat_t A;
+        mp_ptr x, b, y;
+        slong j, n;
+        mp_limb_t mod;
+        int success, singular;
+
+        n = n_randint(state, 60);
+        mod = n_randprime(state, 16 + n_randint(state, FLINT_BITS - 16), 0);
+
+        nmod_sparse_mat_init(S, n, n, mod);
+        nmod_mat_init(A, n, n, mod);
+        x = _nmod_vec_init(n);
+        b = _nmod_vec_init(n);
+        y = _nmod_vec_init(n);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        nmod_sparse_mat_randtest(S, state, n_randint(state, 6) + 1);
+        nmod_sparse_mat_get_nmod_mat(A, S);
+
+        /* mostly nonsingular */
+        if (n_randint(state, 4))
+        {
+            for (j = 0; j < n; j++)
+                if (nmod_mat_entry(A, j, j) == 0)
+                    nmod_mat_entry(A, j, j) = 1;
+            nmod_sparse_mat_set_nmod_mat(S, A);
+        }
+
+        singular = (nmod_mat_rank(A) < n);
+        _nmod_vec_randtest(b, state, n, S->mod);
+
+        success = nmod_sparse_mat_solve_wiedemann(x, S, b);
+
+        if (success)
+            nmod_sparse_mat_mul_vec(y, S, x);
+
+        if ((success && !_nmod_vec_equal(y, b, n)) || (!success && !singular))
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("n = %wd, success = %d, singular = %d\n",
+                                                      n, success, singular);
+            nmod_mat_print_pretty(A);
+            abort();
+        }
+
+        nmod_sparse_mat_clear(S);
+        nmod_mat_clear(A);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(b);
+        _nmod_vec_clear(y);
+    }
+
+    /* composite moduli: failure is allowed, a wrong solution is not */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        nmod_sparse_mat_t S;
+        mp_ptr x, b, y;
+        slong n;
+        mp_limb_t mod;
+
+        n = n_randint(state, 30);
+        mod = n_randprime(state, 2 + n_randint(state, 6), 0) *
+              n_randprime(state, 2 + n_randint(state, 6), 0);
+
+        nmod_sparse_mat_init(S, n, n, mod);
+        x = _nmod_vec_init(n);
+        b = _nmod_vec_init(n);
+        y = _nmod_vec_init(n);
+
+        nmod_sparse_mat_randtest(S, state, n_randint(state, 6) + 1);
+        _nmod_vec_randtest(b, state, n, S->mod);
+
+        if (nmod_sparse_mat_solve_wiedemann(x, S, b))
+        {
+            nmod_sparse_mat_mul_vec(y, S, x);
+
+            if (!_nmod_vec_equal(y, b, n))
+            {
+                flint_printf("FAIL (composite modulus):\n");
+                flint_printf("n = %wd, mod = %wu\n", n, mod);
+                abort();
+            }
+        }
+
+        nmod_sparse_mat_clear(S);
+        _nmod_vec_clear(x);
+        _nmod_vec_clear(b);
+        _nmod_vec_clear(y);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,64 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_sparse_mat.h"
+
+/*
+   A counting sort of the entries by column. The rows of A are scanned in
+   order, so that the columns within each row of B are increasing. This is
+   also how the columns of A are obtained in compressed form.
+*/
+void
+nmod_sparse_mat_transpose(nmod_sparse_mat_t B, const nmod_sparse_mat_t A)
+{
+    slong i, k, * pos;
+
+    if (B == A)
+    {
+        nmod_sparse_mat_t t;
+        nmod_sparse_mat_init(t, A->c, A->r, A->mod.n);
+        nmod_sparse_mat_transpose(t, A);
+        nmod_sparse_mat_swap(B, t);
+        nmod_sparse_mat_clear(t);
+        return;
+    }
+
+    nmod_sparse_mat_fit_nnz(B, A->nnz);
+
+    pos = flint_calloc(A->c + 1, sizeof(slong));
+
+    for (k = 0; k < A->nnz; k++)
+        pos[A->cols[k] + 1]++;
+
+    for (i = 0; i < A->c; i++)
+        pos[i + 1] += pos[i];
+
+    for (i = 0; i <= A->c; i++)
+        B->row_starts[i] = pos[i];
+
+    for (i = 0; i < A->r; i++)
+    {
+        for (k = A->row_starts[i]; k < A->row_starts[i + 1]; k++)
+        {
+            slong j = pos[A->cols[k]]++;
+
+            B->cols[j] = i;
+            B->entries[j] = A->entries[k];
+        }
+    }
+
+    B->nnz = A->nnz;
+
+    flint_free(pos);
+}
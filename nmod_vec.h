@@ -303,6 +303,89 @@ FLINT_DLL mp_limb_t _nmod_vec_dot(mp_srcptr vec1, mp_srcptr vec2,
 FLINT_DLL mp_limb_t _nmod_vec_dot_ptr(mp_srcptr vec1, const mp_ptr * vec2, slong offset,
     slong len, nmod_t mod, int nlimbs);
 
+/* Montgomery form  **********************************************************/
+
+/*
+   Entries in Montgomery form for an odd modulus, see n_mont_t; scalars
+   are also in Montgomery form.
+*/
+FLINT_DLL void _nmod_vec_to_mont(mp_ptr res, mp_srcptr vec, slong len,
+                                                              n_mont_t mont);
+
+FLINT_DLL void _nmod_vec_from_mont(mp_ptr res, mp_srcptr vec, slong len,
+                                                              n_mont_t mont);
+
+FLINT_DLL void _nmod_vec_mont_mul(mp_ptr res, mp_srcptr vec1,
+                                  mp_srcptr vec2, slong len, n_mont_t mont);
+
+FLINT_DLL void _nmod_vec_mont_scalar_mul(mp_ptr res, mp_srcptr vec,
+                                     slong len, mp_limb_t c, n_mont_t mont);
+
+FLINT_DLL void _nmod_vec_mont_scalar_addmul(mp_ptr res, mp_srcptr vec,
+                                     slong len, mp_limb_t c, n_mont_t mont);
+
+FLINT_DLL mp_limb_t _nmod_vec_mont_dot(mp_srcptr vec1, mp_srcptr vec2,
+                                                   slong len, n_mont_t mont);
+
+/* SIMD kernels  *************************************************************/
+
+#if FLINT64 && (HAVE_AVX2_DISPATCH || HAVE_AVX512_DISPATCH)
+#define NMOD_VEC_SIMD 1
+#else
+#define NMOD_VEC_SIMD 0
+#endif
+
+#define NMOD_VEC_SIMD_NONE   0
+#define NMOD_VEC_SIMD_AVX2   1
+#define NMOD_VEC_SIMD_AVX512 2
+
+#define NMOD_VEC_SIMD_CUTOFF 16    /* minimum length for SIMD kernels */
+#define NMOD_VEC_SIMD_FP_BITS 50   /* moduli for floating point kernels */
+
+FLINT_DLL int _nmod_vec_simd_level(void);
+
+FLINT_DLL void _nmod_vec_set_simd_level(int level);
+
+#if NMOD_VEC_SIMD
+
+FLINT_DLL void _nmod_vec_add_avx2(mp_ptr res, mp_srcptr vec1,
+                        mp_srcptr vec2, slong len, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_sub_avx2(mp_ptr res, mp_srcptr vec1,
+                        mp_srcptr vec2, slong len, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_scalar_mul_nmod_fp_avx2(mp_ptr res, mp_srcptr vec,
+                            slong len, mp_limb_t c, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_scalar_addmul_nmod_fp_avx2(mp_ptr res, mp_srcptr vec,
+                            slong len, mp_limb_t c, nmod_t mod);
+
+FLINT_DLL mp_limb_t _nmod_vec_dot_32_avx2(mp_srcptr vec1, mp_srcptr vec2,
+                            slong len, nmod_t mod);
+
+FLINT_DLL mp_limb_t _nmod_vec_dot_fp_avx2(mp_srcptr vec1, mp_srcptr vec2,
+                            slong len, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_add_avx512(mp_ptr res, mp_srcptr vec1,
+                        mp_srcptr vec2, slong len, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_sub_avx512(mp_ptr res, mp_srcptr vec1,
+                        mp_srcptr vec2, slong len, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_scalar_mul_nmod_fp_avx512(mp_ptr res, mp_srcptr vec,
+                            slong len, mp_limb_t c, nmod_t mod);
+
+FLINT_DLL void _nmod_vec_scalar_addmul_nmod_fp_avx512(mp_ptr res,
+                   mp_srcptr vec, slong len, mp_limb_t c, nmod_t mod);
+
+FLINT_DLL mp_limb_t _nmod_vec_dot_32_avx512(mp_srcptr vec1, mp_srcptr vec2,
+                            slong len, nmod_t mod);
+
+FLINT_DLL mp_limb_t _nmod_vec_dot_fp_avx512(mp_srcptr vec1, mp_srcptr vec2,
+                            slong len, nmod_t mod);
+
+#endif
+
 #ifdef __cplusplus
 }
 #endif
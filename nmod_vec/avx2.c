@@ -0,0 +1,236 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+
+#if NMOD_VEC_SIMD && HAVE_AVX2_DISPATCH
+
+#include <immintrin.h>
+
+#define AVX2_FN __attribute__((target("avx2,fma")))
+
+/* conversions between integers in [0, 2^52) and doubles */
+
+static __inline__ AVX2_FN
+__m256d _avx2_u52_to_pd(__m256i x)
+{
+    const __m256d c = _mm256_set1_pd(4503599627370496.0);
+
+    x = _mm256_or_si256(x, _mm256_castpd_si256(c));
+    return _mm256_sub_pd(_mm256_castsi256_pd(x), c);
+}
+
+static __inline__ AVX2_FN
+__m256i _avx2_pd_to_u52(__m256d x)
+{
+    const __m256d c = _mm256_set1_pd(4503599627370496.0);
+
+    x = _mm256_add_pd(x, c);
+    return _mm256_xor_si256(_mm256_castpd_si256(x), _mm256_castpd_si256(c));
+}
+
+/*
+   Returns a*b mod n for 0 <= a, b < n < 2^50. The high part of the product
+   is rounded, but its error is recovered exactly by the fused multiply-sub,
+   so that r = a*b - q*n lies in (-n, n).
+*/
+static __inline__ AVX2_FN
+__m256d _avx2_mulmod_pd(__m256d a, __m256d b, __m256d n, __m256d ninv)
+{
+    __m256d h, l, q, r;
+
+    h = _mm256_mul_pd(a, b);
+    l = _mm256_fmsub_pd(a, b, h);
+    q = _mm256_round_pd(_mm256_mul_pd(h, ninv),
+                              _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    r = _mm256_fnmadd_pd(q, n, h);
+    r = _mm256_add_pd(r, l);
+
+    return _mm256_add_pd(r, _mm256_and_pd(n,
+                  _mm256_cmp_pd(r, _mm256_setzero_pd(), _CMP_LT_OQ)));
+}
+
+/* requires n < 2^62 so that signed comparisons are valid */
+AVX2_FN
+void _nmod_vec_add_avx2(mp_ptr res, mp_srcptr vec1,
+                                   mp_srcptr vec2, slong len, nmod_t mod)
+{
+    slong i;
+    const __m256i n = _mm256_set1_epi64x(mod.n);
+    const __m256i n1 = _mm256_set1_epi64x(mod.n - 1);
+    __m256i a, b;
+
+    for (i = 0; i + 4 <= len; i += 4)
+    {
+        a = _mm256_loadu_si256((const __m256i *) (vec1 + i));
+        b = _mm256_loadu_si256((const __m256i *) (vec2 + i));
+        a = _mm256_add_epi64(a, b);
+        b = _mm256_and_si256(n, _mm256_cmpgt_epi64(a, n1));
+        _mm256_storeu_si256((__m256i *) (res + i), _mm256_sub_epi64(a, b));
+    }
+
+    for ( ; i < len; i++)
+        res[i] = _nmod_add(vec1[i], vec2[i], mod);
+}
+
+AVX2_FN
+void _nmod_vec_sub_avx2(mp_ptr res, mp_srcptr vec1,
+                                   mp_srcptr vec2, slong len, nmod_t mod)
+{
+    slong i;
+    const __m256i n = _mm256_set1_epi64x(mod.n);
+    __m256i a, b, m;
+
+    for (i = 0; i + 4 <= len; i += 4)
+    {
+        a = _mm256_loadu_si256((const __m256i *) (vec1 + i));
+        b = _mm256_loadu_si256((const __m256i *) (vec2 + i));
+        m = _mm256_and_si256(n, _mm256_cmpgt_epi64(b, a));
+        a = _mm256_sub_epi64(a, b);
+        _mm256_storeu_si256((__m256i *) (res + i), _mm256_add_epi64(a, m));
+    }
+
+    for ( ; i < len; i++)
+        res[i] = _nmod_sub(vec1[i], vec2[i], mod);
+}
+
+/* requires n < 2^NMOD_VEC_SIMD_FP_BITS */
+AVX2_FN
+void _nmod_vec_scalar_mul_nmod_fp_avx2(mp_ptr res, mp_srcptr vec,
+                                   slong len, mp_limb_t c, nmod_t mod)
+{
+    slong i;
+    const __m256d n = _mm256_set1_pd((double) mod.n);
+    const __m256d ninv = _mm256_set1_pd(1.0 / (double) mod.n);
+    const __m256d cd = _mm256_set1_pd((double) c);
+    __m256d a;
+
+    for (i = 0; i + 4 <= len; i += 4)
+    {
+        a = _avx2_u52_to_pd(_mm256_loadu_si256((const __m256i *) (vec + i)));
+        a = _avx2_mulmod_pd(a, cd, n, ninv);
+        _mm256_storeu_si256((__m256i *) (res + i), _avx2_pd_to_u52(a));
+    }
+
+    for ( ; i < len; i++)
+        res[i] = nmod_mul(vec[i], c, mod);
+}
+
+AVX2_FN
+void _nmod_vec_scalar_addmul_nmod_fp_avx2(mp_ptr res, mp_srcptr vec,
+                                   slong len, mp_limb_t c, nmod_t mod)
+{
+    slong i;
+    const __m256d n = _mm256_set1_pd((double) mod.n);
+    const __m256d ninv = _mm256_set1_pd(1.0 / (double) mod.n);
+    const __m256d cd = _mm256_set1_pd((double) c);
+    __m256d a, b;
+
+    for (i = 0; i + 4 <= len; i += 4)
+    {
+        a = _avx2_u52_to_pd(_mm256_loadu_si256((const __m256i *) (vec + i)));
+        b = _avx2_u52_to_pd(_mm256_loadu_si256((const __m256i *) (res + i)));
+        a = _avx2_mulmod_pd(a, cd, n, ninv);
+        a = _mm256_add_pd(a, b);
+        a = _mm256_sub_pd(a, _mm256_and_pd(n, _mm256_cmp_pd(a, n, _CMP_GE_OQ)));
+        _mm256_storeu_si256((__m256i *) (res + i), _avx2_pd_to_u52(a));
+    }
+
+    for ( ; i < len; i++)
+        res[i] = nmod_add(res[i], nmod_mul(vec[i], c, mod), mod);
+}
+
+/*
+   Requires n <= 2^32. Products of 32-bit lanes are accumulated as separate
+   sums of their low and high halves, which cannot overflow for fewer than
+   2^30 terms per lane.
+*/
+AVX2_FN
+mp_limb_t _nmod_vec_dot_32_avx2(mp_srcptr vec1, mp_srcptr vec2,
+                                                   slong len, nmod_t mod)
+{
+    slong i, j, stop;
+    const __m256i mask = _mm256_set1_epi64x(UWORD(0xffffffff));
+    __m256i a, b, lo, hi;
+    mp_limb_t s0, s1, t0, t1, u[4], r;
+
+    s0 = s1 = 0;
+
+    for (i = 0; i + 4 <= len; )
+    {
+        stop = FLINT_MIN(len - 3, i + (WORD(1) << 32));
+        lo = hi = _mm256_setzero_si256();
+
+        for ( ; i < stop; i += 4)
+        {
+            a = _mm256_loadu_si256((const __m256i *) (vec1 + i));
+            b = _mm256_loadu_si256((const __m256i *) (vec2 + i));
+            a = _mm256_mul_epu32(a, b);
+            lo = _mm256_add_epi64(lo, _mm256_and_si256(a, mask));
+            hi = _mm256_add_epi64(hi, _mm256_srli_epi64(a, 32));
+        }
+
+        _mm256_storeu_si256((__m256i *) u, hi);
+        t0 = u[0] + u[1] + u[2] + u[3];
+        add_ssaaaa(s1, s0, s1, s0, t0 >> 32, t0 << 32);
+
+        _mm256_storeu_si256((__m256i *) u, lo);
+        for (j = 0; j < 4; j++)
+            add_ssaaaa(s1, s0, s1, s0, UWORD(0), u[j]);
+    }
+
+    for ( ; i < len; i++)
+    {
+        umul_ppmm(t1, t0, vec1[i], vec2[i]);
+        add_ssaaaa(s1, s0, s1, s0, t1, t0);
+    }
+
+    NMOD2_RED2(r, s1, s0, mod);
+
+    return r;
+}
+
+/* requires n < 2^NMOD_VEC_SIMD_FP_BITS; lanes accumulate reduced sums */
+AVX2_FN
+mp_limb_t _nmod_vec_dot_fp_avx2(mp_srcptr vec1, mp_srcptr vec2,
+                                                   slong len, nmod_t mod)
+{
+    slong i;
+    const __m256d n = _mm256_set1_pd((double) mod.n);
+    const __m256d ninv = _mm256_set1_pd(1.0 / (double) mod.n);
+    __m256d a, b, s;
+    mp_limb_t u[4], r;
+
+    s = _mm256_setzero_pd();
+
+    for (i = 0; i + 4 <= len; i += 4)
+    {
+        a = _avx2_u52_to_pd(_mm256_loadu_si256((const __m256i *) (vec1 + i)));
+        b = _avx2_u52_to_pd(_mm256_loadu_si256((const __m256i *) (vec2 + i)));
+        a = _avx2_mulmod_pd(a, b, n, ninv);
+        s = _mm256_add_pd(s, a);
+        s = _mm256_sub_pd(s, _mm256_and_pd(n, _mm256_cmp_pd(s, n, _CMP_GE_OQ)));
+    }
+
+    _mm256_storeu_si256((__m256i *) u, _avx2_pd_to_u52(s));
+
+    r = nmod_add(nmod_add(u[0], u[1], mod), nmod_add(u[2], u[3], mod), mod);
+
+    for ( ; i < len; i++)
+        r = nmod_add(r, nmod_mul(vec1[i], vec2[i], mod), mod);
+
+    return r;
+}
+
+#endif
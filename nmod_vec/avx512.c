@@ -0,0 +1,206 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+
+#if NMOD_VEC_SIMD && HAVE_AVX512_DISPATCH
+
+#include <immintrin.h>
+
+#define AVX512_FN __attribute__((target("avx512f,avx512dq")))
+
+/* see avx2.c for the floating point reduction */
+static __inline__ AVX512_FN
+__m512d _avx512_mulmod_pd(__m512d a, __m512d b, __m512d n, __m512d ninv)
+{
+    __m512d h, l, q, r;
+
+    h = _mm512_mul_pd(a, b);
+    l = _mm512_fmsub_pd(a, b, h);
+    q = _mm512_roundscale_pd(_mm512_mul_pd(h, ninv),
+                              _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+    r = _mm512_fnmadd_pd(q, n, h);
+    r = _mm512_add_pd(r, l);
+
+    return _mm512_mask_add_pd(r,
+                _mm512_cmp_pd_mask(r, _mm512_setzero_pd(), _CMP_LT_OQ), r, n);
+}
+
+AVX512_FN
+void _nmod_vec_add_avx512(mp_ptr res, mp_srcptr vec1,
+                                   mp_srcptr vec2, slong len, nmod_t mod)
+{
+    slong i;
+    const __m512i n = _mm512_set1_epi64(mod.n);
+    __m512i a, b;
+
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        a = _mm512_loadu_si512((const void *) (vec1 + i));
+        b = _mm512_loadu_si512((const void *) (vec2 + i));
+        a = _mm512_add_epi64(a, b);
+        a = _mm512_mask_sub_epi64(a, _mm512_cmpge_epu64_mask(a, n), a, n);
+        _mm512_storeu_si512((void *) (res + i), a);
+    }
+
+    for ( ; i < len; i++)
+        res[i] = _nmod_add(vec1[i], vec2[i], mod);
+}
+
+AVX512_FN
+void _nmod_vec_sub_avx512(mp_ptr res, mp_srcptr vec1,
+                                   mp_srcptr vec2, slong len, nmod_t mod)
+{
+    slong i;
+    const __m512i n = _mm512_set1_epi64(mod.n);
+    __m512i a, b;
+    __mmask8 m;
+
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        a = _mm512_loadu_si512((const void *) (vec1 + i));
+        b = _mm512_loadu_si512((const void *) (vec2 + i));
+        m = _mm512_cmplt_epu64_mask(a, b);
+        a = _mm512_sub_epi64(a, b);
+        a = _mm512_mask_add_epi64(a, m, a, n);
+        _mm512_storeu_si512((void *) (res + i), a);
+    }
+
+    for ( ; i < len; i++)
+        res[i] = _nmod_sub(vec1[i], vec2[i], mod);
+}
+
+AVX512_FN
+void _nmod_vec_scalar_mul_nmod_fp_avx512(mp_ptr res, mp_srcptr vec,
+                                   slong len, mp_limb_t c, nmod_t mod)
+{
+    slong i;
+    const __m512d n = _mm512_set1_pd((double) mod.n);
+    const __m512d ninv = _mm512_set1_pd(1.0 / (double) mod.n);
+    const __m512d cd = _mm512_set1_pd((double) c);
+    __m512d a;
+
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        a = _mm512_cvtepu64_pd(_mm512_loadu_si512((const void *) (vec + i)));
+        a = _avx512_mulmod_pd(a, cd, n, ninv);
+        _mm512_storeu_si512((void *) (res + i), _mm512_cvtpd_epu64(a));
+    }
+
+    for ( ; i < len; i++)
+        res[i] = nmod_mul(vec[i], c, mod);
+}
+
+AVX512_FN
+void _nmod_vec_scalar_addmul_nmod_fp_avx512(mp_ptr res, mp_srcptr vec,
+                                   slong len, mp_limb_t c, nmod_t mod)
+{
+    slong i;
+    const __m512d n = _mm512_set1_pd((double) mod.n);
+    const __m512d ninv = _mm512_set1_pd(1.0 / (double) mod.n);
+    const __m512d cd = _mm512_set1_pd((double) c);
+    __m512d a, b;
+
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        a = _mm512_cvtepu64_pd(_mm512_loadu_si512((const void *) (vec + i)));
+        b = _mm512_cvtepu64_pd(_mm512_loadu_si512((const void *) (res + i)));
+        a = _avx512_mulmod_pd(a, cd, n, ninv);
+        a = _mm512_add_pd(a, b);
+        a = _mm512_mask_sub_pd(a, _mm512_cmp_pd_mask(a, n, _CMP_GE_OQ), a, n);
+        _mm512_storeu_si512((void *) (res + i), _mm512_cvtpd_epu64(a));
+    }
+
+    for ( ; i < len; i++)
+        res[i] = nmod_add(res[i], nmod_mul(vec[i], c, mod), mod);
+}
+
+/* as in avx2.c, with at most 2^29 terms per lane */
+AVX512_FN
+mp_limb_t _nmod_vec_dot_32_avx512(mp_srcptr vec1, mp_srcptr vec2,
+                                                   slong len, nmod_t mod)
+{
+    slong i, stop;
+    const __m512i mask = _mm512_set1_epi64(UWORD(0xffffffff));
+    __m512i a, b, lo, hi;
+    mp_limb_t s0, s1, t0, t1, r;
+
+    s0 = s1 = 0;
+
+    for (i = 0; i + 8 <= len; )
+    {
+        stop = FLINT_MIN(len - 7, i + (WORD(1) << 32));
+        lo = hi = _mm512_setzero_si512();
+
+        for ( ; i < stop; i += 8)
+        {
+            a = _mm512_loadu_si512((const void *) (vec1 + i));
+            b = _mm512_loadu_si512((const void *) (vec2 + i));
+            a = _mm512_mul_epu32(a, b);
+            lo = _mm512_add_epi64(lo, _mm512_and_si512(a, mask));
+            hi = _mm512_add_epi64(hi, _mm512_srli_epi64(a, 32));
+        }
+
+        t0 = (mp_limb_t) _mm512_reduce_add_epi64(hi);
+        add_ssaaaa(s1, s0, s1, s0, t0 >> 32, t0 << 32);
+
+        t0 = (mp_limb_t) _mm512_reduce_add_epi64(lo);
+        add_ssaaaa(s1, s0, s1, s0, UWORD(0), t0);
+    }
+
+    for ( ; i < len; i++)
+    {
+        umul_ppmm(t1, t0, vec1[i], vec2[i]);
+        add_ssaaaa(s1, s0, s1, s0, t1, t0);
+    }
+
+    NMOD2_RED2(r, s1, s0, mod);
+
+    return r;
+}
+
+AVX512_FN
+mp_limb_t _nmod_vec_dot_fp_avx512(mp_srcptr vec1, mp_srcptr vec2,
+                                                   slong len, nmod_t mod)
+{
+    slong i;
+    const __m512d n = _mm512_set1_pd((double) mod.n);
+    const __m512d ninv = _mm512_set1_pd(1.0 / (double) mod.n);
+    __m512d a, b, s;
+    mp_limb_t u[8], r;
+
+    s = _mm512_setzero_pd();
+
+    for (i = 0; i + 8 <= len; i += 8)
+    {
+        a = _mm512_cvtepu64_pd(_mm512_loadu_si512((const void *) (vec1 + i)));
+        b = _mm512_cvtepu64_pd(_mm512_loadu_si512((const void *) (vec2 + i)));
+        a = _avx512_mulmod_pd(a, b, n, ninv);
+        s = _mm512_add_pd(s, a);
+        s = _mm512_mask_sub_pd(s, _mm512_cmp_pd_mask(s, n, _CMP_GE_OQ), s, n);
+    }
+
+    _mm512_storeu_si512((void *) u, _mm512_cvtpd_epu64(s));
+
+    r = 0;
+    for (i = 0; i < 8; i++)
+        r = nmod_add(r, u[i], mod);
+
+    for (i = len - len % 8; i < len; i++)
+        r = nmod_add(r, nmod_mul(vec1[i], vec2[i], mod), mod);
+
+    return r;
+}
+
+#endif
@@ -20,6 +20,43 @@ _nmod_vec_dot(mp_srcptr vec1, mp_srcptr vec2, slong len, nmod_t mod, int nlimbs)
 {
     mp_limb_t res;
     slong i;
+
+#if NMOD_VEC_SIMD
+    if (len >= NMOD_VEC_SIMD_CUTOFF && mod.n <= (UWORD(1) << (FLINT_BITS / 2)))
+    {
+        switch (_nmod_vec_simd_level())
+        {
+#if HAVE_AVX512_DISPATCH
+            case NMOD_VEC_SIMD_AVX512:
+                return _nmod_vec_dot_32_avx512(vec1, vec2, len, mod);
+#endif
+#if HAVE_AVX2_DISPATCH
+            case NMOD_VEC_SIMD_AVX2:
+                return _nmod_vec_dot_32_avx2(vec1, vec2, len, mod);
+#endif
+            default:
+                break;
+        }
+    }
+    else if (len >= NMOD_VEC_SIMD_CUTOFF &&
+             mod.norm > FLINT_BITS - NMOD_VEC_SIMD_FP_BITS)
+    {
+        switch (_nmod_vec_simd_level())
+        {
+#if HAVE_AVX512_DISPATCH
+            case NMOD_VEC_SIMD_AVX512:
+                return _nmod_vec_dot_fp_avx512(vec1, vec2, len, mod);
+#endif
+#if HAVE_AVX2_DISPATCH
+            case NMOD_VEC_SIMD_AVX2:
+                return _nmod_vec_dot_fp_avx2(vec1, vec2, len, mod);
+#endif
+            default:
+                break;
+        }
+    }
+#endif
+
     NMOD_VEC_DOT(res, i, len, vec1[i], vec2[i], mod, nlimbs);
     return res;
 }
@@ -0,0 +1,44 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+
+mp_limb_t _nmod_vec_mont_dot(mp_srcptr vec1, mp_srcptr vec2, slong len,
+                                                               n_mont_t mont)
+{
+    mp_limb_t s2, s1, s0, hi, lo;
+    slong i;
+
+    /*
+       The products are summed exactly in three limbs and reduced once:
+       with T = s2 R^2 + s1 R + s0, where R = 2^FLINT_BITS, the result
+       T / R = s2 R + s1 + s0 / R is REDC applied to (s2 R + s1) mod n
+       and s0.
+    */
+    s2 = s1 = s0 = 0;
+    for (i = 0; i < len; i++)
+    {
+        umul_ppmm(hi, lo, vec1[i], vec2[i]);
+        add_sssaaaaaa(s2, s1, s0, s2, s1, s0, 0, hi, lo);
+    }
+
+    if (s2 >= mont.n)
+        s2 %= mont.n;
+
+    /* s2 R = REDC(s2 R^2) and s1 = REDC(REDC(s1) R^2) */
+    hi = n_addmod(n_mont_mul(s2, mont.r2, mont),
+                  n_mont_mul(n_mont_get_ui(s1, mont), mont.r2, mont), mont.n);
+
+    return n_mont_redc(hi, s0, mont);
+}
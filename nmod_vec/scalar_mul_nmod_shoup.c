@@ -21,6 +21,29 @@ void _nmod_vec_scalar_mul_nmod_shoup(mp_ptr res, mp_srcptr vec,
 {
     slong i;
     mp_limb_t w_pr;
+
+#if NMOD_VEC_SIMD
+    if (len >= NMOD_VEC_SIMD_CUTOFF &&
+        mod.norm > FLINT_BITS - NMOD_VEC_SIMD_FP_BITS)
+    {
+        switch (_nmod_vec_simd_level())
+        {
+#if HAVE_AVX512_DISPATCH
+            case NMOD_VEC_SIMD_AVX512:
+                _nmod_vec_scalar_mul_nmod_fp_avx512(res, vec, len, c, mod);
+                return;
+#endif
+#if HAVE_AVX2_DISPATCH
+            case NMOD_VEC_SIMD_AVX2:
+                _nmod_vec_scalar_mul_nmod_fp_avx2(res, vec, len, c, mod);
+                return;
+#endif
+            default:
+                break;
+        }
+    }
+#endif
+
     w_pr = n_mulmod_precomp_shoup(c, mod.n);
     for (i = 0; i < len; i++)
         res[i] = n_mulmod_shoup(c, vec[i], w_pr, mod.n);
@@ -0,0 +1,60 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+
+static int _nmod_vec_simd_hw = -1;
+static int _nmod_vec_simd = -1;
+
+/*
+   The instruction set is detected once, on first use. Races between
+   threads are harmless as they all store the same value.
+*/
+static void _nmod_vec_simd_init(void)
+{
+    int level = NMOD_VEC_SIMD_NONE;
+
+#if NMOD_VEC_SIMD
+    __builtin_cpu_init();
+
+#if HAVE_AVX2_DISPATCH
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+        level = NMOD_VEC_SIMD_AVX2;
+#endif
+
+#if HAVE_AVX512_DISPATCH
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq"))
+        level = NMOD_VEC_SIMD_AVX512;
+#endif
+#endif
+
+    _nmod_vec_simd_hw = level;
+    _nmod_vec_simd = level;
+}
+
+int _nmod_vec_simd_level(void)
+{
+    if (_nmod_vec_simd < 0)
+        _nmod_vec_simd_init();
+
+    return _nmod_vec_simd;
+}
+
+void _nmod_vec_set_simd_level(int level)
+{
+    if (_nmod_vec_simd_hw < 0)
+        _nmod_vec_simd_init();
+
+    _nmod_vec_simd = FLINT_MIN(FLINT_MAX(level, NMOD_VEC_SIMD_NONE),
+                               _nmod_vec_simd_hw);
+}
@@ -19,6 +19,28 @@ void _nmod_vec_sub(mp_ptr res, mp_srcptr vec1,
                    mp_srcptr vec2, slong len, nmod_t mod)
 {
     slong i;
+
+#if NMOD_VEC_SIMD
+    if (len >= NMOD_VEC_SIMD_CUTOFF && mod.norm >= 2)
+    {
+        switch (_nmod_vec_simd_level())
+        {
+#if HAVE_AVX512_DISPATCH
+            case NMOD_VEC_SIMD_AVX512:
+                _nmod_vec_sub_avx512(res, vec1, vec2, len, mod);
+                return;
+#endif
+#if HAVE_AVX2_DISPATCH
+            case NMOD_VEC_SIMD_AVX2:
+                _nmod_vec_sub_avx2(res, vec1, vec2, len, mod);
+                return;
+#endif
+            default:
+                break;
+        }
+    }
+#endif
+
     if (mod.norm)
     {
         for (i = 0 ; i < len; i++)
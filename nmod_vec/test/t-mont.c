@@ -0,0 +1,125 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "nmod_vec.h"
+
+int
+main(void)
+{
+    slong i, j;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mont....");
+    fflush(stdout);
+
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        slong len = n_randint(state, 100) + 1;
+        mp_limb_t n, c, cm, d1, d2;
+        mp_ptr a, b, am, bm, r1, r2;
+        n_mont_t mont;
+        nmod_t mod;
+
+        n = n_randtest_not_zero(state) | 1;
+        n_mont_init(&mont, n);
+        nmod_init(&mod, n);
+
+        a = _nmod_vec_init(len);
+        b = _nmod_vec_init(len);
+        am = _nmod_vec_init(len);
+        bm = _nmod_vec_init(len);
+        r1 = _nmod_vec_init(len);
+        r2 = _nmod_vec_init(len);
+
+        _nmod_vec_randtest(a, state, len, mod);
+        _nmod_vec_randtest(b, state, len, mod);
+        c = n_randint(state, n);
+        cm = n_mont_set_ui(c, mont);
+
+        _nmod_vec_to_mont(am, a, len, mont);
+        _nmod_vec_to_mont(bm, b, len, mont);
+
+        /* round trip */
+        _nmod_vec_from_mont(r1, am, len, mont);
+        if (!_nmod_vec_equal(r1, a, len))
+        {
+            flint_printf("FAIL (conversion):\n");
+            flint_printf("n = %wu, len = %wd\n", n, len);
+            abort();
+        }
+
+        /* pointwise product */
+        _nmod_vec_mont_mul(r1, am, bm, len, mont);
+        _nmod_vec_from_mont(r1, r1, len, mont);
+        for (j = 0; j < len; j++)
+            r2[j] = nmod_mul(a[j], b[j], mod);
+        if (!_nmod_vec_equal(r1, r2, len))
+        {
+            flint_printf("FAIL (mul):\n");
+            flint_printf("n = %wu, len = %wd\n", n, len);
+            abort();
+        }
+
+        /* scalar multiplication */
+        _nmod_vec_mont_scalar_mul(r1, am, len, cm, mont);
+        _nmod_vec_from_mont(r1, r1, len, mont);
+        _nmod_vec_scalar_mul_nmod(r2, a, len, c, mod);
+        if (!_nmod_vec_equal(r1, r2, len))
+        {
+            flint_printf("FAIL (scalar_mul):\n");
+            flint_printf("n = %wu, len = %wd\n", n, len);
+            abort();
+        }
+
+        /* scalar addmul */
+        _nmod_vec_set(r1, bm, len);
+        _nmod_vec_mont_scalar_addmul(r1, am, len, cm, mont);
+        _nmod_vec_from_mont(r1, r1, len, mont);
+        _nmod_vec_set(r2, b, len);
+        _nmod_vec_scalar_addmul_nmod(r2, a, len, c, mod);
+        if (!_nmod_vec_equal(r1, r2, len))
+        {
+            flint_printf("FAIL (scalar_addmul):\n");
+            flint_printf("n = %wu, len = %wd\n", n, len);
+            abort();
+        }
+
+        /* dot product */
+        d1 = n_mont_get_ui(_nmod_vec_mont_dot(am, bm, len, mont), mont);
+        d2 = 0;
+        for (j = 0; j < len; j++)
+            d2 = nmod_add(d2, nmod_mul(a[j], b[j], mod), mod);
+        if (d1 != d2)
+        {
+            flint_printf("FAIL (dot):\n");
+            flint_printf("n = %wu, len = %wd, d1 = %wu, d2 = %wu\n",
+                                                              n, len, d1, d2);
+            abort();
+        }
+
+        _nmod_vec_clear(a);
+        _nmod_vec_clear(b);
+        _nmod_vec_clear(am);
+        _nmod_vec_clear(bm);
+        _nmod_vec_clear(r1);
+        _nmod_vec_clear(r2);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,147 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "nmod_vec.h"
+#include "ulong_extras.h"
+
+int
+main(void)
+{
+    int i, level, max_level;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("simd....");
+    fflush(stdout);
+
+    max_level = _nmod_vec_simd_level();
+
+    /* Check every available kernel level against the generic code */
+    for (i = 0; i < 2000 * flint_test_multiplier(); i++)
+    {
+        slong len = n_randint(state, 200) + 1;
+        mp_limb_t n, c, d1, d2;
+        nmod_t mod;
+        mp_ptr a, b, r1, r2;
+
+        switch (n_randint(state, 4))
+        {
+            case 0:
+                n = n_randtest_bits(state, n_randint(state, 32) + 1);
+                break;
+            case 1:
+                n = n_randtest_bits(state, n_randint(state, 50) + 1);
+                break;
+            case 2:
+                n = (UWORD(1) << (n_randint(state, 2) ? 32 : 50))
+                        - n_randint(state, 3);
+                break;
+            default:
+                n = n_randtest_not_zero(state);
+        }
+        if (n == 0)
+            n = 1;
+
+        nmod_init(&mod, n);
+
+        a = _nmod_vec_init(len);
+        b = _nmod_vec_init(len);
+        r1 = _nmod_vec_init(len);
+        r2 = _nmod_vec_init(len);
+
+        _nmod_vec_randtest(a, state, len, mod);
+        _nmod_vec_randtest(b, state, len, mod);
+        c = n_randint(state, n);
+
+        for (level = NMOD_VEC_SIMD_AVX2; level <= max_level; level++)
+        {
+            _nmod_vec_set_simd_level(NMOD_VEC_SIMD_NONE);
+            _nmod_vec_add(r1, a, b, len, mod);
+            _nmod_vec_set_simd_level(level);
+            _nmod_vec_add(r2, a, b, len, mod);
+
+            if (!_nmod_vec_equal(r1, r2, len))
+            {
+                flint_printf("FAIL (add):\n");
+                flint_printf("level = %d, len = %wd, n = %wu\n", level, len, n);
+                abort();
+            }
+
+            _nmod_vec_set_simd_level(NMOD_VEC_SIMD_NONE);
+            _nmod_vec_sub(r1, a, b, len, mod);
+            _nmod_vec_set_simd_level(level);
+            _nmod_vec_sub(r2, a, b, len, mod);
+
+            if (!_nmod_vec_equal(r1, r2, len))
+            {
+                flint_printf("FAIL (sub):\n");
+                flint_printf("level = %d, len = %wd, n = %wu\n", level, len, n);
+                abort();
+            }
+
+            _nmod_vec_set_simd_level(NMOD_VEC_SIMD_NONE);
+            _nmod_vec_scalar_mul_nmod(r1, a, len, c, mod);
+            _nmod_vec_set_simd_level(level);
+            _nmod_vec_scalar_mul_nmod(r2, a, len, c, mod);
+
+            if (!_nmod_vec_equal(r1, r2, len))
+            {
+                flint_printf("FAIL (scalar_mul_nmod):\n");
+                flint_printf("level = %d, len = %wd, n = %wu\n", level, len, n);
+                abort();
+            }
+
+            _nmod_vec_set(r1, b, len);
+            _nmod_vec_set(r2, b, len);
+            _nmod_vec_set_simd_level(NMOD_VEC_SIMD_NONE);
+            _nmod_vec_scalar_addmul_nmod(r1, a, len, c, mod);
+            _nmod_vec_set_simd_level(level);
+            _nmod_vec_scalar_addmul_nmod(r2, a, len, c, mod);
+
+            if (!_nmod_vec_equal(r1, r2, len))
+            {
+                flint_printf("FAIL (scalar_addmul_nmod):\n");
+                flint_printf("level = %d, len = %wd, n = %wu\n", level, len, n);
+                abort();
+            }
+
+            _nmod_vec_set_simd_level(NMOD_VEC_SIMD_NONE);
+            d1 = _nmod_vec_dot(a, b, len, mod,
+                               _nmod_vec_dot_bound_limbs(len, mod));
+            _nmod_vec_set_simd_level(level);
+            d2 = _nmod_vec_dot(a, b, len, mod,
+                               _nmod_vec_dot_bound_limbs(len, mod));
+
+            if (d1 != d2)
+            {
+                flint_printf("FAIL (dot):\n");
+                flint_printf("level = %d, len = %wd, n = %wu\n", level, len, n);
+                flint_printf("d1 = %wu, d2 = %wu\n", d1, d2);
+                abort();
+            }
+        }
+
+        _nmod_vec_set_simd_level(max_level);
+
+        _nmod_vec_clear(a);
+        _nmod_vec_clear(b);
+        _nmod_vec_clear(r1);
+        _nmod_vec_clear(r2);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
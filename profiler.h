@@ -242,6 +242,11 @@ FLINT_DLL void prof_repeat(double* min, double* max, profile_target_t target, vo
             meminfo->rss / 1024.0, meminfo->hwm / 1024.0); \
     } while (0);
 
+#define SHOW_MEMSTATS \
+    do { \
+        flint_memstats_print(); \
+    } while (0);
+
 #ifdef __cplusplus
 }
 #endif
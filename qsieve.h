@@ -18,6 +18,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
+#include <pthread.h>
 
 #include "flint.h"
 #include "fmpz.h"
@@ -25,10 +26,6 @@
 #include "fmpz_vec.h"
 #include "fmpz_factor.h"
 
-#if HAVE_OPENMP
-#include <omp.h> /* must include flint.h first */
-#endif
-
 #ifdef __cplusplus
  extern "C" {
 #endif
@@ -163,11 +160,16 @@ typedef struct qs_s
 
    qs_poly_s * poly;         /* poly data per thread */
 
+   slong num_threads;        /* number of threads sieving */
+   slong index_j;            /* index of the next B-polynomial to sieve */
+   pthread_mutex_t mutex;    /* protects the poly and relation data */
+
    /***************************************************************************
                        RELATION DATA
    ***************************************************************************/
 
    FILE * siqs;          /* pointer to file for storing relations */
+   char * fname;         /* name of the relation file, NULL if anonymous */
 
    slong full_relation;  /* number of full relations */
    slong num_cycles;     /* number of possible full relations from partials */
@@ -356,6 +358,12 @@ slong qsieve_insert_relation(qs_t qs_inf, fmpz_t Y);
 
 void qsieve_write_to_file(qs_t qs_inf, mp_limb_t prime, fmpz_t Y, qs_poly_t poly);
 
+void qsieve_set_relation_dir(const char * dir);
+
+void qsieve_open_relation_file(qs_t qs_inf);
+
+void qsieve_close_relation_file(qs_t qs_inf);
+
 hash_t * qsieve_get_table_entry(qs_t qs_inf, mp_limb_t prime);
 
 void qsieve_add_to_hashtable(qs_t qs_inf, mp_limb_t prime);
@@ -22,6 +22,7 @@ benefit from your work.
 
 
 #include "qsieve.h"
+#include "thread_pool.h"
 
 #define BIT(x) (((uint64_t)(1)) << (x))
 
@@ -552,6 +553,441 @@ void mul_trans_MxN_Nx64(slong dense_rows, slong ncols,
 	}
 }
 
+/*-------------------------------------------------------------------*/
+
+/* Inside the iteration the matrix B is used in a packed form. Two
+   compressed copies are made, a row major one for computing B*x and
+   a column major one for computing B'*y, so that both products are
+   gathers which can be split between threads without any write
+   conflicts. Rows are renumbered in order of decreasing weight so
+   that the heavy rows, which are touched by most columns, are
+   adjacent in memory, and each copy is cut into blocks whose slice
+   of the input vector fits in cache. Intermediate vectors B*x are
+   in the renumbered row order, which is invisible to the caller. */
+
+#define LANCZOS_BLOCK_WORDS 32768    /* words of a vector per cache block */
+#define LANCZOS_THREAD_CUTOFF 10000  /* columns needed for using threads */
+
+typedef struct {
+	slong nrows;		/* number of (renumbered) rows */
+	slong ncols;
+	slong num_rblocks;	/* blocks of rows in the column major copy */
+	slong num_cblocks;	/* blocks of columns in the row major copy */
+	slong *col_start;	/* entries of column c in row block b start
+				   at col_start[b*ncols + c] */
+	uint32_t *col_entries;	/* renumbered row indices */
+	slong *row_start;	/* entries of row r in column block b start
+				   at row_start[b*nrows + r] */
+	uint32_t *row_entries;	/* column indices */
+	slong num_tasks;
+	slong *row_split;	/* row ranges of the tasks for B*x */
+	slong *col_split;	/* column ranges of the tasks for B'*y */
+} packed_matrix_t;
+
+typedef struct {
+	slong weight;
+	slong row;
+} row_weight_t;
+
+static int row_weight_cmp(const void *a, const void *b) {
+
+	const row_weight_t *ra = (const row_weight_t *) a;
+	const row_weight_t *rb = (const row_weight_t *) b;
+
+	if (ra->weight != rb->weight)
+		return (ra->weight > rb->weight) ? -1 : 1;
+
+	return (ra->row > rb->row) - (ra->row < rb->row);
+}
+
+/*-------------------------------------------------------------------*/
+static void split_entries(slong *split, slong *start, slong len,
+				slong num_blocks, slong num_tasks) {
+
+	/* Cut 0..len into num_tasks ranges containing about the
+	   same number of entries, given the offsets start[] of
+	   a blocked compressed matrix with len lines per block */
+
+	slong i, t, b, total, count;
+
+	total = start[num_blocks * len];
+	split[0] = 0;
+
+	for (i = count = 0, t = 1; i < len && t < num_tasks; i++) {
+		for (b = 0; b < num_blocks; b++)
+			count += start[b*len + i + 1] - start[b*len + i];
+
+		while (t < num_tasks && count * num_tasks >= total * t)
+			split[t++] = i + 1;
+	}
+
+	while (t <= num_tasks)
+		split[t++] = len;
+}
+
+/*-------------------------------------------------------------------*/
+static void packed_matrix_init(packed_matrix_t *P, slong nrows,
+				slong dense_rows, slong ncols, 
+				la_col_t *A, slong num_tasks) {
+
+	slong i, j, b, r, nnz;
+	slong *perm, *pos;
+	row_weight_t *rw;
+
+	P->nrows = nrows;
+	P->ncols = ncols;
+	P->num_rblocks = (nrows + LANCZOS_BLOCK_WORDS - 1) / LANCZOS_BLOCK_WORDS;
+	P->num_cblocks = (ncols + LANCZOS_BLOCK_WORDS - 1) / LANCZOS_BLOCK_WORDS;
+	P->num_rblocks = FLINT_MAX(P->num_rblocks, 1);
+	P->num_cblocks = FLINT_MAX(P->num_cblocks, 1);
+	P->num_tasks = num_tasks;
+
+	/* renumber the rows by decreasing weight; the dense rows
+	   are simply treated as ordinary rows */
+
+	rw = (row_weight_t *)flint_malloc(nrows * sizeof(row_weight_t));
+	for (i = 0; i < nrows; i++) {
+		rw[i].weight = 0;
+		rw[i].row = i;
+	}
+
+	for (i = nnz = 0; i < ncols; i++) {
+		la_col_t *col = A + i;
+		slong *dense = col->data + col->weight;
+
+		for (j = 0; j < col->weight; j++)
+			rw[col->data[j]].weight++;
+		nnz += col->weight;
+
+		for (j = 0; j < dense_rows; j++) {
+			if (dense[j / 32] & ((slong)1 << (j % 32))) {
+				rw[j].weight++;
+				nnz++;
+			}
+		}
+	}
+
+	qsort(rw, nrows, sizeof(row_weight_t), row_weight_cmp);
+
+	perm = (slong *)flint_malloc(nrows * sizeof(slong));
+	for (i = 0; i < nrows; i++)
+		perm[rw[i].row] = i;
+
+	P->col_start = (slong *)flint_calloc(P->num_rblocks * ncols + 1, 
+						sizeof(slong));
+	P->row_start = (slong *)flint_calloc(P->num_cblocks * nrows + 1, 
+						sizeof(slong));
+	P->col_entries = (uint32_t *)flint_malloc((nnz + 1) * sizeof(uint32_t));
+	P->row_entries = (uint32_t *)flint_malloc((nnz + 1) * sizeof(uint32_t));
+
+	/* count the entries of each line of each block, then 
+	   turn the counts into offsets */
+
+	for (i = 0; i < ncols; i++) {
+		la_col_t *col = A + i;
+		slong *dense = col->data + col->weight;
+
+		for (j = 0; j < col->weight + dense_rows; j++) {
+			if (j < col->weight)
+				r = perm[col->data[j]];
+			else if (dense[(j - col->weight) / 32] & 
+				    ((slong)1 << ((j - col->weight) % 32)))
+				r = perm[j - col->weight];
+			else
+				continue;
+
+			b = r / LANCZOS_BLOCK_WORDS;
+			P->col_start[b*ncols + i + 1]++;
+			b = i / LANCZOS_BLOCK_WORDS;
+			P->row_start[b*nrows + r + 1]++;
+		}
+	}
+
+	for (i = 0; i < P->num_rblocks * ncols; i++)
+		P->col_start[i + 1] += P->col_start[i];
+	for (i = 0; i < P->num_cblocks * nrows; i++)
+		P->row_start[i + 1] += P->row_start[i];
+
+	/* fill in the entries; columns are traversed in order, so
+	   the column indices of each row come out sorted */
+
+	pos = (slong *)flint_malloc(FLINT_MAX(P->num_rblocks * ncols,
+				P->num_cblocks * nrows) * sizeof(slong));
+	memcpy(pos, P->row_start, P->num_cblocks * nrows * sizeof(slong));
+
+	for (i = 0; i < ncols; i++) {
+		la_col_t *col = A + i;
+		slong *dense = col->data + col->weight;
+
+		for (j = 0; j < col->weight + dense_rows; j++) {
+			if (j < col->weight)
+				r = perm[col->data[j]];
+			else if (dense[(j - col->weight) / 32] & 
+				    ((slong)1 << ((j - col->weight) % 32)))
+				r = perm[j - col->weight];
+			else
+				continue;
+
+			b = i / LANCZOS_BLOCK_WORDS;
+			P->row_entries[pos[b*nrows + r]++] = (uint32_t) i;
+		}
+	}
+
+	/* the row major copy, read column by column, gives the
+	   column major copy with sorted row indices */
+
+	memcpy(pos, P->col_start, P->num_rblocks * ncols * sizeof(slong));
+
+	for (b = 0; b < P->num_cblocks; b++) {
+		for (r = 0; r < nrows; r++) {
+			slong k = r / LANCZOS_BLOCK_WORDS;
+
+			for (j = P->row_start[b*nrows + r]; 
+					j < P->row_start[b*nrows + r + 1]; j++) {
+				i = P->row_entries[j];
+				P->col_entries[pos[k*ncols + i]++] = (uint32_t) r;
+			}
+		}
+	}
+
+	/* split both products into tasks with the same number 
+	   of entries */
+
+	P->row_split = (slong *)flint_malloc((num_tasks + 1) * sizeof(slong));
+	P->col_split = (slong *)flint_malloc((num_tasks + 1) * sizeof(slong));
+	split_entries(P->row_split, P->row_start, nrows, 
+					P->num_cblocks, num_tasks);
+	split_entries(P->col_split, P->col_start, ncols, 
+					P->num_rblocks, num_tasks);
+
+	flint_free(pos);
+	flint_free(perm);
+	flint_free(rw);
+}
+
+/*-------------------------------------------------------------------*/
+static void packed_matrix_clear(packed_matrix_t *P) {
+
+	flint_free(P->col_start);
+	flint_free(P->col_entries);
+	flint_free(P->row_start);
+	flint_free(P->row_entries);
+	flint_free(P->row_split);
+	flint_free(P->col_split);
+}
+
+/*-------------------------------------------------------------------*/
+typedef struct {
+	packed_matrix_t *P;
+	uint64_t *x;
+	uint64_t *b;
+	slong start;
+	slong stop;
+} packed_mul_arg_t;
+
+static void mul_packed_worker(void *arg_ptr) {
+
+	/* b[r] = sum of x[c] over the entries (r, c) of B,
+	   for the rows r in [start, stop) */
+
+	packed_mul_arg_t *arg = (packed_mul_arg_t *) arg_ptr;
+	packed_matrix_t *P = arg->P;
+	uint64_t *x = arg->x;
+	uint64_t *b = arg->b;
+	slong i, j, blk;
+
+	memset(b + arg->start, 0, (arg->stop - arg->start) * sizeof(uint64_t));
+
+	for (blk = 0; blk < P->num_cblocks; blk++) {
+		slong *start = P->row_start + blk * P->nrows;
+
+		for (i = arg->start; i < arg->stop; i++) {
+			uint64_t accum = b[i];
+
+			for (j = start[i]; j < start[i + 1]; j++)
+				accum ^= x[P->row_entries[j]];
+			b[i] = accum;
+		}
+	}
+}
+
+static void mul_trans_packed_worker(void *arg_ptr) {
+
+	/* b[c] = sum of x[r] over the entries (r, c) of B,
+	   for the columns c in [start, stop) */
+
+	packed_mul_arg_t *arg = (packed_mul_arg_t *) arg_ptr;
+	packed_matrix_t *P = arg->P;
+	uint64_t *x = arg->x;
+	uint64_t *b = arg->b;
+	slong i, j, blk;
+
+	memset(b + arg->start, 0, (arg->stop - arg->start) * sizeof(uint64_t));
+
+	for (blk = 0; blk < P->num_rblocks; blk++) {
+		slong *start = P->col_start + blk * P->ncols;
+
+		for (i = arg->start; i < arg->stop; i++) {
+			uint64_t accum = b[i];
+
+			for (j = start[i]; j < start[i + 1]; j++)
+				accum ^= x[P->col_entries[j]];
+			b[i] = accum;
+		}
+	}
+}
+
+static void mul_packed(packed_matrix_t *P, uint64_t *x, 
+				uint64_t *b, int trans) {
+
+	/* b = B*x if trans is 0, b = B'*x otherwise; for B*x
+	   the rows of b are in the renumbered order, which is 
+	   also the order expected of x when computing B'*x */
+
+	packed_mul_arg_t *args;
+	slong *split = trans ? P->col_split : P->row_split;
+	slong i;
+
+	args = (packed_mul_arg_t *)flint_malloc(P->num_tasks * 
+					sizeof(packed_mul_arg_t));
+
+	for (i = 0; i < P->num_tasks; i++) {
+		args[i].P = P;
+		args[i].x = x;
+		args[i].b = b;
+		args[i].start = split[i];
+		args[i].stop = split[i + 1];
+	}
+
+	if (P->num_tasks == 1) {
+		if (trans)
+			mul_trans_packed_worker(args);
+		else
+			mul_packed_worker(args);
+	} else
+		flint_parallel_do(trans ? mul_trans_packed_worker : 
+			mul_packed_worker, args, P->num_tasks, 
+			sizeof(packed_mul_arg_t), P->num_tasks);
+
+	flint_free(args);
+}
+
+/*-------------------------------------------------------------------*/
+typedef struct {
+	uint64_t *v;
+	uint64_t *x;
+	uint64_t *c;
+	uint64_t *y;
+	slong start;
+	slong stop;
+} dense_mul_arg_t;
+
+static void mul_Nx64_64x64_acc_worker(void *arg_ptr) {
+
+	/* XOR rows start to stop of v[][] * x[][] into y[][],
+	   using the table c[][] computed by the caller */
+
+	dense_mul_arg_t *arg = (dense_mul_arg_t *) arg_ptr;
+	uint64_t *c = arg->c;
+	uint64_t *v = arg->v;
+	uint64_t *y = arg->y;
+	uint64_t word;
+	slong i;
+
+	for (i = arg->start; i < arg->stop; i++) {
+		word = v[i];
+		y[i] ^=  c[ 0*256 + ((word>> 0) & 0xff) ]
+		       ^ c[ 1*256 + ((word>> 8) & 0xff) ]
+		       ^ c[ 2*256 + ((word>>16) & 0xff) ]
+		       ^ c[ 3*256 + ((word>>24) & 0xff) ]
+		       ^ c[ 4*256 + ((word>>32) & 0xff) ]
+		       ^ c[ 5*256 + ((word>>40) & 0xff) ]
+		       ^ c[ 6*256 + ((word>>48) & 0xff) ]
+		       ^ c[ 7*256 + ((word>>56)       ) ];
+	}
+}
+
+static void mul_Nx64_64x64_acc_threaded(uint64_t *v, uint64_t *x, 
+			uint64_t *c, uint64_t *y, slong n, slong num_tasks) {
+
+	dense_mul_arg_t *args;
+	slong i;
+
+	if (num_tasks == 1) {
+		mul_Nx64_64x64_acc(v, x, c, y, n);
+		return;
+	}
+
+	precompute_Nx64_64x64(x, c);
+
+	args = (dense_mul_arg_t *)flint_malloc(num_tasks * 
+					sizeof(dense_mul_arg_t));
+
+	for (i = 0; i < num_tasks; i++) {
+		args[i].v = v;
+		args[i].c = c;
+		args[i].y = y;
+		args[i].start = (n * i) / num_tasks;
+		args[i].stop = (n * (i + 1)) / num_tasks;
+	}
+
+	flint_parallel_do(mul_Nx64_64x64_acc_worker, args, num_tasks,
+				sizeof(dense_mul_arg_t), num_tasks);
+
+	flint_free(args);
+}
+
+static void mul_64xN_Nx64_worker(void *arg_ptr) {
+
+	/* xy[][] = transpose(x[][]) * y[][], restricted to
+	   rows start to stop of x and y; c[][] is the private 
+	   scratch space of the task */
+
+	dense_mul_arg_t *arg = (dense_mul_arg_t *) arg_ptr;
+
+	mul_64xN_Nx64(arg->v + arg->start, arg->y + arg->start, 
+			arg->c, arg->x, arg->stop - arg->start);
+}
+
+static void mul_64xN_Nx64_threaded(uint64_t *x, uint64_t *y,
+		uint64_t *c, uint64_t *xy, slong n, slong num_tasks) {
+
+	dense_mul_arg_t *args;
+	uint64_t *scratch;
+	slong i, j;
+
+	if (num_tasks == 1) {
+		mul_64xN_Nx64(x, y, c, xy, n);
+		return;
+	}
+
+	args = (dense_mul_arg_t *)flint_malloc(num_tasks * 
+					sizeof(dense_mul_arg_t));
+	scratch = (uint64_t *)flint_malloc(num_tasks * (256 * 8 + 64) *
+					sizeof(uint64_t));
+
+	for (i = 0; i < num_tasks; i++) {
+		args[i].v = x;
+		args[i].y = y;
+		args[i].c = scratch + i * (256 * 8 + 64);
+		args[i].x = args[i].c + 256 * 8;
+		args[i].start = (n * i) / num_tasks;
+		args[i].stop = (n * (i + 1)) / num_tasks;
+	}
+
+	flint_parallel_do(mul_64xN_Nx64_worker, args, num_tasks,
+				sizeof(dense_mul_arg_t), num_tasks);
+
+	memcpy(xy, args[0].x, 64 * sizeof(uint64_t));
+	for (i = 1; i < num_tasks; i++) {
+		for (j = 0; j < 64; j++)
+			xy[j] ^= args[i].x[j];
+	}
+
+	flint_free(scratch);
+	flint_free(args);
+}
+
 /*-----------------------------------------------------------------------*/
 static void transpose_vector(slong ncols, uint64_t *v, uint64_t **trans) {
 
@@ -713,7 +1149,8 @@ uint64_t * block_lanczos(flint_rand_t state, slong nrows,
 	slong n = ncols;
 	slong dim0, dim1;
 	uint64_t mask0, mask1;
-	slong vsize;
+	slong vsize, num_tasks;
+	packed_matrix_t P;
 
 	/* allocate all of the size-n variables. Note that because
 	   B has been preprocessed to ignore singleton rows, the
@@ -744,6 +1181,15 @@ uint64_t * block_lanczos(flint_rand_t state, slong nrows,
 	f = (uint64_t *)flint_malloc(64 * sizeof(uint64_t));
 	f2 = (uint64_t *)flint_malloc(64 * sizeof(uint64_t));
 
+	/* pack the matrix, with one task per thread if the
+	   matrix is large enough */
+
+	num_tasks = 1;
+	if (ncols >= LANCZOS_THREAD_CUTOFF)
+		num_tasks = flint_get_num_threads();
+
+	packed_matrix_init(&P, vsize, dense_rows, ncols, B, num_tasks);
+
 	/* The iterations computes v[0], vt_a_v[0],
 	   vt_a2_v[0], s[0] and winv[0]. Subscripts larger
 	   than zero represent past versions of these
@@ -777,8 +1223,8 @@ uint64_t * block_lanczos(flint_rand_t state, slong nrows,
 #endif
 
 	memcpy(x, v[0], vsize * sizeof(uint64_t));
-	mul_MxN_Nx64(vsize, dense_rows, ncols, B, v[0], scratch);
-	mul_trans_MxN_Nx64(dense_rows, ncols, B, scratch, v[0]);
+	mul_packed(&P, v[0], scratch, 0);
+	mul_packed(&P, scratch, v[0], 1);
 	memcpy(v0, v[0], vsize * sizeof(uint64_t));
 
 	/* perform the iteration */
@@ -790,13 +1236,15 @@ uint64_t * block_lanczos(flint_rand_t state, slong nrows,
 		   version of B, or B'B (apostrophe means 
 		   transpose). Use "A" to refer to B'B  */
 
-		mul_MxN_Nx64(vsize, dense_rows, ncols, B, v[0], scratch);
-		mul_trans_MxN_Nx64(dense_rows, ncols, B, scratch, vnext);
+		mul_packed(&P, v[0], scratch, 0);
+		mul_packed(&P, scratch, vnext, 1);
 
 		/* compute v0'*A*v0 and (A*v0)'(A*v0) */
 
-		mul_64xN_Nx64(v[0], vnext, scratch, vt_a_v[0], n);
-		mul_64xN_Nx64(vnext, vnext, scratch, vt_a2_v[0], n);
+		mul_64xN_Nx64_threaded(v[0], vnext, scratch, vt_a_v[0], 
+							n, num_tasks);
+		mul_64xN_Nx64_threaded(vnext, vnext, scratch, vt_a2_v[0], 
+							n, num_tasks);
 
 		/* if the former is orthogonal to itself, then
 		   the iteration has finished */
@@ -863,15 +1311,19 @@ uint64_t * block_lanczos(flint_rand_t state, slong nrows,
 		for (i = 0; i < n; i++)
 			vnext[i] = vnext[i] & mask0;
 
-		mul_Nx64_64x64_acc(v[0], d, scratch, vnext, n);
-		mul_Nx64_64x64_acc(v[1], e, scratch, vnext, n);
-		mul_Nx64_64x64_acc(v[2], f, scratch, vnext, n);
+		mul_Nx64_64x64_acc_threaded(v[0], d, scratch, vnext, 
+							n, num_tasks);
+		mul_Nx64_64x64_acc_threaded(v[1], e, scratch, vnext, 
+							n, num_tasks);
+		mul_Nx64_64x64_acc_threaded(v[2], f, scratch, vnext, 
+							n, num_tasks);
 		
 		/* update the computed solution 'x' */
 
-		mul_64xN_Nx64(v[0], v0, scratch, d, n);
+		mul_64xN_Nx64_threaded(v[0], v0, scratch, d, n, num_tasks);
 		mul_64x64_64x64(winv[0], d, d);
-		mul_Nx64_64x64_acc(v[0], d, scratch, x, n);
+		mul_Nx64_64x64_acc_threaded(v[0], d, scratch, x, 
+							n, num_tasks);
 
 		/* rotate all the variables */
 
@@ -901,6 +1353,7 @@ uint64_t * block_lanczos(flint_rand_t state, slong nrows,
 
 	/* free unneeded storage */
 
+	packed_matrix_clear(&P);
         flint_free(vnext);
 	flint_free(scratch);
 	flint_free(v0);
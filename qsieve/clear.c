@@ -22,4 +22,6 @@ void qsieve_clear(qs_t qs_inf)
 
     qs_inf->factor_base = NULL;
     qs_inf->sqrts       = NULL;
+
+    pthread_mutex_destroy(&qs_inf->mutex);
 }
@@ -11,6 +11,7 @@
 */
 
 #include "qsieve.h"
+#include "thread_pool.h"
 
 #include <time.h>
 
@@ -398,12 +399,13 @@ slong qsieve_evaluate_candidate(qs_t qs_inf, ulong i, unsigned char * sieve, qs_
 
          poly->num_factors = num_factors;
 
-#pragma omp critical
-         {
-            qsieve_write_to_file(qs_inf, 1, Y, poly);
-         
-            qs_inf->full_relation++;
-         }
+         pthread_mutex_lock(&qs_inf->mutex);
+
+         qsieve_write_to_file(qs_inf, 1, Y, poly);
+
+         qs_inf->full_relation++;
+
+         pthread_mutex_unlock(&qs_inf->mutex);
          relations++;
 
 #if 0
@@ -460,16 +462,17 @@ slong qsieve_evaluate_candidate(qs_t qs_inf, ulong i, unsigned char * sieve, qs_
 
                   poly->num_factors = num_factors;
 
-#pragma omp critical
-                  {
-                     /* store this partial in file */
+                  pthread_mutex_lock(&qs_inf->mutex);
 
-                     qsieve_write_to_file(qs_inf, prime, Y, poly);
+                  /* store this partial in file */
 
-                     qs_inf->edges++;
+                  qsieve_write_to_file(qs_inf, prime, Y, poly);
 
-                     qsieve_add_to_hashtable(qs_inf, prime);
-                  }
+                  qs_inf->edges++;
+
+                  qsieve_add_to_hashtable(qs_inf, prime);
+
+                  pthread_mutex_unlock(&qs_inf->mutex);
               }
           }
       }
@@ -523,47 +526,87 @@ slong qsieve_evaluate_sieve(qs_t qs_inf, unsigned char * sieve, qs_poly_t poly)
     return rels;
 }
 
-/* procedure to call polynomial initialization and sieving procedure */
+/*
+   Each thread owns one sieve array and one polynomial slot. Polynomials
+   are handed out under the mutex, as computing the next one updates the
+   shared roots in qs_inf; relations found are merged into the relation
+   file under the same mutex in qsieve_evaluate_candidate.
+*/
 
-slong qsieve_collect_relations(qs_t qs_inf, unsigned char * sieve)
+typedef struct
 {
-    slong relations = 0, rels, i, j = 0;
+    qs_s * inf;
+    unsigned char * sieve;
+    qs_poly_s * poly;
+    slong rels;
+}
+_collect_relations_arg_t;
 
-    qsieve_init_poly_first(qs_inf);
+static void
+_qsieve_collect_relations_worker(void * arg_ptr)
+{
+    _collect_relations_arg_t * arg = (_collect_relations_arg_t *) arg_ptr;
+    qs_s * qs_inf = arg->inf;
+    slong j;
 
-#pragma omp parallel for
-    for (i = 0; i < (1 << qs_inf->s); i++)
+    while (1)
     {
-#if HAVE_OPENMP
-        unsigned char * thread_sieve = sieve + (qs_inf->sieve_size + sizeof(ulong) + 64)*omp_get_thread_num();
-        qs_poly_s * thread_poly = qs_inf->poly + omp_get_thread_num();
-#else
-        unsigned char * thread_sieve = sieve;
-        qs_poly_s * thread_poly = qs_inf->poly;
-#endif
+        pthread_mutex_lock(&qs_inf->mutex);
+
+        j = qs_inf->index_j;
 
-#pragma omp critical
+        if (j < (WORD(1) << qs_inf->s))
         {
-           if (j == 0)
-              qsieve_poly_copy(thread_poly, qs_inf);
-           else
-           {
-              qsieve_init_poly_next(qs_inf, j);
-              qsieve_poly_copy(thread_poly, qs_inf);
-           }
-           j++;
+            if (j > 0)
+                qsieve_init_poly_next(qs_inf, j);
+
+            qsieve_poly_copy(arg->poly, qs_inf);
+
+            qs_inf->index_j = j + 1;
         }
 
+        pthread_mutex_unlock(&qs_inf->mutex);
+
+        if (j >= (WORD(1) << qs_inf->s))
+            break;
+
         if (qs_inf->sieve_size < 2*BLOCK_SIZE)
-           qsieve_do_sieving(qs_inf, thread_sieve, thread_poly);
+           qsieve_do_sieving(qs_inf, arg->sieve, arg->poly);
         else
-           qsieve_do_sieving2(qs_inf, thread_sieve, thread_poly);
+           qsieve_do_sieving2(qs_inf, arg->sieve, arg->poly);
+
+        arg->rels += qsieve_evaluate_sieve(qs_inf, arg->sieve, arg->poly);
+    }
+}
 
-        rels = qsieve_evaluate_sieve(qs_inf, thread_sieve, thread_poly);
+/* procedure to call polynomial initialization and sieving procedure */
 
-#pragma omp atomic
-        relations += rels;
+slong qsieve_collect_relations(qs_t qs_inf, unsigned char * sieve)
+{
+    _collect_relations_arg_t * args;
+    slong relations = 0, i, num_threads = qs_inf->num_threads;
+
+    qsieve_init_poly_first(qs_inf);
+
+    qs_inf->index_j = 0;
+
+    args = flint_malloc(num_threads*sizeof(_collect_relations_arg_t));
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].inf = qs_inf;
+        args[i].sieve = sieve + (qs_inf->sieve_size + sizeof(ulong) + 64)*i;
+        args[i].poly = qs_inf->poly + i;
+        args[i].rels = 0;
     }
 
+    flint_parallel_do(_qsieve_collect_relations_worker, args, num_threads,
+                             sizeof(_collect_relations_arg_t), num_threads);
+
+    for (i = 0; i < num_threads; i++)
+        relations += args[i].rels;
+
+    flint_free(args);
+
     return relations;
 }
@@ -186,15 +186,11 @@ void qsieve_factor(fmpz_factor_t factors, const fmpz_t n)
     flint_printf("\nPolynomial Initialisation and Sieving\n");
 #endif
 
-#if HAVE_OPENMP
-    /* ensure cache lines don't overlap */
-    sieve = flint_malloc((qs_inf->sieve_size + sizeof(ulong) + 64)*omp_get_max_threads());
-#else
-    sieve = flint_malloc(qs_inf->sieve_size + sizeof(ulong));
-#endif
+    /* one sieve per thread, ensure cache lines don't overlap */
+    sieve = flint_malloc((qs_inf->sieve_size + sizeof(ulong) + 64)*qs_inf->num_threads);
 
     qs_inf->q_idx = qs_inf->num_primes;
-    qs_inf->siqs = fopen("siqs.dat", "w");
+    qsieve_open_relation_file(qs_inf);
 
     for (j = qs_inf->small_primes; j < qs_inf->num_primes; j++)
     {
@@ -244,8 +240,6 @@ void qsieve_factor(fmpz_factor_t factors, const fmpz_t n)
                 {
                     int ok;
 
-                    fclose(qs_inf->siqs);
-
                     ok = qsieve_process_relation(qs_inf);
 
                     if (ok == -1)
@@ -364,7 +358,8 @@ void qsieve_factor(fmpz_factor_t factors, const fmpz_t n)
 
                        _fmpz_vec_clear(facs, 100);
 
-                       qs_inf->siqs = fopen("siqs.dat", "w");
+                       qsieve_close_relation_file(qs_inf);
+                       qsieve_open_relation_file(qs_inf);
                        qs_inf->num_primes = num_primes; /* linear algebra adjusts this */
                        goto more_primes; /* need more primes */
                     }
@@ -446,7 +441,7 @@ cleanup:
     qsieve_clear(qs_inf);
     qsieve_linalg_clear(qs_inf);
     qsieve_poly_clear(qs_inf);
-    remove("siqs.dat");
+    qsieve_close_relation_file(qs_inf);
     fmpz_clear(X);
     fmpz_clear(Y);
     fmpz_clear(temp);
@@ -50,4 +50,12 @@ void qsieve_init(qs_t qs_inf, const fmpz_t n)
     qs_inf->sqrts       = NULL;
 
     qs_inf->s = 0;
+
+    /* each thread sieves with its own copy of the poly data */
+    qs_inf->num_threads = flint_get_num_threads();
+    qs_inf->poly = NULL;
+    pthread_mutex_init(&qs_inf->mutex, NULL);
+
+    qs_inf->siqs = NULL;
+    qs_inf->fname = NULL;
 }
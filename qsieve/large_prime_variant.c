@@ -476,7 +476,8 @@ int qsieve_process_relation(qs_t qs_inf)
     relation_t * rlist;
     int done = 0;
   
-    qs_inf->siqs = fopen("siqs.dat", "r");
+    fflush(qs_inf->siqs);
+    rewind(qs_inf->siqs);
 
 #if QS_DEBUG & 64
     printf("Getting relations\n");
@@ -501,8 +502,6 @@ int qsieve_process_relation(qs_t qs_inf)
         }
     }
 
-    fclose(qs_inf->siqs);
-
 #if QS_DEBUG & 64
     printf("Removing duplicates\n");
 #endif
@@ -553,7 +552,7 @@ int qsieve_process_relation(qs_t qs_inf)
     {
        qs_inf->edges -= 100;
        done = 0;
-       qs_inf->siqs = fopen("siqs.dat", "a");
+       fseek(qs_inf->siqs, 0, SEEK_END);
     } else
     {
        done = 1;
@@ -48,26 +48,21 @@ void qsieve_poly_clear(qs_t qs_inf)
 
    flint_free(qs_inf->A_inv2B);
 
-#if HAVE_OPENMP
-   for (i = 0; i < omp_get_max_threads(); i++)
+   if (qs_inf->poly != NULL)
    {
-      fmpz_clear(qs_inf->poly[i].B);
-      flint_free(qs_inf->poly[i].posn1);
-      flint_free(qs_inf->poly[i].posn2);
-      flint_free(qs_inf->poly[i].soln1);
-      flint_free(qs_inf->poly[i].soln2);
-      flint_free(qs_inf->poly[i].small);
-      flint_free(qs_inf->poly[i].factor);
+      for (i = 0; i < qs_inf->num_threads; i++)
+      {
+         fmpz_clear(qs_inf->poly[i].B);
+         flint_free(qs_inf->poly[i].posn1);
+         flint_free(qs_inf->poly[i].posn2);
+         flint_free(qs_inf->poly[i].soln1);
+         flint_free(qs_inf->poly[i].soln2);
+         flint_free(qs_inf->poly[i].small);
+         flint_free(qs_inf->poly[i].factor);
+      }
+
+      flint_free(qs_inf->poly);
    }
-#else
-   fmpz_clear(qs_inf->poly[0].B);
-   flint_free(qs_inf->poly[0].posn1);
-   flint_free(qs_inf->poly[0].posn2);
-   flint_free(qs_inf->poly[0].soln1);
-   flint_free(qs_inf->poly[0].soln2);
-   flint_free(qs_inf->poly[0].small);
-   flint_free(qs_inf->poly[0].factor);
-#endif
 
    qs_inf->B_terms = NULL;
    qs_inf->A_ind = NULL;
@@ -78,6 +73,7 @@ void qsieve_poly_clear(qs_t qs_inf)
    qs_inf->soln2 = NULL;
    qs_inf->A_inv2B = NULL;
    qs_inf->curr_subset = NULL;
+   qs_inf->poly = NULL;
 }
 
 
@@ -0,0 +1,137 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+/* mkstemp and fdopen are POSIX, not declared under -ansi otherwise */
+#if !defined(_WIN32) && !defined(_XOPEN_SOURCE)
+#define _XOPEN_SOURCE 700
+#endif
+
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include "qsieve.h"
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <stdlib.h>
+#include <unistd.h>
+#endif
+
+/* directory for relation files, NULL for an anonymous temporary file */
+static char * _qsieve_relation_dir = NULL;
+static int _qsieve_relation_dir_registered = 0;
+static pthread_mutex_t _qsieve_relation_dir_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void _qsieve_relation_dir_cleanup(void)
+{
+    pthread_mutex_lock(&_qsieve_relation_dir_lock);
+
+    flint_free(_qsieve_relation_dir);
+    _qsieve_relation_dir = NULL;
+    _qsieve_relation_dir_registered = 0;
+
+    pthread_mutex_unlock(&_qsieve_relation_dir_lock);
+}
+
+void qsieve_set_relation_dir(const char * dir)
+{
+    char * copy = NULL;
+
+    if (dir != NULL)
+    {
+        copy = flint_malloc(strlen(dir) + 1);
+        strcpy(copy, dir);
+    }
+
+    pthread_mutex_lock(&_qsieve_relation_dir_lock);
+
+    flint_free(_qsieve_relation_dir);
+    _qsieve_relation_dir = copy;
+
+    if (copy != NULL && !_qsieve_relation_dir_registered)
+    {
+        flint_register_cleanup_function(_qsieve_relation_dir_cleanup);
+        _qsieve_relation_dir_registered = 1;
+    }
+
+    pthread_mutex_unlock(&_qsieve_relation_dir_lock);
+}
+
+void qsieve_open_relation_file(qs_t qs_inf)
+{
+    char * dir = NULL;
+
+    qs_inf->fname = NULL;
+
+    /* work on a copy, the directory may be changed by another thread */
+    pthread_mutex_lock(&_qsieve_relation_dir_lock);
+
+    if (_qsieve_relation_dir != NULL)
+    {
+        dir = flint_malloc(strlen(_qsieve_relation_dir) + 1);
+        strcpy(dir, _qsieve_relation_dir);
+    }
+
+    pthread_mutex_unlock(&_qsieve_relation_dir_lock);
+
+    if (dir == NULL)
+        qs_inf->siqs = tmpfile();
+    else
+    {
+#if defined(_WIN32)
+        qs_inf->fname = flint_malloc(MAX_PATH);
+
+        if (GetTempFileNameA(dir, "siq", 0, qs_inf->fname))
+            qs_inf->siqs = fopen(qs_inf->fname, "w+");
+        else
+            qs_inf->siqs = NULL;
+#else
+        int fd;
+
+        qs_inf->fname = flint_malloc(strlen(dir) + 12);
+        sprintf(qs_inf->fname, "%s/siqsXXXXXX", dir);
+
+        fd = mkstemp(qs_inf->fname);
+
+        if (fd != -1)
+        {
+            qs_inf->siqs = fdopen(fd, "w+");
+            if (qs_inf->siqs == NULL)
+                close(fd);
+        }
+        else
+            qs_inf->siqs = NULL;
+#endif
+        flint_free(dir);
+    }
+
+    if (qs_inf->siqs == NULL)
+    {
+        flint_printf("Exception (qsieve_factor). Unable to create relation file.\n");
+        flint_abort();
+    }
+}
+
+void qsieve_close_relation_file(qs_t qs_inf)
+{
+    if (qs_inf->siqs != NULL)
+        fclose(qs_inf->siqs);
+
+    if (qs_inf->fname != NULL)
+    {
+        remove(qs_inf->fname);
+        flint_free(qs_inf->fname);
+    }
+
+    qs_inf->siqs = NULL;
+    qs_inf->fname = NULL;
+}
@@ -0,0 +1,118 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "qsieve.h"
+
+int main(void)
+{
+   slong i, j, k;
+   FLINT_TEST_INIT(state);
+
+   flint_printf("block_lanczos....");
+   fflush(stdout);
+
+   for (i = 0; i < 20 * flint_test_multiplier(); i++)
+   {
+      qs_t qs_inf;
+      la_col_t * cols;
+      uint64_t * nullrows, * prod, mask;
+      slong nrows, ncols, orig_ncols, vsize;
+
+      if (n_randint(state, 4) == 0)
+         nrows = n_randint(state, 4000) + 10000;
+      else
+         nrows = n_randint(state, 2000) + 100;
+
+      ncols = orig_ncols = nrows + 100;
+
+      qs_inf->extra_rels = 64;
+
+      cols = flint_malloc(ncols*sizeof(la_col_t));
+
+      /* random columns with a skewed row distribution like a sieve matrix */
+      for (j = 0; j < ncols; j++)
+      {
+         slong w = n_randint(state, 20) + 5;
+
+         cols[j].weight = 0;
+         cols[j].orig = j;
+
+         while (cols[j].weight < w)
+         {
+            slong r = (n_randint(state, nrows)*n_randint(state, nrows))/nrows;
+
+            for (k = 0; k < cols[j].weight; k++)
+               if (cols[j].data[k] == r)
+                  break;
+
+            if (k == cols[j].weight)
+               insert_col_entry(cols + j, r);
+         }
+      }
+
+      reduce_matrix(qs_inf, &nrows, &ncols, cols);
+
+      flint_set_num_threads(n_randint(state, 4) + 1);
+
+      do {
+         nullrows = block_lanczos(state, nrows, 0, ncols, cols);
+      } while (nullrows == NULL);
+
+      /* check the dependencies independently */
+      vsize = FLINT_MAX(nrows, ncols);
+      prod = flint_calloc(vsize, sizeof(uint64_t));
+
+      for (j = 0; j < ncols; j++)
+         for (k = 0; k < cols[j].weight; k++)
+            prod[cols[j].data[k]] ^= nullrows[j];
+
+      for (j = 0; j < vsize; j++)
+      {
+         if (prod[j] != 0)
+         {
+            flint_printf("FAIL:\n");
+            flint_printf("nrows = %wd, ncols = %wd, row %wd nonzero\n",
+                         nrows, ncols, j);
+            abort();
+         }
+      }
+
+      for (j = 0, mask = 0; j < ncols; j++)
+         mask |= nullrows[j];
+
+      if (ncols > nrows && mask == 0)
+      {
+         flint_printf("FAIL:\n");
+         flint_printf("nrows = %wd, ncols = %wd, no dependencies found\n",
+                      nrows, ncols);
+         abort();
+      }
+
+      flint_free(prod);
+      flint_free(nullrows);
+
+      for (j = 0; j < orig_ncols; j++)
+         free_col(cols + j);
+      flint_free(cols);
+   }
+
+   flint_set_num_threads(1);
+
+   FLINT_TEST_CLEANUP(state);
+
+   flint_printf("PASS\n");
+   return 0;
+}
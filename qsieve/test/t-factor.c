@@ -26,6 +26,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <pthread.h>
 #include <gmp.h>
 #include "flint.h"
 #include "ulong_extras.h"
@@ -46,9 +47,33 @@ void randprime(fmpz_t p, flint_rand_t state, slong bits)
        fmpz_add_ui(p, p, 2);
 }
 
+typedef struct
+{
+   fmpz_t n;
+   slong num;
+} factor_arg_t;
+
+void * factor_worker(void * arg_ptr)
+{
+   factor_arg_t * arg = (factor_arg_t *) arg_ptr;
+   fmpz_factor_t factors;
+
+   fmpz_factor_init(factors);
+
+   qsieve_factor(factors, arg->n);
+
+   arg->num = factors->num;
+
+   fmpz_factor_clear(factors);
+
+   flint_cleanup();
+
+   return NULL;
+}
+
 int main(void)
 {
-   slong i;
+   slong i, j;
    fmpz_t n, x, y, z;
    fmpz_factor_t factors;
    FLINT_TEST_INIT(state);
@@ -83,6 +108,8 @@ int main(void)
    {
       slong bits = 40;
 
+      flint_set_num_threads(n_randint(state, 4) + 1);
+
       randprime(x, state, bits);
       do {
          randprime(y, state, bits);
@@ -106,6 +133,8 @@ int main(void)
 
    for (i = 0; i < 30; i++) /* Test random n, three factors */
    {
+      flint_set_num_threads(n_randint(state, 4) + 1);
+
       randprime(x, state, 40);
       do {
          randprime(y, state, 40);
@@ -133,6 +162,8 @@ int main(void)
 
    for (i = 0; i < 30; i++) /* Test random n, small factors */
    {
+      flint_set_num_threads(n_randint(state, 4) + 1);
+
       randprime(x, state, 10);
       do {
          randprime(y, state, 10);
@@ -156,6 +187,48 @@ int main(void)
       fmpz_factor_clear(factors);
    }
 
+   flint_set_num_threads(1);
+
+   /* Test concurrent factorisations don't share relation files */
+   for (i = 0; i < 3; i++)
+   {
+      pthread_t threads[2];
+      factor_arg_t args[2];
+
+      qsieve_set_relation_dir(i == 0 ? NULL : ".");
+
+      for (j = 0; j < 2; j++)
+      {
+         randprime(x, state, 40);
+         do {
+            randprime(y, state, 40);
+         } while (fmpz_equal(x, y));
+
+         fmpz_init(args[j].n);
+         fmpz_mul(args[j].n, x, y);
+      }
+
+      for (j = 0; j < 2; j++)
+         pthread_create(&threads[j], NULL, factor_worker, &args[j]);
+
+      for (j = 0; j < 2; j++)
+         pthread_join(threads[j], NULL);
+
+      for (j = 0; j < 2; j++)
+      {
+         if (args[j].num < 2)
+         {
+            flint_printf("FAIL (concurrent):\n");
+            flint_printf("%ld factors found\n", args[j].num);
+            abort();
+         }
+
+         fmpz_clear(args[j].n);
+      }
+   }
+
+   qsieve_set_relation_dir(NULL);
+
    fmpz_clear(n);
    fmpz_clear(x);
    fmpz_clear(y);
@@ -0,0 +1,125 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+static slong find_tag(const char * tag)
+{
+   slong i;
+
+   for (i = 0; i < flint_memstats_num_tags(); i++)
+   {
+      flint_memstats_t s;
+
+      flint_memstats_get(s, i);
+      if (strcmp(s->tag, tag) == 0)
+         return i;
+   }
+
+   return -1;
+}
+
+int main(void)
+{
+   int i;
+   FLINT_TEST_INIT(state);
+
+   flint_printf("memstats....");
+   fflush(stdout);
+
+   for (i = 0; i < 100 * flint_test_multiplier(); i++)
+   {
+      flint_memstats_t s, t;
+      slong j, n, k, size, size0, grown, peak, len;
+      void * ptr, ** ptrs;
+
+      /* a chain of reallocs, tagged, with a nested tag for other blocks */
+      flint_memstats_push_tag("t-memstats outer");
+
+      size = size0 = n_randint(state, 1000) + 1;
+      ptr = flint_malloc(size);
+      peak = size;
+      grown = 0;
+
+      n = n_randint(state, 10);
+      for (j = 0; j < n; j++)
+      {
+         slong size2 = n_randint(state, 2000) + 1;
+
+         if (size2 > size)
+            grown += size2 - size;
+
+         ptr = flint_realloc(ptr, size2);
+         size = size2;
+         peak = FLINT_MAX(peak, size);
+      }
+
+      flint_memstats_push_tag("t-memstats inner");
+
+      len = n_randint(state, 20) + 1;
+      ptrs = flint_malloc(len*sizeof(void *));
+      for (k = 0; k < len; k++)
+         ptrs[k] = flint_calloc(k + 1, 8);
+
+      flint_memstats_pop_tag();
+
+      flint_free(ptr);
+
+      flint_memstats_pop_tag();
+
+      if (flint_memstats_num_tags() == 0) /* not configured */
+      {
+         for (k = 0; k < len; k++)
+            flint_free(ptrs[k]);
+         flint_free(ptrs);
+         continue;
+      }
+
+      flint_memstats_get(s, find_tag("t-memstats outer"));
+      flint_memstats_get(t, find_tag("t-memstats inner"));
+
+      if (s->allocs != 1 || s->reallocs != n || s->frees != 1 ||
+          s->live != 0 || s->peak != peak || s->max_chain != n ||
+          s->realloc_bytes != grown || s->bytes != size0 + grown ||
+          t->allocs != len + 1 || t->frees != 0 ||
+          t->live != (slong) (len*sizeof(void *) + 4*len*(len + 1)))
+      {
+         flint_printf("FAIL:\n");
+         flint_printf("i = %d, n = %wd, len = %wd\n", i, n, len);
+         flint_memstats_print();
+         flint_abort();
+      }
+
+      for (k = 0; k < len; k++)
+         flint_free(ptrs[k]);
+      flint_free(ptrs);
+
+      flint_memstats_get(t, find_tag("t-memstats inner"));
+
+      if (t->live != 0 || t->frees != len + 1)
+      {
+         flint_printf("FAIL (free):\n");
+         flint_printf("i = %d, len = %wd\n", i, len);
+         flint_memstats_print();
+         flint_abort();
+      }
+
+      flint_memstats_reset();
+   }
+
+   FLINT_TEST_CLEANUP(state);
+
+   flint_printf("PASS\n");
+   return 0;
+}
@@ -0,0 +1,91 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <pthread.h>
+#include "flint.h"
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+typedef struct
+{
+    pthread_t pth;
+    pthread_mutex_t mutex;
+    pthread_cond_t sleep1;      /* signalled when there is work to do */
+    pthread_cond_t sleep2;      /* signalled when the work is done */
+    volatile int available;     /* 1 if the worker can be requested */
+    volatile int working;       /* 1 while the worker has a task */
+    volatile int exit;          /* 1 if the worker should exit */
+    int max_workers;            /* number of workers the task may request */
+    void (*fxn)(void *);
+    void * fxnarg;
+}
+thread_pool_entry_struct;
+
+typedef thread_pool_entry_struct thread_pool_entry_t[1];
+
+typedef struct
+{
+    pthread_mutex_t mutex;
+    slong length;
+    thread_pool_entry_struct * tab;
+}
+thread_pool_struct;
+
+typedef thread_pool_struct thread_pool_t[1];
+
+typedef slong thread_pool_handle;
+
+FLINT_DLL extern int global_thread_pool_initialized;
+FLINT_DLL extern thread_pool_t global_thread_pool;
+
+FLINT_DLL void * thread_pool_idle_loop(void * varg);
+
+FLINT_DLL void thread_pool_init(thread_pool_t T, slong size);
+
+FLINT_DLL void thread_pool_clear(thread_pool_t T);
+
+FLINT_DLL slong thread_pool_get_size(thread_pool_t T);
+
+FLINT_DLL int thread_pool_set_size(thread_pool_t T, slong new_size);
+
+FLINT_DLL slong thread_pool_request(thread_pool_t T,
+                               thread_pool_handle * out, slong requested);
+
+FLINT_DLL void thread_pool_wake(thread_pool_t T, thread_pool_handle i,
+                         int max_workers, void (*f)(void *), void * a);
+
+FLINT_DLL void thread_pool_wait(thread_pool_t T, thread_pool_handle i);
+
+FLINT_DLL void thread_pool_give_back(thread_pool_t T, thread_pool_handle i);
+
+/* Interface to the global thread pool */
+
+FLINT_DLL void _flint_set_num_workers(int num_workers);
+
+FLINT_DLL slong flint_request_threads(thread_pool_handle ** handles,
+                                                        slong thread_limit);
+
+FLINT_DLL void flint_give_back_threads(thread_pool_handle * handles,
+                                                        slong num_handles);
+
+FLINT_DLL void flint_parallel_do(void (*f)(void *), void * args,
+                    slong num_args, size_t arg_size, slong thread_limit);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
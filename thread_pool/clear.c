@@ -0,0 +1,41 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "thread_pool.h"
+
+void thread_pool_clear(thread_pool_t T)
+{
+    slong i;
+
+    for (i = 0; i < T->length; i++)
+    {
+        thread_pool_entry_struct * D = T->tab + i;
+
+        pthread_mutex_lock(&D->mutex);
+        D->exit = 1;
+        pthread_cond_signal(&D->sleep1);
+        pthread_mutex_unlock(&D->mutex);
+
+        pthread_join(D->pth, NULL);
+
+        pthread_cond_destroy(&D->sleep2);
+        pthread_cond_destroy(&D->sleep1);
+        pthread_mutex_destroy(&D->mutex);
+    }
+
+    if (T->tab != NULL)
+        flint_free(T->tab);
+
+    T->tab = NULL;
+    T->length = 0;
+
+    pthread_mutex_destroy(&T->mutex);
+}
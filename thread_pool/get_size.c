@@ -0,0 +1,23 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "thread_pool.h"
+
+slong thread_pool_get_size(thread_pool_t T)
+{
+    slong size;
+
+    pthread_mutex_lock(&T->mutex);
+    size = T->length;
+    pthread_mutex_unlock(&T->mutex);
+
+    return size;
+}
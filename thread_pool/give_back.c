@@ -0,0 +1,19 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "thread_pool.h"
+
+void thread_pool_give_back(thread_pool_t T, thread_pool_handle i)
+{
+    pthread_mutex_lock(&T->mutex);
+    T->tab[i].available = 1;
+    pthread_mutex_unlock(&T->mutex);
+}
@@ -0,0 +1,41 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "thread_pool.h"
+
+void * thread_pool_idle_loop(void * varg)
+{
+    thread_pool_entry_struct * D = (thread_pool_entry_struct *) varg;
+
+    while (1)
+    {
+        pthread_mutex_lock(&D->mutex);
+        while (!D->working && !D->exit)
+            pthread_cond_wait(&D->sleep1, &D->mutex);
+        pthread_mutex_unlock(&D->mutex);
+
+        if (D->exit)
+            break;
+
+        /* nested parallelism: the task may use max_workers more threads */
+        _flint_set_num_workers(D->max_workers);
+
+        D->fxn(D->fxnarg);
+
+        pthread_mutex_lock(&D->mutex);
+        D->working = 0;
+        pthread_cond_signal(&D->sleep2);
+        pthread_mutex_unlock(&D->mutex);
+    }
+
+    flint_cleanup();
+    return NULL;
+}
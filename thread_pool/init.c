@@ -0,0 +1,44 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "thread_pool.h"
+
+void thread_pool_init(thread_pool_t T, slong size)
+{
+    slong i;
+
+    pthread_mutex_init(&T->mutex, NULL);
+
+    T->length = FLINT_MAX(size, 0);
+    T->tab = NULL;
+
+    if (T->length == 0)
+        return;
+
+    T->tab = flint_malloc(sizeof(thread_pool_entry_struct) * T->length);
+
+    for (i = 0; i < T->length; i++)
+    {
+        thread_pool_entry_struct * D = T->tab + i;
+
+        pthread_mutex_init(&D->mutex, NULL);
+        pthread_cond_init(&D->sleep1, NULL);
+        pthread_cond_init(&D->sleep2, NULL);
+        D->available = 1;
+        D->working = 0;
+        D->exit = 0;
+        D->max_workers = 0;
+        D->fxn = NULL;
+        D->fxnarg = NULL;
+
+        pthread_create(&D->pth, NULL, thread_pool_idle_loop, D);
+    }
+}
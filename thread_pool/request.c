@@ -0,0 +1,36 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "thread_pool.h"
+
+slong thread_pool_request(thread_pool_t T,
+                                 thread_pool_handle * out, slong requested)
+{
+    slong i, ret = 0;
+
+    if (requested <= 0)
+        return 0;
+
+    pthread_mutex_lock(&T->mutex);
+
+    for (i = 0; i < T->length && ret < requested; i++)
+    {
+        if (T->tab[i].available)
+        {
+            T->tab[i].available = 0;
+            out[ret++] = i;
+        }
+    }
+
+    pthread_mutex_unlock(&T->mutex);
+
+    return ret;
+}
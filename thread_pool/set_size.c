@@ -0,0 +1,86 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "thread_pool.h"
+
+/*
+   The pool can only be resized while none of its workers are in use,
+   otherwise 0 is returned.
+*/
+int thread_pool_set_size(thread_pool_t T, slong new_size)
+{
+    slong i;
+
+    new_size = FLINT_MAX(new_size, 0);
+
+    pthread_mutex_lock(&T->mutex);
+
+    for (i = 0; i < T->length; i++)
+    {
+        if (!T->tab[i].available)
+        {
+            pthread_mutex_unlock(&T->mutex);
+            return 0;
+        }
+    }
+
+    if (new_size == T->length)
+    {
+        pthread_mutex_unlock(&T->mutex);
+        return 1;
+    }
+
+    for (i = 0; i < T->length; i++)
+    {
+        thread_pool_entry_struct * D = T->tab + i;
+
+        pthread_mutex_lock(&D->mutex);
+        D->exit = 1;
+        pthread_cond_signal(&D->sleep1);
+        pthread_mutex_unlock(&D->mutex);
+
+        pthread_join(D->pth, NULL);
+
+        pthread_cond_destroy(&D->sleep2);
+        pthread_cond_destroy(&D->sleep1);
+        pthread_mutex_destroy(&D->mutex);
+    }
+
+    if (T->tab != NULL)
+        flint_free(T->tab);
+
+    T->length = new_size;
+    T->tab = NULL;
+
+    if (new_size > 0)
+        T->tab = flint_malloc(sizeof(thread_pool_entry_struct) * new_size);
+
+    for (i = 0; i < new_size; i++)
+    {
+        thread_pool_entry_struct * D = T->tab + i;
+
+        pthread_mutex_init(&D->mutex, NULL);
+        pthread_cond_init(&D->sleep1, NULL);
+        pthread_cond_init(&D->sleep2, NULL);
+        D->available = 1;
+        D->working = 0;
+        D->exit = 0;
+        D->max_workers = 0;
+        D->fxn = NULL;
+        D->fxnarg = NULL;
+
+        pthread_create(&D->pth, NULL, thread_pool_idle_loop, D);
+    }
+
+    pthread_mutex_unlock(&T->mutex);
+
+    return 1;
+}
@@ -0,0 +1,208 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "fmpz.h"
+#include "thread_pool.h"
+#include "ulong_extras.h"
+
+typedef struct
+{
+    fmpz_t res;
+    ulong n;
+    slong num_inner;
+    int threads;
+}
+task_t;
+
+/* n! computed with fmpz arithmetic, which uses the per thread caches */
+static void
+task_fac(void * varg)
+{
+    task_t * arg = (task_t *) varg;
+    ulong i;
+
+    arg->threads = flint_get_num_threads();
+
+    fmpz_one(arg->res);
+    for (i = 2; i <= arg->n; i++)
+        fmpz_mul_ui(arg->res, arg->res, i);
+}
+
+/* runs a further parallel loop inside the task */
+static void
+task_nested(void * varg)
+{
+    task_t * arg = (task_t *) varg;
+    task_t * inner;
+    slong i;
+
+    arg->threads = flint_get_num_threads();
+
+    inner = flint_malloc(sizeof(task_t) * arg->num_inner);
+    for (i = 0; i < arg->num_inner; i++)
+    {
+        fmpz_init(inner[i].res);
+        inner[i].n = arg->n + i;
+    }
+
+    flint_parallel_do(task_fac, inner, arg->num_inner, sizeof(task_t),
+                                                                  WORD_MAX);
+
+    fmpz_zero(arg->res);
+    for (i = 0; i < arg->num_inner; i++)
+    {
+        if (inner[i].threads > arg->threads)
+        {
+            flint_printf("FAIL (nested budget):\n");
+            flint_printf("%d > %d\n", inner[i].threads, arg->threads);
+            abort();
+        }
+
+        fmpz_add(arg->res, arg->res, inner[i].res);
+        fmpz_clear(inner[i].res);
+    }
+
+    flint_free(inner);
+}
+
+int
+main(void)
+{
+    slong iter;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("thread_pool....");
+    fflush(stdout);
+
+    /* request, wake, wait and give back directly */
+    for (iter = 0; iter < 50 * flint_test_multiplier(); iter++)
+    {
+        thread_pool_handle * handles;
+        slong i, num_handles, num_threads;
+        task_t * args;
+        fmpz_t t;
+
+        num_threads = n_randint(state, 6) + 1;
+        flint_set_num_threads(num_threads);
+
+        num_handles = flint_request_threads(&handles,
+                                         n_randint(state, num_threads + 2));
+
+        if (num_handles < 0 || num_handles > num_threads - 1)
+        {
+            flint_printf("FAIL (request):\n");
+            flint_printf("num_threads = %wd, num_handles = %wd\n",
+                                                  num_threads, num_handles);
+            abort();
+        }
+
+        args = flint_malloc(sizeof(task_t) * (num_handles + 1));
+        for (i = 0; i <= num_handles; i++)
+        {
+            fmpz_init(args[i].res);
+            args[i].n = n_randint(state, 300);
+        }
+
+        for (i = 0; i < num_handles; i++)
+            thread_pool_wake(global_thread_pool, handles[i], 0,
+                                                    task_fac, args + i + 1);
+        task_fac(args + 0);
+        for (i = 0; i < num_handles; i++)
+            thread_pool_wait(global_thread_pool, handles[i]);
+
+        flint_give_back_threads(handles, num_handles);
+
+        fmpz_init(t);
+        for (i = 0; i <= num_handles; i++)
+        {
+            fmpz_fac_ui(t, args[i].n);
+
+            if (!fmpz_equal(t, args[i].res) ||
+                              (i > 0 && args[i].threads != 1))
+            {
+                flint_printf("FAIL (wake):\n");
+                flint_printf("i = %wd, n = %wu\n", i, args[i].n);
+                abort();
+            }
+
+            fmpz_clear(args[i].res);
+        }
+        fmpz_clear(t);
+
+        flint_free(args);
+    }
+
+    /* nested parallel loops */
+    for (iter = 0; iter < 50 * flint_test_multiplier(); iter++)
+    {
+        slong i, j, num_args, num_threads;
+        task_t * args;
+        fmpz_t s, t;
+
+        num_threads = n_randint(state, 8) + 1;
+        flint_set_num_threads(num_threads);
+
+        num_args = n_randint(state, 10);
+        args = flint_malloc(sizeof(task_t) * num_args);
+        for (i = 0; i < num_args; i++)
+        {
+            fmpz_init(args[i].res);
+            args[i].n = n_randint(state, 100);
+            args[i].num_inner = n_randint(state, 5) + 1;
+        }
+
+        flint_parallel_do(task_nested, args, num_args, sizeof(task_t),
+                                             n_randint(state, 4) + 1);
+
+        if (flint_get_num_threads() != num_threads)
+        {
+            flint_printf("FAIL (thread count restored):\n");
+            flint_printf("%d != %wd\n", flint_get_num_threads(), num_threads);
+            abort();
+        }
+
+        fmpz_init(s);
+        fmpz_init(t);
+        for (i = 0; i < num_args; i++)
+        {
+            fmpz_zero(s);
+            for (j = 0; j < args[i].num_inner; j++)
+            {
+                fmpz_fac_ui(t, args[i].n + j);
+                fmpz_add(s, s, t);
+            }
+
+            if (!fmpz_equal(s, args[i].res) || args[i].threads > num_threads)
+            {
+                flint_printf("FAIL (parallel_do):\n");
+                flint_printf("i = %wd, n = %wu\n", i, args[i].n);
+                abort();
+            }
+
+            fmpz_clear(args[i].res);
+        }
+        fmpz_clear(s);
+        fmpz_clear(t);
+
+        flint_free(args);
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,22 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "thread_pool.h"
+
+void thread_pool_wait(thread_pool_t T, thread_pool_handle i)
+{
+    thread_pool_entry_struct * D = T->tab + i;
+
+    pthread_mutex_lock(&D->mutex);
+    while (D->working)
+        pthread_cond_wait(&D->sleep2, &D->mutex);
+    pthread_mutex_unlock(&D->mutex);
+}
@@ -0,0 +1,26 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "thread_pool.h"
+
+void thread_pool_wake(thread_pool_t T, thread_pool_handle i,
+                               int max_workers, void (*f)(void *), void * a)
+{
+    thread_pool_entry_struct * D = T->tab + i;
+
+    pthread_mutex_lock(&D->mutex);
+    D->max_workers = FLINT_MAX(max_workers, 0);
+    D->fxn = f;
+    D->fxnarg = a;
+    D->working = 1;
+    pthread_cond_signal(&D->sleep1);
+    pthread_mutex_unlock(&D->mutex);
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2013 Fredrik Johansson
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -10,10 +11,17 @@
 */
 
 #include "flint.h"
+#include "thread_pool.h"
+#include "ulong_extras.h"
 #ifdef _OPENMP
 #include <omp.h>
 #endif
 
+int global_thread_pool_initialized = 0;
+thread_pool_t global_thread_pool;
+
+static pthread_mutex_t _global_thread_pool_lock = PTHREAD_MUTEX_INITIALIZER;
+
 FLINT_TLS_PREFIX int _flint_num_threads = 1;
 #pragma omp threadprivate(_flint_num_threads)
 
@@ -22,12 +30,163 @@ int flint_get_num_threads()
     return _flint_num_threads;
 }
 
+void _flint_set_num_workers(int num_workers)
+{
+    _flint_num_threads = num_workers + 1;
+}
+
 void flint_set_num_threads(int num_threads)
 {
+    num_threads = FLINT_MAX(num_threads, 1);
+
     _flint_num_threads = num_threads;
 #ifdef _OPENMP
     omp_set_num_threads(num_threads);
 #endif
+
+    /*
+       The global pool holds the workers; resizing fails harmlessly if some
+       of them are in use, e.g. when called from inside a worker, and then
+       only the limit for this thread is changed.
+    */
+    pthread_mutex_lock(&_global_thread_pool_lock);
+
+    if (global_thread_pool_initialized)
+    {
+        thread_pool_set_size(global_thread_pool, num_threads - 1);
+    }
+    else if (num_threads > 1)
+    {
+        thread_pool_init(global_thread_pool, num_threads - 1);
+        global_thread_pool_initialized = 1;
+    }
+
+    pthread_mutex_unlock(&_global_thread_pool_lock);
+}
+
+slong flint_request_threads(thread_pool_handle ** handles, slong thread_limit)
+{
+    slong max_num_handles, num_handles = 0;
+
+    *handles = NULL;
+
+    thread_limit = FLINT_MIN(thread_limit, flint_get_num_threads());
+
+    if (global_thread_pool_initialized && thread_limit > 1)
+    {
+        max_num_handles = thread_pool_get_size(global_thread_pool);
+        max_num_handles = FLINT_MIN(thread_limit - 1, max_num_handles);
+
+        if (max_num_handles > 0)
+        {
+            *handles = flint_malloc(sizeof(thread_pool_handle) *
+                                                          max_num_handles);
+            num_handles = thread_pool_request(global_thread_pool,
+                                                  *handles, max_num_handles);
+        }
+    }
+
+    return num_handles;
+}
+
+void flint_give_back_threads(thread_pool_handle * handles, slong num_handles)
+{
+    slong i;
+
+    for (i = 0; i < num_handles; i++)
+        thread_pool_give_back(global_thread_pool, handles[i]);
+
+    if (handles != NULL)
+        flint_free(handles);
+}
+
+typedef struct
+{
+    void (*f)(void *);
+    char * args;
+    slong num_args;
+    size_t arg_size;
+    slong next;
+    pthread_mutex_t mutex;
+    const char * tag;   /* allocation tag of the caller, see memstats */
+}
+_parallel_do_struct;
+
+/* tasks are handed out one at a time so that fast threads take more */
+static void
+_parallel_do_worker(void * varg)
+{
+    _parallel_do_struct * S = (_parallel_do_struct *) varg;
+    slong i;
+
+    if (S->tag != NULL)
+        flint_memstats_push_tag(S->tag);
+
+    while (1)
+    {
+        pthread_mutex_lock(&S->mutex);
+        i = S->next++;
+        pthread_mutex_unlock(&S->mutex);
+
+        if (i >= S->num_args)
+            break;
+
+        S->f(S->args + i * S->arg_size);
+    }
+
+    if (S->tag != NULL)
+        flint_memstats_pop_tag();
+}
+
+void flint_parallel_do(void (*f)(void *), void * args, slong num_args,
+                                         size_t arg_size, slong thread_limit)
+{
+    thread_pool_handle * handles;
+    slong i, num_workers, budget, nested;
+    _parallel_do_struct S;
+
+    if (num_args <= 0)
+        return;
+
+    budget = flint_get_num_threads();
+    num_workers = flint_request_threads(&handles,
+                                         FLINT_MIN(thread_limit, num_args));
+
+    if (num_workers == 0)
+    {
+        for (i = 0; i < num_args; i++)
+            f((char *) args + i * arg_size);
+
+        flint_give_back_threads(handles, num_workers);
+        return;
+    }
+
+    /* split the remaining thread budget between the participants */
+    nested = (budget - num_workers - 1) / (num_workers + 1);
+    nested = FLINT_MAX(nested, 0);
+
+    S.f = f;
+    S.args = (char *) args;
+    S.num_args = num_args;
+    S.arg_size = arg_size;
+    S.next = 0;
+    pthread_mutex_init(&S.mutex, NULL);
+    S.tag = flint_memstats_current_tag();
+
+    for (i = 0; i < num_workers; i++)
+        thread_pool_wake(global_thread_pool, handles[i], nested,
+                                                    _parallel_do_worker, &S);
+
+    _flint_set_num_workers(nested);
+    _parallel_do_worker(&S);
+    _flint_set_num_workers(budget - 1);
+
+    for (i = 0; i < num_workers; i++)
+        thread_pool_wait(global_thread_pool, handles[i]);
+
+    pthread_mutex_destroy(&S.mutex);
+
+    flint_give_back_threads(handles, num_workers);
 }
 
 void flint_parallel_cleanup()
@@ -39,3 +198,21 @@ void flint_parallel_cleanup()
     if (needs_cleanup)
         flint_cleanup();
 }
+
+void flint_cleanup_master()
+{
+    pthread_mutex_lock(&_global_thread_pool_lock);
+
+    if (global_thread_pool_initialized)
+    {
+        thread_pool_clear(global_thread_pool);
+        global_thread_pool_initialized = 0;
+    }
+
+    pthread_mutex_unlock(&_global_thread_pool_lock);
+
+    /* the prime tables are shared, so only freed once no workers remain */
+    n_cleanup_primes();
+
+    flint_cleanup();
+}
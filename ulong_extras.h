@@ -59,8 +59,19 @@ typedef struct {
 
 #define FLINT_PRIME_PI_ODD_LOOKUP_CUTOFF 311
 
+/* n above which pi(n) and nth_prime use the Lagarias-Miller-Odlyzko method */
+#define FLINT_PRIME_PI_LMO_CUTOFF UWORD(1000000)
+#define FLINT_NTH_PRIME_LMO_CUTOFF UWORD(78498) /* pi(10^6) */
+
+/* n above which the special leaves of pi(n) are computed in parallel */
+#define FLINT_PRIME_PI_THREAD_CUTOFF UWORD(100000000)
+
 #define FLINT_SIEVE_SIZE 65536
 
+/* odd primes trial divided by n_is_prime_vec, and when to use threads */
+#define FLINT_IS_PRIME_VEC_TRIAL 64
+#define FLINT_IS_PRIME_VEC_THREAD_CUTOFF 16384
+
 #if FLINT64
 #define UWORD_MAX_PRIME UWORD(18446744073709551557)
 #else
@@ -114,14 +125,134 @@ n_primes_next(n_primes_t iter)
     }
 }
 
+/* Wheel sieve ***************************************************************/
+
+/* bytes per segment of the wheel sieve, each byte covering 30 numbers */
+#define FLINT_PRIMES_WHEEL_SEGMENT 32768
+
+/* sieving primes from which on multiples are kept in buckets */
+#define FLINT_PRIMES_WHEEL_LARGE (4 * FLINT_PRIMES_WHEEL_SEGMENT)
+
+typedef struct
+{
+    unsigned int p;     /* sieving prime */
+    unsigned int pos;   /* 64 offset + 8 wheel index of p + that of cofactor */
+}
+n_primes_wheel_entry_struct;
+
+typedef struct
+{
+    n_primes_wheel_entry_struct * entries;
+    slong len;
+    slong alloc;
+}
+n_primes_wheel_bucket_struct;
+
+typedef struct
+{
+    ulong a;
+    ulong b;
+
+    ulong start_byte;
+    ulong end_byte;
+    ulong seg_byte;
+    slong seg_len;
+    unsigned char * seg;
+    unsigned char * pattern;
+
+    slong num_sieve;
+    ulong * sieve_primes;
+    ulong * sieve_next;
+    unsigned char * sieve_wheel;
+
+    slong num_large;
+    slong large_i;
+    unsigned int * large_primes;
+
+    n_primes_wheel_bucket_struct * buckets;
+    slong num_buckets;
+    slong cur_bucket;
+
+    int small_i;
+    slong iter_i;
+    ulong iter_bits;
+}
+n_primes_wheel_struct;
+
+typedef n_primes_wheel_struct n_primes_wheel_t[1];
+
+FLINT_DLL extern const unsigned char _n_primes_wheel_residues[8];
+
+FLINT_DLL extern const unsigned char _n_primes_wheel_bit[30];
+
+ULONG_EXTRAS_INLINE
+void _n_primes_wheel_bucket_push(n_primes_wheel_bucket_struct * B,
+                                                ulong p, ulong pos)
+{
+    if (B->len == B->alloc)
+    {
+        B->alloc = FLINT_MAX(2 * B->alloc, 16);
+        B->entries = flint_realloc(B->entries,
+                                B->alloc * sizeof(n_primes_wheel_entry_struct));
+    }
+
+    B->entries[B->len].p = p;
+    B->entries[B->len].pos = pos;
+    B->len++;
+}
+
+FLINT_DLL void n_primes_wheel_init(n_primes_wheel_t S, ulong a, ulong b);
+
+FLINT_DLL void n_primes_wheel_clear(n_primes_wheel_t S);
+
+FLINT_DLL int n_primes_wheel_next_segment(n_primes_wheel_t S);
+
+FLINT_DLL ulong n_primes_wheel_segment_count(const n_primes_wheel_t S);
+
+FLINT_DLL slong n_primes_wheel_segment_primes(ulong * res,
+                                                  const n_primes_wheel_t S);
+
+FLINT_DLL ulong n_primes_wheel_next(n_primes_wheel_t S);
+
+FLINT_DLL void n_primes_range_partition(ulong * bounds, ulong a, ulong b,
+                                                                   slong num);
+
+FLINT_DLL ulong n_primes_count_range(ulong a, ulong b);
+
+FLINT_DLL void n_primes_range_apply(ulong a, ulong b,
+    void (*f)(void * arg, const ulong * primes, slong num),
+    void * args, size_t arg_size, slong num);
+
 FLINT_DLL extern const unsigned int flint_primes_small[];
 
-extern FLINT_TLS_PREFIX ulong * _flint_primes[FLINT_BITS];
-extern FLINT_TLS_PREFIX double * _flint_prime_inverses[FLINT_BITS];
-extern FLINT_TLS_PREFIX int _flint_primes_used;
-#if defined(_OPENMP)
-#pragma omp threadprivate(_flint_primes, _flint_prime_inverses, _flint_primes_used)
+/*
+   The tables of primes are shared by all threads and only ever grow. New
+   tables are published by storing the number of tables in use with release
+   semantics after the tables have been written, so readers need no lock.
+*/
+FLINT_DLL extern ulong * _flint_primes[FLINT_BITS];
+FLINT_DLL extern double * _flint_prime_inverses[FLINT_BITS];
+FLINT_DLL extern int _flint_primes_used;
+
+ULONG_EXTRAS_INLINE
+int _n_primes_used(void)
+{
+#if defined(__GNUC__)
+    return __atomic_load_n(&_flint_primes_used, __ATOMIC_ACQUIRE);
+#else
+    return *((volatile int *) &_flint_primes_used);
+#endif
+}
+
+ULONG_EXTRAS_INLINE
+void _n_primes_set_used(int used)
+{
+#if defined(__GNUC__)
+    __atomic_store_n(&_flint_primes_used, used, __ATOMIC_RELEASE);
+#else
+    *((volatile int *) &_flint_primes_used) = used;
 #endif
+}
 
 FLINT_DLL void n_compute_primes(ulong num_primes);
 
@@ -279,6 +410,91 @@ ulong n_negmod(ulong x, ulong n)
     return n_submod(0, x, n);
 }
 
+/* Montgomery arithmetic *****************************************************/
+
+/*
+   Residues x mod an odd n are represented by x 2^FLINT_BITS mod n, so
+   that products are reduced with two multiplications (REDC) instead of a
+   division. Addition, subtraction and negation are those of the standard
+   representation, e.g. n_addmod.
+*/
+typedef struct
+{
+    ulong n;        /* odd modulus */
+    ulong ninv;     /* n^-1 mod 2^FLINT_BITS */
+    ulong one;      /* 2^FLINT_BITS mod n, the representation of 1 */
+    ulong r2;       /* 2^(2 FLINT_BITS) mod n */
+}
+n_mont_t;
+
+ULONG_EXTRAS_INLINE
+ulong n_mont_inverse(ulong n)
+{
+    ulong r = n;    /* correct to 3 bits, each step doubles that */
+    int i;
+
+    FLINT_ASSERT(n & 1);
+
+    for (i = 0; i < 5; i++)
+        r *= 2 - n * r;
+
+    return r;
+}
+
+FLINT_DLL void n_mont_init(n_mont_t * mont, ulong n);
+
+/* (hi 2^FLINT_BITS + lo) 2^-FLINT_BITS mod n, for hi < n */
+ULONG_EXTRAS_INLINE
+ulong _n_mont_redc(ulong hi, ulong lo, ulong n, ulong ninv)
+{
+    ulong mh, ml;
+
+    umul_ppmm(mh, ml, lo * ninv, n);
+
+    return (hi >= mh) ? hi - mh : hi - mh + n;
+}
+
+ULONG_EXTRAS_INLINE
+ulong _n_mont_mul(ulong a, ulong b, ulong n, ulong ninv)
+{
+    ulong hi, lo;
+
+    umul_ppmm(hi, lo, a, b);
+
+    return _n_mont_redc(hi, lo, n, ninv);
+}
+
+ULONG_EXTRAS_INLINE
+ulong n_mont_redc(ulong hi, ulong lo, n_mont_t mont)
+{
+    return _n_mont_redc(hi, lo, mont.n, mont.ninv);
+}
+
+ULONG_EXTRAS_INLINE
+ulong n_mont_mul(ulong a, ulong b, n_mont_t mont)
+{
+    return _n_mont_mul(a, b, mont.n, mont.ninv);
+}
+
+ULONG_EXTRAS_INLINE
+ulong n_mont_set_ui(ulong a, n_mont_t mont)
+{
+    if (a >= mont.n)
+        a %= mont.n;
+
+    return n_mont_mul(a, mont.r2, mont);
+}
+
+ULONG_EXTRAS_INLINE
+ulong n_mont_get_ui(ulong a, n_mont_t mont)
+{
+    return n_mont_redc(0, a, mont);
+}
+
+FLINT_DLL ulong n_mont_powmod(ulong a, ulong exp, n_mont_t mont);
+
+FLINT_DLL int n_is_strong_probabprime_mont(ulong a, ulong d, n_mont_t mont);
+
 FLINT_DLL ulong n_sqrtmod(ulong a, ulong p);
 
 FLINT_DLL slong n_sqrtmod_2pow(ulong ** sqrt, ulong a, slong exp); 
@@ -362,12 +578,16 @@ FLINT_DLL int n_is_prime_pocklington(ulong n, ulong iterations);
 
 FLINT_DLL int n_is_prime(ulong n);
 
+FLINT_DLL void n_is_prime_vec(int * res, const ulong * n, slong len);
+
 FLINT_DLL ulong n_nth_prime(ulong n);
 
 FLINT_DLL void n_nth_prime_bounds(ulong *lo, ulong *hi, ulong n);
 
 FLINT_DLL ulong n_prime_pi(ulong n);
 
+FLINT_DLL ulong n_prime_pi_lmo(ulong n);
+
 FLINT_DLL void n_prime_pi_bounds(ulong *lo, ulong *hi, ulong n);
 
 FLINT_DLL int n_remove(ulong * n, ulong p);
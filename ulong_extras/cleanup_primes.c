@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2013 Fredrik Johansson
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -12,12 +13,17 @@
 #include <gmp.h>
 #include "flint.h"
 #include "ulong_extras.h"
+#include <pthread.h>
+
+extern pthread_mutex_t _flint_primes_lock;
 
 void
 n_cleanup_primes()
 {
     int i;
 
+    pthread_mutex_lock(&_flint_primes_lock);
+
     for (i = 0; i < _flint_primes_used; i++)
     {
         if (i < _flint_primes_used - 1 && _flint_primes[i] == _flint_primes[i+1])
@@ -27,6 +33,8 @@ n_cleanup_primes()
         flint_free(_flint_prime_inverses[i]);
     }
 
-    _flint_primes_used = 0;
+    _n_primes_set_used(0);
+
+    pthread_mutex_unlock(&_flint_primes_lock);
 }
 
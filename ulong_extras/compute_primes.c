@@ -2,6 +2,7 @@
     Copyright (C) 2009 Tom Boothby
     Copyright (C) 2009 William Hart
     Copyright (C) 2010 Fredrik Johansson
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -23,11 +24,8 @@
 #include "ulong_extras.h"
 #include <pthread.h>
 
-#if FLINT_REENTRANT && !HAVE_TLS
-
-static pthread_once_t primes_initialised = PTHREAD_ONCE_INIT;
-pthread_mutex_t primes_lock;
-#endif
+/* serialises the writers; readers only load _flint_primes_used */
+pthread_mutex_t _flint_primes_lock = PTHREAD_MUTEX_INITIALIZER;
 
 const unsigned int flint_primes_small[] =
 {
@@ -44,62 +42,56 @@ const unsigned int flint_primes_small[] =
 };
 
 
-/* _flint_primes[i] holds an array of 2^i primes */
-FLINT_TLS_PREFIX mp_limb_t * _flint_primes[FLINT_BITS];
-FLINT_TLS_PREFIX double * _flint_prime_inverses[FLINT_BITS];
-FLINT_TLS_PREFIX int _flint_primes_used = 0;
-#pragma omp threadprivate(_flint_primes, _flint_prime_inverses, _flint_primes_used)
-
-#if FLINT_REENTRANT && !HAVE_TLS
-void n_compute_primes_init()
-{
-   pthread_mutex_init(&primes_lock, NULL);
-}
-#endif
+/*
+    _flint_primes[i] holds an array of at least 2^i primes. The tables are
+    shared by all threads and are never modified once published, so that
+    pointers handed out remain valid while the tables grow.
+*/
+mp_limb_t * _flint_primes[FLINT_BITS];
+double * _flint_prime_inverses[FLINT_BITS];
+int _flint_primes_used = 0;
 
 void
 n_compute_primes(ulong num_primes)
 {
     int i, m;
     ulong num_computed;
-
-#if FLINT_REENTRANT && !HAVE_TLS
-    pthread_once(&primes_initialised, n_compute_primes_init);
-    pthread_mutex_lock(&primes_lock);
-#endif
+    mp_limb_t * primes;
+    double * inverses;
 
     m = FLINT_CLOG2(num_primes);
 
-    if (_flint_primes_used == 0)
-        flint_register_cleanup_function(n_cleanup_primes);
+    if (m < _n_primes_used())
+        return;
+
+    pthread_mutex_lock(&_flint_primes_lock);
 
+    /* another thread may have extended the tables in the meantime */
     if (m >= _flint_primes_used)
     {
         n_primes_t iter;
 
         num_computed = UWORD(1) << m;
-        _flint_primes[m] = flint_malloc(sizeof(mp_limb_t) * num_computed);
-        _flint_prime_inverses[m] = flint_malloc(sizeof(double) * num_computed);
+        primes = flint_malloc(sizeof(mp_limb_t) * num_computed);
+        inverses = flint_malloc(sizeof(double) * num_computed);
 
         n_primes_init(iter);
         for (i = 0; i < num_computed; i++)
         {
-            _flint_primes[m][i] = n_primes_next(iter);
-            _flint_prime_inverses[m][i] = n_precompute_inverse(_flint_primes[m][i]);
+            primes[i] = n_primes_next(iter);
+            inverses[i] = n_precompute_inverse(primes[i]);
         }
         n_primes_clear(iter);
 
-        /* copy to lower power-of-two slots */
-        for (i = m - 1; i >= _flint_primes_used; i--)
+        /* fill the new power-of-two slots, then publish them */
+        for (i = m; i >= _flint_primes_used; i--)
         {
-            _flint_primes[i] = _flint_primes[m];
-            _flint_prime_inverses[i] = _flint_prime_inverses[m];
+            _flint_primes[i] = primes;
+            _flint_prime_inverses[i] = inverses;
         }
-        _flint_primes_used = m + 1;
+
+        _n_primes_set_used(m + 1);
     }
 
-#if FLINT_REENTRANT && !HAVE_TLS
-    pthread_mutex_unlock(&primes_lock);
-#endif
+    pthread_mutex_unlock(&_flint_primes_lock);
 }
-
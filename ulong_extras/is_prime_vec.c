@@ -0,0 +1,359 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "thread_pool.h"
+
+/* candidates trial divided before their survivors are tested together */
+#define IS_PRIME_VEC_CHUNK 256
+
+/* strong probable prime tests run side by side, written out below */
+#define IS_PRIME_VEC_LANES 4
+
+typedef struct
+{
+    int * res;
+    const ulong * n;
+    slong len;
+    const ulong * pinv;     /* pinv[i] = p_i^-1 mod 2^FLINT_BITS */
+    const ulong * plim;     /* plim[i] = floor((2^FLINT_BITS - 1) / p_i) */
+    ulong plast;            /* the largest trial prime */
+}
+_is_prime_vec_arg_t;
+
+typedef struct
+{
+    ulong n[IS_PRIME_VEC_LANES];
+    ulong ninv[IS_PRIME_VEC_LANES];     /* n^-1 mod 2^FLINT_BITS */
+    ulong one[IS_PRIME_VEC_LANES];      /* 2^FLINT_BITS mod n */
+    ulong r2[IS_PRIME_VEC_LANES];       /* 2^(2 FLINT_BITS) mod n */
+    ulong d[IS_PRIME_VEC_LANES];        /* n - 1 = 2^s d with d odd */
+    int s[IS_PRIME_VEC_LANES];
+    int ok[IS_PRIME_VEC_LANES];
+    int have_r2;
+    ulong dmax;
+    slong num;
+}
+_lanes_t;
+
+/* unused lanes repeat the first number */
+static void
+_lanes_init(_lanes_t * L, const ulong * n, slong num)
+{
+    slong i;
+
+    L->num = num;
+    L->dmax = 0;
+    L->have_r2 = 0;
+
+    for (i = 0; i < IS_PRIME_VEC_LANES; i++)
+    {
+        ulong m = n[i < num ? i : 0];
+
+        L->n[i] = m;
+        L->ninv[i] = n_mont_inverse(m);
+        L->one[i] = (UWORD(0) - m) % m;
+        L->d[i] = m - 1;
+        count_trailing_zeros(L->s[i], L->d[i]);
+        L->d[i] >>= L->s[i];
+        L->dmax |= L->d[i];
+        L->ok[i] = (i < num);
+    }
+}
+
+/* 2 x mod n if bit is set, x otherwise, for x < n */
+static __inline__ ulong
+_double_if(ulong x, ulong n, ulong bit)
+{
+    ulong t = x + x;
+
+    if (t < x || t >= n)
+        t -= n;
+
+    return bit ? t : x;
+}
+
+#define LANES_MUL(y, u, v) \
+    do { \
+        y##0 = _n_mont_mul(u##0, v##0, n0, i0); \
+        y##1 = _n_mont_mul(u##1, v##1, n1, i1); \
+        y##2 = _n_mont_mul(u##2, v##2, n2, i2); \
+        y##3 = _n_mont_mul(u##3, v##3, n3, i3); \
+    } while (0)
+
+/*
+    Clears ok[i] for the lanes that are not strong probable primes to
+    base a. The lanes exponentiate in Montgomery form in lockstep, so that
+    their independent multiplications overlap; shorter exponents are padded
+    with leading zero bits, which square the representation of 1. For
+    a = 2 the multiplications by the base are doublings, other bases use
+    windows of four bits.
+*/
+static void
+_lanes_strong_test(_lanes_t * L, ulong a)
+{
+    ulong x[IS_PRIME_VEC_LANES], am[IS_PRIME_VEC_LANES], minus_one;
+    ulong n0 = L->n[0], n1 = L->n[1], n2 = L->n[2], n3 = L->n[3];
+    ulong i0 = L->ninv[0], i1 = L->ninv[1], i2 = L->ninv[2], i3 = L->ninv[3];
+    ulong d0 = L->d[0], d1 = L->d[1], d2 = L->d[2], d3 = L->d[3];
+    ulong x0 = L->one[0], x1 = L->one[1], x2 = L->one[2], x3 = L->one[3];
+    slong i, j, b;
+
+    if (a == 2)
+    {
+        for (i = 0; i < IS_PRIME_VEC_LANES; i++)
+            am[i] = 1;
+
+        for (b = FLINT_BIT_COUNT(L->dmax) - 1; b >= 0; b--)
+        {
+            LANES_MUL(x, x, x);
+
+            x0 = _double_if(x0, n0, (d0 >> b) & 1);
+            x1 = _double_if(x1, n1, (d1 >> b) & 1);
+            x2 = _double_if(x2, n2, (d2 >> b) & 1);
+            x3 = _double_if(x3, n3, (d3 >> b) & 1);
+        }
+    }
+    else
+    {
+        ulong t0[16], t1[16], t2[16], t3[16];
+
+        if (!L->have_r2)
+        {
+            for (i = 0; i < IS_PRIME_VEC_LANES; i++)
+                L->r2[i] = n_mulmod2_preinv(L->one[i], L->one[i], L->n[i],
+                                                 n_preinvert_limb(L->n[i]));
+            L->have_r2 = 1;
+        }
+
+        for (i = 0; i < IS_PRIME_VEC_LANES; i++)
+            am[i] = _n_mont_mul(a % L->n[i], L->r2[i], L->n[i], L->ninv[i]);
+
+        /* t[k] = a^k */
+        t0[0] = x0; t1[0] = x1; t2[0] = x2; t3[0] = x3;
+        t0[1] = am[0]; t1[1] = am[1]; t2[1] = am[2]; t3[1] = am[3];
+        for (j = 2; j < 16; j++)
+        {
+            t0[j] = _n_mont_mul(t0[j - 1], t0[1], n0, i0);
+            t1[j] = _n_mont_mul(t1[j - 1], t1[1], n1, i1);
+            t2[j] = _n_mont_mul(t2[j - 1], t2[1], n2, i2);
+            t3[j] = _n_mont_mul(t3[j - 1], t3[1], n3, i3);
+        }
+
+        for (b = (FLINT_BIT_COUNT(L->dmax) + 3) / 4 * 4 - 4; b >= 0; b -= 4)
+        {
+            LANES_MUL(x, x, x);
+            LANES_MUL(x, x, x);
+            LANES_MUL(x, x, x);
+            LANES_MUL(x, x, x);
+
+            x0 = _n_mont_mul(x0, t0[(d0 >> b) & 15], n0, i0);
+            x1 = _n_mont_mul(x1, t1[(d1 >> b) & 15], n1, i1);
+            x2 = _n_mont_mul(x2, t2[(d2 >> b) & 15], n2, i2);
+            x3 = _n_mont_mul(x3, t3[(d3 >> b) & 15], n3, i3);
+        }
+    }
+
+    x[0] = x0;
+    x[1] = x1;
+    x[2] = x2;
+    x[3] = x3;
+
+    for (i = 0; i < L->num; i++)
+    {
+        int pass;
+
+        /* a base divisible by n says nothing */
+        if (!L->ok[i] || am[i] == 0)
+            continue;
+
+        minus_one = L->n[i] - L->one[i];
+        pass = (x[i] == L->one[i] || x[i] == minus_one);
+
+        for (j = 1; j < L->s[i] && !pass; j++)
+        {
+            x[i] = _n_mont_mul(x[i], x[i], L->n[i], L->ninv[i]);
+
+            if (x[i] == minus_one)
+                pass = 1;
+            else if (x[i] == L->one[i])
+                break;
+        }
+
+        L->ok[i] = pass;
+    }
+}
+
+#undef LANES_MUL
+
+/*
+    Bases for which strong probable primes below the bound are prime,
+    due to Jaeschke and (for all of 2^64) Sinclair.
+*/
+static const ulong _bases_32[] = {2, 7, 61};
+
+#if FLINT64
+static const ulong _bases_40[] = {2, 13, 23, 1662803};
+
+static const ulong _bases_64[] = {2, 325, 9375, 28178, 450775, 9780504,
+                                                              1795265022};
+#endif
+
+static void
+_n_is_prime_vec_range(_is_prime_vec_arg_t * arg)
+{
+    ulong surv[IS_PRIME_VEC_CHUNK];
+    slong idx[IS_PRIME_VEC_CHUNK];
+    const ulong * pinv = arg->pinv;
+    const ulong * plim = arg->plim;
+    ulong plast = arg->plast, n;
+    slong c0, c1, i, j, num;
+
+    for (c0 = 0; c0 < arg->len; c0 = c1)
+    {
+        c1 = FLINT_MIN(c0 + IS_PRIME_VEC_CHUNK, arg->len);
+        num = 0;
+
+        /* one table of exact division inverses serves all candidates */
+        for (i = c0; i < c1; i++)
+        {
+            n = arg->n[i];
+
+            if (n <= plast || (n & 1) == 0)
+            {
+                arg->res[i] = (n <= plast) ? n_is_prime(n) : 0;
+                continue;
+            }
+
+            for (j = 0; j < FLINT_IS_PRIME_VEC_TRIAL; j++)
+                if (n * pinv[j] <= plim[j])
+                    break;
+
+            if (j < FLINT_IS_PRIME_VEC_TRIAL)
+                arg->res[i] = 0;
+            else if (n < plast * plast)
+                arg->res[i] = 1;
+            else
+            {
+                surv[num] = n;
+                idx[num] = i;
+                num++;
+            }
+        }
+
+        for (i = 0; i < num; i += IS_PRIME_VEC_LANES)
+        {
+            slong k = FLINT_MIN(IS_PRIME_VEC_LANES, num - i), nb;
+            const ulong * bases;
+            _lanes_t L;
+            ulong nmax = 0;
+
+            for (j = 0; j < k; j++)
+                nmax = FLINT_MAX(nmax, surv[i + j]);
+
+#if FLINT64
+            if (nmax < UWORD(4759123141))
+#endif
+            {
+                bases = _bases_32;
+                nb = 3;
+            }
+#if FLINT64
+            else if (nmax < UWORD(1122004669633))
+            {
+                bases = _bases_40;
+                nb = 4;
+            }
+            else
+            {
+                bases = _bases_64;
+                nb = 7;
+            }
+#endif
+
+            _lanes_init(&L, surv + i, k);
+
+            /* stop once all lanes are known to be composite */
+            for (j = 0; j < nb; j++)
+            {
+                slong l, alive = 0;
+
+                _lanes_strong_test(&L, bases[j]);
+
+                for (l = 0; l < k; l++)
+                    alive += L.ok[l];
+
+                if (alive == 0)
+                    break;
+            }
+
+            for (j = 0; j < k; j++)
+                arg->res[idx[i + j]] = L.ok[j];
+        }
+    }
+}
+
+static void
+_n_is_prime_vec_worker(void * arg_ptr)
+{
+    _n_is_prime_vec_range((_is_prime_vec_arg_t *) arg_ptr);
+}
+
+void
+n_is_prime_vec(int * res, const ulong * n, slong len)
+{
+    ulong pinv[FLINT_IS_PRIME_VEC_TRIAL], plim[FLINT_IS_PRIME_VEC_TRIAL];
+    _is_prime_vec_arg_t * args;
+    const ulong * primes;
+    slong i, num_threads;
+
+    if (len <= 0)
+        return;
+
+    /* the odd primes 3, 5, 7, ... */
+    primes = n_primes_arr_readonly(FLINT_IS_PRIME_VEC_TRIAL + 1) + 1;
+
+    for (i = 0; i < FLINT_IS_PRIME_VEC_TRIAL; i++)
+    {
+        pinv[i] = n_mont_inverse(primes[i]);
+        plim[i] = UWORD_MAX / primes[i];
+    }
+
+    num_threads = flint_get_num_threads();
+    if (len < FLINT_IS_PRIME_VEC_THREAD_CUTOFF)
+        num_threads = 1;
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads, len / IS_PRIME_VEC_CHUNK));
+
+    args = flint_malloc(sizeof(_is_prime_vec_arg_t) * num_threads);
+
+    for (i = 0; i < num_threads; i++)
+    {
+        slong i0 = (len * i) / num_threads;
+        slong i1 = (len * (i + 1)) / num_threads;
+
+        args[i].res = res + i0;
+        args[i].n = n + i0;
+        args[i].len = i1 - i0;
+        args[i].pinv = pinv;
+        args[i].plim = plim;
+        args[i].plast = primes[FLINT_IS_PRIME_VEC_TRIAL - 1];
+    }
+
+    if (num_threads == 1)
+        _n_is_prime_vec_range(args);
+    else
+        flint_parallel_do(_n_is_prime_vec_worker, args, num_threads,
+                                   sizeof(_is_prime_vec_arg_t), num_threads);
+
+    flint_free(args);
+}
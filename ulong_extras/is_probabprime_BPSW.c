@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2008 Peter Shrimpton
     Copyright (C) 2009 William Hart
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -50,8 +51,9 @@ n_is_probabprime_BPSW(mp_limb_t n)
         }
         else
         {
-            mp_limb_t ninv = n_preinvert_limb(n);
-            if (n_is_strong_probabprime2_preinv(n, ninv, WORD(2), d) == 0)
+            n_mont_t mont;
+            n_mont_init(&mont, n);
+            if (n_is_strong_probabprime_mont(WORD(2), d, mont) == 0)
                 return 0;
         }
 
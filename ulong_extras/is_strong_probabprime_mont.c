@@ -0,0 +1,43 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+int
+n_is_strong_probabprime_mont(ulong a, ulong d, n_mont_t mont)
+{
+    ulong t = d, y, minus_one;
+
+    /* Map large base to range 2 ... n - 1 */
+    if (a >= mont.n)
+        a %= mont.n;
+
+    if ((a <= 1) || (a == mont.n - 1))
+        return 1;
+
+    minus_one = mont.n - mont.one;
+
+    y = n_mont_powmod(n_mont_set_ui(a, mont), t, mont);
+
+    if (y == mont.one)
+        return 1;
+    t <<= 1;
+
+    while ((t != mont.n - 1) && (y != minus_one))
+    {
+        y = n_mont_mul(y, y, mont);
+        t <<= 1;
+    }
+
+    return (y == minus_one);
+}
@@ -0,0 +1,29 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+void
+n_mont_init(n_mont_t * mont, ulong n)
+{
+    if ((n & 1) == 0)
+    {
+        flint_printf("Exception (n_mont_init). Even modulus.\n");
+        flint_abort();
+    }
+
+    mont->n = n;
+    mont->ninv = n_mont_inverse(n);
+    mont->one = (UWORD(0) - n) % n;
+    mont->r2 = n_mulmod2_preinv(mont->one, mont->one, n, n_preinvert_limb(n));
+}
@@ -0,0 +1,35 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+ulong
+n_mont_powmod(ulong a, ulong exp, n_mont_t mont)
+{
+    ulong x;
+    slong b;
+
+    if (exp == 0)
+        return mont.one;
+
+    x = a;
+    for (b = (slong) FLINT_BIT_COUNT(exp) - 2; b >= 0; b--)
+    {
+        x = n_mont_mul(x, x, mont);
+
+        if ((exp >> b) & 1)
+            x = n_mont_mul(x, a, mont);
+    }
+
+    return x;
+}
@@ -1,5 +1,6 @@
 /*
     Copyright (C) 2010 Fredrik Johansson
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -12,19 +13,104 @@
 #define ulong ulongxx /* interferes with system includes */
 #include <stdlib.h>
 #include <stdio.h>
+#include <math.h>
 #undef ulong
 #define ulong mp_limb_t
 #include "flint.h"
 #include "ulong_extras.h"
 
+/* the logarithmic integral by Ramanujan's series, for x >= 2 */
+static double _n_li(double x)
+{
+    double l = log(x), t = l, inner = 0.0, s = 0.0;
+    slong k;
+
+    for (k = 1; k < 200; k++)
+    {
+        /* t = (-1)^(k-1) l^k/(k! 2^(k-1)) */
+        if (k > 1)
+            t *= -l/(2*k);
+
+        if (k % 2 == 1)
+            inner += 1.0/k;
+
+        s += t*inner;
+
+        if (fabs(t*inner) < 1e-17*fabs(s))
+            break;
+    }
+
+    return 0.5772156649015329 + log(l) + sqrt(x)*s;
+}
+
 mp_limb_t n_nth_prime(ulong n)
 {
+    ulong lo, hi, guess, count, p, d, low, high;
+    double x;
+    slong i, num;
+    mp_limb_t * buf;
+    n_primes_t iter;
+
     if (n == 0)
     {
         flint_printf("Exception (n_nth_prime). n_nth_prime(0) is undefined.\n");
         flint_abort();
     }
 
-    return n_primes_arr_readonly(n)[n-1];
-}
+    if (n < FLINT_NTH_PRIME_LMO_CUTOFF)
+        return n_primes_arr_readonly(n)[n-1];
+
+    /* Newton iteration for li(x) = n, the error being O(sqrt(x) log(x)) */
+    x = n*log((double) n);
+    for (i = 0; i < 20; i++)
+        x -= (_n_li(x) - n)*log(x);
+
+    n_nth_prime_bounds(&lo, &hi, n);
+    guess = (ulong) x;
+    guess = FLINT_MAX(guess, lo);
+    guess = FLINT_MIN(guess, hi);
 
+    count = n_prime_pi(guess);
+
+    n_primes_init(iter);
+
+    if (count < n)
+    {
+        /* walk forwards from the guess */
+        n_primes_jump_after(iter, guess);
+        for (p = 0; count < n; count++)
+            p = n_primes_next(iter);
+    } else
+    {
+        /* walk backwards in blocks, the wanted prime being the d-th below */
+        d = count - n;
+        buf = flint_malloc((FLINT_SIEVE_SIZE/2 + 1)*sizeof(mp_limb_t));
+        high = guess;
+        p = 0;
+
+        while (1)
+        {
+            low = high > FLINT_SIEVE_SIZE ? high - FLINT_SIEVE_SIZE : 0;
+
+            num = 0;
+            n_primes_jump_after(iter, low);
+            while ((buf[num] = n_primes_next(iter)) <= high)
+                num++;
+
+            if ((ulong) num > d)
+            {
+                p = buf[num - 1 - d];
+                break;
+            }
+
+            d -= num;
+            high = low;
+        }
+
+        flint_free(buf);
+    }
+
+    n_primes_clear(iter);
+
+    return p;
+}
@@ -0,0 +1,409 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "thread_pool.h"
+
+/*
+    The Lagarias-Miller-Odlyzko method. With y = alpha*n^(1/3) and a = pi(y)
+
+        pi(n) = phi(n, a) + a - 1 - P2(n, y)
+
+    where phi(n, a) = S1 + S2 is split into the ordinary leaves
+
+        S1 = sum_{m <= y} mu(m) floor(n/m)
+
+    and the special leaves
+
+        S2 = -sum_{b < a} sum_{y/p_b < m <= y, lpf(m) > p_b}
+                                              mu(m) phi(n/(p_b m), b - 1),
+
+    the values of phi being read off a segmented sieve of [1, n/y] with
+    a binary indexed tree. All arithmetic is modulo 2^FLINT_BITS; the
+    intermediate sums may wrap around but the final result is exact.
+*/
+
+#define LMO_SEGMENT_MIN (WORD(1) << 14)
+#define LMO_SEGMENT_MAX (WORD(1) << 20)
+
+typedef struct
+{
+    ulong n, y;
+    slong a;
+    const ulong * primes;       /* primes[1..a] */
+    const unsigned int * lpf;   /* least prime factor, lpf[1] = UINT_MAX */
+    const signed char * mu;
+    ulong low, high;            /* part of the sieve interval */
+    slong segment_size;
+    ulong s2;                   /* special leaves with phi counted from low */
+    ulong * phi;                /* unsieved count in [low, high) for each b */
+    slong * mu_sum;             /* sum of mu(m) of the leaves for each b */
+}
+_lmo_arg_struct;
+
+typedef _lmo_arg_struct _lmo_arg_t[1];
+
+/* tree over a segment of which every entry is initially 1 */
+static void _lmo_tree_init(ulong * tree, slong len)
+{
+    slong i;
+
+    for (i = 0; i < len; i++)
+        tree[i] = (i + 1) & -(i + 1);
+}
+
+static void _lmo_tree_remove(ulong * tree, slong len, slong i)
+{
+    for ( ; i < len; i |= i + 1)
+        tree[i]--;
+}
+
+/* number of entries in positions 0 to i */
+static ulong _lmo_tree_count(const ulong * tree, slong i)
+{
+    ulong s = 0;
+
+    for (i = i + 1; i > 0; i &= i - 1)
+        s += tree[i - 1];
+
+    return s;
+}
+
+static void _lmo_s2_worker(void * arg_ptr)
+{
+    _lmo_arg_struct * arg = (_lmo_arg_struct *) arg_ptr;
+    ulong n = arg->n, y = arg->y, low, high, prime, m, min_m, max_m, k;
+    ulong count, s2 = 0;
+    slong a = arg->a, b, len, i;
+    const ulong * primes = arg->primes;
+    const unsigned int * lpf = arg->lpf;
+    const signed char * mu = arg->mu;
+    unsigned char * sieve;
+    ulong * tree;
+
+    sieve = (unsigned char *) flint_malloc(arg->segment_size);
+    tree = (ulong *) flint_malloc(arg->segment_size*sizeof(ulong));
+
+    for (b = 0; b <= a; b++)
+    {
+        arg->phi[b] = 0;
+        arg->mu_sum[b] = 0;
+    }
+
+    for (low = arg->low; low < arg->high; low += arg->segment_size)
+    {
+        high = FLINT_MIN(low + arg->segment_size, arg->high);
+        len = high - low;
+
+        memset(sieve, 1, len);
+        _lmo_tree_init(tree, len);
+        count = len;
+
+        for (b = 1; b < a; b++)
+        {
+            prime = primes[b];
+            min_m = FLINT_MAX(n/prime/high, y/prime);
+            max_m = FLINT_MIN(n/prime/low, y);
+
+            /* no leaves for this or any larger b from here on */
+            if (prime >= max_m)
+                break;
+
+            for (m = max_m; m > min_m; m--)
+            {
+                if (mu[m] != 0 && prime < lpf[m])
+                {
+                    k = n/prime/m;
+                    s2 -= mu[m]*(arg->phi[b] + _lmo_tree_count(tree, k - low));
+                    arg->mu_sum[b] += mu[m];
+                }
+            }
+
+            arg->phi[b] += count;
+
+            /* remove the multiples of prime */
+            k = ((low + prime - 1)/prime)*prime;
+            for (i = k - low; i < len; i += prime)
+            {
+                if (sieve[i])
+                {
+                    sieve[i] = 0;
+                    _lmo_tree_remove(tree, len, i);
+                    count--;
+                }
+            }
+        }
+    }
+
+    arg->s2 = s2;
+
+    flint_free(tree);
+    flint_free(sieve);
+}
+
+/* set s[i] = 1 if low + i is prime, for low + i < high */
+static void _lmo_sieve_primes(unsigned char * s, ulong low, ulong high,
+                                               const ulong * sp, slong nsp)
+{
+    slong i;
+    ulong p, k;
+
+    memset(s, 1, high - low);
+
+    for (k = low; k < FLINT_MIN(high, 2); k++)
+        s[k - low] = 0;
+
+    for (i = 0; i < nsp; i++)
+    {
+        p = sp[i];
+
+        if (p*p >= high)
+            break;
+
+        k = FLINT_MAX(p*p, ((low + p - 1)/p)*p);
+        for ( ; k < high; k += p)
+            s[k - low] = 0;
+    }
+}
+
+/* counts the primes up to t for a nondecreasing sequence of t <= limit */
+typedef struct
+{
+    unsigned char * s;
+    ulong low, high, limit;
+    ulong pos, count;           /* count of the primes below low + pos */
+    const ulong * sp;
+    slong nsp, segment_size;
+}
+_lmo_counter_struct;
+
+static ulong _lmo_counter_pi(_lmo_counter_struct * c, ulong t)
+{
+    while (t >= c->high)
+    {
+        for ( ; c->pos < c->high - c->low; c->pos++)
+            c->count += c->s[c->pos];
+
+        c->low = c->high;
+        c->high = FLINT_MIN(c->low + c->segment_size, c->limit + 1);
+        _lmo_sieve_primes(c->s, c->low, c->high, c->sp, c->nsp);
+        c->pos = 0;
+    }
+
+    for ( ; c->pos <= t - c->low; c->pos++)
+        c->count += c->s[c->pos];
+
+    return c->count;
+}
+
+/*
+    P2(n, y) = sum_{y < p <= sqrt(n)} (pi(n/p) - pi(p) + 1). The primes in
+    (y, sqrt(n)] are generated downwards so that the values n/p increase,
+    and pi(n/p) is read off a sieve of [0, n/y] moving upwards.
+*/
+static ulong _lmo_p2(ulong n, ulong y, slong a, slong segment_size)
+{
+    ulong sqrtn = n_sqrt(n), p2 = 0, t, p, b, low, high;
+    unsigned char * s;
+    ulong * sp;
+    slong nsp, j;
+    _lmo_counter_struct c;
+    n_primes_t iter;
+
+    if (sqrtn <= y)
+        return 0;
+
+    /* sieving primes up to sqrt(n/y) */
+    t = n_sqrt(n/y) + 1;
+    nsp = 0;
+    sp = (ulong *) flint_malloc((2*(t/FLINT_BIT_COUNT(t)) + 10)*sizeof(ulong));
+    n_primes_init(iter);
+    while ((p = n_primes_next(iter)) <= t)
+        sp[nsp++] = p;
+    n_primes_clear(iter);
+
+    s = (unsigned char *) flint_malloc(segment_size);
+
+    c.s = (unsigned char *) flint_malloc(segment_size);
+    c.limit = n/y;
+    c.low = 0;
+    c.high = FLINT_MIN((ulong) segment_size, c.limit + 1);
+    c.pos = 0;
+    c.count = 0;
+    c.sp = sp;
+    c.nsp = nsp;
+    c.segment_size = segment_size;
+    _lmo_sieve_primes(c.s, c.low, c.high, sp, nsp);
+
+    /* p runs down through the primes in (y, sqrt(n)], p being the b-th */
+    b = _lmo_counter_pi(&c, sqrtn);
+
+    high = sqrtn + 1;
+    while (high > y + 1)
+    {
+        low = (high - (y + 1) > (ulong) segment_size) ?
+                                                high - segment_size : y + 1;
+        _lmo_sieve_primes(s, low, high, sp, nsp);
+
+        for (j = high - low - 1; j >= 0; j--)
+        {
+            if (s[j])
+            {
+                p2 += _lmo_counter_pi(&c, n/(low + j)) - b + 1;
+                b--;
+            }
+        }
+
+        high = low;
+    }
+
+    FLINT_ASSERT(b == (ulong) a);
+
+    flint_free(c.s);
+    flint_free(s);
+    flint_free(sp);
+
+    return p2;
+}
+
+ulong n_prime_pi_lmo(ulong n)
+{
+    ulong y, alpha, limit, s1, s2, p2, chunk, p, k;
+    ulong * primes, * phi_before;
+    unsigned int * lpf;
+    signed char * mu;
+    slong a, b, i, num_threads, segment_size;
+    _lmo_arg_struct * args;
+
+    if (n < 1000)
+    {
+        n_primes_t iter;
+
+        a = 0;
+        n_primes_init(iter);
+        while (n_primes_next(iter) <= n)
+            a++;
+        n_primes_clear(iter);
+
+        return a;
+    }
+
+    alpha = FLINT_MAX(1, FLINT_BIT_COUNT(n)/12);
+    y = FLINT_MIN(alpha*n_cbrt(n), n_sqrt(n));
+    limit = n/y + 1;
+
+    /* least prime factors, Moebius function and primes up to y */
+    lpf = (unsigned int *) flint_calloc(y + 1, sizeof(unsigned int));
+    mu = (signed char *) flint_malloc(y + 1);
+    primes = (ulong *) flint_malloc((2*(y/FLINT_BIT_COUNT(y)) + 10)
+                                                            *sizeof(ulong));
+    for (k = 0; k <= y; k++)
+        mu[k] = 1;
+
+    a = 0;
+    primes[0] = 1;
+    for (p = 2; p <= y; p++)
+    {
+        if (lpf[p] != 0)
+            continue;
+
+        primes[++a] = p;
+
+        for (k = p; k <= y; k += p)
+        {
+            if (lpf[k] == 0)
+                lpf[k] = p;
+            mu[k] = -mu[k];
+        }
+
+        if (p <= y/p)
+            for (k = p*p; k <= y; k += p*p)
+                mu[k] = 0;
+    }
+    lpf[1] = -(unsigned int) 1;
+
+    s1 = 0;
+    for (k = 1; k <= y; k++)
+        s1 += mu[k]*(n/k);
+
+    segment_size = LMO_SEGMENT_MIN;
+    while (segment_size < LMO_SEGMENT_MAX &&
+                          (ulong) segment_size*segment_size < limit)
+        segment_size *= 2;
+
+    num_threads = flint_get_num_threads();
+    if (n < FLINT_PRIME_PI_THREAD_CUTOFF)
+        num_threads = 1;
+    num_threads = FLINT_MAX(1, FLINT_MIN(num_threads,
+                                       (slong) (limit/segment_size)));
+
+    /* each thread sieves a whole number of segments */
+    chunk = (limit + num_threads - 1)/num_threads;
+    chunk = ((chunk + segment_size - 1)/segment_size)*segment_size;
+
+    args = (_lmo_arg_struct *) flint_malloc(num_threads*sizeof(_lmo_arg_struct));
+
+    for (i = 0; i < num_threads; i++)
+    {
+        args[i].n = n;
+        args[i].y = y;
+        args[i].a = a;
+        args[i].primes = primes;
+        args[i].lpf = lpf;
+        args[i].mu = mu;
+        args[i].low = FLINT_MIN(1 + i*chunk, limit);
+        args[i].high = FLINT_MIN(1 + (i + 1)*chunk, limit);
+        args[i].segment_size = segment_size;
+        args[i].phi = (ulong *) flint_malloc((a + 1)*sizeof(ulong));
+        args[i].mu_sum = (slong *) flint_malloc((a + 1)*sizeof(slong));
+    }
+
+    if (num_threads == 1)
+        _lmo_s2_worker(args + 0);
+    else
+        flint_parallel_do(_lmo_s2_worker, args, num_threads,
+                                       sizeof(_lmo_arg_struct), num_threads);
+
+    /*
+        the threads counted phi from the start of their own part, so add
+        mu(m) times the count over all earlier parts for each leaf
+    */
+    phi_before = (ulong *) flint_calloc(a + 1, sizeof(ulong));
+    s2 = 0;
+
+    for (i = 0; i < num_threads; i++)
+    {
+        s2 += args[i].s2;
+
+        for (b = 1; b < a; b++)
+        {
+            s2 -= args[i].mu_sum[b]*phi_before[b];
+            phi_before[b] += args[i].phi[b];
+        }
+
+        flint_free(args[i].phi);
+        flint_free(args[i].mu_sum);
+    }
+
+    flint_free(phi_before);
+    flint_free(args);
+
+    p2 = _lmo_p2(n, y, a, segment_size);
+
+    flint_free(primes);
+    flint_free(mu);
+    flint_free(lpf);
+
+    return s1 + s2 + a - 1 - p2;
+}
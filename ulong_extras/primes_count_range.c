@@ -0,0 +1,86 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "ulong_extras.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+    ulong a;
+    ulong b;
+    ulong count;
+}
+_count_arg_t;
+
+static void
+_count_worker(void * varg)
+{
+    _count_arg_t * arg = (_count_arg_t *) varg;
+    n_primes_wheel_t S;
+
+    arg->count = 0;
+
+    n_primes_wheel_init(S, arg->a, arg->b);
+    while (n_primes_wheel_next_segment(S))
+        arg->count += n_primes_wheel_segment_count(S);
+    n_primes_wheel_clear(S);
+}
+
+ulong
+n_primes_count_range(ulong a, ulong b)
+{
+    _count_arg_t * args;
+    ulong * bounds, count;
+    slong i, num, num_threads;
+
+    if (b <= a)
+        return 0;
+
+    num_threads = flint_get_num_threads();
+
+    /* several pieces per thread, each at least a few segments long */
+    num = (b - a) / (30 * 4 * FLINT_PRIMES_WHEEL_SEGMENT) + 1;
+    num = FLINT_MIN(num, 4 * num_threads);
+
+    if (num_threads == 1 || num == 1)
+    {
+        _count_arg_t arg;
+
+        arg.a = a;
+        arg.b = b;
+        _count_worker(&arg);
+
+        return arg.count;
+    }
+
+    bounds = flint_malloc((num + 1) * sizeof(ulong));
+    args = flint_malloc(num * sizeof(_count_arg_t));
+
+    n_primes_range_partition(bounds, a, b, num);
+    for (i = 0; i < num; i++)
+    {
+        args[i].a = bounds[i];
+        args[i].b = bounds[i + 1];
+    }
+
+    flint_parallel_do(_count_worker, args, num, sizeof(_count_arg_t),
+                                                                num_threads);
+
+    count = 0;
+    for (i = 0; i < num; i++)
+        count += args[i].count;
+
+    flint_free(args);
+    flint_free(bounds);
+
+    return count;
+}
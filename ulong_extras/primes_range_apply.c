@@ -0,0 +1,80 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "ulong_extras.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+    ulong a;
+    ulong b;
+    void (*f)(void *, const ulong *, slong);
+    void * arg;
+}
+_apply_arg_t;
+
+static void
+_apply_worker(void * varg)
+{
+    _apply_arg_t * arg = (_apply_arg_t *) varg;
+    n_primes_wheel_t S;
+    ulong * primes;
+    slong num;
+
+    primes = flint_malloc((8 * FLINT_PRIMES_WHEEL_SEGMENT + 3) * sizeof(ulong));
+
+    n_primes_wheel_init(S, arg->a, arg->b);
+
+    while (n_primes_wheel_next_segment(S))
+    {
+        num = n_primes_wheel_segment_primes(primes, S);
+        if (num != 0)
+            arg->f(arg->arg, primes, num);
+    }
+
+    n_primes_wheel_clear(S);
+    flint_free(primes);
+}
+
+void
+n_primes_range_apply(ulong a, ulong b,
+    void (*f)(void * arg, const ulong * primes, slong num),
+    void * args, size_t arg_size, slong num)
+{
+    _apply_arg_t * pieces;
+    ulong * bounds;
+    slong i;
+
+    if (num <= 0)
+        return;
+
+    bounds = flint_malloc((num + 1) * sizeof(ulong));
+    pieces = flint_malloc(num * sizeof(_apply_arg_t));
+
+    n_primes_range_partition(bounds, a, b, num);
+    for (i = 0; i < num; i++)
+    {
+        pieces[i].a = bounds[i];
+        pieces[i].b = bounds[i + 1];
+        pieces[i].f = f;
+        pieces[i].arg = (char *) args + i * arg_size;
+    }
+
+    if (num == 1)
+        _apply_worker(pieces);
+    else
+        flint_parallel_do(_apply_worker, pieces, num, sizeof(_apply_arg_t),
+                                                                         num);
+
+    flint_free(pieces);
+    flint_free(bounds);
+}
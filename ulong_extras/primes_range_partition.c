@@ -0,0 +1,35 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "ulong_extras.h"
+
+void
+n_primes_range_partition(ulong * bounds, ulong a, ulong b, slong num)
+{
+    slong i;
+    ulong step, t;
+
+    if (b < a)
+        b = a;
+
+    step = (b - a) / num;
+
+    bounds[0] = a;
+    for (i = 1; i < num; i++)
+    {
+        /* interior bounds fall on wheel byte boundaries */
+        t = a + step * i;
+        t -= t % 30;
+        bounds[i] = FLINT_MAX(t, bounds[i - 1]);
+    }
+    bounds[num] = b;
+}
@@ -0,0 +1,31 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+void
+n_primes_wheel_clear(n_primes_wheel_t S)
+{
+    slong i;
+
+    for (i = 0; i < S->num_buckets; i++)
+        flint_free(S->buckets[i].entries);
+
+    flint_free(S->buckets);
+    flint_free(S->large_primes);
+    flint_free(S->sieve_primes);
+    flint_free(S->sieve_next);
+    flint_free(S->sieve_wheel);
+    flint_free(S->pattern);
+    flint_free(S->seg);
+}
@@ -0,0 +1,165 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdlib.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+const unsigned char _n_primes_wheel_residues[8] = {1, 7, 11, 13, 17, 19, 23, 29};
+
+const unsigned char _n_primes_wheel_bit[30] =
+{
+    255, 0, 255, 255, 255, 255, 255, 1, 255, 255, 255, 2, 255, 3, 255, 255,
+    255, 4, 255, 5, 255, 255, 255, 6, 255, 255, 255, 255, 255, 7
+};
+
+/* index of the first wheel residue >= r, for 0 <= r < 30 */
+static const unsigned char _wheel_next[30] =
+{
+    0, 0, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 4, 4,
+    4, 4, 5, 5, 6, 6, 6, 6, 7, 7, 7, 7, 7, 7
+};
+
+/*
+    Sets *idx to the byte of the first multiple p q >= 30 lo_byte with
+    q >= p and q coprime to 30, and *j to the wheel index of q. Returns 0 if
+    that multiple is not below 30 end_byte (or does not fit in a limb).
+*/
+static int
+_first_multiple(ulong * idx, int * j, ulong p, ulong lo_byte, ulong end_byte)
+{
+    ulong lo, q, hi, m;
+
+    lo = 30 * lo_byte;
+    q = lo / p + (lo % p != 0);
+    if (q < p)
+        q = p;
+
+    *j = _wheel_next[q % 30];
+    q += _n_primes_wheel_residues[*j] - q % 30;
+
+    umul_ppmm(hi, m, p, q);
+
+    if (hi != 0 || m / 30 >= end_byte)
+        return 0;
+
+    *idx = m / 30 - lo_byte;
+    return 1;
+}
+
+void
+n_primes_wheel_init(n_primes_wheel_t S, ulong a, ulong b)
+{
+    slong i, alloc, large_alloc, window;
+    ulong p, r, idx;
+    int j, k;
+    n_primes_t iter;
+
+    S->a = a;
+    S->b = b;
+    S->start_byte = S->seg_byte = a / 30;
+    S->end_byte = (b > a) ? (b - 1) / 30 + 1 : S->start_byte;
+    S->seg_len = 0;
+    S->small_i = (b > a) ? 0 : 3;
+    S->iter_i = 0;
+    S->iter_bits = 0;
+
+    S->seg = flint_malloc(FLINT_PRIMES_WHEEL_SEGMENT);
+
+    /* multiples of 7, 11 and 13 repeat every 1001 bytes */
+    S->pattern = flint_malloc(1001);
+    for (i = 0; i < 1001; i++)
+    {
+        S->pattern[i] = 0;
+
+        for (k = 0; k < 8; k++)
+        {
+            r = 30 * i + _n_primes_wheel_residues[k];
+            if (r % 7 != 0 && r % 11 != 0 && r % 13 != 0)
+                S->pattern[i] |= (1 << k);
+        }
+    }
+
+    r = (b > a) ? n_sqrt(b - 1) : 0;
+
+    /* large primes are bucketed at most window bytes ahead */
+    S->num_buckets = (r / 5 + 8) / FLINT_PRIMES_WHEEL_SEGMENT + 2;
+    S->buckets = flint_malloc(sizeof(n_primes_wheel_bucket_struct)
+                                                           * S->num_buckets);
+    for (i = 0; i < S->num_buckets; i++)
+    {
+        S->buckets[i].entries = NULL;
+        S->buckets[i].len = 0;
+        S->buckets[i].alloc = 0;
+    }
+    S->cur_bucket = 0;
+    window = (S->num_buckets - 1) * FLINT_PRIMES_WHEEL_SEGMENT;
+
+    alloc = 0;
+    S->num_sieve = 0;
+    S->sieve_primes = NULL;
+    S->sieve_next = NULL;
+    S->sieve_wheel = NULL;
+
+    large_alloc = 0;
+    S->num_large = 0;
+    S->large_i = 0;
+    S->large_primes = NULL;
+
+    n_primes_init(iter);
+    n_primes_jump_after(iter, 13);
+
+    for (p = n_primes_next(iter); p <= r; p = n_primes_next(iter))
+    {
+        if (!_first_multiple(&idx, &j, p, S->start_byte, S->end_byte))
+            continue;
+
+        k = _n_primes_wheel_bit[p % 30];
+
+        if (p < FLINT_PRIMES_WHEEL_LARGE)
+        {
+            if (S->num_sieve == alloc)
+            {
+                alloc = FLINT_MAX(2 * alloc, 64);
+                S->sieve_primes = flint_realloc(S->sieve_primes,
+                                                        alloc * sizeof(ulong));
+                S->sieve_next = flint_realloc(S->sieve_next,
+                                                        alloc * sizeof(ulong));
+                S->sieve_wheel = flint_realloc(S->sieve_wheel, alloc);
+            }
+
+            S->sieve_primes[S->num_sieve] = p;
+            S->sieve_next[S->num_sieve] = idx;
+            S->sieve_wheel[S->num_sieve] = 8 * k + j;
+            S->num_sieve++;
+        }
+        else if (idx < window)
+        {
+            _n_primes_wheel_bucket_push(S->buckets
+                + idx / FLINT_PRIMES_WHEEL_SEGMENT, p,
+                (idx % FLINT_PRIMES_WHEEL_SEGMENT) * 64 + 8 * k + j);
+        }
+        else
+        {
+            /* first hit is at p^2, activated by n_primes_wheel_next_segment */
+            if (S->num_large == large_alloc)
+            {
+                large_alloc = FLINT_MAX(2 * large_alloc, 64);
+                S->large_primes = flint_realloc(S->large_primes,
+                                             large_alloc * sizeof(unsigned int));
+            }
+
+            S->large_primes[S->num_large++] = p;
+        }
+    }
+
+    n_primes_clear(iter);
+}
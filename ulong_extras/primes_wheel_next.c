@@ -0,0 +1,43 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "ulong_extras.h"
+
+ulong
+n_primes_wheel_next(n_primes_wheel_t S)
+{
+    static const unsigned char small[3] = {2, 3, 5};
+    int k;
+
+    while (S->small_i < 3)
+    {
+        k = small[S->small_i++];
+        if (S->a <= k && S->b > k)
+            return k;
+    }
+
+    for (;;)
+    {
+        if (S->iter_bits != 0)
+        {
+            count_trailing_zeros(k, S->iter_bits);
+            S->iter_bits &= S->iter_bits - 1;
+            return 30 * (S->seg_byte + S->iter_i - 1)
+                                         + _n_primes_wheel_residues[k];
+        }
+
+        if (S->iter_i < S->seg_len)
+            S->iter_bits = S->seg[S->iter_i++];
+        else if (!n_primes_wheel_next_segment(S))
+            return 0;
+    }
+}
@@ -0,0 +1,177 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+/* gaps between consecutive wheel residues, the last one wrapping to 31 */
+static const unsigned char _wheel_gap[8] = {6, 4, 2, 4, 2, 4, 6, 2};
+
+/*
+    For p = r mod 30 with r the k-th wheel residue and cofactor q the j-th,
+    _wheel_mask[k][j] clears the bit of p q and _wheel_carry[k][j] is the
+    number of bytes by which the step to the next cofactor exceeds
+    (p / 30) times the gap.
+*/
+static const unsigned char _wheel_mask[8][8] =
+{
+    {0xfe, 0xfd, 0xfb, 0xf7, 0xef, 0xdf, 0xbf, 0x7f},
+    {0xfd, 0xdf, 0xef, 0xfe, 0x7f, 0xf7, 0xfb, 0xbf},
+    {0xfb, 0xef, 0xfe, 0xbf, 0xfd, 0x7f, 0xf7, 0xdf},
+    {0xf7, 0xfe, 0xbf, 0xdf, 0xfb, 0xfd, 0x7f, 0xef},
+    {0xef, 0x7f, 0xfd, 0xfb, 0xdf, 0xbf, 0xfe, 0xf7},
+    {0xdf, 0xf7, 0x7f, 0xfd, 0xbf, 0xfe, 0xef, 0xfb},
+    {0xbf, 0xfb, 0xf7, 0x7f, 0xfe, 0xef, 0xdf, 0xfd},
+    {0x7f, 0xbf, 0xdf, 0xef, 0xf7, 0xfb, 0xfd, 0xfe}
+};
+
+static const unsigned char _wheel_carry[8][8] =
+{
+    {0, 0, 0, 0, 0, 0, 0, 1},
+    {1, 1, 1, 0, 1, 1, 1, 1},
+    {2, 2, 0, 2, 0, 2, 2, 1},
+    {3, 1, 1, 2, 1, 1, 3, 1},
+    {3, 3, 1, 2, 1, 3, 3, 1},
+    {4, 2, 2, 2, 2, 2, 4, 1},
+    {5, 3, 1, 4, 1, 3, 5, 1},
+    {6, 4, 2, 4, 2, 4, 6, 1}
+};
+
+int
+n_primes_wheel_next_segment(n_primes_wheel_t S)
+{
+    unsigned char * seg = S->seg;
+    n_primes_wheel_bucket_struct * B;
+    ulong idx, p, q, t, window;
+    slong i, len, off, n;
+    int j, k;
+
+    if (S->seg_len != 0)
+    {
+        S->seg_byte += S->seg_len;
+        S->cur_bucket = (S->cur_bucket + 1) % S->num_buckets;
+    }
+
+    S->iter_i = 0;
+    S->iter_bits = 0;
+
+    if (S->seg_byte >= S->end_byte)
+    {
+        S->seg_len = 0;
+        return 0;
+    }
+
+    len = FLINT_MIN(S->end_byte - S->seg_byte, FLINT_PRIMES_WHEEL_SEGMENT);
+    S->seg_len = len;
+
+    /* presieve 7, 11 and 13 by copying their pattern */
+    off = S->seg_byte % 1001;
+    for (i = 0; i < len; i += n)
+    {
+        n = FLINT_MIN(len - i, 1001 - off);
+        memcpy(seg + i, S->pattern + off, n);
+        off = 0;
+    }
+
+    /* 1 is not prime, but 7, 11 and 13 are */
+    if (S->seg_byte == 0)
+        seg[0] = (seg[0] & 0xfe) | 0x0e;
+
+    /* medium primes hit the segment several times */
+    for (i = 0; i < S->num_sieve; i++)
+    {
+        idx = S->sieve_next[i];
+        if (idx >= (ulong) len)
+        {
+            S->sieve_next[i] = idx - len;
+            continue;
+        }
+
+        p = S->sieve_primes[i];
+        q = p / 30;
+        k = S->sieve_wheel[i] >> 3;
+        j = S->sieve_wheel[i] & 7;
+
+        do
+        {
+            seg[idx] &= _wheel_mask[k][j];
+            idx += q * _wheel_gap[j] + _wheel_carry[k][j];
+            j = (j + 1) & 7;
+        } while (idx < (ulong) len);
+
+        S->sieve_next[i] = idx - len;
+        S->sieve_wheel[i] = 8 * k + j;
+    }
+
+    /* bring in large primes whose first multiple p^2 is now in reach */
+    window = (S->num_buckets - 1) * FLINT_PRIMES_WHEEL_SEGMENT;
+    while (S->large_i < S->num_large)
+    {
+        p = S->large_primes[S->large_i];
+        t = (p * p) / 30 - S->seg_byte;
+
+        if (t >= window)
+            break;
+
+        k = _n_primes_wheel_bit[p % 30];
+        _n_primes_wheel_bucket_push(S->buckets + (S->cur_bucket
+            + t / FLINT_PRIMES_WHEEL_SEGMENT) % S->num_buckets, p,
+            (t % FLINT_PRIMES_WHEEL_SEGMENT) * 64 + 9 * k);
+        S->large_i++;
+    }
+
+    /* large primes hit the segment at most a few times */
+    B = S->buckets + S->cur_bucket;
+    for (i = 0; i < B->len; i++)
+    {
+        p = B->entries[i].p;
+        q = p / 30;
+        idx = B->entries[i].pos >> 6;
+        k = (B->entries[i].pos >> 3) & 7;
+        j = B->entries[i].pos & 7;
+
+        do
+        {
+            seg[idx] &= _wheel_mask[k][j];
+            idx += q * _wheel_gap[j] + _wheel_carry[k][j];
+            j = (j + 1) & 7;
+        } while (idx < (ulong) len);
+
+        t = idx - len;
+        if (S->seg_byte + len + t < S->end_byte)
+        {
+            _n_primes_wheel_bucket_push(S->buckets + (S->cur_bucket + 1
+                + t / FLINT_PRIMES_WHEEL_SEGMENT) % S->num_buckets, p,
+                (t % FLINT_PRIMES_WHEEL_SEGMENT) * 64 + 8 * k + j);
+        }
+    }
+    B->len = 0;
+
+    /* remove numbers outside [a, b) from the end bytes */
+    if (S->seg_byte == S->start_byte)
+    {
+        t = S->a - 30 * S->seg_byte;
+        for (k = 0; k < 8; k++)
+            if (_n_primes_wheel_residues[k] < t)
+                seg[0] &= ~(1 << k);
+    }
+
+    if (S->seg_byte + len == S->end_byte)
+    {
+        t = S->b - 30 * (S->end_byte - 1);
+        for (k = 0; k < 8; k++)
+            if (_n_primes_wheel_residues[k] >= t)
+                seg[len - 1] &= ~(1 << k);
+    }
+
+    return 1;
+}
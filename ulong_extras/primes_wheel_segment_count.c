@@ -0,0 +1,52 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <string.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+static __inline__ ulong
+_popcount(ulong x)
+{
+#if FLINT64
+    x = x - ((x >> 1) & UWORD(0x5555555555555555));
+    x = (x & UWORD(0x3333333333333333)) + ((x >> 2) & UWORD(0x3333333333333333));
+    x = (x + (x >> 4)) & UWORD(0x0f0f0f0f0f0f0f0f);
+    return (x * UWORD(0x0101010101010101)) >> 56;
+#else
+    x = x - ((x >> 1) & UWORD(0x55555555));
+    x = (x & UWORD(0x33333333)) + ((x >> 2) & UWORD(0x33333333));
+    x = (x + (x >> 4)) & UWORD(0x0f0f0f0f);
+    return (x * UWORD(0x01010101)) >> 24;
+#endif
+}
+
+ulong
+n_primes_wheel_segment_count(const n_primes_wheel_t S)
+{
+    slong i;
+    ulong w, count = 0;
+
+    if (S->seg_byte == S->start_byte && S->seg_len != 0)
+        count += (S->a <= 2 && S->b > 2) + (S->a <= 3 && S->b > 3)
+               + (S->a <= 5 && S->b > 5);
+
+    for (i = 0; i + (slong) sizeof(ulong) <= S->seg_len; i += sizeof(ulong))
+    {
+        memcpy(&w, S->seg + i, sizeof(ulong));
+        count += _popcount(w);
+    }
+
+    for ( ; i < S->seg_len; i++)
+        count += _popcount(S->seg[i]);
+
+    return count;
+}
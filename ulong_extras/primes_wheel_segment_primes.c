@@ -0,0 +1,44 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include "flint.h"
+#include "ulong_extras.h"
+
+slong
+n_primes_wheel_segment_primes(ulong * res, const n_primes_wheel_t S)
+{
+    slong i, num = 0;
+    ulong x, base;
+    int k;
+
+    if (S->seg_byte == S->start_byte && S->seg_len != 0)
+    {
+        if (S->a <= 2 && S->b > 2)
+            res[num++] = 2;
+        if (S->a <= 3 && S->b > 3)
+            res[num++] = 3;
+        if (S->a <= 5 && S->b > 5)
+            res[num++] = 5;
+    }
+
+    base = 30 * S->seg_byte;
+
+    for (i = 0; i < S->seg_len; i++, base += 30)
+    {
+        for (x = S->seg[i]; x != 0; x &= x - 1)
+        {
+            count_trailing_zeros(k, x);
+            res[num++] = base + _n_primes_wheel_residues[k];
+        }
+    }
+
+    return num;
+}
@@ -1,6 +1,7 @@
 /*
     Copyright (C) 2009 William Hart
     Copyright (C) 2013 Fredrik Johansson
+    Copyright (C) 2026 FLINT authors
 
     This file is part of FLINT.
 
@@ -15,6 +16,24 @@
 #include <gmp.h>
 #include "flint.h"
 #include "ulong_extras.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+    slong n;
+    const mp_limb_t * primes;
+    const double * inverses;
+}
+lookup_arg_t;
+
+static void
+lookup_worker(void * varg)
+{
+    lookup_arg_t * arg = (lookup_arg_t *) varg;
+
+    arg->primes = n_primes_arr_readonly(arg->n + 1);
+    arg->inverses = n_prime_inverses_arr_readonly(arg->n + 1);
+}
 
 int main()
 {
@@ -64,6 +83,43 @@ int main()
         }
     }
 
+    /* concurrent lookups all see the same shared tables */
+    flint_set_num_threads(4);
+
+    for (i = 0; i < 20; i++)
+    {
+        slong j, num = 8;
+        lookup_arg_t args[8];
+
+        n_cleanup_primes();
+
+        for (j = 0; j < num; j++)
+            args[j].n = n_randint(state, lim);
+
+        flint_parallel_do(lookup_worker, args, num, sizeof(lookup_arg_t), 4);
+
+        for (j = 0; j < num; j++)
+        {
+            slong n = args[j].n;
+
+            if (args[j].primes[n] != ref_primes[n] ||
+                args[j].inverses[n] != ref_inverses[n])
+            {
+                flint_printf("FAIL (threaded)!\n");
+                flint_printf("n = %wd, p1 = %wu, p2 = %wu\n",
+                                           n, args[j].primes[n], ref_primes[n]);
+                abort();
+            }
+
+            if (args[j].primes != n_primes_arr_readonly(n + 1))
+            {
+                flint_printf("FAIL (threaded)!\n");
+                flint_printf("tables not shared, n = %wd\n", n);
+                abort();
+            }
+        }
+    }
+
     flint_free(ref_primes);
     flint_free(ref_inverses);
     FLINT_TEST_CLEANUP(state);
@@ -0,0 +1,110 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+int main(void)
+{
+    slong i, j;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("is_prime_vec....");
+    fflush(stdout);
+
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        slong len;
+        ulong * n;
+        int * res;
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        len = n_randint(state, 100);
+        if (n_randint(state, 10) == 0)
+            len += n_randint(state, 40000);
+
+        n = flint_malloc(sizeof(ulong) * (len + 1));
+        res = flint_malloc(sizeof(int) * (len + 1));
+
+        for (j = 0; j < len; j++)
+        {
+            switch (n_randint(state, 5))
+            {
+                case 0:
+                    n[j] = n_randint(state, 100000);
+                    break;
+                case 1:
+                    n[j] = n_randprime(state, n_randint(state, FLINT_BITS - 1) + 2, 0);
+                    break;
+                case 2:
+                    /* products of two primes, including strong pseudoprimes */
+                    n[j] = n_randprime(state, n_randint(state, FLINT_BITS / 2 - 1) + 2, 0)
+                         * n_randprime(state, n_randint(state, FLINT_BITS / 2 - 1) + 2, 0);
+                    break;
+                default:
+                    n[j] = n_randtest(state);
+            }
+        }
+
+        n_is_prime_vec(res, n, len);
+
+        for (j = 0; j < len; j++)
+        {
+            if (res[j] != n_is_prime(n[j]))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("n = %wu, res = %d\n", n[j], res[j]);
+                abort();
+            }
+        }
+
+        flint_free(n);
+        flint_free(res);
+    }
+
+    /* strong pseudoprimes to base 2 and Carmichael numbers */
+    {
+        ulong n[] = {UWORD(2047), UWORD(3277), UWORD(4033), UWORD(4681),
+            UWORD(8321), UWORD(15841), UWORD(29341), UWORD(561), UWORD(1105),
+            UWORD(41041), UWORD(825265), UWORD(4294967291),
+#if FLINT64
+            UWORD(3215031751), UWORD(2152302898747), UWORD(3474749660383),
+            UWORD(341550071728321), UWORD(3825123056546413051),
+            UWORD(18446744073709551557), UWORD(18446744073709551615)
+#else
+            UWORD(4294967295)
+#endif
+        };
+        int res[20];
+        slong len = sizeof(n) / sizeof(ulong);
+
+        n_is_prime_vec(res, n, len);
+
+        for (j = 0; j < len; j++)
+        {
+            if (res[j] != n_is_prime(n[j]))
+            {
+                flint_printf("FAIL (pseudoprimes):\n");
+                flint_printf("n = %wu, res = %d\n", n[j], res[j]);
+                abort();
+            }
+        }
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,67 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+int main(void)
+{
+    slong i, j;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("is_strong_probabprime_mont....");
+    fflush(stdout);
+
+    /* agrees with the preinv version on primes and composites */
+    for (i = 0; i < 1000 * flint_test_multiplier(); i++)
+    {
+        ulong n, d, a;
+        unsigned int norm;
+        n_mont_t mont;
+        int r1, r2;
+
+        if (n_randint(state, 2))
+            n = n_randprime(state, 2 + n_randint(state, FLINT_BITS - 1), 0);
+        else
+            n = n_randtest(state) | 1;
+
+        if (n < 3)
+            n = 3;
+
+        n_mont_init(&mont, n);
+        count_trailing_zeros(norm, n - 1);
+        d = (n - 1) >> norm;
+
+        for (j = 0; j < 10; j++)
+        {
+            do a = n_randtest(state) % n;
+            while (a == 0);
+
+            r1 = n_is_strong_probabprime_mont(a, d, mont);
+            r2 = n_is_strong_probabprime2_preinv(n, n_preinvert_limb(n), a, d);
+
+            if (r1 != r2 || (n_is_prime(n) && !r1))
+            {
+                flint_printf("FAIL:\n");
+                flint_printf("n = %wu, a = %wu, r1 = %d, r2 = %d\n", n, a, r1, r2);
+                abort();
+            }
+        }
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
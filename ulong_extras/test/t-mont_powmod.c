@@ -0,0 +1,81 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+int main(void)
+{
+    slong i;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("mont_powmod....");
+    fflush(stdout);
+
+    for (i = 0; i < 10000 * flint_test_multiplier(); i++)
+    {
+        ulong n, ninv, a, b, e, r1, r2;
+        n_mont_t mont;
+
+        do
+            n = n_randtest_not_zero(state) | 1;
+        while (n == 1);
+
+        n_mont_init(&mont, n);
+        ninv = n_preinvert_limb(n);
+
+        a = n_randtest(state);
+        b = n_randtest(state) % n;
+        e = n_randtest(state);
+
+        /* conversions are inverse to each other */
+        r1 = n_mont_get_ui(n_mont_set_ui(a, mont), mont);
+        if (r1 != n_mod2_preinv(a, n, ninv) || mont.one != n_mont_set_ui(1, mont))
+        {
+            flint_printf("FAIL (conversion):\n");
+            flint_printf("n = %wu, a = %wu, r1 = %wu\n", n, a, r1);
+            abort();
+        }
+
+        a = n_mod2_preinv(a, n, ninv);
+
+        /* multiplication */
+        r1 = n_mont_get_ui(n_mont_mul(n_mont_set_ui(a, mont),
+                                       n_mont_set_ui(b, mont), mont), mont);
+        r2 = n_mulmod2_preinv(a, b, n, ninv);
+        if (r1 != r2)
+        {
+            flint_printf("FAIL (mul):\n");
+            flint_printf("n = %wu, a = %wu, b = %wu, r1 = %wu, r2 = %wu\n",
+                                                            n, a, b, r1, r2);
+            abort();
+        }
+
+        /* powering */
+        r1 = n_mont_get_ui(n_mont_powmod(n_mont_set_ui(a, mont), e, mont), mont);
+        r2 = n_powmod2_ui_preinv(a, e, n, ninv);
+        if (r1 != r2)
+        {
+            flint_printf("FAIL (powmod):\n");
+            flint_printf("n = %wu, a = %wu, e = %wu, r1 = %wu, r2 = %wu\n",
+                                                            n, a, e, r1, r2);
+            abort();
+        }
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,95 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "flint.h"
+#include "ulong_extras.h"
+
+static const ulong pi_powers_of_ten[] =
+{
+    0, 4, 25, 168, 1229, 9592, 78498, 664579, 5761455, 50847534,
+    UWORD(455052511)
+};
+
+int main(void)
+{
+    int i, k;
+    ulong n, m, c, p;
+    n_primes_t iter;
+
+    FLINT_TEST_INIT(state);
+
+    flint_printf("prime_pi_lmo....");
+    fflush(stdout);
+
+    /* Check known values */
+    for (k = 0, n = 1; k <= 10; k++, n *= 10)
+    {
+        if (k == 10 && flint_test_multiplier() < 10)
+            break;
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        if (n_prime_pi_lmo(n) != pi_powers_of_ten[k])
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("pi(10^%d) = %wu, expected %wu\n", k,
+                                    n_prime_pi_lmo(n), pi_powers_of_ten[k]);
+            abort();
+        }
+    }
+
+    /* Check pi(m) - pi(n) is the number of primes in (n, m] */
+    for (i = 0; i < 100 * flint_test_multiplier(); i++)
+    {
+        n = n_randint(state, UWORD(1) << (n_randint(state, 28) + 1));
+        m = n + n_randint(state, 100000);
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        c = 0;
+        n_primes_init(iter);
+        n_primes_jump_after(iter, n);
+        while (n_primes_next(iter) <= m)
+            c++;
+        n_primes_clear(iter);
+
+        if (n_prime_pi_lmo(m) - n_prime_pi_lmo(n) != c)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("pi(%wu) - pi(%wu) = %wu - %wu, expected %wu\n",
+                            m, n, n_prime_pi_lmo(m), n_prime_pi_lmo(n), c);
+            abort();
+        }
+    }
+
+    /* Check pi(nth_prime(k)) = k above the table cutoff */
+    for (i = 0; i < 20 * flint_test_multiplier(); i++)
+    {
+        n = FLINT_NTH_PRIME_LMO_CUTOFF + n_randint(state, 10000000);
+
+        p = n_nth_prime(n);
+
+        if (!n_is_prime(p) || n_prime_pi(p) != n || n_prime_pi(p - 1) != n - 1)
+        {
+            flint_printf("FAIL:\n");
+            flint_printf("nth_prime(%wu) = %wu\n", n, p);
+            abort();
+        }
+    }
+
+    flint_set_num_threads(1);
+
+    FLINT_TEST_CLEANUP(state);
+    flint_printf("PASS\n");
+    return 0;
+}
@@ -0,0 +1,220 @@
+/*
+    Copyright (C) 2026 FLINT authors
+
+    This file is part of FLINT.
+
+    FLINT is free software: you can redistribute it and/or modify it under
+    the terms of the GNU Lesser General Public License (LGPL) as published
+    by the Free Software Foundation; either version 2.1 of the License, or
+    (at your option) any later version.  See <http://www.gnu.org/licenses/>.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <gmp.h>
+#include "flint.h"
+#include "ulong_extras.h"
+#include "thread_pool.h"
+
+typedef struct
+{
+    ulong count;
+    ulong first;
+    ulong last;
+    int sorted;
+}
+apply_arg_t;
+
+static void
+apply_func(void * varg, const ulong * primes, slong num)
+{
+    apply_arg_t * arg = (apply_arg_t *) varg;
+    slong i;
+
+    for (i = 0; i < num; i++)
+    {
+        if (arg->count == 0)
+            arg->first = primes[i];
+        else if (primes[i] <= arg->last)
+            arg->sorted = 0;
+
+        arg->last = primes[i];
+        arg->count++;
+    }
+}
+
+int main(void)
+{
+    slong i, j;
+    FLINT_TEST_INIT(state);
+
+    flint_printf("primes_wheel....");
+    fflush(stdout);
+
+    /* iteration agrees with n_primes_next */
+    for (i = 0; i < 200 * flint_test_multiplier(); i++)
+    {
+        ulong a, b, p, q, count;
+        n_primes_t iter;
+        n_primes_wheel_t S;
+
+        switch (n_randint(state, 3))
+        {
+            case 0:
+                a = n_randint(state, 1000);
+                break;
+            case 1:
+                a = n_randint(state, UWORD(10000000));
+                break;
+            default:
+                a = n_randint(state, UWORD(1) << (FLINT_BITS / 2 + 8));
+        }
+        b = a + n_randint(state, n_randint(state, 2) ? 1000 : 3000000);
+
+        n_primes_init(iter);
+        if (a > 0)
+            n_primes_jump_after(iter, a - 1);
+
+        n_primes_wheel_init(S, a, b);
+
+        count = 0;
+        do
+        {
+            p = n_primes_next(iter);
+            q = n_primes_wheel_next(S);
+
+            if ((p < b && p != q) || (p >= b && q != 0))
+            {
+                flint_printf("FAIL (next):\n");
+                flint_printf("a = %wu, b = %wu, p = %wu, q = %wu\n", a, b, p, q);
+                abort();
+            }
+
+            count += (q != 0);
+        } while (q != 0);
+
+        n_primes_wheel_clear(S);
+        n_primes_clear(iter);
+
+        if (n_primes_count_range(a, b) != count)
+        {
+            flint_printf("FAIL (count_range):\n");
+            flint_printf("a = %wu, b = %wu, count = %wu, %wu\n",
+                                    a, b, count, n_primes_count_range(a, b));
+            abort();
+        }
+    }
+
+    /* counts against pi(x) */
+    for (i = 0; i < 5; i++)
+    {
+        ulong a, b, c1, c2;
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        a = n_randint(state, UWORD(100000000));
+        b = a + n_randint(state, UWORD(100000000));
+
+        c1 = n_primes_count_range(a, b);
+        c2 = n_prime_pi(b - 1) - (a == 0 ? 0 : n_prime_pi(a - 1));
+
+        if (b > a && c1 != c2)
+        {
+            flint_printf("FAIL (pi):\n");
+            flint_printf("a = %wu, b = %wu, c1 = %wu, c2 = %wu\n", a, b, c1, c2);
+            abort();
+        }
+    }
+
+    /* the top of the limb range */
+    {
+        ulong a, b, p, q;
+        n_primes_wheel_t S;
+
+        b = UWORD_MAX;
+        a = b - 100000;
+
+        n_primes_wheel_init(S, a, b);
+
+        q = n_primes_wheel_next(S);
+        for (p = a; p < b; p++)
+        {
+            if (n_is_prime(p))
+            {
+                if (p != q)
+                {
+                    flint_printf("FAIL (top):\n");
+                    flint_printf("p = %wu, q = %wu\n", p, q);
+                    abort();
+                }
+
+                q = n_primes_wheel_next(S);
+            }
+        }
+
+        if (q != 0)
+        {
+            flint_printf("FAIL (top):\n");
+            flint_printf("q = %wu\n", q);
+            abort();
+        }
+
+        n_primes_wheel_clear(S);
+    }
+
+    /* partitioned callbacks */
+    for (i = 0; i < 10; i++)
+    {
+        ulong a, b, total, * bounds;
+        slong num;
+        apply_arg_t * args;
+
+        flint_set_num_threads(n_randint(state, 4) + 1);
+
+        num = n_randint(state, 10) + 1;
+        a = n_randint(state, UWORD(10000000));
+        b = a + n_randint(state, UWORD(10000000));
+
+        args = flint_malloc(num * sizeof(apply_arg_t));
+        bounds = flint_malloc((num + 1) * sizeof(ulong));
+
+        for (j = 0; j < num; j++)
+        {
+            args[j].count = 0;
+            args[j].sorted = 1;
+        }
+
+        n_primes_range_apply(a, b, apply_func, args, sizeof(apply_arg_t), num);
+        n_primes_range_partition(bounds, a, b, num);
+
+        total = 0;
+        for (j = 0; j < num; j++)
+        {
+            if (!args[j].sorted || (args[j].count != 0 &&
+                 (args[j].first < bounds[j] || args[j].last >= bounds[j + 1]))
+                 || args[j].count != n_primes_count_range(bounds[j], bounds[j + 1]))
+            {
+                flint_printf("FAIL (apply):\n");
+                flint_printf("a = %wu, b = %wu, num = %wd, j = %wd\n", a, b, num, j);
+                abort();
+            }
+
+            total += args[j].count;
+        }
+
+        if (total != n_primes_count_range(a, b))
+        {
+            flint_printf("FAIL (apply):\n");
+            flint_printf("a = %wu, b = %wu, num = %wd\n", a, b, num);
+            abort();
+        }
+
+        flint_free(bounds);
+        flint_free(args);
+    }
+
+    FLINT_TEST_CLEANUP(state);
+
+    flint_printf("PASS\n");
+    return 0;
+}